@@ -19,6 +19,10 @@
 #include "gpos/base.h"
 #include "gpos/common/CDouble.h"
 
+namespace gpopt {
+class CPhysicalAgg;
+}
+
 namespace gpdbcost {
 using namespace gpos;
 using namespace gpopt;
@@ -124,6 +128,10 @@ class CCostModelGPDB : public ICostModel {
   static CCost CostSort(CMemoryPool *mp, CExpressionHandle &exprhdl, const CCostModelGPDB *pcmgpdb,
                         const SCostingInfo *pci);
 
+  // cost of incremental sort
+  static CCost CostIncrementalSort(CMemoryPool *mp, CExpressionHandle &exprhdl, const CCostModelGPDB *pcmgpdb,
+                                   const SCostingInfo *pci);
+
   // cost of TVF
   static CCost CostTVF(CMemoryPool *mp, CExpressionHandle &exprhdl, const CCostModelGPDB *pcmgpdb,
                        const SCostingInfo *pci);
@@ -148,12 +156,30 @@ class CCostModelGPDB : public ICostModel {
   static CCost CostIndexNLJoin(CMemoryPool *mp, CExpressionHandle &exprhdl, const CCostModelGPDB *pcmgpdb,
                                const SCostingInfo *pci);
 
+  // cost of the inner side of an index-nljoin that caches it on the given outer references
+  static CCost CostMemoizedInner(CMemoryPool *mp, const CCostModelGPDB *pcmgpdb, const SCostingInfo *pci,
+                                 CColRefArray *pdrgpcrKeys);
+
   // cost of bitmap scan when the NDV is small
   static CCost CostBitmapSmallNDV(const CCostModelGPDB *pcmgpdb, const SCostingInfo *pci, CDouble dNDV);
 
   // cost of bitmap scan when the NDV is large
   static CCost CostBitmapLargeNDV(const CCostModelGPDB *pcmgpdb, const SCostingInfo *pci, CDouble dNDV);
 
+  // cost of Gather
+  static CCost CostGather(CMemoryPool *mp, CExpressionHandle &exprhdl, const CCostModelGPDB *pcmgpdb,
+                          const SCostingInfo *pci);
+
+  // share of the work done by each process of a parallel plan
+  static CDouble DParallelDivisor(uint32_t ulWorkers);
+
+  // adjust the input and output rows of an aggregate to its stage
+  static void AggStageRows(const CCostModelGPDB *pcmgpdb, CExpressionHandle &exprhdl, const CPhysicalAgg *popAgg,
+                           double *pdInputRows, double *pdOutputRows);
+
+  // cost of the given operator, ignoring parallelism below it
+  CCost CostOperator(CExpressionHandle &exprhdl, const SCostingInfo *pci) const;
+
   // cost of compute scalar
   static CCost CostComputeScalar(CMemoryPool *mp, CExpressionHandle &exprhdl, const SCostingInfo *pci,
                                  ICostModelParams *pcp, const CCostModelGPDB *pcmgpdb);
@@ -190,6 +216,9 @@ class CCostModelGPDB : public ICostModel {
   // cost model type
   ECostModelType Ecmt() const override { return ICostModel::EcmtGPDBCalibrated; }
 
+  // number of parallel workers a Gather may use
+  uint32_t UlParallelWorkers() const override;
+
 };  // class CCostModelGPDB
 
 }  // namespace gpdbcost
@@ -102,6 +102,13 @@ class CCostModelParamsGPDB : public ICostModelParams {
     EcpIndexOnlyScanTupCostUnit,  // index only scan cost per tuple retrieving
 
     EcpIndexCostConversionFactor,  // Cost conversion factor for Index & Index only scans
+
+    EcpParallelSetupCost,  // cost of launching parallel workers for a Gather
+    EcpParallelWorkers,    // number of parallel workers a Gather may use
+
+    EcpMemoizeLookupCostUnit,  // cost of probing the cache of a memoized inner side per outer row
+    EcpMemoizeCacheSize,       // memory available to the cache of a memoized inner side, in bytes
+
     EcpSentinel
   };
 
@@ -281,6 +288,18 @@ class CCostModelParamsGPDB : public ICostModelParams {
   // Cost conversion factor for Index & Index only scan
   static const CDouble DIndexCostConversionFactor;
 
+  // default cost of launching parallel workers
+  static const CDouble DParallelSetupCostVal;
+
+  // default number of parallel workers
+  static const CDouble DParallelWorkersVal;
+
+  // default cost of a memoize cache lookup
+  static const CDouble DMemoizeLookupCostUnitVal;
+
+  // default size of a memoize cache
+  static const CDouble DMemoizeCacheSizeVal;
+
  public:
   CCostModelParamsGPDB(CCostModelParamsGPDB &) = delete;
 
@@ -23,11 +23,15 @@
 #include "gpopt/operators/CExpression.h"
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPhysicalHashAgg.h"
+#include "gpopt/operators/CPhysicalIncrementalSort.h"
 #include "gpopt/operators/CPhysicalIndexOnlyScan.h"
 #include "gpopt/operators/CPhysicalIndexScan.h"
+#include "gpopt/operators/CPhysicalInnerIndexNLJoin.h"
+#include "gpopt/operators/CPhysicalLeftOuterIndexNLJoin.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
 #include "gpopt/operators/CPhysicalSequenceProject.h"
 #include "gpopt/operators/CPhysicalStreamAgg.h"
+#include "gpopt/operators/CPhysicalTableScan.h"
 #include "gpopt/operators/CPhysicalUnionAll.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarBitmapIndexProbe.h"
@@ -68,6 +72,68 @@ CDouble CCostModelGPDB::DRowsPerHost(CDouble dRowsTotal) const {
   return dRowsTotal;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::UlParallelWorkers
+//
+//	@doc:
+//		Return number of parallel workers a Gather may use
+//
+//---------------------------------------------------------------------------
+uint32_t CCostModelGPDB::UlParallelWorkers() const {
+  return (uint32_t)m_cost_model_params->PcpLookup(CCostModelParamsGPDB::EcpParallelWorkers)->Get().Get();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::DParallelDivisor
+//
+//	@doc:
+//		Share of the rows handled by each process of a parallel plan; the
+//		leader also runs the plan but spends part of its time reading the
+//		tuples sent by the workers, same as Postgres' get_parallel_divisor()
+//
+//---------------------------------------------------------------------------
+CDouble CCostModelGPDB::DParallelDivisor(uint32_t ulWorkers) {
+  double dDivisor = ulWorkers;
+  double dLeaderContribution = 1.0 - (0.3 * ulWorkers);
+  if (0.0 < dLeaderContribution) {
+    dDivisor += dLeaderContribution;
+  }
+
+  return CDouble(std::max(dDivisor, 1.0));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::AggStageRows
+//
+//	@doc:
+//		Statistics estimate the groups of an aggregate regardless of its
+//		stage. A local aggregate over a partial input runs in every process
+//		of the Gather above it and each of them may see every group, so it
+//		emits up to that many groups per process; the global aggregate above
+//		the Gather has to combine all of them
+//
+//---------------------------------------------------------------------------
+void CCostModelGPDB::AggStageRows(const CCostModelGPDB *pcmgpdb, CExpressionHandle &exprhdl,
+                                  const CPhysicalAgg *popAgg, double *pdInputRows, double *pdOutputRows) {
+  GPOS_ASSERT(nullptr != pdInputRows);
+  GPOS_ASSERT(nullptr != pdOutputRows);
+
+  const double dProcesses = pcmgpdb->UlParallelWorkers() + 1;
+  if (1.0 == dProcesses) {
+    return;
+  }
+
+  CParallelSpec::EParallelType ept = exprhdl.Pdpplan(0 /*child_index*/)->Ppar()->Ept();
+  if (COperator::EgbaggtypeLocal == popAgg->Egbaggtype() && CParallelSpec::EptPartial == ept) {
+    *pdOutputRows = std::min(*pdInputRows, *pdOutputRows * dProcesses);
+  } else if (popAgg->FGlobal() && popAgg->FMultiStage() && CParallelSpec::EptSingleton == ept) {
+    *pdInputRows = *pdInputRows * dProcesses;
+  }
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::~CCostModelGPDB
@@ -312,7 +378,8 @@ CCost CCostModelGPDB::CostCTEProducer(CMemoryPool *mp, CExpressionHandle &exprhd
   }
 
   COperator::EOperatorId op_id = popChild->Eopid();
-  if (COperator::EopPhysicalSpool != op_id && COperator::EopPhysicalSort != op_id) {
+  if (COperator::EopPhysicalSpool != op_id && COperator::EopPhysicalSort != op_id &&
+      COperator::EopPhysicalIncrementalSort != op_id) {
     // no materialize needed
     return cost;
   }
@@ -473,20 +540,14 @@ CCost CCostModelGPDB::CostStreamAgg(CMemoryPool *mp, CExpressionHandle &exprhdl,
   double dWidthOuter = pci->GetWidth()[0];
 
   // In order to handle worst-case scenarios where grouping key tuples
-  // are distributed across segments, and to maintain accurate
-  // cardinality for local stream agg, it is crucial to ensure that the
-  // local stream agg's cardinality does not exceed the NDV of the
-  // grouping key in global agg (upper bound for the number of output
-  // rows). This is achieved by multiplying the global agg's cardinality
-  // of the grouping key with the number of segments. It can helps to
-  // maintain the cardinality for local stream agg in both best and
-  // worst-case scenarios.
+  // are spread across the processes of a parallel plan, the local stream
+  // agg's cardinality is the NDV of the grouping key in global agg
+  // multiplied with the number of processes, capped by its input. The
+  // global agg in turn combines that many partial states.
 
   double num_output_rows = pci->Rows();  // estimated output rows
   CPhysicalStreamAgg *popAgg = CPhysicalStreamAgg::PopConvert(exprhdl.Pop());
-  if ((COperator::EgbaggtypeLocal == popAgg->Egbaggtype()) && popAgg->FGeneratesDuplicates()) {
-    num_output_rows = num_output_rows;
-  }
+  AggStageRows(pcmgpdb, exprhdl, popAgg, &num_input_rows, &num_output_rows);
 
   // streamAgg cost is correlated with num_input_rows and width of input
   // tuples and num_output_rows and width of output tuples CCost
@@ -549,6 +610,49 @@ CCost CCostModelGPDB::CostSort(CMemoryPool *mp, CExpressionHandle &exprhdl, cons
   return costLocal + costChild;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostIncrementalSort
+//
+//	@doc:
+//		Cost of incremental sort; the input is sorted one group of equal
+//		presorted values at a time, so the n*log(n) term of a full sort
+//		shrinks to the size of a group, the number of groups being the NDV
+//		of the presorted columns. Every group pays for starting a sort.
+//
+//---------------------------------------------------------------------------
+CCost CCostModelGPDB::CostIncrementalSort(CMemoryPool *mp, CExpressionHandle &exprhdl, const CCostModelGPDB *pcmgpdb,
+                                          const SCostingInfo *pci) {
+  GPOS_ASSERT(nullptr != pcmgpdb);
+  GPOS_ASSERT(nullptr != pci);
+  GPOS_ASSERT(COperator::EopPhysicalIncrementalSort == exprhdl.Pop()->Eopid());
+
+  CPhysicalIncrementalSort *popSort = CPhysicalIncrementalSort::PopConvert(exprhdl.Pop());
+  const CDouble rows = CDouble(std::max(2.0, pci->Rows()));
+  const CDouble num_rebinds = CDouble(pci->NumRebinds());
+  const CDouble width = CDouble(pci->Width());
+
+  const CDouble dSortTupWidthCost =
+      pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpSortTupWidthCostUnit)->Get();
+  GPOS_ASSERT(0 < dSortTupWidthCost);
+
+  std::vector<uint32_t> presorted_colids;
+  for (uint32_t ul = 0; ul < popSort->UlPresortedCols(); ul++) {
+    presorted_colids.push_back(popSort->PosPresorted()->Pcr(ul)->Id());
+  }
+  CStatisticsConfig *stats_config = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetStatsConf();
+  const double dGroups =
+      CStatisticsUtils::Groups(mp, pci->Pcstats(0)->Pstats(), stats_config, presorted_colids, nullptr /*keys*/).Get();
+  const CDouble groups = CDouble(std::min(std::max(dGroups, 1.0), rows.Get()));
+  const CDouble group_rows = CDouble(std::max(2.0, (rows / groups).Get()));
+
+  CCost costLocal =
+      CCost(num_rebinds * (rows * group_rows.Log2() * width * dSortTupWidthCost + groups * width * dSortTupWidthCost));
+  CCost costChild = CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
+
+  return costLocal + costChild;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostTVF
@@ -626,22 +730,15 @@ CCost CCostModelGPDB::CostHashAgg(CMemoryPool *mp, CExpressionHandle &exprhdl, c
   // which allows it to complete all local aggregation in memory and
   // produce exactly tuples as the number of groups.
   //
-  // Considering the tuples of local hash agg fit within memory. To
-  // handle worst-case scenarios where the tuples of the grouping key are
-  // distributed across segments. To maintain accurate cardinality for
-  // local hash agg, its crucial to ensure that the cardinality of the
-  // local hash agg does not exceed the NDV of the grouping key in global
-  // aggs (upper bound for the number of output rows).  So we are
-  // achieving this by multiplying the global agg's cardinality of grouping
-  // key with the number of segments. It can help's to maintain the
-  // cardinality for local hash agg across both best and worst-case
-  // scenarios.
+  // Considering the tuples of local hash agg fit within memory, each
+  // process of a parallel plan emits at most one partial state per
+  // group, so the local hash agg's cardinality is the NDV of the grouping
+  // key in global agg multiplied with the number of processes, capped by
+  // its input. The global agg in turn combines that many partial states.
 
   double num_output_rows = pci->Rows();  // estimated output rows
   CPhysicalHashAgg *popAgg = CPhysicalHashAgg::PopConvert(exprhdl.Pop());
-  if ((COperator::EgbaggtypeLocal == popAgg->Egbaggtype()) && popAgg->FGeneratesDuplicates()) {
-    num_output_rows = num_output_rows;
-  }
+  AggStageRows(pcmgpdb, exprhdl, popAgg, &num_input_rows, &num_output_rows);
 
   // get the number of grouping columns
   const uint32_t ulGrpCols = CPhysicalHashAgg::PopConvert(exprhdl.Pop())->PdrgpcrGroupingCols()->Size();
@@ -720,7 +817,7 @@ CCost CCostModelGPDB::CostHashJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
       pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpHJFeedingTupWidthSpillingCostUnit)->Get();
   const CDouble dHJHashingTupWidthSpillingCostUnit =
       pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpHJHashingTupWidthSpillingCostUnit)->Get();
-  const CDouble dPenalizeHJSkewUpperLimit =
+  const CDouble dPenalizeHJSkewUpperLimit GPOS_ASSERTS_ONLY =
       pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpPenalizeHJSkewUpperLimit)->Get();
   GPOS_ASSERT(0 < dHJHashTableInitCostFactor);
   GPOS_ASSERT(0 < dHJHashTableColumnCostUnit);
@@ -808,7 +905,9 @@ CCost CCostModelGPDB::CostMergeJoin(CMemoryPool *mp, CExpressionHandle &exprhdl,
   GPOS_ASSERT(nullptr != pci);
 #ifdef GPOS_DEBUG
   COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
-  GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id);
+  GPOS_ASSERT(COperator::EopPhysicalFullMergeJoin == op_id || COperator::EopPhysicalInnerMergeJoin == op_id ||
+              COperator::EopPhysicalLeftOuterMergeJoin == op_id || COperator::EopPhysicalLeftSemiMergeJoin == op_id ||
+              COperator::EopPhysicalLeftAntiSemiMergeJoin == op_id);
 #endif  // GPOS_DEBUG
 
   const double num_rows_outer = pci->PdRows()[0];
@@ -902,12 +1001,25 @@ CCost CCostModelGPDB::CostIndexNLJoin(CMemoryPool *mp, CExpressionHandle &exprhd
                                                   pci->Rows() * pci->Width() * dJoinOutputTupCostUnit));
 
   CCost costChild = CostChildren(mp, exprhdl, pci, pcmgpdb->GetCostModelParams());
+  bool fInnerJoin = COperator::EopPhysicalInnerIndexNLJoin == exprhdl.Pop()->Eopid();
+
+  // a cached inner side is only probed for outer rows missing from the cache
+  CColRefArray *pdrgpcrMemoizeKeys = nullptr;
+  if (fInnerJoin && CPhysicalInnerIndexNLJoin::PopConvert(exprhdl.Pop())->FMemoize()) {
+    pdrgpcrMemoizeKeys = CPhysicalInnerIndexNLJoin::PopConvert(exprhdl.Pop())->PdrgPcrOuterRefs();
+  } else if (!fInnerJoin && CPhysicalLeftOuterIndexNLJoin::PopConvert(exprhdl.Pop())->FMemoize()) {
+    pdrgpcrMemoizeKeys = CPhysicalLeftOuterIndexNLJoin::PopConvert(exprhdl.Pop())->PdrgPcrOuterRefs();
+  }
+
+  if (nullptr != pdrgpcrMemoizeKeys) {
+    costChild = CCost(costChild.Get() - pci->PdCost()[1] +
+                      CostMemoizedInner(mp, pcmgpdb, pci, pdrgpcrMemoizeKeys).Get());
+  }
 
   uint32_t risk = pci->Pcstats()->StatsEstimationRisk();
   uint32_t ulPenalizationFactor = 1;
   const CDouble dIndexJoinAllowedRiskThreshold =
       pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpIndexJoinAllowedRiskThreshold)->Get();
-  bool fInnerJoin = COperator::EopPhysicalInnerIndexNLJoin == exprhdl.Pop()->Eopid();
 
   // Only apply penalize factor for inner index nestloop join, because we are more confident
   // on the cardinality estimation of outer join than inner join. So don't penalize outer join
@@ -919,6 +1031,57 @@ CCost CCostModelGPDB::CostIndexNLJoin(CMemoryPool *mp, CExpressionHandle &exprhd
   return CCost(ulPenalizationFactor * (costLocal + costChild));
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostMemoizedInner
+//
+//	@doc:
+//		Cost of the inner side of an index-nljoin cached on the given outer
+//		references, along the lines of Postgres' cost_memoize_rescan(). The
+//		inner side runs once per distinct key, as far as the entries fit in
+//		the cache; every outer row pays for a lookup and every miss for
+//		copying the inner rows into the cache.
+//
+//---------------------------------------------------------------------------
+CCost CCostModelGPDB::CostMemoizedInner(CMemoryPool *mp, const CCostModelGPDB *pcmgpdb, const SCostingInfo *pci,
+                                        CColRefArray *pdrgpcrKeys) {
+  GPOS_ASSERT(nullptr != pdrgpcrKeys);
+
+  const CDouble dMemoizeLookupCostUnit =
+      pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpMemoizeLookupCostUnit)->Get();
+  const CDouble dMemoizeCacheSize =
+      pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpMemoizeCacheSize)->Get();
+  const CDouble dMaterializeCostUnit =
+      pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpMaterializeCostUnit)->Get();
+  GPOS_ASSERT(0 < dMemoizeLookupCostUnit);
+  GPOS_ASSERT(0 < dMaterializeCostUnit);
+
+  const double dCalls = std::max(pci->PdRows()[0], 1.0);
+  const double dRowsPerCall = std::max(pci->PdRows()[1] / dCalls, 1.0);
+  const double dWidthInner = pci->GetWidth()[1];
+
+  // distinct keys of the outer rows, bounded by the upper bound NDVs of
+  // their source tables
+  std::vector<uint32_t> keys;
+  for (uint32_t ul = 0; ul < pdrgpcrKeys->Size(); ul++) {
+    keys.push_back((*pdrgpcrKeys)[ul]->Id());
+  }
+  CStatisticsConfig *stats_config = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetStatsConf();
+  const double dDistinct =
+      std::min(CStatisticsUtils::Groups(mp, pci->Pcstats(0)->Pstats(), stats_config, keys, nullptr /*keys*/).Get(),
+               dCalls);
+
+  // entries hold the inner rows of one key, each with a tuple header and a
+  // list link, plus the hash entry and the key; only part of them may fit
+  const double dEntryBytes = dRowsPerCall * (dWidthInner + 40.0) + 64.0;
+  const double dEntries = std::min(dDistinct, std::max(dMemoizeCacheSize.Get() / dEntryBytes, 1.0));
+  const double dHitRatio = ((dCalls - dDistinct) / dCalls) * (dEntries / dDistinct);
+  const double dMisses = dCalls * (1.0 - dHitRatio);
+
+  return CCost(pci->PdCost()[1] * (1.0 - dHitRatio) + dCalls * dMemoizeLookupCostUnit +
+               dMisses * dRowsPerCall * dWidthInner * dMaterializeCostUnit);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostNLJoin
@@ -1574,6 +1737,13 @@ CCost CCostModelGPDB::CostScan(CMemoryPool *,  // mp
       pcmgpdb->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpTableScanCostUnit)->Get();
   GPOS_ASSERT(0 < dTableScanCostUnit);
 
+  // a parallel scan spreads the tuples across all processes, the fixed
+  // cost is paid in each of them
+  CDouble dDivisor(1.0);
+  if (COperator::EopPhysicalTableScan == op_id && CPhysicalTableScan::PopConvert(pop)->FParallel()) {
+    dDivisor = DParallelDivisor(pcmgpdb->UlParallelWorkers());
+  }
+
   switch (op_id) {
     case COperator::EopPhysicalTableScan:
     case COperator::EopPhysicalForeignScan:
@@ -1581,13 +1751,43 @@ CCost CCostModelGPDB::CostScan(CMemoryPool *,  // mp
       // since we scan the entire table here, the cost is correlated with table rows and table width,
       // since Scan's parent operator may be a filter that will be pushed into Scan node in GPDB plan,
       // we add Scan output tuple cost in the parent operator and not here
-      return CCost(pci->NumRebinds() * (dInitScan + pci->Rows() * dTableWidth * dTableScanCostUnit));
+      return CCost(pci->NumRebinds() *
+                   (dInitScan + pci->Rows() * dTableWidth * dTableScanCostUnit / dDivisor.Get()));
     default:
       GPOS_ASSERT(!"invalid index scan");
       return CCost(0);
   }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostGather
+//
+//	@doc:
+//		Cost of Gather; launching the workers plus passing every tuple
+//		from a worker to the leader
+//
+//---------------------------------------------------------------------------
+CCost CCostModelGPDB::CostGather(CMemoryPool *mp, CExpressionHandle &exprhdl, const CCostModelGPDB *pcmgpdb,
+                                 const SCostingInfo *pci) {
+  GPOS_ASSERT(nullptr != pcmgpdb);
+  GPOS_ASSERT(nullptr != pci);
+  GPOS_ASSERT(COperator::EopPhysicalGather == exprhdl.Pop()->Eopid());
+
+  ICostModelParams *pcp = pcmgpdb->GetCostModelParams();
+  const CDouble dSetupCost = pcp->PcpLookup(CCostModelParamsGPDB::EcpParallelSetupCost)->Get();
+  const CDouble dSendCostUnit = pcp->PcpLookup(CCostModelParamsGPDB::EcpGatherSendCostUnit)->Get();
+  const CDouble dRecvCostUnit = pcp->PcpLookup(CCostModelParamsGPDB::EcpGatherRecvCostUnit)->Get();
+  GPOS_ASSERT(0 < dSendCostUnit);
+  GPOS_ASSERT(0 < dRecvCostUnit);
+
+  CCost costLocal =
+      CCost(pci->NumRebinds() * (dSetupCost + pci->Rows() * pci->Width() * (dSendCostUnit + dRecvCostUnit)));
+  CCost costChild = CostChildren(mp, exprhdl, pci, pcp);
+
+  return costLocal + costChild;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CCostModelGPDB::CostFilter
@@ -1630,6 +1830,37 @@ CCost CCostModelGPDB::Cost(CExpressionHandle &exprhdl,  // handle gives access t
                            const SCostingInfo *pci) const {
   GPOS_ASSERT(nullptr != pci);
 
+  CCost cost = CostOperator(exprhdl, pci);
+
+  // an operator over a partial input runs in every process of the Gather
+  // above it, each one handling its share of the rows; scans account for
+  // this themselves
+  COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
+  if (0 == pci->ChildCount() || COperator::EopPhysicalGather == op_id || exprhdl.FScalarChild(0) ||
+      CParallelSpec::EptPartial != exprhdl.Pdpplan(0 /*child_index*/)->Ppar()->Ept()) {
+    return cost;
+  }
+
+  double dCostChildren = 0.0;
+  for (uint32_t ul = 0; ul < pci->ChildCount(); ul++) {
+    dCostChildren += pci->PdCost()[ul];
+  }
+
+  CDouble dDivisor = DParallelDivisor(UlParallelWorkers());
+  return CCost(dCostChildren + (cost.Get() - dCostChildren) / dDivisor.Get());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CCostModelGPDB::CostOperator
+//
+//	@doc:
+//		Cost of the given operator and its children
+//
+//---------------------------------------------------------------------------
+CCost CCostModelGPDB::CostOperator(CExpressionHandle &exprhdl, const SCostingInfo *pci) const {
+  GPOS_ASSERT(nullptr != pci);
+
   COperator::EOperatorId op_id = exprhdl.Pop()->Eopid();
   if (op_id == COperator::EopPhysicalComputeScalar) {
     return CostComputeScalar(m_mp, exprhdl, pci, m_cost_model_params, this);
@@ -1705,6 +1936,10 @@ CCost CCostModelGPDB::Cost(CExpressionHandle &exprhdl,  // handle gives access t
       return CostSort(m_mp, exprhdl, this, pci);
     }
 
+    case COperator::EopPhysicalIncrementalSort: {
+      return CostIncrementalSort(m_mp, exprhdl, this, pci);
+    }
+
     case COperator::EopPhysicalTVF: {
       return CostTVF(m_mp, exprhdl, this, pci);
     }
@@ -1743,9 +1978,17 @@ CCost CCostModelGPDB::Cost(CExpressionHandle &exprhdl,  // handle gives access t
       return CostNLJoin(m_mp, exprhdl, this, pci);
     }
 
-    case COperator::EopPhysicalFullMergeJoin: {
+    case COperator::EopPhysicalFullMergeJoin:
+    case COperator::EopPhysicalInnerMergeJoin:
+    case COperator::EopPhysicalLeftOuterMergeJoin:
+    case COperator::EopPhysicalLeftSemiMergeJoin:
+    case COperator::EopPhysicalLeftAntiSemiMergeJoin: {
       return CostMergeJoin(m_mp, exprhdl, this, pci);
     }
+
+    case COperator::EopPhysicalGather: {
+      return CostGather(m_mp, exprhdl, this, pci);
+    }
   }
 }
 
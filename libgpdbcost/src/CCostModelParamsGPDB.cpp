@@ -192,6 +192,20 @@ const CDouble CCostModelParamsGPDB::DScalarFuncCost(1.0e-04);
 // 'Initial cost' mapped to DInitScanFacorVal (431.0). It is not present in the
 // "Index scan costing".
 const CDouble CCostModelParamsGPDB::DIndexCostConversionFactor = 1.0e-04;
+
+// cost of launching the workers of a Gather, a fraction of the initial scan
+// cost so that only scans of a few thousand pages and up go parallel
+const CDouble CCostModelParamsGPDB::DParallelSetupCostVal = 100.0;
+
+// parallel workers are disabled unless set by the caller
+const CDouble CCostModelParamsGPDB::DParallelWorkersVal = 0.0;
+
+// hashing the outer references and probing the cache, same order as hashing
+// a tuple in a hash join
+const CDouble CCostModelParamsGPDB::DMemoizeLookupCostUnitVal = 2.0e-05;
+
+// work_mem times hash_mem_multiplier at their defaults, set by the caller
+const CDouble CCostModelParamsGPDB::DMemoizeCacheSizeVal = 8.0 * 1024 * 1024;
 #define GPOPT_COSTPARAM_NAME_MAX_LENGTH 80
 
 // parameter names in the same order of param enumeration
@@ -402,6 +416,19 @@ CCostModelParamsGPDB::CCostModelParamsGPDB(CMemoryPool *mp) : m_mp(mp) {
   m_rgpcp[EcpIndexCostConversionFactor] =
       GPOS_NEW(mp) SCostParam(EcpIndexCostConversionFactor, DIndexCostConversionFactor,
                               DIndexCostConversionFactor - 0.0, DIndexCostConversionFactor + 0.0);
+
+  m_rgpcp[EcpParallelSetupCost] = GPOS_NEW(mp) SCostParam(EcpParallelSetupCost, DParallelSetupCostVal,
+                                                          DParallelSetupCostVal - 10.0, DParallelSetupCostVal + 10.0);
+
+  m_rgpcp[EcpParallelWorkers] = GPOS_NEW(mp)
+      SCostParam(EcpParallelWorkers, DParallelWorkersVal, DParallelWorkersVal - 0.0, DParallelWorkersVal + 0.0);
+
+  m_rgpcp[EcpMemoizeLookupCostUnit] =
+      GPOS_NEW(mp) SCostParam(EcpMemoizeLookupCostUnit, DMemoizeLookupCostUnitVal, DMemoizeLookupCostUnitVal - 0.0,
+                              DMemoizeLookupCostUnitVal + 0.0);
+
+  m_rgpcp[EcpMemoizeCacheSize] = GPOS_NEW(mp)
+      SCostParam(EcpMemoizeCacheSize, DMemoizeCacheSizeVal, DMemoizeCacheSizeVal - 0.0, DMemoizeCacheSizeVal + 0.0);
 }
 
 //---------------------------------------------------------------------------
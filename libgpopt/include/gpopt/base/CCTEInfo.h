@@ -11,12 +11,15 @@
 #ifndef GPOPT_CCTEInfo_H
 #define GPOPT_CCTEInfo_H
 
+#include <atomic>
+
 #include "gpopt/base/CColRef.h"
 #include "gpopt/base/CColRefSet.h"
 #include "gpopt/base/CColumnFactory.h"
 #include "gpopt/operators/CExpression.h"
 #include "gpos/base.h"
 #include "gpos/common/CHashMap.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/common/CStack.h"
 
 namespace gpopt {
@@ -160,7 +163,10 @@ class CCTEInfo : public CRefCount {
   UlongToCTEInfoEntryMap *m_phmulcteinfoentry;
 
   // next available CTE Id
-  uint32_t m_ulNextCTEId;
+  std::atomic<uint32_t> m_ulNextCTEId;
+
+  // lock protecting the maps, taken by the methods used during search
+  mutable CMutex m_mutex;
 
   // whether or not to inline CTE consumers
   bool m_fEnableInlining;
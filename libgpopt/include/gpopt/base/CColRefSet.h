@@ -115,9 +115,6 @@ class CColRefSet : public CBitSet {
   // convert to id colref map
   IntToColRefMap *Phmicr(CMemoryPool *mp) const;
 
-  // hash function
-  uint32_t HashValue();
-
   // debug print
   IOstream &OsPrint(IOstream &os) const override;
   IOstream &OsPrint(IOstream &os, uint32_t ulLenMax) const;
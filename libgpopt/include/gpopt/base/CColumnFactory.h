@@ -11,10 +11,13 @@
 #ifndef GPOPT_CColumnFactory_H
 #define GPOPT_CColumnFactory_H
 
+#include <atomic>
+
 #include "gpopt/base/CColRefSet.h"
 #include "gpopt/metadata/CColumnDescriptor.h"
 #include "gpos/base.h"
 #include "gpos/common/CList.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/common/CSyncHashtable.h"
 #include "naucrates/md/IMDId.h"
 #include "naucrates/md/IMDType.h"
@@ -47,8 +50,11 @@ class CColumnFactory {
   // mapping between column id of computed column and a set of used column references
   ColRefToColRefSetMap *m_phmcrcrs{nullptr};
 
+  // lock protecting the computed column map
+  CMutex m_mutex;
+
   // id counter
-  uint32_t m_aul{0};
+  std::atomic<uint32_t> m_aul{0};
 
   // hash table
   CSyncHashtable<CColRef, uint32_t> m_sht;
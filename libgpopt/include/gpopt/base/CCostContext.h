@@ -110,9 +110,6 @@ class CCostContext : public CRefCount {
   // main optimization context
   COptimizationContext *m_poc;
 
-  // link for cost context hash table in CGroupExpression
-  SLink m_link;
-
   // ctor
   CCostContext(CMemoryPool *mp, COptimizationContext *poc, uint32_t ulOptReq, CGroupExpression *pgexpr);
 
@@ -22,6 +22,7 @@ using namespace gpos;
 // fwd declaration
 class CExpressionHandle;
 class COrderSpec;
+class CParallelSpec;
 class CPartitionPropagationSpec;
 class CReqdPropPlan;
 class CCTEMap;
@@ -35,7 +36,7 @@ class CCTEMap;
 //
 //		These are properties that are expression-specific and they depend on
 //		the physical implementation. This includes sort order, distribution,
-//		rewindability, partition propagation spec and CTE map.
+//		rewindability, partition propagation spec, parallelism and CTE map.
 //
 //---------------------------------------------------------------------------
 class CDrvdPropPlan : public CDrvdProp {
@@ -46,6 +47,9 @@ class CDrvdPropPlan : public CDrvdProp {
   // derived partition propagation spec
   CPartitionPropagationSpec *m_ppps{nullptr};
 
+  // derived parallelism
+  CParallelSpec *m_ppar{nullptr};
+
   // derived cte map
   CCTEMap *m_pcm{nullptr};
 
@@ -75,6 +79,9 @@ class CDrvdPropPlan : public CDrvdProp {
 
   CPartitionPropagationSpec *Ppps() const { return m_ppps; }
 
+  // parallelism accessor
+  CParallelSpec *Ppar() const { return m_ppar; }
+
   // cte map
   CCTEMap *GetCostModel() const { return m_pcm; }
 
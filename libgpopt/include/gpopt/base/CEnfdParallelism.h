@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CEnfdParallelism.h
+//
+//	@doc:
+//		Enforceable parallelism property
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CEnfdParallelism_H
+#define GPOPT_CEnfdParallelism_H
+
+#include "gpopt/base/CEnfdProp.h"
+#include "gpopt/base/CParallelSpec.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CEnfdParallelism
+//
+//	@doc:
+//		Enforceable parallelism property; a singleton requirement is
+//		enforced by a Gather over a partial plan
+//
+//---------------------------------------------------------------------------
+class CEnfdParallelism : public CEnfdProp {
+ public:
+  // type of parallelism matching function(s)
+  enum EParallelismMatching { EparmSatisfy = 0, EparmSentinel };
+
+ private:
+  // required parallelism
+  CParallelSpec *m_ppar;
+
+  // parallelism matching type
+  EParallelismMatching m_eparm;
+
+ public:
+  CEnfdParallelism(const CEnfdParallelism &) = delete;
+
+  // ctor
+  CEnfdParallelism(CParallelSpec *ppar, EParallelismMatching eparm);
+
+  // dtor
+  ~CEnfdParallelism() override;
+
+  // parallelism spec accessor
+  CPropSpec *Pps() const override { return m_ppar; }
+
+  // hash function
+  uint32_t HashValue() const override;
+
+  // required parallelism accessor
+  CParallelSpec *PparRequired() const { return m_ppar; }
+
+  // get parallelism enforcing type for the given operator
+  EPropEnforcingType Epet(CExpressionHandle &exprhdl, CPhysical *popPhysical, bool fParallelismReqd) const;
+
+  // return matching type
+  EParallelismMatching Eparm() const { return m_eparm; }
+
+  // matching function
+  bool Matches(CEnfdParallelism *pepar);
+
+  // check if the given parallelism fulfills the requirement
+  bool FCompatible(CParallelSpec *ppar_drvd) const;
+
+  // print function
+  IOstream &OsPrint(IOstream &os) const override;
+
+  // name of parallelism matching type
+  static const char *SzParallelismMatching(EParallelismMatching eparm);
+
+};  // class CEnfdParallelism
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CEnfdParallelism_H
+
+// EOF
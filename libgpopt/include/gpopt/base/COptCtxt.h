@@ -12,6 +12,8 @@
 #ifndef GPOPT_COptCtxt_H
 #define GPOPT_COptCtxt_H
 
+#include <atomic>
+
 #include "gpopt/base/CCTEInfo.h"
 #include "gpopt/base/CColumnFactory.h"
 #include "gpopt/base/IComparator.h"
@@ -70,7 +72,7 @@ class COptCtxt : public CTaskLocalStorageObject {
   IComparator *m_pcomp;
 
   // atomic counter for generating part index ids
-  uint32_t m_auPartId;
+  std::atomic<uint32_t> m_auPartId;
 
   // global CTE information
   CCTEInfo *m_pcteinfo;
@@ -113,7 +115,7 @@ class COptCtxt : public CTaskLocalStorageObject {
   UlongToBitSetMap *m_scanid_to_part_map;
 
   // unique id per partition selector in the memo
-  uint32_t m_selector_id_counter;
+  std::atomic<uint32_t> m_selector_id_counter;
 
   // detailed info (filter expr, stats etc) per partition selector
   // (required by CDynamicPhysicalScan for recomputing statistics for DPE)
@@ -240,9 +240,6 @@ class COptimizationContext : public CRefCount {
   // compute required properties to CTE producer based on plan properties of CTE consumer
   static CReqdPropPlan *PrppCTEProducer(CMemoryPool *mp, COptimizationContext *poc, uint32_t ulSearchStages);
 
-  // link for optimization context hash table in CGroup
-  SLink m_link;
-
   // invalid optimization context, needed for hash table iteration
   static const COptimizationContext m_ocInvalid;
 
@@ -158,6 +158,12 @@ class COrderSpec : public CPropSpec {
   // check if order specs satisfies req'd spec
   bool FSatisfies(const COrderSpec *pos) const;
 
+  // number of leading components of the given spec matched by this spec
+  uint32_t UlMatchingPrefix(const COrderSpec *pos) const;
+
+  // order spec made of the first components of this spec
+  COrderSpec *PosPrefix(CMemoryPool *mp, uint32_t ulCols) const;
+
   // append enforcers to dynamic array for the given plan properties
   void AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl, CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr,
                        CExpression *pexpr) override;
@@ -0,0 +1,88 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CParallelSpec.h
+//
+//	@doc:
+//		Specification of how a result is spread across parallel workers
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CParallelSpec_H
+#define GPOPT_CParallelSpec_H
+
+#include "gpopt/base/CPropSpec.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CParallelSpec
+//
+//	@doc:
+//		Parallelism specification. A partial result is produced by the
+//		leader and the workers of a Gather together, each process returning
+//		a disjoint part of the rows. Serial and singleton results are
+//		complete; a serial result may also be computed inside a worker,
+//		a singleton one only in the leader, e.g. because it contains a
+//		Gather itself.
+//
+//---------------------------------------------------------------------------
+class CParallelSpec : public CPropSpec {
+ public:
+  enum EParallelType {
+    EptAny,        // no requirement
+    EptSerial,     // complete result, may run in a worker
+    EptPartial,    // result split across the leader and the workers
+    EptSingleton,  // complete result, leader only
+
+    EptSentinel
+  };
+
+ private:
+  // parallelism type
+  EParallelType m_ept;
+
+ public:
+  CParallelSpec(const CParallelSpec &) = delete;
+
+  // ctor
+  explicit CParallelSpec(EParallelType ept);
+
+  // dtor
+  ~CParallelSpec() override = default;
+
+  // parallelism type accessor
+  EParallelType Ept() const { return m_ept; }
+
+  // does the spec impose any requirement?
+  bool FParallelismReqd() const { return EptAny != m_ept; }
+
+  // check if this spec satisfies the given one
+  bool FSatisfies(const CParallelSpec *ppar) const;
+
+  // match function
+  bool Matches(const CParallelSpec *ppar) const { return m_ept == ppar->Ept(); }
+
+  // append enforcers to dynamic array for the given plan properties
+  void AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl, CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr,
+                       CExpression *pexpr) override;
+
+  // hash function
+  uint32_t HashValue() const override { return (uint32_t)m_ept + 1; }
+
+  // extract columns used by the spec
+  CColRefSet *PcrsUsed(CMemoryPool *mp) const override;
+
+  // property type
+  EPropSpecType Epst() const override { return EpstParallelism; }
+
+  // print
+  IOstream &OsPrint(IOstream &os) const override;
+
+};  // class CParallelSpec
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CParallelSpec_H
+
+// EOF
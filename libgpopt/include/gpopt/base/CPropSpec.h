@@ -35,6 +35,7 @@ class CPropSpec : public CRefCount {
   enum EPropSpecType {
     EpstOrder,
     EpstPartPropagation,
+    EpstParallelism,
 
     EpstSentinel
   };
@@ -23,6 +23,7 @@ class CColRefSet;
 class CDrvdPropRelational;
 class CDrvdPropPlan;
 class CEnfdOrder;
+class CEnfdParallelism;
 class CEnfdPartitionPropagation;
 class CExpressionHandle;
 class CCTEReq;
@@ -49,6 +50,9 @@ class CReqdPropPlan : public CReqdProp {
   // required partition propagation
   CEnfdPartitionPropagation *m_pepp{nullptr};
 
+  // required parallelism
+  CEnfdParallelism *m_pepar{nullptr};
+
   // required ctes
   CCTEReq *m_pcter{nullptr};
 
@@ -59,7 +63,8 @@ class CReqdPropPlan : public CReqdProp {
   CReqdPropPlan() = default;
 
   // ctor
-  CReqdPropPlan(CColRefSet *pcrs, CEnfdOrder *peo, CEnfdPartitionPropagation *pepp, CCTEReq *pcter);
+  CReqdPropPlan(CColRefSet *pcrs, CEnfdOrder *peo, CEnfdPartitionPropagation *pepp, CEnfdParallelism *pepar,
+                CCTEReq *pcter);
 
   // dtor
   ~CReqdPropPlan() override;
@@ -91,6 +96,9 @@ class CReqdPropPlan : public CReqdProp {
   // required partition propagation accessor
   CEnfdPartitionPropagation *Pepp() const { return m_pepp; }
 
+  // required parallelism accessor
+  CEnfdParallelism *Pepar() const { return m_pepar; }
+
   // required cte accessor
   CCTEReq *Pcter() const { return m_pcter; }
 
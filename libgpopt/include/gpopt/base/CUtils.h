@@ -459,6 +459,9 @@ class CUtils {
   // check if a given operator is a hash join
   static bool FHashJoin(COperator *pop);
 
+  // check if a given operator is a merge join
+  static bool FMergeJoin(COperator *pop);
+
   // check if a given operator is a correlated nested loops join
   static bool FCorrelatedNLJoin(COperator *pop);
 
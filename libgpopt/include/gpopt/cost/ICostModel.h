@@ -260,6 +260,9 @@ class ICostModel : public CRefCount {
   // cost model type
   virtual ECostModelType Ecmt() const = 0;
 
+  // number of parallel workers a Gather may use, zero if parallelism is off
+  virtual uint32_t UlParallelWorkers() const = 0;
+
   // set cost model params
   void SetParams(ICostModelParamsArray *pdrgpcp) const;
 
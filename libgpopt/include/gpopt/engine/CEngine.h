@@ -11,10 +11,13 @@
 #ifndef GPOPT_CEngine_H
 #define GPOPT_CEngine_H
 
+#include <atomic>
+
 #include "gpopt/search/CMemo.h"
 #include "gpopt/search/CSearchStage.h"
 #include "gpopt/xforms/CXform.h"
 #include "gpos/base.h"
+#include "gpos/common/CWallClock.h"
 
 namespace gpopt {
 using namespace gpos;
@@ -59,6 +62,18 @@ class CEngine {
   //  pattern used for adding enforcers
   CExpression *m_pexprEnforcerPattern;
 
+  // planning time budget in milliseconds, UINT32_MAX if unlimited
+  uint32_t m_ulBudget;
+
+  // wall clock started when the search starts
+  CWallClock m_clockBudget;
+
+  // has the planning time budget been used up?
+  std::atomic<bool> m_fBudgetExhausted;
+
+  // has a completed search stage found a plan?
+  bool m_fPlanFound;
+
   // the following variables are used for maintaining optimization statistics
 
   // set of activated xforms
@@ -127,6 +142,12 @@ class CEngine {
   // create and schedule the main optimization job
   void ScheduleMainJob(CSchedulerContext *psc, COptimizationContext *poc) const;
 
+  // number of workers running the search jobs
+  static uint32_t UlSearchWorkers();
+
+  // run the scheduled jobs on helper workers
+  void RunHelpers(CSchedulerContext *rgsc, uint32_t ulWorkers);
+
   // print activated xform
   void PrintActivatedXforms(IOstream &os) const;
 
@@ -135,10 +156,14 @@ class CEngine {
 
   // check if search has terminated
   bool FSearchTerminated() const {
-    // at least one stage has completed and achieved required cost
-    return (nullptr != PssPrevious() && PssPrevious()->FAchievedReqdCost());
+    // at least one stage has completed and achieved required cost, or the
+    // time budget is used up and a plan has been found
+    return (nullptr != PssPrevious() && PssPrevious()->FAchievedReqdCost()) || FBudgetPlanReady();
   }
 
+  // is the time budget used up while a plan from an earlier stage can be returned?
+  bool FBudgetPlanReady() const { return m_fBudgetExhausted && m_fPlanFound; }
+
   // generate random plan id
   uint64_t UllRandomPlanId(uint32_t *seed);
 
@@ -152,14 +177,16 @@ class CEngine {
   static bool FChildrenOptimized(COptimizationContextArray *pdrgpoc);
 
   // check if ayn of the given property enforcing types prohibits enforcement
-  static bool FProhibited(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation);
+  static bool FProhibited(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation,
+                          CEnfdProp::EPropEnforcingType epetParallelism);
 
   // check whether the given memo groups can be marked as duplicates. This is
   // true only if they have the same logical properties
   static bool FPossibleDuplicateGroups(CGroup *pgroupFst, CGroup *pgroupSnd);
 
   // check if optimization is possible under the given property enforcing types
-  static bool FOptimize(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation);
+  static bool FOptimize(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation,
+                        CEnfdProp::EPropEnforcingType epetParallelism);
 
   // unrank the plan with the given 'plan_id' from the memo
   CExpression *PexprUnrank(uint64_t plan_id);
@@ -270,6 +297,16 @@ class CEngine {
   // number of search stages accessor
   uint32_t UlSearchStages() const { return m_search_stage_array->Size(); }
 
+  // check the planning time budget, called periodically by the scheduler
+  void CheckBudget();
+
+  // has the planning time budget been used up? no more alternatives are explored then
+  bool FBudgetExhausted() const { return m_fBudgetExhausted; }
+
+  // should the current search stage stop? either it timed out, or the budget is
+  // used up and an earlier stage already found a plan
+  bool FStageTimedOut() const { return PssCurrent()->FTimedOut() || FBudgetPlanReady(); }
+
   // set of xforms of current stage
   CXformSet *PxfsCurrentStage() const { return (*m_search_stage_array)[m_ulCurrSearchStage]->GetXformSet(); }
 
@@ -13,6 +13,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CDouble.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/common/CRefCount.h"
 #include "gpos/memory/CMemoryPool.h"
 #include "naucrates/md/CMDIdColStats.h"
@@ -53,6 +54,9 @@ class CStatisticsConfig : public CRefCount {
   // hash set of md ids for columns with missing statistics
   MdidHashSet *m_phsmdidcolinfo;
 
+  // lock protecting the hash set of missing statistics
+  CMutex m_mutex;
+
  public:
   // ctor
   CStatisticsConfig(CMemoryPool *mp, CDouble damping_factor_filter, CDouble damping_factor_join,
@@ -35,6 +35,7 @@ enum ExMinor {
   ExmiEvalUnsupportedScalarExpr,
   ExmiCTEProducerConsumerMisAligned,
   ExmiNoStats,
+  ExmiInvalidSearchStrategy,
 
   ExmiSentinel
 };
@@ -32,6 +32,20 @@ using namespace gpmd;
 //
 //---------------------------------------------------------------------------
 class CMDCache {
+ public:
+  // predicate selecting cached metadata objects for eviction
+  using MDObjMatchFunc = bool (*)(const IMDCacheObject *, void *);
+
+  // events affecting the lifetime of the cache contents
+  enum EMDCacheEvent {
+    EmdceInvalidationReset,  // cache reset because of catalog changes
+    EmdceInvalidationEvict,  // individual entries evicted because of catalog changes
+    EmdceErrorReset,         // cache dropped after an optimizer error
+    EmdceErrorKeep,          // cache kept after an optimizer error
+
+    EmdceSentinel
+  };
+
  private:
   // pointer to the underlying cache
   static CMDAccessor::MDCache *m_pcache;
@@ -39,6 +53,9 @@ class CMDCache {
   // the maximum size of the cache
   static uint64_t m_ullCacheQuota;
 
+  // number of times each event occurred since the backend started
+  static uint64_t m_rgullEventCounters[EmdceSentinel];
+
   // private ctor
   CMDCache() = default;
 
@@ -69,6 +86,21 @@ class CMDCache {
   // reset global instance
   static void Reset();
 
+  // evict all cached objects accepted by the given predicate
+  static uint64_t Evict(MDObjMatchFunc match_func, void *arg);
+
+  // evict a relation along with its statistics, indexes and check constraints
+  static uint64_t EvictRelation(OID rel_oid);
+
+  // can the cache be kept once all metadata accessors are gone?
+  static bool FConsistent();
+
+  // record an event
+  static void RecordEvent(EMDCacheEvent event) { m_rgullEventCounters[event]++; }
+
+  // number of times the given event occurred
+  static uint64_t ULLGetEventCounter(EMDCacheEvent event) { return m_rgullEventCounters[event]; }
+
   // global accessor
   static CMDAccessor::MDCache *Pcache() { return m_pcache; }
 
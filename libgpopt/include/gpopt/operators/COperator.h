@@ -195,6 +195,10 @@ class COperator : public CRefCount {
     EopPhysicalLeftAntiSemiNLJoinNotIn,
     EopPhysicalCorrelatedNotInLeftAntiSemiNLJoin,
     EopPhysicalFullMergeJoin,
+    EopPhysicalInnerMergeJoin,
+    EopPhysicalLeftOuterMergeJoin,
+    EopPhysicalLeftSemiMergeJoin,
+    EopPhysicalLeftAntiSemiMergeJoin,
     EopPhysicalSequence,
     EopPhysicalTVF,
     EopPhysicalCTEProducer,
@@ -219,10 +223,12 @@ class COperator : public CRefCount {
     EopPhysicalParallelUnionAll,
 
     EopPhysicalSort,
+    EopPhysicalIncrementalSort,
     EopPhysicalLimit,
     EopPhysicalComputeScalar,
     EopPhysicalSpool,
     EopPhysicalPartitionSelector,
+    EopPhysicalGather,
 
     EopPhysicalConstTableGet,
 
@@ -13,8 +13,10 @@
 
 #include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/base/CEnfdOrder.h"
+#include "gpopt/base/CEnfdParallelism.h"
 #include "gpopt/base/CEnfdPartitionPropagation.h"
 #include "gpopt/base/COrderSpec.h"
+#include "gpopt/base/CParallelSpec.h"
 #include "gpopt/base/CPartitionPropagationSpec.h"
 #include "gpopt/operators/COperator.h"
 #include "gpos/base.h"
@@ -164,6 +166,17 @@ class CPhysical : public COperator {
   // pass cte requirement to the child
   static CCTEReq *PcterPushThru(CCTEReq *pcter);
 
+  // pass parallelism requirement to the child
+  static CParallelSpec *PparPassThru(CParallelSpec *pparRequired);
+
+  // helper for common case of parallelism derivation
+  static CParallelSpec *PparDerivePassThruOuter(CExpressionHandle &exprhdl);
+
+  // parallelism enforcing type of operators that can run inside a worker
+  // and are worth putting under a Gather
+  static CEnfdProp::EPropEnforcingType EpetParallelismPassThru(CExpressionHandle &exprhdl,
+                                                               const CEnfdParallelism *pepar);
+
   // combine the derived CTE maps of the first n children
   // of the given expression handle
   static CCTEMap *PcmCombine(CMemoryPool *mp, CDrvdPropArray *pdrgpdpCtxt);
@@ -227,6 +240,10 @@ class CPhysical : public COperator {
                                                   CPartitionPropagationSpec *pppsRequired, uint32_t child_index,
                                                   CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const;
 
+  // compute required parallelism of the n-th child
+  virtual CParallelSpec *PparRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CParallelSpec *pparRequired,
+                                      uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const;
+
   // required properties: check if required columns are included in output columns
   virtual bool FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired, uint32_t ulOptReq) const = 0;
 
@@ -243,6 +260,9 @@ class CPhysical : public COperator {
   // derived properties: derive partition propagation spec
   virtual CPartitionPropagationSpec *PppsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const;
 
+  // derive parallelism
+  virtual CParallelSpec *PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const;
+
   // derive cte map
   virtual CCTEMap *PcmDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const;
 
@@ -258,6 +278,10 @@ class CPhysical : public COperator {
   virtual CEnfdProp::EPropEnforcingType EpetPartitionPropagation(CExpressionHandle &exprhdl,
                                                                  const CEnfdPartitionPropagation *per) const;
 
+  // return parallelism property enforcing type for this operator
+  virtual CEnfdProp::EPropEnforcingType EpetParallelism(CExpressionHandle &exprhdl,
+                                                        const CEnfdParallelism *pepar) const;
+
   // order matching type
   virtual CEnfdOrder::EOrderMatching Eom(CReqdPropPlan *prppInput, uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt,
                                          uint32_t ulOptReq);
@@ -130,6 +130,10 @@ class CPhysicalAgg : public CPhysical {
   CCTEReq *PcteRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CCTEReq *pcter, uint32_t child_index,
                         CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
 
+  // compute required parallelism of the n-th child
+  CParallelSpec *PparRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CParallelSpec *pparRequired,
+                              uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+
   // check if required columns are included in output columns
   bool FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired, uint32_t ulOptReq) const override;
 
@@ -137,10 +141,17 @@ class CPhysicalAgg : public CPhysical {
   // Derived Plan Properties
   //-------------------------------------------------------------------------------------
 
+  // derive parallelism
+  CParallelSpec *PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
+
   //-------------------------------------------------------------------------------------
   // Enforced Properties
   //-------------------------------------------------------------------------------------
 
+  // return parallelism property enforcing type for this operator
+  CEnfdProp::EPropEnforcingType EpetParallelism(CExpressionHandle &exprhdl,
+                                                const CEnfdParallelism *pepar) const override;
+
   // return true if operator passes through stats obtained from children,
   // this is used when computing stats during costing
   bool FPassThruStats() const override { return false; }
@@ -89,6 +89,13 @@ class CPhysicalCTEProducer : public CPhysical {
   // derive sort order
   COrderSpec *PosDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
 
+  // derive parallelism; shared scans are executed by the leader only
+  CParallelSpec *PparDerive(CMemoryPool *mp,
+                            CExpressionHandle &  // exprhdl
+  ) const override {
+    return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSingleton);
+  }
+
   // derive cte map
   CCTEMap *PcmDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
 
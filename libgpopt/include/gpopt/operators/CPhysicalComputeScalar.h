@@ -61,6 +61,17 @@ class CPhysicalComputeScalar : public CPhysical {
   COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, COrderSpec *posRequired, uint32_t child_index,
                           CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
 
+  // compute required parallelism of the n-th child
+  CParallelSpec *PparRequired(CMemoryPool *,        // mp
+                              CExpressionHandle &,  // exprhdl
+                              CParallelSpec *pparRequired,
+                              uint32_t,          // child_index
+                              CDrvdPropArray *,  // pdrgpdpCtxt
+                              uint32_t           // ulOptReq
+  ) const override {
+    return PparPassThru(pparRequired);
+  }
+
   // check if required columns are included in output columns
   bool FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired, uint32_t ulOptReq) const override;
 
@@ -71,6 +82,12 @@ class CPhysicalComputeScalar : public CPhysical {
   // derive sort order
   COrderSpec *PosDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
 
+  // derive parallelism
+  CParallelSpec *PparDerive(CMemoryPool *,  // mp
+                            CExpressionHandle &exprhdl) const override {
+    return PparDerivePassThruOuter(exprhdl);
+  }
+
   //-------------------------------------------------------------------------------------
   // Enforced Properties
   //-------------------------------------------------------------------------------------
@@ -78,6 +95,12 @@ class CPhysicalComputeScalar : public CPhysical {
   // return order property enforcing type for this operator
   CEnfdProp::EPropEnforcingType EpetOrder(CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
 
+  // return parallelism property enforcing type for this operator
+  CEnfdProp::EPropEnforcingType EpetParallelism(CExpressionHandle &exprhdl,
+                                                const CEnfdParallelism *pepar) const override {
+    return EpetParallelismPassThru(exprhdl, pepar);
+  }
+
   // return true if operator passes through stats obtained from children,
   // this is used when computing stats during costing
   bool FPassThruStats() const override { return false; }
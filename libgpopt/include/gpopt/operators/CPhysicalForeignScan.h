@@ -44,6 +44,14 @@ class CPhysicalForeignScan : public CPhysicalTableScan {
   // Derived Plan Properties
   //-------------------------------------------------------------------------------------
 
+  // derive parallelism; foreign data wrappers are not assumed to be
+  // parallel safe, so the scan stays in the leader
+  CParallelSpec *PparDerive(CMemoryPool *mp,
+                            CExpressionHandle &  // exprhdl
+  ) const override {
+    return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSingleton);
+  }
+
   //-------------------------------------------------------------------------------------
   // Enforced Properties
   //-------------------------------------------------------------------------------------
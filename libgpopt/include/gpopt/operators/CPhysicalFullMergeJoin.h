@@ -4,16 +4,11 @@
 #ifndef GPOPT_CPhysicalFullMergeJoin_H
 #define GPOPT_CPhysicalFullMergeJoin_H
 
-#include "gpopt/operators/CPhysicalJoin.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 #include "gpos/base.h"
 
 namespace gpopt {
-class CPhysicalFullMergeJoin : public CPhysicalJoin {
- private:
-  CExpressionArray *m_outer_merge_clauses;
-
-  CExpressionArray *m_inner_merge_clauses;
-
+class CPhysicalFullMergeJoin : public CPhysicalMergeJoin {
  public:
   CPhysicalFullMergeJoin(const CPhysicalFullMergeJoin &) = delete;
 
@@ -23,7 +18,7 @@ class CPhysicalFullMergeJoin : public CPhysicalJoin {
                                   bool is_null_aware = true, CXform::EXformId origin_xform = CXform::ExfSentinel);
 
   // dtor
-  ~CPhysicalFullMergeJoin() override;
+  ~CPhysicalFullMergeJoin() override = default;
 
   // ident accessors
   EOperatorId Eopid() const override { return EopPhysicalFullMergeJoin; }
@@ -38,8 +33,23 @@ class CPhysicalFullMergeJoin : public CPhysicalJoin {
     return dynamic_cast<CPhysicalFullMergeJoin *>(pop);
   }
 
-  COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, COrderSpec *posInput, uint32_t child_index,
-                          CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+  // compute required sort order of the n-th child; nothing beyond the
+  // merge keys is requested since the output order is not preserved
+  COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &,  // exprhdl
+                          COrderSpec *,                          // posInput
+                          uint32_t child_index,
+                          CDrvdPropArray *,  // pdrgpdpCtxt
+                          uint32_t           // ulOptReq
+  ) const override {
+    return PosMergeKeys(mp, child_index);
+  }
+
+  // compute required parallelism of the n-th child; unmatched inner rows
+  // must be emitted exactly once, so the outer side is never split
+  CParallelSpec *PparRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CParallelSpec *pparRequired,
+                              uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override {
+    return CPhysical::PparRequired(mp, exprhdl, pparRequired, child_index, pdrgpdpCtxt, ulOptReq);
+  }
 
   // return order property enforcing type for this operator
   CEnfdProp::EPropEnforcingType EpetOrder(CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalGather.h
+//
+//	@doc:
+//		Physical Gather / Gather Merge operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalGather_H
+#define GPOPT_CPhysicalGather_H
+
+#include "gpopt/base/COrderSpec.h"
+#include "gpopt/operators/CPhysical.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalGather
+//
+//	@doc:
+//		Collects the partial results of the leader and the parallel workers
+//		into a complete one. With an empty order spec this is a Gather,
+//		otherwise a Gather Merge combining inputs sorted by that order.
+//
+//---------------------------------------------------------------------------
+class CPhysicalGather : public CPhysical {
+ private:
+  // order preserved while merging, empty for a plain Gather
+  COrderSpec *m_pos;
+
+  // columns used by order spec
+  CColRefSet *m_pcrsSort;
+
+ public:
+  CPhysicalGather(const CPhysicalGather &) = delete;
+
+  // ctor
+  CPhysicalGather(CMemoryPool *mp, COrderSpec *pos);
+
+  // dtor
+  ~CPhysicalGather() override;
+
+  // ident accessors
+  EOperatorId Eopid() const override { return EopPhysicalGather; }
+
+  // return a string for operator name
+  const char *SzId() const override { return "CPhysicalGather"; }
+
+  // merge order accessor
+  const COrderSpec *Pos() const { return m_pos; }
+
+  // is this a Gather Merge?
+  bool FMerge() const { return !m_pos->IsEmpty(); }
+
+  // match function
+  bool Matches(COperator *pop) const override;
+
+  // sensitivity to order of inputs
+  bool FInputOrderSensitive() const override { return true; }
+
+  //-------------------------------------------------------------------------------------
+  // Required Plan Properties
+  //-------------------------------------------------------------------------------------
+
+  // compute required output columns of the n-th child
+  CColRefSet *PcrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CColRefSet *pcrsRequired, uint32_t child_index,
+                           CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) override;
+
+  // compute required ctes of the n-th child
+  CCTEReq *PcteRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CCTEReq *pcter, uint32_t child_index,
+                        CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+
+  // compute required sort order of the n-th child
+  COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, COrderSpec *posRequired, uint32_t child_index,
+                          CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+
+  // compute required parallelism of the n-th child
+  CParallelSpec *PparRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CParallelSpec *pparRequired,
+                              uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+
+  // check if required columns are included in output columns
+  bool FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired, uint32_t ulOptReq) const override;
+
+  //-------------------------------------------------------------------------------------
+  // Derived Plan Properties
+  //-------------------------------------------------------------------------------------
+
+  // derive sort order
+  COrderSpec *PosDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
+
+  // derive parallelism
+  CParallelSpec *PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
+
+  //-------------------------------------------------------------------------------------
+  // Enforced Properties
+  //-------------------------------------------------------------------------------------
+
+  // return order property enforcing type for this operator
+  CEnfdProp::EPropEnforcingType EpetOrder(CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
+
+  // return parallelism property enforcing type for this operator
+  CEnfdProp::EPropEnforcingType EpetParallelism(CExpressionHandle &exprhdl,
+                                                const CEnfdParallelism *pepar) const override;
+
+  // return true if operator passes through stats obtained from children,
+  // this is used when computing stats during costing
+  bool FPassThruStats() const override { return true; }
+
+  //-------------------------------------------------------------------------------------
+  //-------------------------------------------------------------------------------------
+  //-------------------------------------------------------------------------------------
+
+  // debug print
+  IOstream &OsPrint(IOstream &os) const override;
+
+  // conversion function
+  static CPhysicalGather *PopConvert(COperator *pop) {
+    GPOS_ASSERT(nullptr != pop);
+    GPOS_ASSERT(EopPhysicalGather == pop->Eopid());
+
+    return dynamic_cast<CPhysicalGather *>(pop);
+  }
+
+};  // class CPhysicalGather
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CPhysicalGather_H
+
+// EOF
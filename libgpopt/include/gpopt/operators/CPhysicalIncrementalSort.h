@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalIncrementalSort.h
+//
+//	@doc:
+//		Physical incremental sort operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalIncrementalSort_H
+#define GPOPT_CPhysicalIncrementalSort_H
+
+#include "gpopt/operators/CPhysicalSort.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalIncrementalSort
+//
+//	@doc:
+//		Sort of an input that is already sorted on a prefix of the order;
+//		rows are sorted on the remaining columns one group of equal prefix
+//		values at a time, so only a group needs to be kept in memory and
+//		the first rows are returned before the whole input is read.
+//
+//---------------------------------------------------------------------------
+class CPhysicalIncrementalSort : public CPhysicalSort {
+ private:
+  // order already provided by the child, a prefix of the sort order
+  COrderSpec *m_posPresorted;
+
+ public:
+  CPhysicalIncrementalSort(const CPhysicalIncrementalSort &) = delete;
+
+  // ctor
+  CPhysicalIncrementalSort(CMemoryPool *mp, COrderSpec *pos, COrderSpec *posPresorted);
+
+  // dtor
+  ~CPhysicalIncrementalSort() override;
+
+  // ident accessors
+  EOperatorId Eopid() const override { return EopPhysicalIncrementalSort; }
+
+  // return a string for operator name
+  const char *SzId() const override { return "CPhysicalIncrementalSort"; }
+
+  // presorted prefix accessor
+  const COrderSpec *PosPresorted() const { return m_posPresorted; }
+
+  // number of presorted columns
+  uint32_t UlPresortedCols() const { return m_posPresorted->UlSortColumns(); }
+
+  // match function
+  bool Matches(COperator *pop) const override;
+
+  //-------------------------------------------------------------------------------------
+  // Required Plan Properties
+  //-------------------------------------------------------------------------------------
+
+  // compute required sort order of the n-th child
+  COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, COrderSpec *posRequired, uint32_t child_index,
+                          CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+
+  //-------------------------------------------------------------------------------------
+  //-------------------------------------------------------------------------------------
+  //-------------------------------------------------------------------------------------
+
+  // debug print
+  IOstream &OsPrint(IOstream &os) const override;
+
+  // conversion function
+  static CPhysicalIncrementalSort *PopConvert(COperator *pop) {
+    GPOS_ASSERT(nullptr != pop);
+    GPOS_ASSERT(EopPhysicalIncrementalSort == pop->Eopid());
+
+    return dynamic_cast<CPhysicalIncrementalSort *>(pop);
+  }
+
+};  // class CPhysicalIncrementalSort
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CPhysicalIncrementalSort_H
+
+// EOF
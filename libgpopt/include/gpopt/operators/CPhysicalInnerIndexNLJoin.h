@@ -31,11 +31,15 @@ class CPhysicalInnerIndexNLJoin : public CPhysicalInnerNLJoin {
   // a copy of the original join predicate that has been pushed down to the inner side
   CExpression *m_origJoinPred;
 
+  // is the inner side cached per distinct value of the outer references
+  bool m_fMemoize;
+
  public:
   CPhysicalInnerIndexNLJoin(const CPhysicalInnerIndexNLJoin &) = delete;
 
   // ctor
-  CPhysicalInnerIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array, CExpression *origJoinPred);
+  CPhysicalInnerIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array, CExpression *origJoinPred,
+                            bool fMemoize = false);
 
   // dtor
   ~CPhysicalInnerIndexNLJoin() override;
@@ -52,6 +56,12 @@ class CPhysicalInnerIndexNLJoin : public CPhysicalInnerNLJoin {
   // outer column references accessor
   CColRefArray *PdrgPcrOuterRefs() const { return m_pdrgpcrOuterRefs; }
 
+  // is the inner side cached per distinct value of the outer references
+  bool FMemoize() const { return m_fMemoize; }
+
+  // debug print
+  IOstream &OsPrint(IOstream &os) const override;
+
   // execution order of children
   EChildExecOrder Eceo() const override {
     // we optimize inner (right) child first to be able to match child hashed distributions
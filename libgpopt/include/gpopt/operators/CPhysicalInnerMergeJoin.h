@@ -0,0 +1,56 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalInnerMergeJoin.h
+//
+//	@doc:
+//		Inner merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalInnerMergeJoin_H
+#define GPOPT_CPhysicalInnerMergeJoin_H
+
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalInnerMergeJoin
+//
+//	@doc:
+//		Inner merge join operator
+//
+//---------------------------------------------------------------------------
+class CPhysicalInnerMergeJoin : public CPhysicalMergeJoin {
+ public:
+  CPhysicalInnerMergeJoin(const CPhysicalInnerMergeJoin &) = delete;
+
+  // ctor
+  CPhysicalInnerMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses, CExpressionArray *inner_merge_clauses,
+                          IMdIdArray *,  // hash_opfamilies
+                          bool,          // is_null_aware
+                          CXform::EXformId origin_xform = CXform::ExfSentinel)
+      : CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses, origin_xform) {}
+
+  // dtor
+  ~CPhysicalInnerMergeJoin() override = default;
+
+  // ident accessors
+  EOperatorId Eopid() const override { return EopPhysicalInnerMergeJoin; }
+
+  // return a string for operator name
+  const char *SzId() const override { return "CPhysicalInnerMergeJoin"; }
+
+  // conversion function
+  static CPhysicalInnerMergeJoin *PopConvert(COperator *pop) {
+    GPOS_ASSERT(EopPhysicalInnerMergeJoin == pop->Eopid());
+
+    return dynamic_cast<CPhysicalInnerMergeJoin *>(pop);
+  }
+
+};  // class CPhysicalInnerMergeJoin
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CPhysicalInnerMergeJoin_H
+
+// EOF
@@ -81,6 +81,10 @@ class CPhysicalJoin : public CPhysical {
   CCTEReq *PcteRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CCTEReq *pcter, uint32_t child_index,
                         CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
 
+  // compute required parallelism of the n-th child
+  CParallelSpec *PparRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CParallelSpec *pparRequired,
+                              uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+
   // check if required columns are included in output columns
   bool FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired, uint32_t ulOptReq) const override;
 
@@ -94,10 +98,19 @@ class CPhysicalJoin : public CPhysical {
     return PosDerivePassThruOuter(exprhdl);
   }
 
+  // derive parallelism
+  CParallelSpec *PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
+
   //-------------------------------------------------------------------------------------
   // Enforced Properties
   //-------------------------------------------------------------------------------------
 
+  // return parallelism property enforcing type for this operator
+  CEnfdProp::EPropEnforcingType EpetParallelism(CExpressionHandle &exprhdl,
+                                                const CEnfdParallelism *pepar) const override {
+    return EpetParallelismPassThru(exprhdl, pepar);
+  }
+
   // return true if operator passes through stats obtained from children,
   // this is used when computing stats during costing
   bool FPassThruStats() const override { return false; }
@@ -0,0 +1,65 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalLeftAntiSemiMergeJoin.h
+//
+//	@doc:
+//		Left anti semi merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalLeftAntiSemiMergeJoin_H
+#define GPOPT_CPhysicalLeftAntiSemiMergeJoin_H
+
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalLeftAntiSemiMergeJoin
+//
+//	@doc:
+//		Left anti semi merge join operator
+//
+//---------------------------------------------------------------------------
+class CPhysicalLeftAntiSemiMergeJoin : public CPhysicalMergeJoin {
+ public:
+  CPhysicalLeftAntiSemiMergeJoin(const CPhysicalLeftAntiSemiMergeJoin &) = delete;
+
+  // ctor
+  CPhysicalLeftAntiSemiMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+                                 CExpressionArray *inner_merge_clauses,
+                                 IMdIdArray *,  // hash_opfamilies
+                                 bool,          // is_null_aware
+                                 CXform::EXformId origin_xform = CXform::ExfSentinel)
+      : CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses, origin_xform) {}
+
+  // dtor
+  ~CPhysicalLeftAntiSemiMergeJoin() override = default;
+
+  // ident accessors
+  EOperatorId Eopid() const override { return EopPhysicalLeftAntiSemiMergeJoin; }
+
+  // return a string for operator name
+  const char *SzId() const override { return "CPhysicalLeftAntiSemiMergeJoin"; }
+
+  // check if required columns are included in output columns
+  bool FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired,
+                         uint32_t  // ulOptReq
+  ) const override {
+    // left anti semi join only propagates columns from left child
+    return FOuterProvidesReqdCols(exprhdl, pcrsRequired);
+  }
+
+  // conversion function
+  static CPhysicalLeftAntiSemiMergeJoin *PopConvert(COperator *pop) {
+    GPOS_ASSERT(EopPhysicalLeftAntiSemiMergeJoin == pop->Eopid());
+
+    return dynamic_cast<CPhysicalLeftAntiSemiMergeJoin *>(pop);
+  }
+
+};  // class CPhysicalLeftAntiSemiMergeJoin
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CPhysicalLeftAntiSemiMergeJoin_H
+
+// EOF
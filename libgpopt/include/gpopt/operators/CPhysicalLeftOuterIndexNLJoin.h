@@ -19,11 +19,15 @@ class CPhysicalLeftOuterIndexNLJoin : public CPhysicalLeftOuterNLJoin {
   // a copy of the original join predicate that has been pushed down to the inner side
   CExpression *m_origJoinPred;
 
+  // is the inner side cached per distinct value of the outer references
+  bool m_fMemoize;
+
  public:
   CPhysicalLeftOuterIndexNLJoin(const CPhysicalLeftOuterIndexNLJoin &) = delete;
 
   // ctor
-  CPhysicalLeftOuterIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array, CExpression *origJoinPred);
+  CPhysicalLeftOuterIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array, CExpression *origJoinPred,
+                                bool fMemoize = false);
 
   // dtor
   ~CPhysicalLeftOuterIndexNLJoin() override;
@@ -40,6 +44,12 @@ class CPhysicalLeftOuterIndexNLJoin : public CPhysicalLeftOuterNLJoin {
   // outer column references accessor
   CColRefArray *PdrgPcrOuterRefs() const { return m_pdrgpcrOuterRefs; }
 
+  // is the inner side cached per distinct value of the outer references
+  bool FMemoize() const { return m_fMemoize; }
+
+  // debug print
+  IOstream &OsPrint(IOstream &os) const override;
+
   // execution order of children
   EChildExecOrder Eceo() const override {
     // we optimize inner (right) child first to be able to match child hashed distributions
@@ -0,0 +1,57 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalLeftOuterMergeJoin.h
+//
+//	@doc:
+//		Left outer merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalLeftOuterMergeJoin_H
+#define GPOPT_CPhysicalLeftOuterMergeJoin_H
+
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalLeftOuterMergeJoin
+//
+//	@doc:
+//		Left outer merge join operator
+//
+//---------------------------------------------------------------------------
+class CPhysicalLeftOuterMergeJoin : public CPhysicalMergeJoin {
+ public:
+  CPhysicalLeftOuterMergeJoin(const CPhysicalLeftOuterMergeJoin &) = delete;
+
+  // ctor
+  CPhysicalLeftOuterMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+                              CExpressionArray *inner_merge_clauses,
+                              IMdIdArray *,  // hash_opfamilies
+                              bool,          // is_null_aware
+                              CXform::EXformId origin_xform = CXform::ExfSentinel)
+      : CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses, origin_xform) {}
+
+  // dtor
+  ~CPhysicalLeftOuterMergeJoin() override = default;
+
+  // ident accessors
+  EOperatorId Eopid() const override { return EopPhysicalLeftOuterMergeJoin; }
+
+  // return a string for operator name
+  const char *SzId() const override { return "CPhysicalLeftOuterMergeJoin"; }
+
+  // conversion function
+  static CPhysicalLeftOuterMergeJoin *PopConvert(COperator *pop) {
+    GPOS_ASSERT(EopPhysicalLeftOuterMergeJoin == pop->Eopid());
+
+    return dynamic_cast<CPhysicalLeftOuterMergeJoin *>(pop);
+  }
+
+};  // class CPhysicalLeftOuterMergeJoin
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CPhysicalLeftOuterMergeJoin_H
+
+// EOF
@@ -0,0 +1,65 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalLeftSemiMergeJoin.h
+//
+//	@doc:
+//		Left semi merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalLeftSemiMergeJoin_H
+#define GPOPT_CPhysicalLeftSemiMergeJoin_H
+
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalLeftSemiMergeJoin
+//
+//	@doc:
+//		Left semi merge join operator
+//
+//---------------------------------------------------------------------------
+class CPhysicalLeftSemiMergeJoin : public CPhysicalMergeJoin {
+ public:
+  CPhysicalLeftSemiMergeJoin(const CPhysicalLeftSemiMergeJoin &) = delete;
+
+  // ctor
+  CPhysicalLeftSemiMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+                             CExpressionArray *inner_merge_clauses,
+                             IMdIdArray *,  // hash_opfamilies
+                             bool,          // is_null_aware
+                             CXform::EXformId origin_xform = CXform::ExfSentinel)
+      : CPhysicalMergeJoin(mp, outer_merge_clauses, inner_merge_clauses, origin_xform) {}
+
+  // dtor
+  ~CPhysicalLeftSemiMergeJoin() override = default;
+
+  // ident accessors
+  EOperatorId Eopid() const override { return EopPhysicalLeftSemiMergeJoin; }
+
+  // return a string for operator name
+  const char *SzId() const override { return "CPhysicalLeftSemiMergeJoin"; }
+
+  // check if required columns are included in output columns
+  bool FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired,
+                         uint32_t  // ulOptReq
+  ) const override {
+    // left semi join only propagates columns from left child
+    return FOuterProvidesReqdCols(exprhdl, pcrsRequired);
+  }
+
+  // conversion function
+  static CPhysicalLeftSemiMergeJoin *PopConvert(COperator *pop) {
+    GPOS_ASSERT(EopPhysicalLeftSemiMergeJoin == pop->Eopid());
+
+    return dynamic_cast<CPhysicalLeftSemiMergeJoin *>(pop);
+  }
+
+};  // class CPhysicalLeftSemiMergeJoin
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CPhysicalLeftSemiMergeJoin_H
+
+// EOF
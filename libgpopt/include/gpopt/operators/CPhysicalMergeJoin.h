@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalMergeJoin.h
+//
+//	@doc:
+//		Base merge join operator
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CPhysicalMergeJoin_H
+#define GPOPT_CPhysicalMergeJoin_H
+
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CPhysicalJoin.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+//---------------------------------------------------------------------------
+//	@class:
+//		CPhysicalMergeJoin
+//
+//	@doc:
+//		Base class for merge join operators. Both children are required to
+//		be sorted on the merge keys, ascending with nulls last; conjuncts of
+//		the join predicate that are not merge-joinable are evaluated as a
+//		join filter.
+//
+//---------------------------------------------------------------------------
+class CPhysicalMergeJoin : public CPhysicalJoin {
+ private:
+  // merge keys of the outer child
+  CExpressionArray *m_outer_merge_clauses;
+
+  // merge keys of the inner child
+  CExpressionArray *m_inner_merge_clauses;
+
+ protected:
+  // ctor
+  CPhysicalMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses, CExpressionArray *inner_merge_clauses,
+                     CXform::EXformId origin_xform);
+
+  // dtor
+  ~CPhysicalMergeJoin() override;
+
+  // sort order on the merge keys of the given child
+  COrderSpec *PosMergeKeys(CMemoryPool *mp, uint32_t child_index) const;
+
+ public:
+  CPhysicalMergeJoin(const CPhysicalMergeJoin &) = delete;
+
+  // merge keys of the outer child
+  CExpressionArray *PdrgpexprOuterKeys() const { return m_outer_merge_clauses; }
+
+  // merge keys of the inner child
+  CExpressionArray *PdrgpexprInnerKeys() const { return m_inner_merge_clauses; }
+
+  //-------------------------------------------------------------------------------------
+  // Required Plan Properties
+  //-------------------------------------------------------------------------------------
+
+  // compute required sort order of the n-th child
+  COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, COrderSpec *posInput, uint32_t child_index,
+                          CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
+
+  //-------------------------------------------------------------------------------------
+  // Enforced Properties
+  //-------------------------------------------------------------------------------------
+
+  // return order property enforcing type for this operator
+  CEnfdProp::EPropEnforcingType EpetOrder(CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
+
+  // conversion function
+  static CPhysicalMergeJoin *PopConvert(COperator *pop) {
+    GPOS_ASSERT(CUtils::FMergeJoin(pop));
+
+    return dynamic_cast<CPhysicalMergeJoin *>(pop);
+  }
+
+};  // class CPhysicalMergeJoin
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CPhysicalMergeJoin_H
+
+// EOF
@@ -61,6 +61,13 @@ class CPhysicalRightOuterHashJoin : public CPhysicalHashJoin {
                                           CPartitionPropagationSpec *pppsRequired, uint32_t child_index,
                                           CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
 
+  // compute required parallelism of the n-th child; unmatched inner rows
+  // must be emitted exactly once, so the outer side is never split
+  CParallelSpec *PparRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CParallelSpec *pparRequired,
+                              uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override {
+    return CPhysical::PparRequired(mp, exprhdl, pparRequired, child_index, pdrgpdpCtxt, ulOptReq);
+  }
+
   CPartitionPropagationSpec *PppsDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
 
 };  // class CPhysicalRightOuterHashJoin
@@ -28,10 +28,13 @@ class CPhysicalTableScan : public CPhysicalScan {
   // private copy ctor
   CPhysicalTableScan(const CPhysicalTableScan &);
 
+  // is this a parallel-aware scan, splitting the table across workers?
+  bool m_parallel{false};
+
  public:
   // ctors
   explicit CPhysicalTableScan(CMemoryPool *mp);
-  CPhysicalTableScan(CMemoryPool *, const CName *, CTableDescriptor *, CColRefArray *);
+  CPhysicalTableScan(CMemoryPool *, const CName *, CTableDescriptor *, CColRefArray *, bool parallel = false);
 
   // ident accessors
   EOperatorId Eopid() const override { return EopPhysicalTableScan; }
@@ -45,6 +48,16 @@ class CPhysicalTableScan : public CPhysicalScan {
   // match function
   bool Matches(COperator *) const override;
 
+  // parallel-aware scan?
+  bool FParallel() const { return m_parallel; }
+
+  //-------------------------------------------------------------------------------------
+  // Derived Plan Properties
+  //-------------------------------------------------------------------------------------
+
+  // derive parallelism
+  CParallelSpec *PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
+
   //-------------------------------------------------------------------------------------
   //-------------------------------------------------------------------------------------
   //-------------------------------------------------------------------------------------
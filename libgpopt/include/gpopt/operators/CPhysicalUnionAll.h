@@ -70,6 +70,17 @@ class CPhysicalUnionAll : public CPhysical {
   COrderSpec *PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, COrderSpec *posRequired, uint32_t child_index,
                           CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const override;
 
+  // compute required parallelism of the n-th child
+  CParallelSpec *PparRequired(CMemoryPool *,        // mp
+                              CExpressionHandle &,  // exprhdl
+                              CParallelSpec *pparRequired,
+                              uint32_t,          // child_index
+                              CDrvdPropArray *,  // pdrgpdpCtxt
+                              uint32_t           // ulOptReq
+  ) const override {
+    return PparPassThru(pparRequired);
+  }
+
   // conversion function
   static CPhysicalUnionAll *PopConvert(COperator *pop);
 
@@ -83,12 +94,21 @@ class CPhysicalUnionAll : public CPhysical {
   // derive sort order
   COrderSpec *PosDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
 
+  // derive parallelism
+  CParallelSpec *PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const override;
+
   //-------------------------------------------------------------------------------------
   // Enforced Properties
   //-------------------------------------------------------------------------------------
 
   // return order property enforcing type for this operator
   CEnfdProp::EPropEnforcingType EpetOrder(CExpressionHandle &exprhdl, const CEnfdOrder *peo) const override;
+
+  // return parallelism property enforcing type for this operator
+  CEnfdProp::EPropEnforcingType EpetParallelism(CExpressionHandle &exprhdl,
+                                                const CEnfdParallelism *pepar) const override {
+    return EpetParallelismPassThru(exprhdl, pepar);
+  }
 };
 }  // namespace gpopt
 
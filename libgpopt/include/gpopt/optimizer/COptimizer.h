@@ -35,6 +35,7 @@ class ICostModel;
 class COptimizerConfig;
 class CQueryContext;
 class CEnumeratorConfig;
+class IQueryToExprTranslator;
 
 //---------------------------------------------------------------------------
 //	@class:
@@ -52,6 +53,9 @@ class COptimizer {
   // optimize query in the given query context
   static CExpression *PexprOptimize(CMemoryPool *mp, CQueryContext *pqc, CSearchStageArray *search_stage_array);
 
+  // does the plan use operators that only the plan generator emits?
+  static bool FPlanGeneratorOnly(CExpression *pexprPlan);
+
   // translate an optimizer expression into a DXL tree
   static CDXLNode *CreateDXLNode(CMemoryPool *mp, CMDAccessor *md_accessor, CExpression *pexpr,
                                  CColRefArray *colref_array, CMDNameArray *pdrgpmdname);
@@ -68,6 +72,12 @@ class COptimizer {
   // Check for a plan with CTE, if both CTEProducer and CTEConsumer are executed on the same locality.
   static void CheckCTEConsistency(CMemoryPool *mp);
 
+  // optimize a translated query expression and produce the plan,
+  // must be called with the optimizer context installed
+  static void *PvOptimizeTranslated(CMemoryPool *mp, CMDAccessor *md_accessor, CExpression *pexprTranslated,
+                                    ULongPtrArray *pdrgpul, CMDNameArray *pdrgpmdname,
+                                    CSearchStageArray *search_stage_array, COptimizerConfig *optimizer_config);
+
  public:
   // main optimizer function
   static void *PdxlnOptimize(CMemoryPool *mp,
@@ -79,6 +89,15 @@ class COptimizer {
                              CSearchStageArray *search_stage_array,  // search strategy
                              COptimizerConfig *optimizer_config      // optimizer configurations
   );
+
+  // optimize a query translated directly into an expression, bypassing DXL
+  static void *PdxlnOptimize(CMemoryPool *mp,
+                             CMDAccessor *md_accessor,                 // MD accessor
+                             IQueryToExprTranslator *query_translator,  // query translator
+                             IConstExprEvaluator *pceeval,              // constant expression evaluator
+                             CSearchStageArray *search_stage_array,     // search strategy
+                             COptimizerConfig *optimizer_config         // optimizer configurations
+  );
 };  // class COptimizer
 }  // namespace gpopt
 
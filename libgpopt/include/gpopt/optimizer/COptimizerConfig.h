@@ -62,6 +62,9 @@ class COptimizerConfig : public CRefCount {
   // default window oids
   CWindowOids *m_window_oids;
 
+  // set by the engine when the planning time budget cut the search short
+  bool m_budget_exhausted{false};
+
  public:
   // ctor
   COptimizerConfig(CEnumeratorConfig *pec, CStatisticsConfig *stats_config, CCTEConfig *pcteconf, ICostModel *pcm,
@@ -88,6 +91,12 @@ class COptimizerConfig : public CRefCount {
   // hint configuration
   CHint *GetHint() const { return m_hint; }
 
+  // was the plan produced with an exhausted planning time budget
+  bool FBudgetExhausted() const { return m_budget_exhausted; }
+
+  // record that the planning time budget was exhausted
+  void SetBudgetExhausted() { m_budget_exhausted = true; }
+
   // generate default optimizer configurations
   static COptimizerConfig *PoconfDefault(CMemoryPool *mp);
 
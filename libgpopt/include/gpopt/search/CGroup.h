@@ -11,6 +11,8 @@
 #ifndef GPOPT_CGroup_H
 #define GPOPT_CGroup_H
 
+#include <atomic>
+
 #include "gpopt/base/CCostContext.h"
 #include "gpopt/base/COptimizationContext.h"
 #include "gpopt/base/CReqdPropPlan.h"
@@ -19,7 +21,8 @@
 #include "gpopt/search/CTreeMap.h"
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
-#include "gpos/common/CSyncHashtable.h"
+#include "gpos/common/CMutex.h"
+#include "gpos/common/COpenHashtable.h"
 #include "gpos/common/CSyncList.h"
 
 #define GPOPT_INVALID_GROUP_ID UINT32_MAX
@@ -65,11 +68,12 @@ enum EOptimizationLevel {
 //
 //---------------------------------------------------------------------------
 class CGroup : public CRefCount {
+  friend class CGroupExpression;
   friend class CGroupProxy;
 
  public:
   // type definition of optimization context hash table
-  using ShtOC = CSyncHashtable<COptimizationContext, COptimizationContext>;
+  using ShtOC = COpenHashtable<COptimizationContext, COptimizationContext>;
 
   // states of a group
   enum EState {
@@ -89,13 +93,13 @@ class CGroup : public CRefCount {
 
  private:
   // definition of hash table iter
-  using ShtIter = CSyncHashtableIter<COptimizationContext, COptimizationContext>;
+  using ShtIter = COpenHashtableIter<COptimizationContext, COptimizationContext>;
 
   // definition of hash table iter accessor
-  using ShtAccIter = CSyncHashtableAccessByIter<COptimizationContext, COptimizationContext>;
+  using ShtAccIter = COpenHashtableAccessByIter<COptimizationContext, COptimizationContext>;
 
   // definition of hash table accessor
-  using ShtAcc = CSyncHashtableAccessByKey<COptimizationContext, COptimizationContext>;
+  using ShtAcc = COpenHashtableAccessByKey<COptimizationContext, COptimizationContext>;
 
   //---------------------------------------------------------------------------
   //	@class:
@@ -200,10 +204,10 @@ class CGroup : public CRefCount {
   ReqdPropPlanToCostMap *m_pcostmap;
 
   // number of optimization contexts
-  uintptr_t m_ulpOptCtxts;
+  std::atomic<uintptr_t> m_ulpOptCtxts;
 
   // current state
-  EState m_estate;
+  std::atomic<EState> m_estate;
 
   // maximum optimization level of member group expressions
   EOptimizationLevel m_eolMax;
@@ -223,6 +227,10 @@ class CGroup : public CRefCount {
   // implementation job queue
   CJobQueue m_jqImplementation;
 
+  // lock protecting group expressions, properties and cached maps; held by
+  // group proxies
+  CMutex m_mutex;
+
   // cleanup optimization contexts on destruction
   void CleanupContexts();
 
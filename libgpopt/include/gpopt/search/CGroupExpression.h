@@ -61,17 +61,17 @@ class CGroupExpression : public CRefCount {
   };
 
   // type definition of cost context hash table
-  using ShtCC = CSyncHashtable<CCostContext, OPTCTXT_PTR>;
+  using ShtCC = COpenHashtable<CCostContext, OPTCTXT_PTR>;
 
  private:
   // definition of context hash table accessor
-  using ShtAcc = CSyncHashtableAccessByKey<CCostContext, OPTCTXT_PTR>;
+  using ShtAcc = COpenHashtableAccessByKey<CCostContext, OPTCTXT_PTR>;
 
   // definition of context hash table iter
-  using ShtIter = CSyncHashtableIter<CCostContext, OPTCTXT_PTR>;
+  using ShtIter = COpenHashtableIter<CCostContext, OPTCTXT_PTR>;
 
   // definition of context hash table iter accessor
-  using ShtAccIter = CSyncHashtableAccessByIter<CCostContext, OPTCTXT_PTR>;
+  using ShtAccIter = COpenHashtableAccessByIter<CCostContext, OPTCTXT_PTR>;
 
   // map of partial plans to their costs
   using PartialPlanToCostMap = CHashMap<CPartialPlan, CCost, CPartialPlan::HashValue, CPartialPlan::Equals,
@@ -306,7 +306,7 @@ class CGroupExpression : public CRefCount {
   // link for list in Group
   SLink m_linkGroup;
 
-  // link for group expression hash table
+  // link for the list of group expressions used when rehashing the memo
   SLink m_linkMemo;
 
   // invalid group expression
@@ -11,6 +11,8 @@
 #ifndef GPOPT_CJob_H
 #define GPOPT_CJob_H
 
+#include <atomic>
+
 #include "gpos/base.h"
 #include "gpos/common/CList.h"
 #include "gpos/task/ITask.h"
@@ -112,7 +114,7 @@ class CJob {
   CJobQueue *m_pjq{nullptr};
 
   // reference counter
-  uintptr_t m_ulpRefs{0};
+  std::atomic<uintptr_t> m_ulpRefs{0};
 
   // job id - set by job factory
   uint32_t m_id{0};
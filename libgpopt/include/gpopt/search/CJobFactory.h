@@ -23,6 +23,7 @@
 #include "gpopt/search/CJobTest.h"
 #include "gpopt/search/CJobTransformation.h"
 #include "gpos/base.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/common/CSyncPool.h"
 
 namespace gpopt {
@@ -80,12 +81,18 @@ class CJobFactory {
   // container for transformation jobs
   CSyncPool<CJobTransformation> *m_pspjTransformation;
 
+  // lock protecting the lazy creation of containers
+  CMutex m_mutex;
+
   // retrieve job of specific type
   template <class T>
   T *PtRetrieve(CSyncPool<T> *&pspt) {
-    if (nullptr == pspt) {
-      pspt = GPOS_NEW(m_mp) CSyncPool<T>(m_mp, m_ulJobs);
-      pspt->Init(GPOS_OFFSET(T, m_id));
+    {
+      CAutoMutex am(m_mutex);
+      if (nullptr == pspt) {
+        pspt = GPOS_NEW(m_mp) CSyncPool<T>(m_mp, m_ulJobs);
+        pspt->Init(GPOS_OFFSET(T, m_id));
+      }
     }
 
     return pspt->PtRetrieve();
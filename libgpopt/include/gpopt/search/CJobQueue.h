@@ -12,9 +12,12 @@
 #ifndef GPOPT_CJobQueue_H
 #define GPOPT_CJobQueue_H
 
+#include <atomic>
+
 #include "gpopt/search/CJob.h"
 #include "gpos/base.h"
 #include "gpos/common/CList.h"
+#include "gpos/common/CMutex.h"
 
 namespace gpopt {
 using namespace gpos;
@@ -33,11 +36,14 @@ class CJobQueue {
   CJob *m_pj{nullptr};
 
   // flag indicating if main job has completed
-  bool m_fCompleted{false};
+  std::atomic<bool> m_fCompleted{false};
 
   // list of jobs waiting for main job to complete
   CList<CJob> m_listjQueued;
 
+  // lock protecting main job and list of waiting jobs
+  CMutex m_mutex;
+
  public:
   // enum indicating job queueing result
   enum EJobQueueResult { EjqrMain = 0, EjqrQueued, EjqrCompleted };
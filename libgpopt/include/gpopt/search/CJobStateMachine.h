@@ -130,7 +130,7 @@ class CJobStateMachine {
     TEnumState estNext = estSentinel;
     do {
       // check if current search stage is timed-out
-      if (psc->Peng()->PssCurrent()->FTimedOut()) {
+      if (psc->Peng()->FStageTimedOut()) {
         // cleanup job state and terminate state machine
         pjOwner->Cleanup();
         return true;
@@ -11,12 +11,17 @@
 #ifndef GPOPT_CMemo_H
 #define GPOPT_CMemo_H
 
+#include <atomic>
+
 #include "gpopt/search/CGroupExpression.h"
 #include "gpos/base.h"
 #include "gpos/common/CRefCount.h"
-#include "gpos/common/CSyncHashtable.h"
+#include "gpos/common/COpenHashtable.h"
 #include "gpos/common/CSyncList.h"
 
+// number of shards of the memo's group expression table
+#define GPOPT_MEMO_HT_SHARDS 16
+
 namespace gpopt {
 class CGroup;
 class CDrvdProp;
@@ -41,25 +46,25 @@ using namespace gpos;
 class CMemo {
  private:
   // definition of hash table key accessor
-  using ShtAcc = CSyncHashtableAccessByKey<CGroupExpression, CGroupExpression>;
+  using ShtAcc = COpenHashtableAccessByKey<CGroupExpression, CGroupExpression>;
 
   // definition of hash table iterator
-  using ShtIter = CSyncHashtableIter<CGroupExpression, CGroupExpression>;
+  using ShtIter = COpenHashtableIter<CGroupExpression, CGroupExpression>;
 
   // definition of hash table iterator accessor
-  using ShtAccIter = CSyncHashtableAccessByIter<CGroupExpression, CGroupExpression>;
+  using ShtAccIter = COpenHashtableAccessByIter<CGroupExpression, CGroupExpression>;
 
   // memory pool
   CMemoryPool *m_mp;
 
   // id counter for groups
-  uint32_t m_aul;
+  std::atomic<uint32_t> m_aul;
 
   // root group
   CGroup *m_pgroupRoot;
 
   // number of groups
-  uintptr_t m_ulpGrps;
+  std::atomic<uintptr_t> m_ulpGrps;
 
   // tree map of member group expressions
   MemoTreeMap *m_pmemotmap;
@@ -68,7 +73,7 @@ class CMemo {
   CSyncList<CGroup> m_listGroups;
 
   // hashtable of all group expressions
-  CSyncHashtable<CGroupExpression,  // entry
+  COpenHashtable<CGroupExpression,  // entry
                  CGroupExpression>
       m_sht;
 
@@ -11,9 +11,14 @@
 #ifndef GPOPT_CScheduler_H
 #define GPOPT_CScheduler_H
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include "gpopt/search/CJob.h"
 #include "gpos/base.h"
-#include "gpos/common/CSyncList.h"
+#include "gpos/common/CList.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/common/CSyncPool.h"
 
 #define OPT_SCHED_QUEUED_RUNNING_RATIO 10
@@ -49,6 +54,12 @@ class CSchedulerContext;
 //		complete. At this point, a queued job can be terminated if it does not
 //		have any further dependencies.
 //
+//		Every worker running the scheduler owns a queue of runnable jobs.
+//		Jobs scheduled by a worker go to the head of its own queue and are
+//		picked from there, so a single worker executes jobs depth-first. A
+//		worker whose queue is empty steals the oldest job of another queue;
+//		these sit closest to the root of the search and carry the most work.
+//
 //---------------------------------------------------------------------------
 class CScheduler {
   // friend classes
@@ -83,24 +94,53 @@ class CScheduler {
     }
   };
 
-  // list of jobs waiting to execute
-  CSyncList<SJobLink> m_listjlWaiting;
+  // queue of jobs waiting to execute, owned by one worker
+  struct SJobQueue {
+    // waiting jobs, most recent first
+    CList<SJobLink> m_listjl;
+
+    // lock protecting the list
+    CMutex m_mutex;
+  };
+
+  // memory pool
+  CMemoryPool *m_mp;
+
+  // queues of waiting jobs, one per worker
+  SJobQueue *m_rgjq;
+
+  // number of queues
+  const uint32_t m_ulQueues;
+
+  // next queue to hand out to a worker
+  std::atomic<uint32_t> m_ulNextQueue;
+
+  // queue owned by the worker of the current thread
+  static thread_local uint32_t m_ulCurrentQueue;
 
   // pool of job link objects
   CSyncPool<SJobLink> m_spjl;
 
+  // idle workers wait here until a job is queued or all jobs have completed
+  std::mutex m_mutexIdle;
+  std::condition_variable m_condIdle;
+
+  // number of idle workers
+  std::atomic<uint32_t> m_ulIdle;
+
   // current job counters
-  uintptr_t m_ulpTotal;
-  uintptr_t m_ulpRunning;
-  uintptr_t m_ulpQueued;
+  std::atomic<uintptr_t> m_ulpTotal;
+  std::atomic<uintptr_t> m_ulpRunning;
+  std::atomic<uintptr_t> m_ulpQueued;
 
   // stats
-  uintptr_t m_ulpStatsQueued;
-  uintptr_t m_ulpStatsDequeued;
-  uintptr_t m_ulpStatsSuspended;
-  uintptr_t m_ulpStatsCompleted;
-  uintptr_t m_ulpStatsCompletedQueued;
-  uintptr_t m_ulpStatsResumed;
+  std::atomic<uintptr_t> m_ulpStatsQueued;
+  std::atomic<uintptr_t> m_ulpStatsDequeued;
+  std::atomic<uintptr_t> m_ulpStatsSuspended;
+  std::atomic<uintptr_t> m_ulpStatsCompleted;
+  std::atomic<uintptr_t> m_ulpStatsCompletedQueued;
+  std::atomic<uintptr_t> m_ulpStatsResumed;
+  std::atomic<uintptr_t> m_ulpStatsStolen;
 
 #ifdef GPOS_DEBUG
   // list of running jobs
@@ -123,9 +163,18 @@ class CScheduler {
   // retrieve next job to run
   CJob *PjRetrieve();
 
+  // queue owned by the worker of the current thread
+  SJobQueue &JqCurrent() const { return m_rgjq[m_ulCurrentQueue % m_ulQueues]; }
+
   // schedule job for execution
   void Schedule(CJob *pj);
 
+  // wait for jobs to be queued by other workers
+  void WaitForJobs();
+
+  // wake up idle workers
+  void WakeIdle(bool fAll);
+
   // prepare for job execution
   void PreExecute(CJob *pj);
 
@@ -146,7 +195,7 @@ class CScheduler {
 
  public:
   // ctor
-  CScheduler(CMemoryPool *mp, uint32_t ulJobs
+  CScheduler(CMemoryPool *mp, uint32_t ulJobs, uint32_t ulWorkers = 1
 #ifdef GPOS_DEBUG
              ,
              bool fTrackingJobs = true
@@ -14,7 +14,7 @@
 #include "gpopt/xforms/CXform.h"
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
-#include "gpos/common/CTimerUser.h"
+#include "gpos/common/CWallClock.h"
 
 namespace gpopt {
 using namespace gpos;
@@ -52,7 +52,7 @@ class CSearchStage {
   CCost m_costBest;
 
   // elapsed time
-  CTimerUser m_timer;
+  CWallClock m_timer;
 
  public:
   // ctor
@@ -107,6 +107,9 @@ class CSearchStage {
 
   // generate default search strategy
   static CSearchStageArray *PdrgpssDefault(CMemoryPool *mp);
+
+  // generate search strategy from its JSON description
+  static CSearchStageArray *PdrgpssParse(CMemoryPool *mp, const char *szStrategy);
 };
 
 // shorthand for printing
@@ -0,0 +1,51 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		IQueryToExprTranslator.h
+//
+//	@doc:
+//		Interface for translators producing the optimizer's input expression
+//		straight from the host's query representation
+//---------------------------------------------------------------------------
+
+#ifndef GPOPT_IQueryToExprTranslator_H
+#define GPOPT_IQueryToExprTranslator_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDynamicPtrArray.h"
+#include "naucrates/md/CMDName.h"
+
+namespace gpopt {
+using namespace gpos;
+
+class CExpression;  // forward declaration
+
+//---------------------------------------------------------------------------
+//	@class:
+//		IQueryToExprTranslator
+//
+//	@doc:
+//		Translates a query into a logical expression without going through
+//		DXL. The translation is invoked by the optimizer once the optimizer
+//		context is installed, so implementations may use the column factory.
+//		Output arrays stay owned by the translator.
+//
+//---------------------------------------------------------------------------
+class IQueryToExprTranslator {
+ public:
+  // dtor
+  virtual ~IQueryToExprTranslator() = default;
+
+  // translate the query, caller takes ownership of returned expression
+  virtual CExpression *PexprTranslateQuery() = 0;
+
+  // ids of the column references making up the query output
+  virtual ULongPtrArray *PdrgpulOutputColRefs() = 0;
+
+  // names of the query output columns
+  virtual gpmd::CMDNameArray *Pdrgpmdname() = 0;
+};
+}  // namespace gpopt
+
+#endif  // !GPOPT_IQueryToExprTranslator_H
+
+// EOF
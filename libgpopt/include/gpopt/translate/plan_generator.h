@@ -14,6 +14,7 @@ class List;
 class Node;
 class Expr;
 class Var;
+class Param;
 class Const;
 class TargetEntry;
 
@@ -21,6 +22,15 @@ namespace gpnaucrates {
 class IDatum;
 }
 
+namespace gpmd {
+class IMDIndex;
+class IMDRelation;
+}  // namespace gpmd
+
+namespace gpdxl {
+class CDXLNode;
+}
+
 namespace gpopt {
 
 using plan_node_id_t = uint32_t;
@@ -31,9 +41,22 @@ class CTableDescriptor;
 class CColRefSet;
 
 struct PlanResult {
-  Plan *plan;
-  List *rtable;
-  List *relationOids;
+  Plan *plan{nullptr};
+  List *rtable{nullptr};
+  List *relationOids{nullptr};
+
+  // the plan contains a Gather, PlannedStmt::parallelModeNeeded
+  bool parallel_mode_needed{false};
+
+  // types of the PARAM_EXEC params of the plan, PlannedStmt::paramExecTypes
+  List *param_exec_types{nullptr};
+
+  // plans of the CTE producers, PlannedStmt::subplans
+  List *subplans{nullptr};
+
+  // set instead of plan when the generator hit an operator it does not
+  // handle and the plan was translated to DXL instead
+  gpdxl::CDXLNode *dxl_plan{nullptr};
 };
 
 struct TranslateContextBaseTable {
@@ -79,9 +102,48 @@ class PlanGenerator {
   Plan *GenerateComputeScalarPlan(PlanGeneratorContext *ctx);
   Plan *GenerateConstTableGetPlan(PlanGeneratorContext *ctx);
   Plan *GenerateCorrelatedNLJoinPlan(PlanGeneratorContext *ctx);
+  Plan *GenerateIndexOnlyScanPlan(PlanGeneratorContext *ctx);
+  Plan *GenerateBitmapTableScanPlan(PlanGeneratorContext *ctx);
+  Plan *GenerateMergeJoinPlan(PlanGeneratorContext *ctx);
+  Plan *GenerateWindowPlan(PlanGeneratorContext *ctx);
+  Plan *GenerateGatherPlan(PlanGeneratorContext *ctx);
+  Plan *GenerateForeignScanPlan(PlanGeneratorContext *ctx);
+  Plan *GenerateSequencePlan(PlanGeneratorContext *ctx);
+  Plan *GenerateCTEConsumerPlan(PlanGeneratorContext *ctx);
+
+  /**
+   * Register the plan of a CTE producer as a subplan that the CteScans of its
+   * consumers read from
+   */
+  void GenerateCTEProducerPlan(CExpression *expr);
+
+  /**
+   * Result node evaluating the filter and project list of the context on top
+   * of a child that cannot absorb them
+   */
+  Plan *GenerateResultPlan(PlanGeneratorContext *ctx);
+
+  Plan *GenerateBitmapAccessPathPlan(CExpression *expr, const gpmd::IMDRelation *md_rel, uint32_t scanrelid);
+
+  /**
+   * Material node on top of the inner side of a merge join, unless the plan
+   * can mark and restore its scan position itself
+   */
+  Plan *MaterializeForMarkRestore(Plan *plan);
+
+  /**
+   * Memoize node caching the inner side of an index nested loop join on the
+   * values of its outer references, whose params must be set up already
+   */
+  Plan *GenerateMemoizePlan(Plan *inner_plan, CExpression *outer, CColRefArray *keys);
 
   plan_node_id_t GetNextPlanNodeID() { return plan_id_counter_++; }
 
+  /**
+   * Allocate a PARAM_EXEC param of the given type
+   */
+  uint32_t GetNextParamId(uint32_t type_oid);
+
   /**
    * The required output property. Note that we have previously enforced
    * properties so this is fulfilled by the current operator
@@ -99,6 +161,13 @@ class PlanGenerator {
   List *GeneratePlanTargetList(uint32_t varno, const CColRefSet *pcrsOutput, CColRefArray *colref_array,
                                bool base_table = false);
 
+  // append the project list pushed down into a scan to its target list
+  void GenerateProjectTargets(Plan *plan, CExpression *pexprProjList);
+
+  void TranslateIndexConditions(CExpression *index_cond, const gpmd::IMDIndex *md_index,
+                                const gpmd::IMDRelation *md_rel, bool is_bitmap_index_probe, List **index_qual,
+                                List **index_qual_orig);
+
   Expr *TransExpr(CExpression *expr);
   List *TransExprList(CExpression *expr);
 
@@ -107,6 +176,12 @@ class PlanGenerator {
   Expr *PdxlnExistentialSubplan(CColRefArray *pdrgpcrInner, CExpression *expr, CColRefSet *outer_refs);
 
   Var *CreateVar(CColRef *colref);
+
+  /**
+   * Param passing the value of an outer reference to the inner side of an
+   * index nested loop join
+   */
+  Param *CreateNestParam(const CColRef *colref, uint32_t param_id);
   Const *CreateConstFromItem(gpnaucrates::IDatum *item);
 
   auto GetChildTarget(uint32_t colid) {
@@ -131,11 +206,52 @@ class PlanGenerator {
   List *rtable_{nullptr};
   List *relationOids_{nullptr};
 
+  /**
+   * Set once a Gather or Gather Merge has been generated
+   */
+  bool parallel_mode_needed_{false};
+
+  /**
+   * Set while the child of a Gather is being generated
+   */
+  bool in_parallel_{false};
+
   /**
    * Plan node counter, used to generate plan node ids
    */
   plan_node_id_t plan_id_counter_{0};
 
+  /**
+   * Types of the PARAM_EXEC params allocated so far, indexed by param id
+   */
+  List *param_exec_types_{nullptr};
+
+  /**
+   * Plans of the CTE producers, indexed by plan id - 1, and the initplans
+   * attached to the top of the plan for them
+   */
+  List *subplans_{nullptr};
+  List *cte_init_plans_{nullptr};
+
+  struct CTEPlan {
+    int plan_id;
+    int param_id;
+    List *targetlist;
+    // attribute of each column of the producer in its plan
+    std::vector<int> attnos;
+  };
+
+  /**
+   * Subplan and param shared by the CteScans of a CTE, by CTE id
+   */
+  std::unordered_map<uint32_t, CTEPlan> cte_plans_;
+
+  /**
+   * Params of the outer references of the index nested loop joins whose
+   * inner side is being generated, by column id
+   */
+  std::unordered_map<uint32_t, uint32_t> nest_param_ids_;
+
   CMemoryPool *m_mp;
 
   TranslateContextBaseTable *translate_ctxt_base_table_{nullptr};
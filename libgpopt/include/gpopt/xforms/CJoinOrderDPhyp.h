@@ -0,0 +1,231 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CJoinOrderDPhyp.h
+//
+//	@doc:
+//		Join order generation by dynamic programming over the connected
+//		subgraphs of the join hypergraph
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CJoinOrderDPhyp_H
+#define GPOPT_CJoinOrderDPhyp_H
+
+#include "gpopt/operators/CExpression.h"
+#include "gpopt/xforms/CJoinOrder.h"
+#include "gpos/base.h"
+#include "gpos/common/CHashIndex.h"
+#include "gpos/io/IOstream.h"
+
+namespace gpopt {
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CJoinOrderDPhyp
+//
+//	@doc:
+//		Helper class for creating join orders with the DPhyp algorithm:
+//		only pairs of connected subgraphs that are connected to each other
+//		(csg-cmp pairs) are enumerated, so that no cross products are
+//		considered and each pair is visited once.
+//
+//		Sets of atoms are 64-bit masks and the DP table is a flat array of
+//		plans indexed by CHashIndex. Predicates over more than two atoms
+//		and the ON predicates of left outer joins are hyperedges; the right
+//		child of a left outer join is only ever joined as a single atom to
+//		a set producing all the columns of its ON predicate, as in DPv2.
+//		Disconnected parts of the graph are joined by cross products once
+//		they are complete.
+//
+//		Graphs with more atoms than optimizer_join_order_threshold are only
+//		enumerated if they have no more connected subgraphs than a join of
+//		that many atoms could have; otherwise, and when enumeration gives
+//		up, the sets with the fewest rows are joined greedily.
+//
+//---------------------------------------------------------------------------
+class CJoinOrderDPhyp : public CJoinOrder {
+ public:
+  // set of atoms, one bit per atom
+  using Mask = uint64_t;
+
+  // maximum number of atoms
+  static const uint32_t MaxAtoms = 64;
+
+ private:
+  //---------------------------------------------------------------------------
+  //	@struct:
+  //		SHyperedge
+  //
+  //	@doc:
+  //		Edge of the join graph between two sets of atoms with at least
+  //		one of them holding more than one atom
+  //
+  //---------------------------------------------------------------------------
+  struct SHyperedge {
+    // atoms on either side
+    Mask m_left;
+    Mask m_right;
+  };
+
+  //---------------------------------------------------------------------------
+  //	@struct:
+  //		SPlan
+  //
+  //	@doc:
+  //		Entry of the DP table, the cheapest join found for a set of atoms
+  //
+  //---------------------------------------------------------------------------
+  struct SPlan {
+    // atoms joined
+    Mask m_atoms;
+
+    // plans joined, UINT32_MAX for an atom
+    uint32_t m_left;
+    uint32_t m_right;
+
+    // estimated number of rows
+    double m_rows;
+
+    // cost of the cheapest join
+    double m_cost;
+
+    // join of the first pair found, carries the stats of the set
+    CExpression *m_pexpr;
+  };
+
+  // number of plans after which enumeration stops
+  static const uint32_t MaxPlans = 1 << 16;
+
+  // neighbors of each atom over simple edges
+  Mask *m_neighbors;
+
+  // hyperedges
+  SHyperedge *m_hyperedges;
+
+  // number of hyperedges
+  uint32_t m_num_hyperedges;
+
+  // atoms covered by each edge of the base class
+  Mask *m_edge_atoms;
+
+  // right children of left outer joins
+  Mask m_loj_right_atoms;
+
+  // index of the ON predicate edge of each right child of a left outer join
+  uint32_t *m_loj_edges;
+
+  // DP table
+  SPlan *m_plans;
+
+  // number of plans
+  uint32_t m_num_plans;
+
+  // index over the DP table
+  CHashIndex m_index;
+
+  // was enumeration cut short by MaxPlans
+  bool m_exhausted;
+
+  // bit of given atom
+  static Mask Bit(uint32_t atom) { return (Mask)1 << atom; }
+
+  // lowest atom of a non-empty set
+  static Mask Lowest(Mask atoms) { return atoms & (0 - atoms); }
+
+  // atoms with index up to and including given atom
+  static Mask Prefix(uint32_t atom) { return ((Mask)2 << atom) - 1; }
+
+  // is the set the right child of a left outer join alone
+  bool FLojRightAtom(Mask atoms) const { return 0 == (atoms & (atoms - 1)) && 0 != (atoms & m_loj_right_atoms); }
+
+  // hash of a set of atoms
+  static uint32_t HashValue(Mask atoms) { return CombineHashes((uint32_t)atoms, (uint32_t)(atoms >> 32)); }
+
+  // add an edge between two sets of atoms
+  void AddEdge(Mask left, Mask right);
+
+  // connect the parts of the graph with edges that become cross products
+  void AddCrossProductEdges();
+
+  // atoms adjacent to a set, excluding given ones
+  Mask Neighborhood(Mask atoms, Mask excluded) const;
+
+  // is there an edge between two disjoint sets
+  bool FConnected(Mask fst, Mask snd) const;
+
+  // plan for given set of atoms, UINT32_MAX if there is none
+  uint32_t Lookup(Mask atoms) const;
+
+  // add plan for a set of atoms not in the DP table yet
+  uint32_t AddPlan(Mask atoms, uint32_t left, uint32_t right, CExpression *pexpr);
+
+  // predicate joining two sets, marking the inner join edges used
+  CExpression *PexprPred(Mask left, Mask right, CBitSet *used_edges);
+
+  // join of two expressions for sets of atoms
+  CExpression *PexprJoin(Mask left, Mask right, CExpression *pexprLeft, CExpression *pexprRight,
+                         CBitSet *used_edges);
+
+  // can the first set be the outer and the second set the inner side of a join
+  bool FValidJoin(Mask left, Mask right) const;
+
+  // add plan joining two sets, whose union is not in the DP table yet
+  uint32_t AddJoin(Mask left, Mask right, uint32_t ulLeft, uint32_t ulRight);
+
+  // consider joining two disjoint connected subgraphs
+  void EmitCsgCmp(Mask fst, Mask snd);
+
+  // find the complements of a connected subgraph
+  void EmitCsg(Mask atoms);
+
+  // grow a connected subgraph
+  void EnumerateCsgRec(Mask atoms, Mask excluded);
+
+  // grow a complement of a connected subgraph
+  void EnumerateCmpRec(Mask csg, Mask atoms, Mask excluded);
+
+  // count the connected subgraphs grown from the given one, up to a limit
+  void CountCsgRec(Mask atoms, Mask excluded, uint32_t limit, uint32_t *count) const;
+
+  // is the graph small enough to enumerate its connected subgraphs
+  bool FEnumerate() const;
+
+  // plan for the union of two disjoint sets, UINT32_MAX if they cannot be joined
+  uint32_t UlGreedyPlan(Mask fst, Mask snd);
+
+  // join the sets with the fewest rows first
+  CExpression *PexprGreedy(CBitSet *used_edges);
+
+  // expression for the best join order of a plan
+  CExpression *PexprBuild(uint32_t plan, CBitSet *used_edges);
+
+  // join the atoms in their order in the query
+  CExpression *PexprQueryOrder(CBitSet *used_edges);
+
+  // add a select with the predicates not used by a join
+  CExpression *PexprAddRemainingEdges(CExpression *pexpr, CBitSet *used_edges);
+
+ public:
+  CJoinOrderDPhyp(const CJoinOrderDPhyp &) = delete;
+
+  // ctor
+  CJoinOrderDPhyp(CMemoryPool *mp, CExpressionArray *pdrgpexprAtoms, CExpressionArray *innerJoinConjuncts,
+                  CExpressionArray *onPredConjuncts, ULongPtrArray *childPredIndexes);
+
+  // dtor
+  ~CJoinOrderDPhyp() override;
+
+  // main handler
+  CExpression *PexprExpand();
+
+  // print function
+  IOstream &OsPrint(IOstream &) const;
+
+  CXform::EXformId EOriginXForm() const override { return CXform::ExfExpandNAryJoinDPhyp; }
+
+};  // class CJoinOrderDPhyp
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CJoinOrderDPhyp_H
+
+// EOF
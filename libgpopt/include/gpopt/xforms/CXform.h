@@ -207,6 +207,11 @@ class CXform : public CRefCount {
     ExfLimit2IndexOnlyGet,
     ExfFullOuterJoin2HashJoin,
     ExfFullJoinCommutativity,
+    ExfInnerJoin2MergeJoin,
+    ExfLeftOuterJoin2MergeJoin,
+    ExfLeftSemiJoin2MergeJoin,
+    ExfLeftAntiSemiJoin2MergeJoin,
+    ExfExpandNAryJoinDPhyp,
     ExfInvalid,
     ExfSentinel = ExfInvalid
   };
@@ -301,6 +306,9 @@ class CXform : public CRefCount {
   // returns a set containing xforms to use for exhaustive2 join order
   static CBitSet *PbsJoinOrderOnExhaustive2Xforms(CMemoryPool *mp);
 
+  // returns a set containing xforms to use for DPhyp join order
+  static CBitSet *PbsJoinOrderOnDPhypXforms(CMemoryPool *mp);
+
   // return true if xform should be applied only once.
   // for expression of type CPatternTree, in deep trees, the number
   // of expressions generated for group expression can be significantly
@@ -0,0 +1,59 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CXformExpandNAryJoinDPhyp.h
+//
+//	@doc:
+//		Expand n-ary join into series of binary joins using dynamic
+//		programming over connected subgraphs
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformExpandNAryJoinDPhyp_H
+#define GPOPT_CXformExpandNAryJoinDPhyp_H
+
+#include "gpopt/xforms/CXformExploration.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformExpandNAryJoinDPhyp
+//
+//	@doc:
+//		Expand n-ary join into series of binary joins using dynamic
+//		programming over connected subgraphs, see CJoinOrderDPhyp
+//
+//---------------------------------------------------------------------------
+class CXformExpandNAryJoinDPhyp : public CXformExploration {
+ private:
+ public:
+  CXformExpandNAryJoinDPhyp(const CXformExpandNAryJoinDPhyp &) = delete;
+
+  // ctor
+  explicit CXformExpandNAryJoinDPhyp(CMemoryPool *mp);
+
+  // dtor
+  ~CXformExpandNAryJoinDPhyp() override = default;
+
+  // ident accessors
+  EXformId Exfid() const override { return ExfExpandNAryJoinDPhyp; }
+
+  // return a string for xform name
+  const char *SzId() const override { return "CXformExpandNAryJoinDPhyp"; }
+
+  // compute xform promise for a given expression handle
+  EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+  // do stats need to be computed before applying xform?
+  bool FNeedsStats() const override { return true; }
+
+  // actual transform
+  void Transform(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr) const override;
+
+};  // class CXformExpandNAryJoinDPhyp
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CXformExpandNAryJoinDPhyp_H
+
+// EOF
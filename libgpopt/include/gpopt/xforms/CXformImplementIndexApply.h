@@ -21,6 +21,35 @@ using namespace gpos;
 
 class CXformImplementIndexApply : public CXformImplementation {
  private:
+  // can the inner side be cached on the given outer references, the cache
+  // is a hash table keyed by their values
+  static bool FMemoizable(CColRefArray *colref_array) {
+    if (GPOS_FTRACE(EopttraceDisableMemoize) || 0 == colref_array->Size()) {
+      return false;
+    }
+
+    for (uint32_t ul = 0; ul < colref_array->Size(); ul++) {
+      const IMDType *pmdtype = (*colref_array)[ul]->RetrieveType();
+      if (!pmdtype->IsHashable() || !IMDId::IsValid(pmdtype->GetMdidForCmpType(IMDType::EcmptEq))) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  // index nested loop join on the outer references of the index apply
+  static CPhysicalNLJoin *PopIndexNLJoin(CMemoryPool *mp, CLogicalIndexApply *indexApply, bool fMemoize) {
+    CColRefArray *colref_array = indexApply->PdrgPcrOuterRefs();
+    colref_array->AddRef();
+
+    if (indexApply->FouterJoin()) {
+      return GPOS_NEW(mp) CPhysicalLeftOuterIndexNLJoin(mp, colref_array, indexApply->OrigJoinPred(), fMemoize);
+    }
+
+    return GPOS_NEW(mp) CPhysicalInnerIndexNLJoin(mp, colref_array, indexApply->OrigJoinPred(), fMemoize);
+  }
+
  public:
   CXformImplementIndexApply(const CXformImplementIndexApply &) = delete;
 
@@ -62,8 +91,6 @@ class CXformImplementIndexApply : public CXformImplementation {
     CExpression *pexprOuter = (*pexpr)[0];
     CExpression *pexprInner = (*pexpr)[1];
     CExpression *pexprScalar = (*pexpr)[2];
-    CColRefArray *colref_array = indexApply->PdrgPcrOuterRefs();
-    colref_array->AddRef();
 
     // addref all components
     pexprOuter->AddRef();
@@ -71,18 +98,22 @@ class CXformImplementIndexApply : public CXformImplementation {
     pexprScalar->AddRef();
 
     // assemble physical operator
-    CPhysicalNLJoin *pop = nullptr;
-
-    if (CLogicalIndexApply::PopConvert(pexpr->Pop())->FouterJoin()) {
-      pop = GPOS_NEW(mp) CPhysicalLeftOuterIndexNLJoin(mp, colref_array, indexApply->OrigJoinPred());
-    } else {
-      pop = GPOS_NEW(mp) CPhysicalInnerIndexNLJoin(mp, colref_array, indexApply->OrigJoinPred());
-    }
-
-    CExpression *pexprResult = GPOS_NEW(mp) CExpression(mp, pop, pexprOuter, pexprInner, pexprScalar);
+    CExpression *pexprResult = GPOS_NEW(mp)
+        CExpression(mp, PopIndexNLJoin(mp, indexApply, false /*fMemoize*/), pexprOuter, pexprInner, pexprScalar);
 
     // add alternative to results
     pxfres->Add(pexprResult);
+
+    // alternative caching the inner side, the cost model decides whether
+    // the outer references repeat often enough for that to pay off
+    if (FMemoizable(indexApply->PdrgPcrOuterRefs())) {
+      pexprOuter->AddRef();
+      pexprInner->AddRef();
+      pexprScalar->AddRef();
+      CExpression *pexprMemoize = GPOS_NEW(mp)
+          CExpression(mp, PopIndexNLJoin(mp, indexApply, true /*fMemoize*/), pexprOuter, pexprInner, pexprScalar);
+      pxfres->Add(pexprMemoize);
+    }
   }
 
 };  // class CXformImplementIndexApply
@@ -0,0 +1,54 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CXformLeftAntiSemiJoin2MergeJoin.h
+//
+//	@doc:
+//		Transform left anti semi join to left anti semi merge join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformLeftAntiSemiJoin2MergeJoin_H
+#define GPOPT_CXformLeftAntiSemiJoin2MergeJoin_H
+
+#include "gpopt/xforms/CXformImplementation.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformLeftAntiSemiJoin2MergeJoin
+//
+//	@doc:
+//		Transform left anti semi join to left anti semi merge join
+//
+//---------------------------------------------------------------------------
+class CXformLeftAntiSemiJoin2MergeJoin : public CXformImplementation {
+ private:
+ public:
+  CXformLeftAntiSemiJoin2MergeJoin(const CXformLeftAntiSemiJoin2MergeJoin &) = delete;
+
+  // ctor
+  explicit CXformLeftAntiSemiJoin2MergeJoin(CMemoryPool *mp);
+
+  // dtor
+  ~CXformLeftAntiSemiJoin2MergeJoin() override = default;
+
+  // ident accessors
+  EXformId Exfid() const override { return ExfLeftAntiSemiJoin2MergeJoin; }
+
+  // return a string for xform name
+  const char *SzId() const override { return "CXformLeftAntiSemiJoin2MergeJoin"; }
+
+  // compute xform promise for a given expression handle
+  EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+  // actual transform
+  void Transform(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr) const override;
+
+};  // class CXformLeftAntiSemiJoin2MergeJoin
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CXformLeftAntiSemiJoin2MergeJoin_H
+
+// EOF
@@ -0,0 +1,54 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CXformLeftSemiJoin2MergeJoin.h
+//
+//	@doc:
+//		Transform left semi join to left semi merge join
+//---------------------------------------------------------------------------
+#ifndef GPOPT_CXformLeftSemiJoin2MergeJoin_H
+#define GPOPT_CXformLeftSemiJoin2MergeJoin_H
+
+#include "gpopt/xforms/CXformImplementation.h"
+#include "gpos/base.h"
+
+namespace gpopt {
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CXformLeftSemiJoin2MergeJoin
+//
+//	@doc:
+//		Transform left semi join to left semi merge join
+//
+//---------------------------------------------------------------------------
+class CXformLeftSemiJoin2MergeJoin : public CXformImplementation {
+ private:
+ public:
+  CXformLeftSemiJoin2MergeJoin(const CXformLeftSemiJoin2MergeJoin &) = delete;
+
+  // ctor
+  explicit CXformLeftSemiJoin2MergeJoin(CMemoryPool *mp);
+
+  // dtor
+  ~CXformLeftSemiJoin2MergeJoin() override = default;
+
+  // ident accessors
+  EXformId Exfid() const override { return ExfLeftSemiJoin2MergeJoin; }
+
+  // return a string for xform name
+  const char *SzId() const override { return "CXformLeftSemiJoin2MergeJoin"; }
+
+  // compute xform promise for a given expression handle
+  EXformPromise Exfp(CExpressionHandle &exprhdl) const override;
+
+  // actual transform
+  void Transform(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr) const override;
+
+};  // class CXformLeftSemiJoin2MergeJoin
+
+}  // namespace gpopt
+
+#endif  // !GPOPT_CXformLeftSemiJoin2MergeJoin_H
+
+// EOF
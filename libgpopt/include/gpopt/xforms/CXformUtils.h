@@ -202,6 +202,11 @@ class CXformUtils {
   template <class T>
   static void ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr);
 
+  // helper function for implementation of merge joins that evaluate
+  // conjuncts which are not merge-joinable as a join filter
+  template <class T>
+  static void ImplementMergeJoinWithFilter(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr);
+
   // helper function for implementation of nested loops joins
   template <class T>
   static void ImplementNLJoin(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr);
@@ -687,6 +692,66 @@ void CXformUtils::ImplementMergeJoin(CXformContext *pxfctxt, CXformResult *pxfre
   pexprResult->Release();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformUtils::ImplementMergeJoinWithFilter
+//
+//	@doc:
+//		Helper function for implementation of inner, left outer, semi and
+//		anti semi merge joins; unlike full merge joins these may evaluate
+//		the conjuncts that are not merge-joinable as a join filter, so an
+//		alternative is added as soon as one merge-joinable conjunct exists.
+//		The join keys cached on the scalar child are not used: they are
+//		shared with hash joins, whose keys need not be merge-joinable.
+//
+//---------------------------------------------------------------------------
+template <class T>
+void CXformUtils::ImplementMergeJoinWithFilter(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr) {
+  GPOS_ASSERT(nullptr != pxfctxt);
+
+  // if there are outer references, then we cannot build a merge join
+  if (CUtils::HasOuterRefs(pexpr)) {
+    return;
+  }
+
+  CMemoryPool *mp = pxfctxt->Pmp();
+  CExpression *pexprOuter = (*pexpr)[0];
+  CExpression *pexprInner = (*pexpr)[1];
+  CExpression *pexprScalar = (*pexpr)[2];
+
+  CExpressionArray *pdrgpexprOuter = GPOS_NEW(mp) CExpressionArray(mp);
+  CExpressionArray *pdrgpexprInner = GPOS_NEW(mp) CExpressionArray(mp);
+
+  CExpressionArray *pdrgpexpr = CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
+  const uint32_t ulPreds = pdrgpexpr->Size();
+  for (uint32_t ul = 0; ul < ulPreds; ul++) {
+    CExpression *pexprPred = (*pdrgpexpr)[ul];
+    if (CPhysicalJoin::FMergeJoinCompatible(pexprPred, pexprOuter, pexprInner)) {
+      CExpression *pexprPredInner;
+      CExpression *pexprPredOuter;
+      IMDId *mdid_scop;
+      CPhysicalJoin::AlignJoinKeyOuterInner(pexprPred, pexprOuter, pexprInner, &pexprPredOuter, &pexprPredInner,
+                                            &mdid_scop);
+
+      pexprPredInner->AddRef();
+      pexprPredOuter->AddRef();
+      pdrgpexprOuter->Append(pexprPredOuter);
+      pdrgpexprInner->Append(pexprPredInner);
+    }
+  }
+  pdrgpexpr->Release();
+  GPOS_ASSERT(pdrgpexprInner->Size() == pdrgpexprOuter->Size());
+
+  // Add an alternative only if we found at least one merge-joinable predicate
+  if (0 != pdrgpexprOuter->Size()) {
+    AddHashOrMergeJoinAlternative<T>(mp, pexpr, pdrgpexprOuter, pdrgpexprInner, nullptr /* opfamilies */, pxfres,
+                                     false /*is_hash_join_null_aware*/);
+  } else {
+    pdrgpexprOuter->Release();
+    pdrgpexprInner->Release();
+  }
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CXformUtils::ImplementNLJoin
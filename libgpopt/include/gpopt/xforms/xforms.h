@@ -32,6 +32,7 @@
 #include "gpopt/xforms/CXformExpandFullOuterJoin.h"
 #include "gpopt/xforms/CXformExpandNAryJoin.h"
 #include "gpopt/xforms/CXformExpandNAryJoinDP.h"
+#include "gpopt/xforms/CXformExpandNAryJoinDPhyp.h"
 #include "gpopt/xforms/CXformExpandNAryJoinDPv2.h"
 #include "gpopt/xforms/CXformExpandNAryJoinGreedy.h"
 #include "gpopt/xforms/CXformExpandNAryJoinMinCard.h"
@@ -74,6 +75,7 @@
 #include "gpopt/xforms/CXformInnerApply2InnerJoin.h"
 #include "gpopt/xforms/CXformInnerApply2InnerJoinNoCorrelations.h"
 #include "gpopt/xforms/CXformInnerApplyWithOuterKey2InnerJoin.h"
+#include "gpopt/xforms/CXformInnerJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinNotInSwap.h"
 #include "gpopt/xforms/CXformInnerJoinAntiSemiJoinSwap.h"
 #include "gpopt/xforms/CXformInnerJoinCommutativity.h"
@@ -91,6 +93,7 @@
 #include "gpopt/xforms/CXformLeftAntiSemiApplyNotIn2LeftAntiSemiJoinNotInNoCorrelations.h"
 #include "gpopt/xforms/CXformLeftAntiSemiJoin2CrossProduct.h"
 #include "gpopt/xforms/CXformLeftAntiSemiJoin2HashJoin.h"
+#include "gpopt/xforms/CXformLeftAntiSemiJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformLeftAntiSemiJoin2NLJoin.h"
 #include "gpopt/xforms/CXformLeftAntiSemiJoinNotIn2CrossProduct.h"
 #include "gpopt/xforms/CXformLeftAntiSemiJoinNotIn2HashJoinNotIn.h"
@@ -100,6 +103,7 @@
 #include "gpopt/xforms/CXformLeftOuterApply2LeftOuterJoin.h"
 #include "gpopt/xforms/CXformLeftOuterApply2LeftOuterJoinNoCorrelations.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2HashJoin.h"
+#include "gpopt/xforms/CXformLeftOuterJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformLeftOuterJoin2NLJoin.h"
 #include "gpopt/xforms/CXformLeftSemiApply2LeftSemiJoin.h"
 #include "gpopt/xforms/CXformLeftSemiApply2LeftSemiJoinNoCorrelations.h"
@@ -111,6 +115,7 @@
 #include "gpopt/xforms/CXformLeftSemiJoin2HashJoin.h"
 #include "gpopt/xforms/CXformLeftSemiJoin2InnerJoin.h"
 #include "gpopt/xforms/CXformLeftSemiJoin2InnerJoinUnderGb.h"
+#include "gpopt/xforms/CXformLeftSemiJoin2MergeJoin.h"
 #include "gpopt/xforms/CXformLeftSemiJoin2NLJoin.h"
 #include "gpopt/xforms/CXformLimit2IndexGet.h"
 #include "gpopt/xforms/CXformLimit2IndexOnlyGet.h"
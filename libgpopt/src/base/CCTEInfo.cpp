@@ -193,6 +193,8 @@ CExpression *CCTEInfo::PexprPreprocessCTEProducer(const CExpression *pexprCTEPro
 //
 //---------------------------------------------------------------------------
 void CCTEInfo::AddCTEProducer(CExpression *pexprCTEProducer) {
+  CAutoMutex am(m_mutex);
+
   CExpression *pexprProducerToAdd = PexprPreprocessCTEProducer(pexprCTEProducer);
 
   COperator *pop = pexprCTEProducer->Pop();
@@ -212,6 +214,8 @@ void CCTEInfo::AddCTEProducer(CExpression *pexprCTEProducer) {
 //
 //---------------------------------------------------------------------------
 void CCTEInfo::ReplaceCTEProducer(CExpression *pexprCTEProducer) {
+  CAutoMutex am(m_mutex);
+
   COperator *pop = pexprCTEProducer->Pop();
   uint32_t ulCTEId = CLogicalCTEProducer::PopConvert(pop)->UlCTEId();
 
@@ -259,6 +263,8 @@ void CCTEInfo::InitDefaultStats(CExpression *pexprCTEProducer) {
 //
 //---------------------------------------------------------------------------
 void CCTEInfo::DeriveProducerStats(CLogicalCTEConsumer *popConsumer, CColRefSet *pcrsStat) {
+  CAutoMutex am(m_mutex);
+
   const uint32_t ulCTEId = popConsumer->UlCTEId();
 
   CCTEInfoEntry *pcteinfoentry = m_phmulcteinfoentry->Find(&ulCTEId);
@@ -287,6 +293,8 @@ void CCTEInfo::DeriveProducerStats(CLogicalCTEConsumer *popConsumer, CColRefSet
 //
 //---------------------------------------------------------------------------
 CExpression *CCTEInfo::PexprCTEProducer(uint32_t ulCTEId) const {
+  CAutoMutex am(m_mutex);
+
   const CCTEInfoEntry *pcteinfoentry = m_phmulcteinfoentry->Find(&ulCTEId);
   GPOS_ASSERT(nullptr != pcteinfoentry);
 
@@ -326,6 +334,8 @@ uint32_t CCTEInfo::UlConsumersInParent(uint32_t ulConsumerId, uint32_t ulParentI
 //
 //---------------------------------------------------------------------------
 uint32_t CCTEInfo::UlConsumers(uint32_t ulCTEId) const {
+  CAutoMutex am(m_mutex);
+
   // find consumers in main query
   uint32_t ulConsumers = UlConsumersInParent(ulCTEId, UINT32_MAX);
 
@@ -350,6 +360,8 @@ uint32_t CCTEInfo::UlConsumers(uint32_t ulCTEId) const {
 //
 //---------------------------------------------------------------------------
 bool CCTEInfo::FUsed(uint32_t ulCTEId) const {
+  CAutoMutex am(m_mutex);
+
   CCTEInfoEntry *pcteinfoentry = m_phmulcteinfoentry->Find(&ulCTEId);
   GPOS_ASSERT(nullptr != pcteinfoentry);
   return pcteinfoentry->FUsed();
@@ -364,6 +376,8 @@ bool CCTEInfo::FUsed(uint32_t ulCTEId) const {
 //
 //---------------------------------------------------------------------------
 bool CCTEInfo::HasOuterReferences(uint32_t ulCTEId) const {
+  CAutoMutex am(m_mutex);
+
   CCTEInfoEntry *pcteinfoentry = m_phmulcteinfoentry->Find(&ulCTEId);
   GPOS_ASSERT(nullptr != pcteinfoentry);
   return pcteinfoentry->HasOuterReferences();
@@ -378,6 +392,8 @@ bool CCTEInfo::HasOuterReferences(uint32_t ulCTEId) const {
 //
 //---------------------------------------------------------------------------
 void CCTEInfo::SetHasOuterReferences(uint32_t ulCTEId) {
+  CAutoMutex am(m_mutex);
+
   CCTEInfoEntry *pcteinfoentry = m_phmulcteinfoentry->Find(&ulCTEId);
   GPOS_ASSERT(nullptr != pcteinfoentry);
   pcteinfoentry->SetHasOuterReferences();
@@ -392,6 +408,8 @@ void CCTEInfo::SetHasOuterReferences(uint32_t ulCTEId) {
 //
 //---------------------------------------------------------------------------
 void CCTEInfo::IncrementConsumers(uint32_t ulConsumerId, uint32_t ulParentCTEId) {
+  CAutoMutex am(m_mutex);
+
   // get map of given parent
   UlongToConsumerCounterMap *phmulconsumermap = m_phmulprodconsmap->Find(&ulParentCTEId);
   if (nullptr == phmulconsumermap) {
@@ -481,6 +499,8 @@ void CCTEInfo::MapComputedToUsedCols(CColumnFactory *col_factory) const {
 //
 //---------------------------------------------------------------------------
 void CCTEInfo::AddConsumerCols(uint32_t ulCTEId, CColRefArray *colref_array) {
+  CAutoMutex am(m_mutex);
+
   GPOS_ASSERT(nullptr != colref_array);
 
   CCTEInfoEntry *pcteinfoentry = m_phmulcteinfoentry->Find(&ulCTEId);
@@ -498,6 +518,8 @@ void CCTEInfo::AddConsumerCols(uint32_t ulCTEId, CColRefArray *colref_array) {
 //
 //---------------------------------------------------------------------------
 uint32_t CCTEInfo::UlConsumerColPos(uint32_t ulCTEId, CColRef *colref) {
+  CAutoMutex am(m_mutex);
+
   GPOS_ASSERT(nullptr != colref);
 
   CCTEInfoEntry *pcteinfoentry = m_phmulcteinfoentry->Find(&ulCTEId);
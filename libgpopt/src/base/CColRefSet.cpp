@@ -256,30 +256,6 @@ IntToColRefMap *CColRefSet::Phmicr(CMemoryPool *mp) const {
   return phmicr;
 }
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CColRefSet::HashValue
-//
-//	@doc:
-//		Compute hash value by combining hashes of components
-//
-//---------------------------------------------------------------------------
-uint32_t CColRefSet::HashValue() {
-  uint32_t size = this->Size();
-  uint32_t ulHash = gpos::HashValue<uint32_t>(&size);
-
-  // limit the number of columns used in hash computation
-  uint32_t length = std::min(size, (uint32_t)8);
-
-  CColRefSetIter crsi(*this);
-  for (uint32_t i = 0; i < length; i++) {
-    (void)crsi.Advance();
-    ulHash = gpos::CombineHashes(ulHash, gpos::HashPtr<CColRef>(crsi.Pcr()));
-  }
-
-  return ulHash;
-}
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CColRefSet::OsPrint
@@ -295,6 +295,7 @@ const CColRefSet *CColumnFactory::PcrsUsedInComputedCol(const CColRef *colref) {
   GPOS_ASSERT(nullptr != m_phmcrcrs);
 
   // get its column reference set from the hash map
+  CAutoMutex am(m_mutex);
   const CColRefSet *pcrs = m_phmcrcrs->Find(colref);
 
   return pcrs;
@@ -317,6 +318,7 @@ void CColumnFactory::AddComputedToUsedColsMap(CExpression *pexpr) {
 
   CColRefSet *pcrsUsed = pexpr->DeriveUsedColumns();
   if (nullptr != pcrsUsed && 0 < pcrsUsed->Size()) {
+    CAutoMutex am(m_mutex);
     bool fres GPOS_ASSERTS_ONLY = m_phmcrcrs->Insert(pcrComputedCol, GPOS_NEW(m_mp) CColRefSet(m_mp, *pcrsUsed));
     GPOS_ASSERT(fres);
   }
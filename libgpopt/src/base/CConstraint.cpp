@@ -111,13 +111,14 @@ CConstraint *CConstraint::PcnstrFromScalarArrayCmp(CMemoryPool *mp, CExpression
 
     const uint32_t arity = CUtils::UlScalarArrayArity(pexprArray);
 
-    // When array size exceeds the constraint derivation threshold,
-    // don't expand it into a DNF and don't derive constraints
+    // When array size exceeds the constraint derivation threshold, don't
+    // expand it into a DNF, build a single interval from the sorted and
+    // de-duplicated constants instead
     COptimizerConfig *optimizer_config = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig();
     uint32_t array_expansion_threshold = optimizer_config->GetHint()->UlArrayExpansionThreshold();
 
     if (arity > array_expansion_threshold) {
-      return nullptr;
+      return CConstraintInterval::PcnstrIntervalFromScalarArrayCmp(mp, pexpr, colref, infer_nulls_as);
     }
 
     if (arity == 0) {
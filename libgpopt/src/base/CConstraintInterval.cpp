@@ -23,6 +23,7 @@
 #include "gpopt/operators/CScalarBooleanTest.h"
 #include "gpopt/operators/CScalarIdent.h"
 #include "gpopt/operators/CScalarIsDistinctFrom.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpos/base.h"
 #include "gpos/common/CAutoRef.h"
 #include "naucrates/base/IDatumBool.h"
@@ -210,12 +211,14 @@ CConstraintInterval *CConstraintInterval::PciIntervalFromScalarExpr(CMemoryPool
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CConstraint::PcnstrFromScalarArrayCmp
+//		CConstraintInterval::PcnstrIntervalFromScalarArrayCmp
 //
 //	@doc:
 //		Create constraint from scalar array comparison expression. Returns
 //		NULL if a constraint interval cannot be created. Has side effect of
-//		removing duplicates
+//		removing duplicates. Only 'A IN (...)' and 'A NOT IN (...)' are
+//		handled; the interval is built from the sorted constants in a single
+//		pass, so this is also used for arrays too large to expand
 //
 //---------------------------------------------------------------------------
 CConstraintInterval *CConstraintInterval::PcnstrIntervalFromScalarArrayCmp(CMemoryPool *mp, CExpression *pexpr,
@@ -239,6 +242,13 @@ CConstraintInterval *CConstraintInterval::PcnstrIntervalFromScalarArrayCmp(CMemo
 
   CScalarArrayCmp *popScArrayCmp = CScalarArrayCmp::PopConvert(pexpr->Pop());
   IMDType::ECmpType cmp_type = CUtils::ParseCmpType(popScArrayCmp->MdIdOp());
+  CScalarArrayCmp::EArrCmpType earrcmpt = popScArrayCmp->Earrcmpt();
+
+  // only '= ANY' (IN) and '<> ALL' (NOT IN) map to a single interval
+  if (!(IMDType::EcmptEq == cmp_type && CScalarArrayCmp::EarrcmpAny == earrcmpt) &&
+      !(IMDType::EcmptNEq == cmp_type && CScalarArrayCmp::EarrcmpAll == earrcmpt)) {
+    return nullptr;
+  }
 
   CExpression *pexprArray = CUtils::PexprScalarArrayChild(pexpr);
   const uint32_t ulArrayExprArity = CUtils::UlScalarArrayArity(pexprArray);
@@ -248,6 +258,16 @@ CConstraintInterval *CConstraintInterval::PcnstrIntervalFromScalarArrayCmp(CMemo
 
   const IComparator *pcomp = COptCtxt::PoctxtFromTLS()->Pcomp();
   gpos::CAutoRef<CDatumSortedSet> apdatumsortedset(GPOS_NEW(mp) CDatumSortedSet(mp, pexprArray, pcomp));
+
+  if (IMDType::EcmptNEq == cmp_type && apdatumsortedset->FIncludesNull()) {
+    // 'A NOT IN (..., NULL)' is never true
+    if (infer_nulls_as) {
+      return nullptr;
+    }
+
+    return GPOS_NEW(mp) CConstraintInterval(mp, colref, GPOS_NEW(mp) CRangeArray(mp), false /*fIncludesNull*/);
+  }
+
   // construct ranges representing IN or NOT IN
   CRangeArray *prgrng = GPOS_NEW(mp) CRangeArray(mp);
 
@@ -768,7 +788,12 @@ CExpression *CConstraintInterval::PexprConstructScalar(CMemoryPool *mp) const {
     return CUtils::PexprScalarConstBool(mp, false /*fval*/, false /*is_null*/);
   }
 
-  if (GPOS_FTRACE(EopttraceArrayConstraints)) {
+  // large intervals are kept as a single array comparison rather than
+  // expanded into a disjunction with one predicate per range
+  COptimizerConfig *optimizer_config = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig();
+  const uint32_t array_expansion_threshold = optimizer_config->GetHint()->UlArrayExpansionThreshold();
+
+  if (GPOS_FTRACE(EopttraceArrayConstraints) || m_pdrgprng->Size() > array_expansion_threshold) {
     // try creating an array IN/NOT IN expression
     CExpression *pexpr = PexprConstructArrayScalar(mp);
     if (pexpr != nullptr) {
@@ -23,6 +23,7 @@
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpos/memory/CAutoMemoryPool.h"
+#include "gpos/task/CWorkerPoolManager.h"
 #include "naucrates/base/IDatum.h"
 #include "naucrates/base/IDatumBool.h"
 #include "naucrates/md/IMDId.h"
@@ -32,6 +33,20 @@ using namespace gpopt;
 using namespace gpos;
 using gpnaucrates::IDatum;
 
+// arguments of a constant evaluation forwarded to the main worker
+struct SEvalArgs {
+  IConstExprEvaluator *m_pceeval;
+  CExpression *m_pexpr;
+};
+
+// evaluate a constant expression; the evaluator enters the host system, so
+// helper workers run this on the main worker
+static void *EvalExpr(void *pv) {
+  SEvalArgs *args = static_cast<SEvalArgs *>(pv);
+
+  return args->m_pceeval->PexprEval(args->m_pexpr);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CDefaultComparator::CDefaultComparator
@@ -64,7 +79,8 @@ bool CDefaultComparator::FEvalComparison(CMemoryPool *mp, const IDatum *datum1,
   CExpression *pexpr2 = GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CScalarConst(mp, pdatum2Copy));
   CExpression *pexprComp = CUtils::PexprScalarCmp(mp, pexpr1, pexpr2, cmp_type);
 
-  CExpression *pexprResult = m_pceeval->PexprEval(pexprComp);
+  SEvalArgs args{m_pceeval, pexprComp};
+  CExpression *pexprResult = static_cast<CExpression *>(CWorkerPoolManager::ExecuteOnMainWorker(EvalExpr, &args));
   pexprComp->Release();
   CScalarConst *popScalarConst = CScalarConst::PopConvert(pexprResult->Pop());
   IDatum *datum = popScalarConst->GetDatum();
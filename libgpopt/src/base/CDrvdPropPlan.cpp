@@ -13,6 +13,7 @@
 
 #include "gpopt/base/CCTEMap.h"
 #include "gpopt/base/CDrvdPropCtxtPlan.h"
+#include "gpopt/base/CEnfdParallelism.h"
 #include "gpopt/base/CReqdPropPlan.h"
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CPhysical.h"
@@ -43,6 +44,7 @@ CDrvdPropPlan::CDrvdPropPlan() = default;
 CDrvdPropPlan::~CDrvdPropPlan() {
   CRefCount::SafeRelease(m_pos);
   CRefCount::SafeRelease(m_ppps);
+  CRefCount::SafeRelease(m_ppar);
   CRefCount::SafeRelease(m_pcm);
 }
 
@@ -77,6 +79,7 @@ void CDrvdPropPlan::Derive(CMemoryPool *mp, CExpressionHandle &exprhdl, CDrvdPro
     // call property derivation functions on the operator
     m_pos = popPhysical->PosDerive(mp, exprhdl);
     m_ppps = popPhysical->PppsDerive(mp, exprhdl);
+    m_ppar = popPhysical->PparDerive(mp, exprhdl);
   }
 
   m_pcm = popPhysical->PcmDerive(mp, exprhdl);
@@ -103,6 +106,9 @@ void CDrvdPropPlan::CopyCTEProducerPlanProps(CMemoryPool *mp, CDrvdPropCtxt *pdp
     // no need to copy the part index map. return an empty one. This is to
     // distinguish between a CTE consumer and the inlined expression
     m_ppps = GPOS_NEW(mp) CPartitionPropagationSpec(mp);
+
+    // the producer is executed by the leader only
+    m_ppar = GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSingleton);
   }
 }
 
@@ -120,7 +126,7 @@ bool CDrvdPropPlan::FSatisfies(const CReqdPropPlan *prpp) const {
   GPOS_ASSERT(nullptr != prpp->Pcter());
 
   return m_pos->FSatisfies(prpp->Peo()->PosRequired()) && m_ppps->FSatisfies(prpp->Pepp()->PppsRequired()) &&
-         m_pcm->FSatisfies(prpp->Pcter());
+         m_ppar->FSatisfies(prpp->Pepar()->PparRequired()) && m_pcm->FSatisfies(prpp->Pcter());
 }
 
 //---------------------------------------------------------------------------
@@ -146,7 +152,8 @@ uint32_t CDrvdPropPlan::HashValue() const {
 //
 //---------------------------------------------------------------------------
 uint32_t CDrvdPropPlan::Equals(const CDrvdPropPlan *pdpplan) const {
-  return m_pos->Matches(pdpplan->Pos()) && m_ppps->Equals(pdpplan->Ppps()) && m_pcm->Equals(pdpplan->GetCostModel());
+  return m_pos->Matches(pdpplan->Pos()) && m_ppps->Equals(pdpplan->Ppps()) && m_ppar->Matches(pdpplan->Ppar()) &&
+         m_pcm->Equals(pdpplan->GetCostModel());
 }
 
 //---------------------------------------------------------------------------
@@ -158,8 +165,8 @@ uint32_t CDrvdPropPlan::Equals(const CDrvdPropPlan *pdpplan) const {
 //
 //---------------------------------------------------------------------------
 IOstream &CDrvdPropPlan::OsPrint(IOstream &os) const {
-  os << "Drvd Plan Props (" << "ORD: " << (*m_pos) << ", PART PROP:" << (*m_ppps) << ")" << ", CTE Map: [" << *m_pcm
-     << "]";
+  os << "Drvd Plan Props (" << "ORD: " << (*m_pos) << ", PART PROP:" << (*m_ppps) << ", PAR: " << (*m_ppar) << ")"
+     << ", CTE Map: [" << *m_pcm << "]";
 
   return os;
 }
@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CEnfdParallelism.cpp
+//
+//	@doc:
+//		Implementation of enforceable parallelism property
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CEnfdParallelism.h"
+
+#include "gpopt/base/CReqdPropPlan.h"
+#include "gpopt/operators/CPhysical.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+// ctor
+CEnfdParallelism::CEnfdParallelism(CParallelSpec *ppar, EParallelismMatching eparm) : m_ppar(ppar), m_eparm(eparm) {
+  GPOS_ASSERT(nullptr != ppar);
+  GPOS_ASSERT(EparmSentinel > eparm);
+}
+
+// dtor
+CEnfdParallelism::~CEnfdParallelism() {
+  m_ppar->Release();
+}
+
+// hash function
+uint32_t CEnfdParallelism::HashValue() const {
+  return gpos::CombineHashes(m_eparm + 1, m_ppar->HashValue());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEnfdParallelism::Epet
+//
+//	@doc:
+// 		Get parallelism enforcing type for the given operator
+//
+//---------------------------------------------------------------------------
+CEnfdProp::EPropEnforcingType CEnfdParallelism::Epet(CExpressionHandle &exprhdl, CPhysical *popPhysical,
+                                                     bool fParallelismReqd) const {
+  if (fParallelismReqd) {
+    return popPhysical->EpetParallelism(exprhdl, this);
+  }
+
+  return EpetUnnecessary;
+}
+
+// print function
+IOstream &CEnfdParallelism::OsPrint(IOstream &os) const {
+  return os << (*m_ppar) << " match: " << SzParallelismMatching(m_eparm) << " ";
+}
+
+// parallelism matching string
+const char *CEnfdParallelism::SzParallelismMatching(EParallelismMatching eparm) {
+  GPOS_ASSERT(EparmSentinel > eparm);
+  const char *rgszParallelismMatching[EparmSentinel] = {"satisfy"};
+
+  return rgszParallelismMatching[eparm];
+}
+
+bool CEnfdParallelism::Matches(CEnfdParallelism *pepar) {
+  GPOS_ASSERT(nullptr != pepar);
+
+  return m_eparm == pepar->Eparm() && m_ppar->Matches(pepar->PparRequired());
+}
+
+bool CEnfdParallelism::FCompatible(CParallelSpec *ppar_drvd) const {
+  GPOS_ASSERT(nullptr != ppar_drvd);
+
+  switch (m_eparm) {
+    case EparmSatisfy:
+      return ppar_drvd->FSatisfies(m_ppar);
+
+    case EparmSentinel:
+      GPOS_ASSERT("invalid matching type");
+  }
+
+  return false;
+}
+
+// EOF
@@ -135,7 +135,7 @@ bool COptimizationContext::FOptimize(CMemoryPool *mp, CGroupExpression *pgexprPa
                                      COptimizationContext *pocChild, uint32_t ulSearchStages) {
   COperator *pop = pgexprChild->Pop();
 
-  if (COperator::EopPhysicalSort == pop->Eopid()) {
+  if (COperator::EopPhysicalSort == pop->Eopid() || COperator::EopPhysicalIncrementalSort == pop->Eopid()) {
     return FOptimizeSort(mp, pgexprParent, pgexprChild, pocChild, ulSearchStages);
   }
 
@@ -192,7 +192,8 @@ bool COptimizationContext::FOptimizeSort(CMemoryPool *,       // mp
 ) {
   GPOS_ASSERT(nullptr != pgexprSort);
   GPOS_ASSERT(nullptr != poc);
-  GPOS_ASSERT(COperator::EopPhysicalSort == pgexprSort->Pop()->Eopid());
+  GPOS_ASSERT(COperator::EopPhysicalSort == pgexprSort->Pop()->Eopid() ||
+              COperator::EopPhysicalIncrementalSort == pgexprSort->Pop()->Eopid());
 
   CPhysicalSort *pop = CPhysicalSort::PopConvert(pgexprSort->Pop());
 
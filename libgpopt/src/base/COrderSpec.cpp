@@ -11,9 +11,15 @@
 
 #include "gpopt/base/COrderSpec.h"
 
+#include <algorithm>
+
 #include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CDrvdPropPlan.h"
 #include "gpopt/base/COptCtxt.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpopt/operators/CPhysicalIncrementalSort.h"
 #include "gpopt/operators/CPhysicalSort.h"
+#include "naucrates/traceflags/traceflags.h"
 
 #ifdef GPOS_DEBUG
 #include "gpos/error/CAutoTrace.h"
@@ -156,16 +162,57 @@ bool COrderSpec::FSatisfies(const COrderSpec *pos) const {
   return fSatisfies;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COrderSpec::UlMatchingPrefix
+//
+//	@doc:
+//		Number of leading components of the given spec matched by this spec
+//
+//---------------------------------------------------------------------------
+uint32_t COrderSpec::UlMatchingPrefix(const COrderSpec *pos) const {
+  const uint32_t ulMax = std::min(m_pdrgpoe->Size(), pos->m_pdrgpoe->Size());
+
+  uint32_t ul = 0;
+  while (ul < ulMax && (*m_pdrgpoe)[ul]->Matches((*(pos->m_pdrgpoe))[ul])) {
+    ul++;
+  }
+
+  return ul;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COrderSpec::PosPrefix
+//
+//	@doc:
+//		Order spec made of the first components of this spec
+//
+//---------------------------------------------------------------------------
+COrderSpec *COrderSpec::PosPrefix(CMemoryPool *mp, uint32_t ulCols) const {
+  GPOS_ASSERT(ulCols <= UlSortColumns());
+
+  COrderSpec *pos = GPOS_NEW(mp) COrderSpec(mp);
+  for (uint32_t ul = 0; ul < ulCols; ul++) {
+    IMDId *mdid = GetMdIdSortOp(ul);
+    mdid->AddRef();
+    pos->Append(mdid, Pcr(ul), Ent(ul));
+  }
+
+  return pos;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COrderSpec::AppendEnforcers
 //
 //	@doc:
-//		Add required enforcers enforcers to dynamic array
+//		Add required enforcers enforcers to dynamic array; besides a full
+//		sort, an incremental sort is added when the expression delivers a
+//		prefix of the required order
 //
 //---------------------------------------------------------------------------
-void COrderSpec::AppendEnforcers(CMemoryPool *mp,
-                                 CExpressionHandle &,  // exprhdl
+void COrderSpec::AppendEnforcers(CMemoryPool *mp, CExpressionHandle &exprhdl,
                                  CReqdPropPlan *
 #ifdef GPOS_DEBUG
                                      prpp
@@ -182,6 +229,20 @@ void COrderSpec::AppendEnforcers(CMemoryPool *mp,
   pexpr->AddRef();
   CExpression *pexprSort = GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPhysicalSort(mp, this), pexpr);
   pdrgpexpr->Append(pexprSort);
+
+  if (GPOS_FTRACE(EopttraceDisableIncrementalSort)) {
+    return;
+  }
+
+  COrderSpec *posDerived = CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Pos();
+  const uint32_t ulPresorted = posDerived->UlMatchingPrefix(this);
+  if (0 < ulPresorted && ulPresorted < UlSortColumns()) {
+    AddRef();
+    pexpr->AddRef();
+    CExpression *pexprIncrementalSort = GPOS_NEW(mp)
+        CExpression(mp, GPOS_NEW(mp) CPhysicalIncrementalSort(mp, this, PosPrefix(mp, ulPresorted)), pexpr);
+    pdrgpexpr->Append(pexprIncrementalSort);
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CParallelSpec.cpp
+//
+//	@doc:
+//		Specification of how a result is spread across parallel workers
+//---------------------------------------------------------------------------
+
+#include "gpopt/base/CParallelSpec.h"
+
+#include "gpopt/base/CColRefSet.h"
+#include "gpopt/base/CEnfdOrder.h"
+#include "gpopt/base/CReqdPropPlan.h"
+#include "gpopt/operators/CPhysicalGather.h"
+
+using namespace gpopt;
+
+// ctor
+CParallelSpec::CParallelSpec(EParallelType ept) : m_ept(ept) {
+  GPOS_ASSERT(EptSentinel > ept);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParallelSpec::FSatisfies
+//
+//	@doc:
+//		Check if this spec satisfies the given one; a serial result may be
+//		used wherever the leader needs a complete one, a partial result
+//		never stands in for a complete one and vice versa
+//
+//---------------------------------------------------------------------------
+bool CParallelSpec::FSatisfies(const CParallelSpec *ppar) const {
+  GPOS_ASSERT(nullptr != ppar);
+
+  switch (ppar->Ept()) {
+    case EptAny:
+      return true;
+
+    case EptSingleton:
+      return EptSingleton == m_ept || EptSerial == m_ept;
+
+    default:
+      return m_ept == ppar->Ept();
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CParallelSpec::AppendEnforcers
+//
+//	@doc:
+//		Add a Gather on top of the given expression, and a Gather Merge
+//		when a sort order is required as well; only complete results needed
+//		by the leader can be enforced
+//
+//---------------------------------------------------------------------------
+void CParallelSpec::AppendEnforcers(CMemoryPool *mp,
+                                    CExpressionHandle &,  // exprhdl
+                                    CReqdPropPlan *prpp, CExpressionArray *pdrgpexpr, CExpression *pexpr) {
+  GPOS_ASSERT(nullptr != prpp);
+  GPOS_ASSERT(nullptr != pdrgpexpr);
+  GPOS_ASSERT(nullptr != pexpr);
+
+  if (EptSingleton != m_ept) {
+    return;
+  }
+
+  pexpr->AddRef();
+  CExpression *pexprGather =
+      GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPhysicalGather(mp, GPOS_NEW(mp) COrderSpec(mp)), pexpr);
+  pdrgpexpr->Append(pexprGather);
+
+  COrderSpec *pos = prpp->Peo()->PosRequired();
+  if (!pos->IsEmpty()) {
+    pos->AddRef();
+    pexpr->AddRef();
+    CExpression *pexprGatherMerge = GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPhysicalGather(mp, pos), pexpr);
+    pdrgpexpr->Append(pexprGatherMerge);
+  }
+}
+
+// extract columns used by the spec
+CColRefSet *CParallelSpec::PcrsUsed(CMemoryPool *mp) const {
+  return GPOS_NEW(mp) CColRefSet(mp);
+}
+
+// print
+IOstream &CParallelSpec::OsPrint(IOstream &os) const {
+  const char *rgszParallelType[EptSentinel] = {"ANY", "SERIAL", "PARTIAL", "SINGLETON"};
+
+  return os << rgszParallelType[m_ept];
+}
+
+// EOF
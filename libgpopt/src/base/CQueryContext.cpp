@@ -13,6 +13,7 @@
 
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CColumnFactory.h"
+#include "gpopt/base/CEnfdParallelism.h"
 #include "gpopt/base/COptCtxt.h"
 #include "gpopt/operators/CLogicalLimit.h"
 #include "gpos/base.h"
@@ -194,6 +195,12 @@ CQueryContext *CQueryContext::PqcGenerate(CMemoryPool *mp, CExpression *pexpr,
   CEnfdPartitionPropagation *pepp =
       GPOS_NEW(mp) CEnfdPartitionPropagation(ppps, CEnfdPartitionPropagation::EppmSatisfy);
 
+  // The leader needs the complete result when parallel workers may be used,
+  // otherwise parallelism is not part of the search
+  CParallelSpec::EParallelType ept =
+      0 < poptctxt->GetCostModel()->UlParallelWorkers() ? CParallelSpec::EptSingleton : CParallelSpec::EptAny;
+  CEnfdParallelism *pepar = GPOS_NEW(mp) CEnfdParallelism(GPOS_NEW(mp) CParallelSpec(ept), CEnfdParallelism::EparmSatisfy);
+
   // Required CTEs are obtained from the CTEInfo global information in the optimizer context
   CCTEReq *pcter = poptctxt->Pcteinfo()->PcterProducers(mp);
 
@@ -201,7 +208,7 @@ CQueryContext *CQueryContext::PqcGenerate(CMemoryPool *mp, CExpression *pexpr,
   // constructed later based on derived relation properties (CPartInfo) by
   // CReqdPropPlan::InitReqdPartitionPropagation().
 
-  CReqdPropPlan *prpp = GPOS_NEW(mp) CReqdPropPlan(pcrs, peo, pepp, pcter);
+  CReqdPropPlan *prpp = GPOS_NEW(mp) CReqdPropPlan(pcrs, peo, pepp, pepar, pcter);
 
   // Finally, create the CQueryContext
   pdrgpmdname->AddRef();
@@ -15,6 +15,7 @@
 #include "gpopt/base/CColRefSet.h"
 #include "gpopt/base/CColRefSetIter.h"
 #include "gpopt/base/CEnfdOrder.h"
+#include "gpopt/base/CEnfdParallelism.h"
 #include "gpopt/base/CEnfdPartitionPropagation.h"
 #include "gpopt/base/CPartInfo.h"
 #include "gpopt/base/CUtils.h"
@@ -36,11 +37,13 @@ using namespace gpopt;
 //             Ctor
 //
 //---------------------------------------------------------------------------
-CReqdPropPlan::CReqdPropPlan(CColRefSet *pcrs, CEnfdOrder *peo, CEnfdPartitionPropagation *pepp, CCTEReq *pcter)
-    : m_pcrs(pcrs), m_peo(peo), m_pepp(pepp), m_pcter(pcter) {
+CReqdPropPlan::CReqdPropPlan(CColRefSet *pcrs, CEnfdOrder *peo, CEnfdPartitionPropagation *pepp,
+                             CEnfdParallelism *pepar, CCTEReq *pcter)
+    : m_pcrs(pcrs), m_peo(peo), m_pepp(pepp), m_pepar(pepar), m_pcter(pcter) {
   GPOS_ASSERT(nullptr != pcrs);
   GPOS_ASSERT(nullptr != peo);
   GPOS_ASSERT(nullptr != pepp);
+  GPOS_ASSERT(nullptr != pepar);
   GPOS_ASSERT(nullptr != pcter);
 }
 
@@ -56,6 +59,7 @@ CReqdPropPlan::~CReqdPropPlan() {
   CRefCount::SafeRelease(m_pcrs);
   CRefCount::SafeRelease(m_peo);
   CRefCount::SafeRelease(m_pepp);
+  CRefCount::SafeRelease(m_pepar);
   CRefCount::SafeRelease(m_pcter);
 }
 
@@ -124,6 +128,12 @@ void CReqdPropPlan::Compute(CMemoryPool *mp, CExpressionHandle &exprhdl, CReqdPr
       GPOS_NEW(mp) CEnfdPartitionPropagation(popPhysical->PppsRequired(mp, exprhdl, prppInput->Pepp()->PppsRequired(),
                                                                        child_index, pdrgpdpCtxt, ulPartPropagateReq),
                                              CEnfdPartitionPropagation::EppmSatisfy);
+
+  // there are no distribution requests outside of MPP, the slot is used for
+  // parallelism requests instead
+  m_pepar = GPOS_NEW(mp) CEnfdParallelism(popPhysical->PparRequired(mp, exprhdl, prppInput->Pepar()->PparRequired(),
+                                                                     child_index, pdrgpdpCtxt, ulDistrReq),
+                                          CEnfdParallelism::EparmSatisfy);
 }
 
 //---------------------------------------------------------------------------
@@ -144,6 +154,9 @@ CPropSpec *CReqdPropPlan::Pps(uint32_t ul) const {
     case CPropSpec::EpstPartPropagation:
       return m_pepp->PppsRequired();
 
+    case CPropSpec::EpstParallelism:
+      return m_pepar->PparRequired();
+
     default:
       GPOS_ASSERT(!"Invalid property spec index");
   }
@@ -208,6 +221,10 @@ bool CReqdPropPlan::Equals(const CReqdPropPlan *prpp) const {
     }
   }
 
+  if (result) {
+    result = Pepar()->Matches(prpp->Pepar());
+  }
+
   return result;
 }
 
@@ -227,6 +244,7 @@ uint32_t CReqdPropPlan::HashValue() const {
   uint32_t ulHash = m_pcrs->HashValue();
   ulHash = gpos::CombineHashes(ulHash, m_peo->HashValue());
   ulHash = gpos::CombineHashes(ulHash, m_pcter->HashValue());
+  ulHash = gpos::CombineHashes(ulHash, m_pepar->HashValue());
 
   return ulHash;
 }
@@ -251,11 +269,12 @@ bool CReqdPropPlan::FSatisfied(const CDrvdPropRelational *pdprel, const CDrvdPro
 
   // second, check satisfiability of plan properties;
   // if max cardinality <= 1, then any order requirement is already satisfied;
-  // we only need to check satisfiability of distribution and rewindability
+  // we only need to check satisfiability of the remaining properties
   if (pdprel->GetMaxCard().Ull() <= 1) {
     GPOS_ASSERT(nullptr != pdpplan->Ppps());
 
     return pdpplan->Ppps()->FSatisfies(this->Pepp()->PppsRequired()) &&
+           this->Pepar()->FCompatible(pdpplan->Ppar()) &&
            pdpplan->GetCostModel()->FSatisfies(this->Pcter());
   }
 
@@ -282,6 +301,7 @@ bool CReqdPropPlan::FCompatible(CExpressionHandle &exprhdl, CPhysical *popPhysic
   }
 
   return m_peo->FCompatible(pdpplan->Pos()) && pdpplan->Ppps()->FSatisfies(m_pepp->PppsRequired()) &&
+         m_pepar->FCompatible(pdpplan->Ppar()) &&
          popPhysical->FProvidesReqdCTEs(exprhdl, m_pcter);
 }
 
@@ -299,9 +319,11 @@ CReqdPropPlan *CReqdPropPlan::PrppEmpty(CMemoryPool *mp) {
   CPartitionPropagationSpec *pps = GPOS_NEW(mp) CPartitionPropagationSpec(mp);
   CEnfdOrder *peo = GPOS_NEW(mp) CEnfdOrder(pos, CEnfdOrder::EomSatisfy);
   CEnfdPartitionPropagation *pepp = GPOS_NEW(mp) CEnfdPartitionPropagation(pps, CEnfdPartitionPropagation::EppmSatisfy);
+  CEnfdParallelism *pepar =
+      GPOS_NEW(mp) CEnfdParallelism(GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptAny), CEnfdParallelism::EparmSatisfy);
   CCTEReq *pcter = GPOS_NEW(mp) CCTEReq(mp);
 
-  return GPOS_NEW(mp) CReqdPropPlan(pcrs, peo, pepp, pcter);
+  return GPOS_NEW(mp) CReqdPropPlan(pcrs, peo, pepp, pepar, pcter);
 }
 
 //---------------------------------------------------------------------------
@@ -335,6 +357,11 @@ IOstream &CReqdPropPlan::OsPrint(IOstream &os) const {
   if (nullptr != m_pepp) {
     os << GetPrintablePtr(m_pepp);
   }
+
+  os << "], req parallelism: [";
+  if (nullptr != m_pepar) {
+    os << (*m_pepar);
+  }
   os << "]";
 
   return os;
@@ -400,10 +427,13 @@ CReqdPropPlan *CReqdPropPlan::PrppRemapForCTE(CMemoryPool *mp, CReqdPropPlan *pr
   prppProducer->Pepp()->AddRef();
   CEnfdPartitionPropagation *pepp = prppProducer->Pepp();
 
+  prppProducer->Pepar()->AddRef();
+  CEnfdParallelism *pepar = prppProducer->Pepar();
+
   prppProducer->Pcter()->AddRef();
   CCTEReq *pcter = prppProducer->Pcter();
 
-  return GPOS_NEW(mp) CReqdPropPlan(pcrsRequired, peo, pepp, pcter);
+  return GPOS_NEW(mp) CReqdPropPlan(pcrsRequired, peo, pepp, pepar, pcter);
 }
 
 // EOF
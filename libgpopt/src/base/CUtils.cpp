@@ -37,6 +37,7 @@
 #include "gpopt/operators/CPhysicalAgg.h"
 #include "gpopt/operators/CPhysicalCTEConsumer.h"
 #include "gpopt/operators/CPhysicalCTEProducer.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 #include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarArray.h"
@@ -892,6 +893,18 @@ bool CUtils::FHashJoin(COperator *pop) {
   return (nullptr != popHJN);
 }
 
+// check if a given operator is a merge join
+bool CUtils::FMergeJoin(COperator *pop) {
+  GPOS_ASSERT(nullptr != pop);
+
+  CPhysicalMergeJoin *popMJ = nullptr;
+  if (pop->FPhysical()) {
+    popMJ = dynamic_cast<CPhysicalMergeJoin *>(pop);
+  }
+
+  return (nullptr != popMJ);
+}
+
 // check if a given operator is a correlated nested loops join
 bool CUtils::FCorrelatedNLJoin(COperator *pop) {
   GPOS_ASSERT(nullptr != pop);
@@ -920,7 +933,7 @@ bool CUtils::FNLJoin(COperator *pop) {
 bool CUtils::FPhysicalJoin(COperator *pop) {
   GPOS_ASSERT(nullptr != pop);
 
-  return FHashJoin(pop) || FNLJoin(pop);
+  return FHashJoin(pop) || FNLJoin(pop) || FMergeJoin(pop);
 }
 
 // check if a given operator is a physical agg
@@ -956,8 +969,9 @@ bool CUtils::FEnforcer(COperator *pop) {
   GPOS_ASSERT(nullptr != pop);
 
   COperator::EOperatorId op_id = pop->Eopid();
-  return COperator::EopPhysicalSort == op_id || COperator::EopPhysicalSpool == op_id ||
-         COperator::EopPhysicalPartitionSelector == op_id;
+  return COperator::EopPhysicalSort == op_id || COperator::EopPhysicalIncrementalSort == op_id ||
+         COperator::EopPhysicalSpool == op_id || COperator::EopPhysicalPartitionSelector == op_id ||
+         COperator::EopPhysicalGather == op_id;
 }
 
 // check if a given operator is an Apply
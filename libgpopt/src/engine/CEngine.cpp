@@ -27,6 +27,7 @@
 #include "gpopt/operators/CPattern.h"
 #include "gpopt/operators/CPatternLeaf.h"
 #include "gpopt/operators/CPhysicalAgg.h"
+#include "gpopt/operators/CPhysicalIncrementalSort.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
 #include "gpopt/operators/CPhysicalSort.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
@@ -41,6 +42,7 @@
 #include "gpopt/search/CSchedulerContext.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "gpos/base.h"
+#include "gpos/common/CAutoRg.h"
 #include "gpos/common/CAutoTimer.h"
 #include "gpos/common/syslibwrapper.h"
 #include "gpos/error/CAutoTrace.h"
@@ -49,6 +51,7 @@
 #include "gpos/string/CWStringDynamic.h"
 #include "gpos/task/CAutoTaskProxy.h"
 #include "gpos/task/CAutoTraceFlag.h"
+#include "gpos/task/CWorkerPoolManager.h"
 #include "naucrates/traceflags/traceflags.h"
 
 #define GPOPT_SAMPLING_MAX_ITERS 30
@@ -76,6 +79,9 @@ CEngine::CEngine(CMemoryPool *mp)
       m_ulCurrSearchStage(0),
       m_pmemo(nullptr),
       m_pexprEnforcerPattern(nullptr),
+      m_ulBudget(UINT32_MAX),
+      m_fBudgetExhausted(false),
+      m_fPlanFound(false),
       m_xforms(nullptr),
       m_pdrgpulpXformCalls(nullptr),
       m_pdrgpulpXformTimes(nullptr),
@@ -594,7 +600,7 @@ void CEngine::ApplyTransformations(CMemoryPool *pmpLocal, CXformSet *xform_set,
     InsertXformResult(pgexpr->Pgroup(), pxfres, pxform->Exfid(), pgexpr, ulElapsedTime, ulNumberOfBindings);
     pxfres->Release();
 
-    if (PssCurrent()->FTimedOut()) {
+    if (FStageTimedOut()) {
       break;
     }
   }
@@ -612,7 +618,7 @@ void CEngine::TransitionGroupExpression(CMemoryPool *pmpLocal, CGroupExpression
                                         CGroupExpression::EState estTarget) {
   GPOS_ASSERT(CGroupExpression::estExplored == estTarget || CGroupExpression::estImplemented == estTarget);
 
-  if (PssCurrent()->FTimedOut()) {
+  if (FStageTimedOut()) {
     return;
   }
 
@@ -664,7 +670,7 @@ void CEngine::TransitionGroup(CMemoryPool *pmpLocal, CGroup *pgroup, CGroup::ESt
   // check stack size
   GPOS_CHECK_STACK_SIZE;
 
-  if (PssCurrent()->FTimedOut()) {
+  if (FStageTimedOut()) {
     return;
   }
 
@@ -704,7 +710,7 @@ void CEngine::TransitionGroup(CMemoryPool *pmpLocal, CGroup *pgroup, CGroup::ESt
         TransitionGroupExpression(pmpLocal, pgexprCurrent, estGExprTargetState);
       }
 
-      if (PssCurrent()->FTimedOut()) {
+      if (FStageTimedOut()) {
         break;
       }
 
@@ -803,7 +809,7 @@ CCostContext *CEngine::PccOptimizeChild(CExpressionHandle &exprhdl,  // initiali
   // optimize child group
   CGroupExpression *pgexprChildBest = PgexprOptimize(pgroupChild, pocChild, pgexpr);
   pocChild->Release();
-  if (nullptr == pgexprChildBest || PssCurrent()->FTimedOut()) {
+  if (nullptr == pgexprChildBest || FStageTimedOut()) {
     // failed to generate a plan for the child, or search stage is timed-out
     return nullptr;
   }
@@ -988,7 +994,7 @@ CGroupExpression *CEngine::PgexprOptimize(CGroup *pgroup, COptimizationContext *
         OptimizeGroupExpression(pgexprCurrent, poc);
       }
 
-      if (PssCurrent()->FTimedOut()) {
+      if (FStageTimedOut()) {
         break;
       }
 
@@ -1025,7 +1031,7 @@ void CEngine::Explore() {
   GPOS_ASSERT(!PgroupRoot()->FExplored());
 
   TransitionGroup(m_mp, PgroupRoot(), CGroup::estExplored /*estTarget*/);
-  GPOS_ASSERT_IMP(!PssCurrent()->FTimedOut(), PgroupRoot()->FExplored());
+  GPOS_ASSERT_IMP(!FStageTimedOut(), PgroupRoot()->FExplored());
 }
 
 //---------------------------------------------------------------------------
@@ -1044,7 +1050,7 @@ void CEngine::Implement() {
   GPOS_ASSERT(!PgroupRoot()->FImplemented());
 
   TransitionGroup(m_mp, PgroupRoot(), CGroup::estImplemented /*estTarget*/);
-  GPOS_ASSERT_IMP(!PssCurrent()->FTimedOut(), PgroupRoot()->FImplemented());
+  GPOS_ASSERT_IMP(!FStageTimedOut(), PgroupRoot()->FImplemented());
 }
 
 //---------------------------------------------------------------------------
@@ -1349,6 +1355,70 @@ void CEngine::ProcessTraceFlags() {
   }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::CheckBudget
+//
+//	@doc:
+//		Mark the planning time budget as used up once the search has run
+//		for longer; exploration stops, and FStageTimedOut() abandons the
+//		current stage if an earlier one already found a plan
+//
+//---------------------------------------------------------------------------
+void CEngine::CheckBudget() {
+  if (UINT32_MAX != m_ulBudget && !m_fBudgetExhausted && m_clockBudget.ElapsedMS() > m_ulBudget) {
+    m_fBudgetExhausted = true;
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::RunHelpers
+//
+//	@doc:
+//		Run the scheduled jobs on one helper worker per scheduling context;
+//		the current worker serves the helpers' calls into the host system
+//		until all of them are done
+//
+//---------------------------------------------------------------------------
+void CEngine::RunHelpers(CSchedulerContext *rgsc, uint32_t ulWorkers) {
+  CAutoTaskProxy atp(m_mp, CWorkerPoolManager::WorkerPoolManager());
+  for (uint32_t ul = 0; ul < ulWorkers; ul++) {
+    CTask *task = atp.Create(CScheduler::Run, &rgsc[ul]);
+
+    // helpers see the optimizer context of the current task
+    task->GetTls().Inherit(ITask::Self()->GetTls());
+    atp.Schedule(task);
+  }
+
+  atp.ExecuteScheduled();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CEngine::UlSearchWorkers
+//
+//	@doc:
+//		Number of workers running the search jobs; helper workers allocate
+//		from the optimizer's own memory pools only and cannot write traces,
+//		so the search stays on the current worker otherwise
+//
+//---------------------------------------------------------------------------
+uint32_t CEngine::UlSearchWorkers() {
+  const int workers = GPOS_CONDIF(optimizer_threads);
+  if (1 >= workers || GPOS_CONDIF(palloc_memory_pools)) {
+    return 1;
+  }
+
+  for (uint32_t ul = EopttracePrintQuery; ul <= EopttracePrintPgHintPlanLog; ul++) {
+    if (GPOS_FTRACE(ul)) {
+      return 1;
+    }
+  }
+
+  return (uint32_t)workers;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CEngine::Optimize
@@ -1364,11 +1434,19 @@ void CEngine::Optimize() {
   GPOS_ASSERT(nullptr != COptCtxt::PoctxtFromTLS());
 
   const uint32_t ulJobs = std::min((uint32_t)GPOPT_JOBS_CAP, (uint32_t)(m_pmemo->UlpGroups() * GPOPT_JOBS_PER_GROUP));
+  const int budget = GPOS_CONDIF(planning_time_budget);
+  m_ulBudget = 0 < budget ? (uint32_t)budget : UINT32_MAX;
+  m_clockBudget.Restart();
+
+  const uint32_t ulWorkers = UlSearchWorkers();
   CJobFactory jf(m_mp, ulJobs);
-  CScheduler sched(m_mp, ulJobs);
+  CScheduler sched(m_mp, ulJobs, ulWorkers);
 
-  CSchedulerContext sc;
-  sc.Init(m_mp, &jf, &sched, this);
+  // one scheduling context per worker, each with its own scratch pool
+  CAutoRg<CSchedulerContext> rgsc(GPOS_NEW_ARRAY(m_mp, CSchedulerContext, ulWorkers));
+  for (uint32_t ul = 0; ul < ulWorkers; ul++) {
+    rgsc[ul].Init(m_mp, &jf, &sched, this);
+  }
 
   const uint32_t ulSearchStages = m_search_stage_array->Size();
   for (uint32_t ul = 0; !FSearchTerminated() && ul < ulSearchStages; ul++) {
@@ -1384,10 +1462,14 @@ void CEngine::Optimize() {
         m_ulCurrSearchStage);
 
     // schedule main optimization job
-    ScheduleMainJob(&sc, poc);
+    ScheduleMainJob(&rgsc[0], poc);
 
     // run optimization job
-    CScheduler::Run(&sc);
+    if (1 == ulWorkers) {
+      CScheduler::Run(&rgsc[0]);
+    } else {
+      RunHelpers(rgsc.Rgt(), ulWorkers);
+    }
 
     poc->Release();
 
@@ -1395,13 +1477,23 @@ void CEngine::Optimize() {
     CExpression *pexprPlan =
         m_pmemo->PexprExtractPlan(m_mp, m_pmemo->PgroupRoot(), m_pqc->Prpp(), m_search_stage_array->Size());
     PssCurrent()->SetBestExpr(pexprPlan);
+    m_fPlanFound = m_fPlanFound || nullptr != pexprPlan;
 
     FinalizeSearchStage();
   }
 
+  if (m_fBudgetExhausted) {
+    // a plan found under an exhausted budget depends on timing, the host must
+    // not treat it as the plan of the query
+    COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->SetBudgetExhausted();
+  }
+
   if (GPOS_FTRACE(EopttracePrintOptimizationStatistics)) {
     CAutoTrace atSearch(m_mp);
     atSearch.Os() << "[OPT]: Search terminated at stage " << m_ulCurrSearchStage << "/" << m_search_stage_array->Size();
+    if (m_fBudgetExhausted) {
+      atSearch.Os() << ", planning time budget of " << m_ulBudget << "ms exhausted";
+    }
   }
 
   if (CEnumeratorConfig::FSample()) {
@@ -1709,6 +1801,8 @@ bool CEngine::FCheckEnfdProps(CMemoryPool *mp, CGroupExpression *pgexpr, COptimi
   bool fPartPropagationReqd =
       !GPOS_FTRACE(EopttraceDisablePartPropagation) && prpp->Pepp()->PppsRequired()->FPartPropagationReqd();
 
+  bool fParallelismReqd = prpp->Pepar()->PparRequired()->FParallelismReqd();
+
   // Determine if adding an enforcer to the group is required, optional,
   // unnecessary or prohibited over the group expression and given the current
   // optimization context (required properties)
@@ -1716,12 +1810,13 @@ bool CEngine::FCheckEnfdProps(CMemoryPool *mp, CGroupExpression *pgexpr, COptimi
   // get order enforcing type
   CEnfdProp::EPropEnforcingType epetOrder = prpp->Peo()->Epet(exprhdl, popPhysical, fOrderReqd);
 
-  // get rewindability enforcing type
-
   // get partition propagation enforcing type
   CEnfdProp::EPropEnforcingType epetPartitionPropagation =
       prpp->Pepp()->Epet(exprhdl, popPhysical, fPartPropagationReqd);
 
+  // get parallelism enforcing type
+  CEnfdProp::EPropEnforcingType epetParallelism = prpp->Pepar()->Epet(exprhdl, popPhysical, fParallelismReqd);
+
   // Skip adding enforcers entirely if any property determines it to be
   // 'prohibited'. In this way, a property may veto out the creation of an
   // enforcer for the current group expression and optimization context.
@@ -1730,7 +1825,7 @@ bool CEngine::FCheckEnfdProps(CMemoryPool *mp, CGroupExpression *pgexpr, COptimi
   // expression G because it was prohibited, some other group expression H may
   // decide to add it. And if E is added, it is possible for E to consider both
   // G and H as its child.
-  if (FProhibited(epetOrder, epetPartitionPropagation)) {
+  if (FProhibited(epetOrder, epetPartitionPropagation, epetParallelism)) {
     pcc->Release();
     return false;
   }
@@ -1745,6 +1840,7 @@ bool CEngine::FCheckEnfdProps(CMemoryPool *mp, CGroupExpression *pgexpr, COptimi
 
   prpp->Peo()->AppendEnforcers(mp, prpp, pdrgpexprEnforcers, pexpr, epetOrder, exprhdl);
   prpp->Pepp()->AppendEnforcers(mp, prpp, pdrgpexprEnforcers, pexpr, epetPartitionPropagation, exprhdl);
+  prpp->Pepar()->AppendEnforcers(mp, prpp, pdrgpexprEnforcers, pexpr, epetParallelism, exprhdl);
 
   if (0 < pdrgpexprEnforcers->Size()) {
     AddEnforcers(exprhdl.Pgexpr(), pdrgpexprEnforcers);
@@ -1753,7 +1849,7 @@ bool CEngine::FCheckEnfdProps(CMemoryPool *mp, CGroupExpression *pgexpr, COptimi
   pexpr->Release();
   pcc->Release();
 
-  return FOptimize(epetOrder, epetPartitionPropagation);
+  return FOptimize(epetOrder, epetPartitionPropagation, epetParallelism);
 }
 
 //---------------------------------------------------------------------------
@@ -1786,8 +1882,10 @@ bool CEngine::FChildrenOptimized(COptimizationContextArray *pdrgpoc) {
 //		types
 //
 //---------------------------------------------------------------------------
-bool CEngine::FOptimize(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation) {
-  return CEnfdProp::FOptimize(epetOrder) && CEnfdProp::FOptimize(epetPropagation);
+bool CEngine::FOptimize(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation,
+                        CEnfdProp::EPropEnforcingType epetParallelism) {
+  return CEnfdProp::FOptimize(epetOrder) && CEnfdProp::FOptimize(epetPropagation) &&
+         CEnfdProp::FOptimize(epetParallelism);
 }
 
 //---------------------------------------------------------------------------
@@ -1798,8 +1896,10 @@ bool CEngine::FOptimize(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPro
 //		Check if any of the given property enforcing types prohibits enforcement
 //
 //---------------------------------------------------------------------------
-bool CEngine::FProhibited(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation) {
-  return (CEnfdProp::EpetProhibited == epetOrder || CEnfdProp::EpetProhibited == epetPropagation);
+bool CEngine::FProhibited(CEnfdProp::EPropEnforcingType epetOrder, CEnfdProp::EPropEnforcingType epetPropagation,
+                          CEnfdProp::EPropEnforcingType epetParallelism) {
+  return (CEnfdProp::EpetProhibited == epetOrder || CEnfdProp::EpetProhibited == epetPropagation ||
+          CEnfdProp::EpetProhibited == epetParallelism);
 }
 
 //---------------------------------------------------------------------------
@@ -1841,7 +1941,15 @@ bool CEngine::FCheckReqdProps(CExpressionHandle &exprhdl, CReqdPropPlan *prpp, u
   // this check is required to avoid self-deadlocks, i.e.
   // sort optimizing same group with the same optimization context;
   bool fOrderReqd = !prpp->Peo()->PosRequired()->IsEmpty();
-  if (!fOrderReqd && COperator::EopPhysicalSort == op_id) {
+  if (!fOrderReqd && (COperator::EopPhysicalSort == op_id || COperator::EopPhysicalIncrementalSort == op_id)) {
+    return false;
+  }
+
+  // likewise, an incremental sort requires its presorted prefix from its
+  // own group, so it must not be optimized for an order that prefix
+  // already satisfies
+  if (COperator::EopPhysicalIncrementalSort == op_id &&
+      CPhysicalIncrementalSort::PopConvert(popPhysical)->PosPresorted()->FSatisfies(prpp->Peo()->PosRequired())) {
     return false;
   }
 
@@ -1860,6 +1968,14 @@ bool CEngine::FCheckReqdProps(CExpressionHandle &exprhdl, CReqdPropPlan *prpp, u
     }
   }
 
+  // a Gather is only useful where the leader needs a complete result; this
+  // also keeps a Gather from optimizing its own group under the partial
+  // requirement it passes to its child
+  if (COperator::EopPhysicalGather == op_id &&
+      CParallelSpec::EptSingleton != prpp->Pepar()->PparRequired()->Ept()) {
+    return false;
+  }
+
   return true;
 }
 
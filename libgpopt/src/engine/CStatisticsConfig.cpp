@@ -70,6 +70,7 @@ void CStatisticsConfig::AddMissingStatsColumn(CMDIdColStats *pmdidCol) {
   GPOS_ASSERT(nullptr != pmdidCol);
 
   // add the new column information to the hash set
+  CAutoMutex am(m_mutex);
   if (m_phsmdidcolinfo->Insert(pmdidCol)) {
     pmdidCol->AddRef();
   }
@@ -86,6 +86,11 @@ void gpopt::EresExceptionInit(CMemoryPool *mp) {
 
       CMessage(CException(gpopt::ExmaGPOPT, gpopt::ExmiNoStats), CException::ExsevError,
                GPOS_WSZ_WSZLEN("Missing group stats in %ls"), 1, GPOS_WSZ_WSZLEN("Missing group stats")),
+
+      CMessage(CException(gpopt::ExmaGPOPT, gpopt::ExmiInvalidSearchStrategy), CException::ExsevError,
+               GPOS_WSZ_WSZLEN("Invalid search strategy at offset %d: %s"),
+               2,  // offset, reason
+               GPOS_WSZ_WSZLEN("Invalid search strategy")),
   };
 
   // copy exception array into heap
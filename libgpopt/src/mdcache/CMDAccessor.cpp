@@ -23,6 +23,7 @@
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/task/CAutoSuspendAbort.h"
+#include "gpos/task/CWorkerPoolManager.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/CMDIdCast.h"
@@ -59,6 +60,23 @@ using namespace gpdxl;
 // invalid mdid pointer
 const MdidPtr CMDAccessor::SMDAccessorElem::m_pmdidInvalid = nullptr;
 
+// arguments of a metadata fetch forwarded to the main worker
+struct SMDFetchArgs {
+  IMDProvider *m_pmdp;
+  CMemoryPool *m_mp;
+  CMDAccessor *m_md_accessor;
+  IMDId *m_mdid;
+  IMDCacheObject::Emdtype m_mdtype;
+};
+
+// fetch an object from the MD provider; providers may enter the host
+// system, so helper workers run this on the main worker
+static void *FetchMDObj(void *pv) {
+  SMDFetchArgs *args = static_cast<SMDFetchArgs *>(pv);
+
+  return args->m_pmdp->GetMDObj(args->m_mp, args->m_md_accessor, args->m_mdid, args->m_mdtype);
+}
+
 // invalid md provider element
 const CMDAccessor::SMDProviderElem CMDAccessor::SMDProviderElem::m_mdpelemInvalid(CSystemId(IMDId::EmdidSentinel,
                                                                                             nullptr, 0),
@@ -462,7 +480,8 @@ const IMDCacheObject *CMDAccessor::GetImdObj(IMDId *mdid, IMDCacheObject::Emdtyp
       mdidCopy = mdid->Copy(mp);
       GPOS_ASSERT(mdidCopy->Equals(mdid));
 
-      pmdobjNew = pmdp->GetMDObj(mp, this, mdidCopy, mdtype);
+      SMDFetchArgs args{pmdp, mp, this, mdidCopy, mdtype};
+      pmdobjNew = static_cast<IMDCacheObject *>(CWorkerPoolManager::ExecuteOnMainWorker(FetchMDObj, &args));
       GPOS_ASSERT(nullptr != pmdobjNew);
 
       if (fPrintOptStats) {
@@ -11,7 +11,14 @@
 
 #include "gpopt/mdcache/CMDCache.h"
 
+#include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/task/CAutoTraceFlag.h"
+#include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/md/CMDIdRelStats.h"
+#include "naucrates/md/IMDCheckConstraint.h"
+#include "naucrates/md/IMDExtStatsInfo.h"
+#include "naucrates/md/IMDRelation.h"
 
 using namespace gpos;
 using namespace gpmd;
@@ -23,6 +30,99 @@ CMDAccessor::MDCache *CMDCache::m_pcache = nullptr;
 // maximum size of the cache
 uint64_t CMDCache::m_ullCacheQuota = UNLIMITED_CACHE_QUOTA;
 
+// event counters
+uint64_t CMDCache::m_rgullEventCounters[EmdceSentinel] = {0};
+
+// predicate passed through to the underlying cache
+struct SMDObjMatchCtxt {
+  CMDCache::MDObjMatchFunc m_match_func;
+  void *m_arg;
+};
+
+// objects to be evicted when a relation is invalidated
+struct SRelationEvictionCtxt {
+  CMemoryPool *m_mp;
+
+  OID m_rel_oid;
+
+  // indexes and extended statistics of the relation, collected while
+  // evicting the relation itself
+  ULongPtrArray *m_dependent_oids;
+};
+
+// adapt a metadata object predicate to the cache entry interface
+static bool FMatchCacheEntry(CMDKey *const &, IMDCacheObject *md_obj, void *arg) {
+  SMDObjMatchCtxt *ctxt = static_cast<SMDObjMatchCtxt *>(arg);
+
+  return ctxt->m_match_func(md_obj, ctxt->m_arg);
+}
+
+// oid of a relation-level mdid
+static OID RelOid(const IMDId *mdid) {
+  return CMDIdGPDB::CastMdid(mdid)->Oid();
+}
+
+// does the object belong to the invalidated relation?
+static bool FRelationObject(const IMDCacheObject *md_obj, void *arg) {
+  SRelationEvictionCtxt *ctxt = static_cast<SRelationEvictionCtxt *>(arg);
+  const IMDId *mdid = md_obj->MDId();
+
+  switch (mdid->MdidType()) {
+    case IMDId::EmdidRel: {
+      if (ctxt->m_rel_oid != RelOid(mdid)) {
+        return false;
+      }
+
+      const IMDRelation *md_rel = dynamic_cast<const IMDRelation *>(md_obj);
+      for (uint32_t ul = 0; ul < md_rel->IndexCount(); ul++) {
+        ctxt->m_dependent_oids->Append(GPOS_NEW(ctxt->m_mp) uint32_t(RelOid(md_rel->IndexMDidAt(ul))));
+      }
+      return true;
+    }
+    case IMDId::EmdidExtStatsInfo: {
+      if (ctxt->m_rel_oid != RelOid(mdid)) {
+        return false;
+      }
+
+      CMDExtStatsInfoArray *ext_stats = dynamic_cast<const IMDExtStatsInfo *>(md_obj)->GetExtStatInfoArray();
+      for (uint32_t ul = 0; ul < ext_stats->Size(); ul++) {
+        ctxt->m_dependent_oids->Append(GPOS_NEW(ctxt->m_mp) uint32_t((*ext_stats)[ul]->GetStatOid()));
+      }
+      return true;
+    }
+    case IMDId::EmdidInd:
+      // an index is invalidated through its own relcache entry
+      return ctxt->m_rel_oid == RelOid(mdid);
+    case IMDId::EmdidRelStats:
+      return ctxt->m_rel_oid == RelOid(CMDIdRelStats::CastMdid(mdid)->GetRelMdId());
+    case IMDId::EmdidColStats:
+      return ctxt->m_rel_oid == RelOid(CMDIdColStats::CastMdid(mdid)->GetRelMdId());
+    case IMDId::EmdidCheckConstraint:
+      return ctxt->m_rel_oid == RelOid(dynamic_cast<const IMDCheckConstraint *>(md_obj)->GetRelMdId());
+    default:
+      return false;
+  }
+}
+
+// is the object an index or extended statistic of the invalidated relation?
+static bool FRelationDependentObject(const IMDCacheObject *md_obj, void *arg) {
+  SRelationEvictionCtxt *ctxt = static_cast<SRelationEvictionCtxt *>(arg);
+  const IMDId *mdid = md_obj->MDId();
+
+  if (IMDId::EmdidInd != mdid->MdidType() && IMDId::EmdidExtStats != mdid->MdidType()) {
+    return false;
+  }
+
+  OID oid = RelOid(mdid);
+  for (uint32_t ul = 0; ul < ctxt->m_dependent_oids->Size(); ul++) {
+    if (oid == *(*ctxt->m_dependent_oids)[ul]) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMDCache::Init
@@ -107,4 +207,62 @@ void CMDCache::Reset() {
   Init();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::Evict
+//
+//	@doc:
+//		Evict all objects accepted by the given predicate. Objects currently
+//		in use are released once their last accessor goes away
+//
+//---------------------------------------------------------------------------
+uint64_t CMDCache::Evict(MDObjMatchFunc match_func, void *arg) {
+  GPOS_ASSERT(nullptr != m_pcache && "Metadata cache was not created");
+
+  SMDObjMatchCtxt ctxt = {match_func, arg};
+  return m_pcache->EvictMatching(FMatchCacheEntry, &ctxt);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::EvictRelation
+//
+//	@doc:
+//		Evict a relation together with the objects derived from it: its
+//		relation and column statistics, indexes, check constraints and
+//		extended statistics
+//
+//---------------------------------------------------------------------------
+uint64_t CMDCache::EvictRelation(OID rel_oid) {
+  CAutoMemoryPool amp;
+  CMemoryPool *mp = amp.Pmp();
+
+  SRelationEvictionCtxt ctxt = {mp, rel_oid, GPOS_NEW(mp) ULongPtrArray(mp)};
+  uint64_t num_evicted = Evict(FRelationObject, &ctxt);
+
+  if (0 < ctxt.m_dependent_oids->Size()) {
+    num_evicted += Evict(FRelationDependentObject, &ctxt);
+  }
+  ctxt.m_dependent_oids->Release();
+
+  return num_evicted;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CMDCache::FConsistent
+//
+//	@doc:
+//		Check that no entry is still pinned. Called after the metadata
+//		accessors of a failed optimization are destroyed, a pinned entry
+//		means that an accessor was leaked while unwinding, and the cache
+//		must not be trusted anymore
+//
+//---------------------------------------------------------------------------
+bool CMDCache::FConsistent() {
+  GPOS_ASSERT(nullptr != m_pcache && "Metadata cache was not created");
+
+  return 0 == m_pcache->PinnedEntries();
+}
+
 // EOF
@@ -494,7 +494,8 @@ CXformSet *CLogicalGbAgg::PxfsCandidates(CMemoryPool *mp) const {
   if (FGlobal()) {
     (void)xform_set->ExchangeSet(CXform::ExfSplitGbAgg);
   }
-  (void)xform_set->ExchangeSet(CXform::ExfSplitDQA);
+  // no ExfSplitDQA: its plans need an intermediate aggregate stage, which
+  // the executor does not have
   (void)xform_set->ExchangeSet(CXform::ExfGbAgg2Apply);
   (void)xform_set->ExchangeSet(CXform::ExfGbAgg2HashAgg);
   (void)xform_set->ExchangeSet(CXform::ExfGbAgg2StreamAgg);
@@ -59,6 +59,7 @@ CXformSet *CLogicalInnerJoin::PxfsCandidates(CMemoryPool *mp) const {
   CXformSet *xform_set = GPOS_NEW(mp) CXformSet(mp);
 
   (void)xform_set->ExchangeSet(CXform::ExfImplementInnerJoin);
+  (void)xform_set->ExchangeSet(CXform::ExfInnerJoin2MergeJoin);
   (void)xform_set->ExchangeSet(CXform::ExfSubqJoin2Apply);
   (void)xform_set->ExchangeSet(CXform::ExfJoin2BitmapIndexGetApply);
   (void)xform_set->ExchangeSet(CXform::ExfJoin2IndexGetApply);
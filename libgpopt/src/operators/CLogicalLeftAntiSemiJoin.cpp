@@ -65,6 +65,7 @@ CXformSet *CLogicalLeftAntiSemiJoin::PxfsCandidates(CMemoryPool *mp) const {
   (void)xform_set->ExchangeSet(CXform::ExfLeftAntiSemiJoin2CrossProduct);
   (void)xform_set->ExchangeSet(CXform::ExfLeftAntiSemiJoin2NLJoin);
   (void)xform_set->ExchangeSet(CXform::ExfLeftAntiSemiJoin2HashJoin);
+  (void)xform_set->ExchangeSet(CXform::ExfLeftAntiSemiJoin2MergeJoin);
   return xform_set;
 }
 
@@ -53,6 +53,7 @@ CXformSet *CLogicalLeftSemiJoin::PxfsCandidates(CMemoryPool *mp) const {
   (void)xform_set->ExchangeSet(CXform::ExfLeftSemiJoin2CrossProduct);
   (void)xform_set->ExchangeSet(CXform::ExfLeftSemiJoin2NLJoin);
   (void)xform_set->ExchangeSet(CXform::ExfLeftSemiJoin2HashJoin);
+  (void)xform_set->ExchangeSet(CXform::ExfLeftSemiJoin2MergeJoin);
 
   return xform_set;
 }
@@ -523,4 +523,102 @@ CPartitionPropagationSpec *CPhysical::PppsDerive(CMemoryPool *mp, CExpressionHan
   return pps_result;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysical::PparRequired
+//
+//	@doc:
+//		Compute required parallelism of the n-th child; by default an
+//		operator needs complete inputs, so a partial requirement is turned
+//		into a serial one
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysical::PparRequired(CMemoryPool *mp,
+                                       CExpressionHandle &,  // exprhdl
+                                       CParallelSpec *pparRequired,
+                                       uint32_t,          // child_index
+                                       CDrvdPropArray *,  // pdrgpdpCtxt
+                                       uint32_t           // ulOptReq
+) const {
+  if (CParallelSpec::EptAny == pparRequired->Ept() || CParallelSpec::EptSingleton == pparRequired->Ept()) {
+    return PparPassThru(pparRequired);
+  }
+
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSerial);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysical::PparDerive
+//
+//	@doc:
+//		Derive parallelism; the result is leader-only as soon as one of the
+//		children is, and complete otherwise
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysical::PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const {
+  for (uint32_t ul = 0; ul < exprhdl.Arity(); ++ul) {
+    if (exprhdl.FScalarChild(ul)) {
+      continue;
+    }
+
+    if (CParallelSpec::EptSingleton == exprhdl.Pdpplan(ul)->Ppar()->Ept()) {
+      return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSingleton);
+    }
+  }
+
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSerial);
+}
+
+CEnfdProp::EPropEnforcingType CPhysical::EpetParallelism(CExpressionHandle &exprhdl,
+                                                         const CEnfdParallelism *pepar) const {
+  GPOS_ASSERT(nullptr != pepar);
+
+  CParallelSpec *ppar_drvd = CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Ppar();
+  if (pepar->FCompatible(ppar_drvd)) {
+    return CEnfdProp::EpetUnnecessary;
+  }
+
+  return CEnfdProp::EpetRequired;
+}
+
+CParallelSpec *CPhysical::PparPassThru(CParallelSpec *pparRequired) {
+  pparRequired->AddRef();
+  return pparRequired;
+}
+
+CParallelSpec *CPhysical::PparDerivePassThruOuter(CExpressionHandle &exprhdl) {
+  CParallelSpec *ppar = exprhdl.Pdpplan(0 /*child_index*/)->Ppar();
+  ppar->AddRef();
+
+  return ppar;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysical::EpetParallelismPassThru
+//
+//	@doc:
+//		A complete result computed without a Gather below can either be
+//		used as is or be computed in parallel under a Gather on top, so the
+//		enforcer is optional there
+//
+//---------------------------------------------------------------------------
+CEnfdProp::EPropEnforcingType CPhysical::EpetParallelismPassThru(CExpressionHandle &exprhdl,
+                                                                 const CEnfdParallelism *pepar) {
+  GPOS_ASSERT(nullptr != pepar);
+
+  CParallelSpec *ppar_drvd = CDrvdPropPlan::Pdpplan(exprhdl.Pdp())->Ppar();
+  if (CParallelSpec::EptSingleton == pepar->PparRequired()->Ept() &&
+      CParallelSpec::EptSerial == ppar_drvd->Ept()) {
+    return CEnfdProp::EpetOptional;
+  }
+
+  if (pepar->FCompatible(ppar_drvd)) {
+    return CEnfdProp::EpetUnnecessary;
+  }
+
+  return CEnfdProp::EpetRequired;
+}
+
 // EOF
@@ -182,6 +182,61 @@ CCTEReq *CPhysicalAgg::PcteRequired(CMemoryPool *,        // mp,
   return PcterPushThru(pcter);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalAgg::PparRequired
+//
+//	@doc:
+//		Compute required parallelism of the n-th child; a local aggregate
+//		only emits partial states, so it may run in every process below a
+//		Gather and leave combining them to the global aggregate above it
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalAgg::PparRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CParallelSpec *pparRequired,
+                                          uint32_t child_index, CDrvdPropArray *pdrgpdpCtxt, uint32_t ulOptReq) const {
+  GPOS_ASSERT(0 == child_index);
+
+  if (COperator::EgbaggtypeLocal == m_egbaggtype) {
+    return PparPassThru(pparRequired);
+  }
+
+  return CPhysical::PparRequired(mp, exprhdl, pparRequired, child_index, pdrgpdpCtxt, ulOptReq);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalAgg::PparDerive
+//
+//	@doc:
+//		Derive parallelism
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalAgg::PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const {
+  if (COperator::EgbaggtypeLocal == m_egbaggtype) {
+    return PparDerivePassThruOuter(exprhdl);
+  }
+
+  return CPhysical::PparDerive(mp, exprhdl);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalAgg::EpetParallelism
+//
+//	@doc:
+//		Return the enforcing type for parallelism property based on this
+//		operator
+//
+//---------------------------------------------------------------------------
+CEnfdProp::EPropEnforcingType CPhysicalAgg::EpetParallelism(CExpressionHandle &exprhdl,
+                                                            const CEnfdParallelism *pepar) const {
+  if (COperator::EgbaggtypeLocal == m_egbaggtype) {
+    return EpetParallelismPassThru(exprhdl, pepar);
+  }
+
+  return CPhysical::EpetParallelism(exprhdl, pepar);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalAgg::FProvidesReqdCols
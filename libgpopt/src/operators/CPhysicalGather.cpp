@@ -0,0 +1,261 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalGather.cpp
+//
+//	@doc:
+//		Implementation of physical Gather / Gather Merge operator
+//---------------------------------------------------------------------------
+
+#include "gpopt/operators/CPhysicalGather.h"
+
+#include "gpopt/base/CCTEMap.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::CPhysicalGather
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalGather::CPhysicalGather(CMemoryPool *mp, COrderSpec *pos)
+    : CPhysical(mp),
+      m_pos(pos),  // caller must add-ref pos
+      m_pcrsSort(nullptr) {
+  GPOS_ASSERT(nullptr != pos);
+
+  m_pcrsSort = m_pos->PcrsUsed(mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::~CPhysicalGather
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalGather::~CPhysicalGather() {
+  m_pos->Release();
+  m_pcrsSort->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::Matches
+//
+//	@doc:
+//		Match operator
+//
+//---------------------------------------------------------------------------
+bool CPhysicalGather::Matches(COperator *pop) const {
+  if (Eopid() != pop->Eopid()) {
+    return false;
+  }
+
+  CPhysicalGather *popGather = CPhysicalGather::PopConvert(pop);
+  return m_pos->Matches(popGather->Pos());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::PcrsRequired
+//
+//	@doc:
+//		Compute required columns of the n-th child
+//
+//---------------------------------------------------------------------------
+CColRefSet *CPhysicalGather::PcrsRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, CColRefSet *pcrsRequired,
+                                          uint32_t child_index,
+                                          CDrvdPropArray *,  // pdrgpdpCtxt
+                                          uint32_t           // ulOptReq
+) {
+  GPOS_ASSERT(0 == child_index);
+
+  CColRefSet *pcrs = GPOS_NEW(mp) CColRefSet(mp, *m_pcrsSort);
+  pcrs->Union(pcrsRequired);
+  CColRefSet *pcrsChildReqd = PcrsChildReqd(mp, exprhdl, pcrs, child_index, UINT32_MAX);
+  pcrs->Release();
+
+  return pcrsChildReqd;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::PosRequired
+//
+//	@doc:
+//		Compute required sort order of the n-th child; a Gather Merge
+//		needs every process to deliver its part in merge order
+//
+//---------------------------------------------------------------------------
+COrderSpec *CPhysicalGather::PosRequired(CMemoryPool *,        // mp
+                                         CExpressionHandle &,  // exprhdl
+                                         COrderSpec *,         // posRequired
+                                         uint32_t
+#ifdef GPOS_DEBUG
+                                             child_index
+#endif  // GPOS_DEBUG
+                                         ,
+                                         CDrvdPropArray *,  // pdrgpdpCtxt
+                                         uint32_t           // ulOptReq
+) const {
+  GPOS_ASSERT(0 == child_index);
+
+  m_pos->AddRef();
+  return m_pos;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::PparRequired
+//
+//	@doc:
+//		Compute required parallelism of the n-th child
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalGather::PparRequired(CMemoryPool *mp,
+                                             CExpressionHandle &,  // exprhdl
+                                             CParallelSpec *,      // pparRequired
+                                             uint32_t
+#ifdef GPOS_DEBUG
+                                                 child_index
+#endif  // GPOS_DEBUG
+                                             ,
+                                             CDrvdPropArray *,  // pdrgpdpCtxt
+                                             uint32_t           // ulOptReq
+) const {
+  GPOS_ASSERT(0 == child_index);
+
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptPartial);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::PcteRequired
+//
+//	@doc:
+//		Compute required CTE map of the n-th child
+//
+//---------------------------------------------------------------------------
+CCTEReq *CPhysicalGather::PcteRequired(CMemoryPool *,        // mp,
+                                       CExpressionHandle &,  // exprhdl,
+                                       CCTEReq *pcter,
+                                       uint32_t
+#ifdef GPOS_DEBUG
+                                           child_index
+#endif
+                                       ,
+                                       CDrvdPropArray *,  // pdrgpdpCtxt,
+                                       uint32_t           // ulOptReq
+) const {
+  GPOS_ASSERT(0 == child_index);
+  return PcterPushThru(pcter);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::FProvidesReqdCols
+//
+//	@doc:
+//		Check if required columns are included in output columns
+//
+//---------------------------------------------------------------------------
+bool CPhysicalGather::FProvidesReqdCols(CExpressionHandle &exprhdl, CColRefSet *pcrsRequired,
+                                        uint32_t  // ulOptReq
+) const {
+  return FUnaryProvidesReqdCols(exprhdl, pcrsRequired);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::PosDerive
+//
+//	@doc:
+//		Derive sort order; a plain Gather interleaves the rows of all
+//		processes and delivers no order
+//
+//---------------------------------------------------------------------------
+COrderSpec *CPhysicalGather::PosDerive(CMemoryPool *,       // mp
+                                       CExpressionHandle &  // exprhdl
+) const {
+  m_pos->AddRef();
+  return m_pos;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::PparDerive
+//
+//	@doc:
+//		Derive parallelism
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalGather::PparDerive(CMemoryPool *mp,
+                                           CExpressionHandle &  // exprhdl
+) const {
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSingleton);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::EpetOrder
+//
+//	@doc:
+//		Return the enforcing type for order property based on this operator
+//
+//---------------------------------------------------------------------------
+CEnfdProp::EPropEnforcingType CPhysicalGather::EpetOrder(CExpressionHandle &,  // exprhdl
+                                                         const CEnfdOrder *peo) const {
+  GPOS_ASSERT(nullptr != peo);
+  GPOS_ASSERT(!peo->PosRequired()->IsEmpty());
+
+  if (peo->FCompatible(m_pos)) {
+    // required order is already established by the merge
+    return CEnfdProp::EpetUnnecessary;
+  }
+
+  if (FMerge()) {
+    // a Gather Merge on a different order is never useful below a sort
+    return CEnfdProp::EpetProhibited;
+  }
+
+  return CEnfdProp::EpetRequired;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::EpetParallelism
+//
+//	@doc:
+//		Return the enforcing type for parallelism property based on this
+//		operator
+//
+//---------------------------------------------------------------------------
+CEnfdProp::EPropEnforcingType CPhysicalGather::EpetParallelism(CExpressionHandle &,  // exprhdl
+                                                               const CEnfdParallelism *pepar) const {
+  GPOS_ASSERT(nullptr != pepar);
+
+  // a Gather is only kept where the leader needs a complete result, see
+  // CEngine::FCheckReqdProps
+  return CEnfdProp::EpetUnnecessary;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalGather::OsPrint
+//
+//	@doc:
+//		Debug print
+//
+//---------------------------------------------------------------------------
+IOstream &CPhysicalGather::OsPrint(IOstream &os) const {
+  os << SzId() << "  ";
+  return m_pos->OsPrint(os);
+}
+
+// EOF
@@ -268,7 +268,8 @@ void CPhysicalHashJoin::CreateOptRequests() {
   // we also generate this additional request for expressions that originated
   // from CXformExpandNAryJoinGreedy.
   CPhysicalJoin *physical_join = dynamic_cast<CPhysicalJoin *>(this);
-  if ((GPOPT_FDISABLED_XFORM(CXform::ExfExpandNAryJoinDP) && GPOPT_FDISABLED_XFORM(CXform::ExfExpandNAryJoinDPv2)) ||
+  if ((GPOPT_FDISABLED_XFORM(CXform::ExfExpandNAryJoinDP) && GPOPT_FDISABLED_XFORM(CXform::ExfExpandNAryJoinDPv2) &&
+       GPOPT_FDISABLED_XFORM(CXform::ExfExpandNAryJoinDPhyp)) ||
       physical_join->OriginXform() == CXform::ExfExpandNAryJoinGreedy) {
     SetPartPropagateRequests(2);
   } else {
@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalIncrementalSort.cpp
+//
+//	@doc:
+//		Implementation of physical incremental sort operator
+//---------------------------------------------------------------------------
+
+#include "gpopt/operators/CPhysicalIncrementalSort.h"
+
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIncrementalSort::CPhysicalIncrementalSort
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CPhysicalIncrementalSort::CPhysicalIncrementalSort(CMemoryPool *mp, COrderSpec *pos, COrderSpec *posPresorted)
+    : CPhysicalSort(mp, pos),
+      m_posPresorted(posPresorted)  // caller must add-ref posPresorted
+{
+  GPOS_ASSERT(nullptr != posPresorted);
+  GPOS_ASSERT(!posPresorted->IsEmpty());
+  GPOS_ASSERT(posPresorted->UlSortColumns() < pos->UlSortColumns());
+  GPOS_ASSERT(pos->FSatisfies(posPresorted));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIncrementalSort::~CPhysicalIncrementalSort
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CPhysicalIncrementalSort::~CPhysicalIncrementalSort() {
+  m_posPresorted->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIncrementalSort::Matches
+//
+//	@doc:
+//		Match operator
+//
+//---------------------------------------------------------------------------
+bool CPhysicalIncrementalSort::Matches(COperator *pop) const {
+  if (Eopid() != pop->Eopid()) {
+    return false;
+  }
+
+  CPhysicalIncrementalSort *popSort = CPhysicalIncrementalSort::PopConvert(pop);
+  return Pos()->Matches(popSort->Pos()) && m_posPresorted->Matches(popSort->PosPresorted());
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIncrementalSort::PosRequired
+//
+//	@doc:
+//		Compute required sort order of the n-th child; unlike a full sort,
+//		the child has to deliver the presorted prefix
+//
+//---------------------------------------------------------------------------
+COrderSpec *CPhysicalIncrementalSort::PosRequired(CMemoryPool *,        // mp
+                                                  CExpressionHandle &,  // exprhdl
+                                                  COrderSpec *,         // posRequired
+                                                  uint32_t
+#ifdef GPOS_DEBUG
+                                                      child_index
+#endif  // GPOS_DEBUG
+                                                  ,
+                                                  CDrvdPropArray *,  // pdrgpdpCtxt
+                                                  uint32_t           // ulOptReq
+) const {
+  GPOS_ASSERT(0 == child_index);
+
+  m_posPresorted->AddRef();
+  return m_posPresorted;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalIncrementalSort::OsPrint
+//
+//	@doc:
+//		Debug print
+//
+//---------------------------------------------------------------------------
+IOstream &CPhysicalIncrementalSort::OsPrint(IOstream &os) const {
+  os << SzId() << "  ";
+  Pos()->OsPrint(os);
+  os << " presorted: ";
+  return m_posPresorted->OsPrint(os);
+}
+
+// EOF
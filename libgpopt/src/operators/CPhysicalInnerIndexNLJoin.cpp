@@ -26,8 +26,8 @@ using namespace gpopt;
 //
 //---------------------------------------------------------------------------
 CPhysicalInnerIndexNLJoin::CPhysicalInnerIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array,
-                                                     CExpression *origJoinPred)
-    : CPhysicalInnerNLJoin(mp), m_pdrgpcrOuterRefs(colref_array), m_origJoinPred(origJoinPred) {
+                                                     CExpression *origJoinPred, bool fMemoize)
+    : CPhysicalInnerNLJoin(mp), m_pdrgpcrOuterRefs(colref_array), m_origJoinPred(origJoinPred), m_fMemoize(fMemoize) {
   GPOS_ASSERT(nullptr != colref_array);
   if (nullptr != origJoinPred) {
     origJoinPred->AddRef();
@@ -57,8 +57,26 @@ CPhysicalInnerIndexNLJoin::~CPhysicalInnerIndexNLJoin() {
 //---------------------------------------------------------------------------
 bool CPhysicalInnerIndexNLJoin::Matches(COperator *pop) const {
   if (pop->Eopid() == Eopid()) {
-    return m_pdrgpcrOuterRefs->Equals(CPhysicalInnerIndexNLJoin::PopConvert(pop)->PdrgPcrOuterRefs());
+    CPhysicalInnerIndexNLJoin *popIndexNLJoin = CPhysicalInnerIndexNLJoin::PopConvert(pop);
+    return m_fMemoize == popIndexNLJoin->FMemoize() && m_pdrgpcrOuterRefs->Equals(popIndexNLJoin->PdrgPcrOuterRefs());
   }
 
   return false;
 }
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalInnerIndexNLJoin::OsPrint
+//
+//	@doc:
+//		Debug print
+//
+//---------------------------------------------------------------------------
+IOstream &CPhysicalInnerIndexNLJoin::OsPrint(IOstream &os) const {
+  os << SzId();
+  if (m_fMemoize) {
+    os << " (Memoize)";
+  }
+
+  return os;
+}
@@ -103,6 +103,62 @@ CCTEReq *CPhysicalJoin::PcteRequired(CMemoryPool *mp, CExpressionHandle &exprhdl
   return PcterNAry(mp, exprhdl, pcter, child_index, pdrgpdpCtxt);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalJoin::PparRequired
+//
+//	@doc:
+//		Compute required parallelism of the n-th child; a partial join is
+//		computed by joining a partial outer side with a complete inner side
+//		in every process. Nested loops joins rescan their inner side, which
+//		must then not contain a Gather.
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalJoin::PparRequired(CMemoryPool *mp,
+                                           CExpressionHandle &,  // exprhdl
+                                           CParallelSpec *pparRequired, uint32_t child_index,
+                                           CDrvdPropArray *,  // pdrgpdpCtxt
+                                           uint32_t           // ulOptReq
+) const {
+  GPOS_ASSERT(2 > child_index);
+
+  CParallelSpec::EParallelType ept = pparRequired->Ept();
+  if (0 == child_index || CParallelSpec::EptAny == ept) {
+    return PparPassThru(pparRequired);
+  }
+
+  if (CParallelSpec::EptSingleton == ept && !CUtils::FNLJoin(const_cast<CPhysicalJoin *>(this))) {
+    return PparPassThru(pparRequired);
+  }
+
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSerial);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalJoin::PparDerive
+//
+//	@doc:
+//		Derive parallelism; correlated joins are executed with parameters
+//		set by the leader and are never run in a worker
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalJoin::PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const {
+  CParallelSpec::EParallelType eptOuter = exprhdl.Pdpplan(0 /*child_index*/)->Ppar()->Ept();
+  CParallelSpec::EParallelType eptInner = exprhdl.Pdpplan(1 /*child_index*/)->Ppar()->Ept();
+
+  if (CParallelSpec::EptSingleton == eptOuter || CParallelSpec::EptSingleton == eptInner ||
+      CUtils::FCorrelatedNLJoin(const_cast<CPhysicalJoin *>(this))) {
+    return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSingleton);
+  }
+
+  if (CParallelSpec::EptPartial == eptOuter) {
+    return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptPartial);
+  }
+
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSerial);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalJoin::FProvidesReqdCols
@@ -15,8 +15,11 @@
 using namespace gpopt;
 
 CPhysicalLeftOuterIndexNLJoin::CPhysicalLeftOuterIndexNLJoin(CMemoryPool *mp, CColRefArray *colref_array,
-                                                             CExpression *origJoinPred)
-    : CPhysicalLeftOuterNLJoin(mp), m_pdrgpcrOuterRefs(colref_array), m_origJoinPred(origJoinPred) {
+                                                             CExpression *origJoinPred, bool fMemoize)
+    : CPhysicalLeftOuterNLJoin(mp),
+      m_pdrgpcrOuterRefs(colref_array),
+      m_origJoinPred(origJoinPred),
+      m_fMemoize(fMemoize) {
   GPOS_ASSERT(nullptr != colref_array);
   if (nullptr != origJoinPred) {
     origJoinPred->AddRef();
@@ -30,8 +33,18 @@ CPhysicalLeftOuterIndexNLJoin::~CPhysicalLeftOuterIndexNLJoin() {
 
 bool CPhysicalLeftOuterIndexNLJoin::Matches(COperator *pop) const {
   if (pop->Eopid() == Eopid()) {
-    return m_pdrgpcrOuterRefs->Equals(CPhysicalLeftOuterIndexNLJoin::PopConvert(pop)->PdrgPcrOuterRefs());
+    CPhysicalLeftOuterIndexNLJoin *popIndexNLJoin = CPhysicalLeftOuterIndexNLJoin::PopConvert(pop);
+    return m_fMemoize == popIndexNLJoin->FMemoize() && m_pdrgpcrOuterRefs->Equals(popIndexNLJoin->PdrgPcrOuterRefs());
   }
 
   return false;
 }
+
+IOstream &CPhysicalLeftOuterIndexNLJoin::OsPrint(IOstream &os) const {
+  os << SzId();
+  if (m_fMemoize) {
+    os << " (Memoize)";
+  }
+
+  return os;
+}
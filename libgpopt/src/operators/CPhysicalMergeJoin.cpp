@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPhysicalMergeJoin.cpp
+//
+//	@doc:
+//		Implementation of base merge join operator
+//---------------------------------------------------------------------------
+
+#include "gpopt/operators/CPhysicalMergeJoin.h"
+
+#include "gpopt/base/CCastUtils.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CExpressionHandle.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+// ctor
+CPhysicalMergeJoin::CPhysicalMergeJoin(CMemoryPool *mp, CExpressionArray *outer_merge_clauses,
+                                       CExpressionArray *inner_merge_clauses, CXform::EXformId origin_xform)
+    : CPhysicalJoin(mp, origin_xform),
+      m_outer_merge_clauses(outer_merge_clauses),
+      m_inner_merge_clauses(inner_merge_clauses) {
+  GPOS_ASSERT(nullptr != mp);
+  GPOS_ASSERT(nullptr != outer_merge_clauses);
+  GPOS_ASSERT(nullptr != inner_merge_clauses);
+  GPOS_ASSERT(outer_merge_clauses->Size() == inner_merge_clauses->Size());
+}
+
+// dtor
+CPhysicalMergeJoin::~CPhysicalMergeJoin() {
+  m_outer_merge_clauses->Release();
+  m_inner_merge_clauses->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMergeJoin::PosMergeKeys
+//
+//	@doc:
+//		Sort order on the merge keys of the given child
+//
+//---------------------------------------------------------------------------
+COrderSpec *CPhysicalMergeJoin::PosMergeKeys(CMemoryPool *mp, uint32_t child_index) const {
+  COrderSpec *os = GPOS_NEW(mp) COrderSpec(mp);
+
+  CExpressionArray *clauses;
+  if (child_index == 0) {
+    clauses = m_outer_merge_clauses;
+  } else {
+    GPOS_ASSERT(child_index == 1);
+    clauses = m_inner_merge_clauses;
+  }
+
+  for (uint32_t ul = 0; ul < clauses->Size(); ++ul) {
+    CExpression *expr = (*clauses)[ul];
+
+    GPOS_ASSERT(CUtils::FScalarIdent(expr));
+    const CColRef *colref = CCastUtils::PcrExtractFromScIdOrCastScId(expr);
+
+    // Make sure that the corresponding properties (mergeStrategies, mergeNullsFirst)
+    // in CTranslatorDXLToPlStmt::TranslateDXLMergeJoin() and
+    // PlanGenerator::GenerateMergeJoinPlan() match.
+    //
+    // NB: The operator used for sorting here is the '<' operator in the
+    // default btree opfamily of the column's type. For this to work correctly,
+    // the '=' operator of the merge join clauses must also belong to the same
+    // opfamily, which in this case, is the default of the type.
+    // See FMergeJoinCompatible() where predicates using a different opfamily
+    // are rejected from merge clauses.
+    gpmd::IMDId *mdid = colref->RetrieveType()->GetMdidForCmpType(IMDType::EcmptL);
+    mdid->AddRef();
+    os->Append(mdid, colref, COrderSpec::EntLast);
+  }
+
+  return os;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMergeJoin::PosRequired
+//
+//	@doc:
+//		Compute required sort order of the n-th child; the join emits its
+//		rows in the order of the outer child, so a required order that
+//		starts with the outer merge keys is completed by sorting the outer
+//		child on the remaining columns as well
+//
+//---------------------------------------------------------------------------
+COrderSpec *CPhysicalMergeJoin::PosRequired(CMemoryPool *mp, CExpressionHandle &exprhdl, COrderSpec *posInput,
+                                            uint32_t child_index,
+                                            CDrvdPropArray *,  // pdrgpdpCtxt
+                                            uint32_t           // ulOptReq
+) const {
+  COrderSpec *os = PosMergeKeys(mp, child_index);
+  if (0 != child_index) {
+    return os;
+  }
+
+  const uint32_t ulKeys = os->UlSortColumns();
+  const uint32_t ulReqd = posInput->UlSortColumns();
+  if (ulReqd <= ulKeys || !FSortColsInOuterChild(mp, exprhdl, posInput)) {
+    return os;
+  }
+
+  for (uint32_t ul = 0; ul < ulKeys; ul++) {
+    if (posInput->Pcr(ul) != os->Pcr(ul) || !posInput->GetMdIdSortOp(ul)->Equals(os->GetMdIdSortOp(ul)) ||
+        posInput->Ent(ul) != os->Ent(ul)) {
+      return os;
+    }
+  }
+
+  for (uint32_t ul = ulKeys; ul < ulReqd; ul++) {
+    IMDId *mdid = posInput->GetMdIdSortOp(ul);
+    mdid->AddRef();
+    os->Append(mdid, posInput->Pcr(ul), posInput->Ent(ul));
+  }
+
+  return os;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalMergeJoin::EpetOrder
+//
+//	@doc:
+//		Return the enforcing type for order property based on this operator;
+//		the order of the outer child is preserved, so an order on outer
+//		columns may be provided without a sort on top
+//
+//---------------------------------------------------------------------------
+CEnfdProp::EPropEnforcingType CPhysicalMergeJoin::EpetOrder(CExpressionHandle &exprhdl, const CEnfdOrder *peo) const {
+  GPOS_ASSERT(nullptr != peo);
+  GPOS_ASSERT(!peo->PosRequired()->IsEmpty());
+
+  if (FSortColsInOuterChild(m_mp, exprhdl, peo->PosRequired())) {
+    return CEnfdProp::EpetOptional;
+  }
+
+  return CEnfdProp::EpetRequired;
+}
+
+// EOF
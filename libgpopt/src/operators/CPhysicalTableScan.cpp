@@ -27,8 +27,8 @@ using namespace gpopt;
 //
 //---------------------------------------------------------------------------
 CPhysicalTableScan::CPhysicalTableScan(CMemoryPool *mp, const CName *pnameAlias, CTableDescriptor *ptabdesc,
-                                       CColRefArray *pdrgpcrOutput)
-    : CPhysicalScan(mp, pnameAlias, ptabdesc, pdrgpcrOutput) {}
+                                       CColRefArray *pdrgpcrOutput, bool parallel)
+    : CPhysicalScan(mp, pnameAlias, ptabdesc, pdrgpcrOutput), m_parallel(parallel) {}
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -41,6 +41,7 @@ CPhysicalTableScan::CPhysicalTableScan(CMemoryPool *mp, const CName *pnameAlias,
 uint32_t CPhysicalTableScan::HashValue() const {
   uint32_t ulHash = gpos::CombineHashes(COperator::HashValue(), m_ptabdesc->MDId()->HashValue());
   ulHash = gpos::CombineHashes(ulHash, CUtils::UlHashColArray(m_pdrgpcrOutput));
+  ulHash = gpos::CombineHashes(ulHash, gpos::HashValue<bool>(&m_parallel));
 
   return ulHash;
 }
@@ -60,7 +61,26 @@ bool CPhysicalTableScan::Matches(COperator *pop) const {
 
   CPhysicalTableScan *popTableScan = CPhysicalTableScan::PopConvert(pop);
   return m_ptabdesc->MDId()->Equals(popTableScan->Ptabdesc()->MDId()) &&
-         m_pdrgpcrOutput->Equals(popTableScan->PdrgpcrOutput());
+         m_pdrgpcrOutput->Equals(popTableScan->PdrgpcrOutput()) && m_parallel == popTableScan->FParallel();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalTableScan::PparDerive
+//
+//	@doc:
+//		Derive parallelism; each process of a parallel scan returns the
+//		blocks it claimed
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalTableScan::PparDerive(CMemoryPool *mp,
+                                              CExpressionHandle &  // exprhdl
+) const {
+  if (m_parallel) {
+    return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptPartial);
+  }
+
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSerial);
 }
 
 //---------------------------------------------------------------------------
@@ -82,6 +102,10 @@ IOstream &CPhysicalTableScan::OsPrint(IOstream &os) const {
   m_ptabdesc->Name().OsPrint(os);
   os << ")";
 
+  if (m_parallel) {
+    os << " parallel";
+  }
+
   return os;
 }
 
@@ -172,6 +172,29 @@ COrderSpec *CPhysicalUnionAll::PosDerive(CMemoryPool *mp,
   return GPOS_NEW(mp) COrderSpec(mp);
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CPhysicalUnionAll::PparDerive
+//
+//	@doc:
+//		Derive parallelism; all children are requested the same
+//		parallelism, so a partial first child means a partial union
+//
+//---------------------------------------------------------------------------
+CParallelSpec *CPhysicalUnionAll::PparDerive(CMemoryPool *mp, CExpressionHandle &exprhdl) const {
+  for (uint32_t ul = 0; ul < exprhdl.Arity(); ++ul) {
+    if (CParallelSpec::EptSingleton == exprhdl.Pdpplan(ul)->Ppar()->Ept()) {
+      return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSingleton);
+    }
+  }
+
+  if (CParallelSpec::EptPartial == exprhdl.Pdpplan(0 /*child_index*/)->Ppar()->Ept()) {
+    return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptPartial);
+  }
+
+  return GPOS_NEW(mp) CParallelSpec(CParallelSpec::EptSerial);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CPhysicalUnionAll::EpetOrder
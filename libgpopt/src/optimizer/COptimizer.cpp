@@ -22,12 +22,16 @@
 #include "gpopt/engine/CStatisticsConfig.h"
 #include "gpopt/exception.h"
 #include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/operators/CPhysicalInnerIndexNLJoin.h"
+#include "gpopt/operators/CPhysicalLeftOuterIndexNLJoin.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
 #include "gpopt/translate/CTranslatorExprToDXL.h"
+#include "gpopt/translate/IQueryToExprTranslator.h"
 #include "gpopt/translate/plan_generator.h"
 #include "gpos/common/CBitSet.h"
 #include "gpos/error/CAutoTrace.h"
+#include "gpos/task/CAutoTraceFlag.h"
 #include "gpos/error/CErrorHandlerStandard.h"
 #include "gpos/io/CFileDescriptor.h"
 #include "naucrates/base/CDatumGenericGPDB.h"
@@ -143,35 +147,52 @@ void *COptimizer::PdxlnOptimize(CMemoryPool *mp, CMDAccessor *md_accessor, const
       gpdxl::ULongPtrArray *pdrgpul = dxltr.PdrgpulOutputColRefs();
       gpmd::CMDNameArray *pdrgpmdname = dxltr.Pdrgpmdname();
 
-      CQueryContext *pqc = CQueryContext::PqcGenerate(mp, pexprTranslated, pdrgpul, pdrgpmdname, true /*fDeriveStats*/);
-      GPOS_CHECK_ABORT;
+      pdxlnPlan = PvOptimizeTranslated(mp, md_accessor, pexprTranslated, pdrgpul, pdrgpmdname, search_stage_array,
+                                       optimizer_config);
+    }
+  }
+  GPOS_CATCH_EX(ex) {
+    GPOS_RETHROW(ex);
+  }
+  GPOS_CATCH_END;
 
-      PrintQueryOrPlan(mp, pexprTranslated, pqc);
+  return pdxlnPlan;
+}
 
-      CWStringDynamic strTrace(mp);
-      COstreamString oss(&strTrace);
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizer::PdxlnOptimize
+//
+//	@doc:
+//		Optimize a query that the given translator turns into an expression
+//		directly, without building a DXL tree first
+//
+//---------------------------------------------------------------------------
+void *COptimizer::PdxlnOptimize(CMemoryPool *mp, CMDAccessor *md_accessor, IQueryToExprTranslator *query_translator,
+                                IConstExprEvaluator *pceeval, CSearchStageArray *search_stage_array,
+                                COptimizerConfig *optimizer_config) {
+  GPOS_ASSERT(nullptr != md_accessor);
+  GPOS_ASSERT(nullptr != query_translator);
+  GPOS_ASSERT(nullptr != optimizer_config);
 
-      // if the number of inlinable CTEs is greater than the cutoff, then
-      // disable inlining for this query
-      if (!GPOS_FTRACE(EopttraceEnableCTEInlining) ||
-          CUtils::UlInlinableCTEs(pexprTranslated) > optimizer_config->GetCteConf()->UlCTEInliningCutoff()) {
-        COptCtxt::PoctxtFromTLS()->Pcteinfo()->DisableInlining();
+  void *pdxlnPlan = nullptr;
+  CErrorHandlerStandard errhdl;
+  GPOS_TRY_HDL(&errhdl) {
+    {
+      optimizer_config->AddRef();
+      if (nullptr != pceeval) {
+        pceeval->AddRef();
       }
 
-      GPOS_CHECK_ABORT;
-      // optimize logical expression tree into physical expression tree.
-      CExpression *pexprPlan = PexprOptimize(mp, pqc, search_stage_array);
+      // install opt context in TLS
+      CAutoOptCtxt aoc(mp, md_accessor, pceeval, optimizer_config);
+
+      // translate Query -> Expr Tree
+      CExpression *pexprTranslated = query_translator->PexprTranslateQuery();
       GPOS_CHECK_ABORT;
 
-      if (GPOS_CONDIF(enable_new_planner_generation)) {
-        PlanGenerator gen_plan{mp, md_accessor};
-        pdxlnPlan = (void *)gen_plan.GeneratePlan(pexprPlan, pqc->PdrgPcr(), pdrgpmdname);
-      } else {
-        pdxlnPlan = (void *)CreateDXLNode(mp, md_accessor, pexprPlan, pqc->PdrgPcr(), pdrgpmdname);
-      }
-      pexprTranslated->Release();
-      pexprPlan->Release();
-      GPOS_DELETE(pqc);
+      pdxlnPlan = PvOptimizeTranslated(mp, md_accessor, pexprTranslated, query_translator->PdrgpulOutputColRefs(),
+                                       query_translator->Pdrgpmdname(), search_stage_array, optimizer_config);
     }
   }
   GPOS_CATCH_EX(ex) {
@@ -182,6 +203,124 @@ void *COptimizer::PdxlnOptimize(CMemoryPool *mp, CMDAccessor *md_accessor, const
   return pdxlnPlan;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizer::FPlanGeneratorOnly
+//
+//	@doc:
+//		Does the plan use operators that only the plan generator emits?
+//
+//---------------------------------------------------------------------------
+bool COptimizer::FPlanGeneratorOnly(CExpression *pexprPlan) {
+  COperator *pop = pexprPlan->Pop();
+  switch (pop->Eopid()) {
+    case COperator::EopPhysicalInnerIndexNLJoin:
+      if (CPhysicalInnerIndexNLJoin::PopConvert(pop)->FMemoize()) {
+        return true;
+      }
+      break;
+
+    case COperator::EopPhysicalLeftOuterIndexNLJoin:
+      if (CPhysicalLeftOuterIndexNLJoin::PopConvert(pop)->FMemoize()) {
+        return true;
+      }
+      break;
+
+    case COperator::EopPhysicalIncrementalSort:
+      return true;
+
+    default:
+      break;
+  }
+
+  for (uint32_t ul = 0; ul < pexprPlan->Arity(); ul++) {
+    if (FPlanGeneratorOnly((*pexprPlan)[ul])) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptimizer::PvOptimizeTranslated
+//
+//	@doc:
+//		Optimize a translated query expression and produce the plan in the
+//		requested format; releases the expression
+//
+//---------------------------------------------------------------------------
+void *COptimizer::PvOptimizeTranslated(CMemoryPool *mp, CMDAccessor *md_accessor, CExpression *pexprTranslated,
+                                       ULongPtrArray *pdrgpul, CMDNameArray *pdrgpmdname,
+                                       CSearchStageArray *search_stage_array, COptimizerConfig *optimizer_config) {
+  void *pdxlnPlan = nullptr;
+
+  CQueryContext *pqc = CQueryContext::PqcGenerate(mp, pexprTranslated, pdrgpul, pdrgpmdname, true /*fDeriveStats*/);
+  GPOS_CHECK_ABORT;
+
+  PrintQueryOrPlan(mp, pexprTranslated, pqc);
+
+  // if the number of inlinable CTEs is greater than the cutoff, then
+  // disable inlining for this query
+  if (!GPOS_FTRACE(EopttraceEnableCTEInlining) ||
+      CUtils::UlInlinableCTEs(pexprTranslated) > optimizer_config->GetCteConf()->UlCTEInliningCutoff()) {
+    COptCtxt::PoctxtFromTLS()->Pcteinfo()->DisableInlining();
+  }
+
+  GPOS_CHECK_ABORT;
+  // the engine releases the search stages, keep them for a second search
+  // when the plan generator hands the plan back
+  if (nullptr != search_stage_array) {
+    search_stage_array->AddRef();
+  }
+
+  // optimize logical expression tree into physical expression tree.
+  CExpression *pexprPlan = PexprOptimize(mp, pqc, search_stage_array);
+  GPOS_CHECK_ABORT;
+
+  if (GPOS_CONDIF(enable_new_planner_generation)) {
+    GPOS_TRY {
+      PlanGenerator gen_plan{mp, md_accessor};
+      pdxlnPlan = (void *)gen_plan.GeneratePlan(pexprPlan, pqc->PdrgPcr(), pdrgpmdname);
+    }
+    GPOS_CATCH_EX(ex) {
+      if (!GPOS_MATCH_EX(ex, gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp)) {
+        GPOS_RETHROW(ex);
+      }
+
+      // the plan uses an operator the generator does not handle, hand the
+      // caller a DXL plan instead; DXL cannot express everything the plan
+      // was costed with, so search again without those operators
+      GPOS_RESET_EX;
+      if (FPlanGeneratorOnly(pexprPlan)) {
+        CAutoTraceFlag atfMemoize(EopttraceDisableMemoize, true);
+        CAutoTraceFlag atfIncrementalSort(EopttraceDisableIncrementalSort, true);
+
+        pexprPlan->Release();
+        if (nullptr != search_stage_array) {
+          search_stage_array->AddRef();
+        }
+        pexprPlan = PexprOptimize(mp, pqc, search_stage_array);
+        GPOS_CHECK_ABORT;
+      }
+
+      pdxlnPlan = (void *)new PlanResult{
+          .dxl_plan = CreateDXLNode(mp, md_accessor, pexprPlan, pqc->PdrgPcr(), pdrgpmdname),
+      };
+    }
+    GPOS_CATCH_END;
+  } else {
+    pdxlnPlan = (void *)CreateDXLNode(mp, md_accessor, pexprPlan, pqc->PdrgPcr(), pdrgpmdname);
+  }
+  pexprTranslated->Release();
+  pexprPlan->Release();
+  CRefCount::SafeRelease(search_stage_array);
+  GPOS_DELETE(pqc);
+
+  return pdxlnPlan;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptimizer::HandleExceptionAfterFinalizingMinidump
@@ -35,8 +35,6 @@
 using namespace gpnaucrates;
 using namespace gpopt;
 
-#define GPOPT_OPTCTXT_HT_BUCKETS 100
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CGroup::SContextLink::SContextLink
@@ -149,9 +147,8 @@ CGroup::CGroup(CMemoryPool *mp, bool fScalar)
   m_listGExprs.Init(GPOS_OFFSET(CGroupExpression, m_linkGroup));
   m_listDupGExprs.Init(GPOS_OFFSET(CGroupExpression, m_linkGroup));
 
-  m_sht.Init(mp, GPOPT_OPTCTXT_HT_BUCKETS, GPOS_OFFSET(COptimizationContext, m_link),
-             0, /*cKeyOffset (0 because we use COptimizationContext class as key)*/
-             &(COptimizationContext::m_ocInvalid), COptimizationContext::HashValue, COptimizationContext::Equals);
+  m_sht.Init(mp, 0, /*cKeyOffset (0 because we use COptimizationContext class as key)*/
+             COptimizationContext::HashValue, COptimizationContext::Equals);
   m_plinkmap = GPOS_NEW(mp) LinkMap(mp);
   m_pstatsmap = GPOS_NEW(mp) OptCtxtToIStatisticsMap(mp);
   m_pcostmap = GPOS_NEW(mp) ReqdPropPlanToCostMap(mp);
@@ -258,6 +255,7 @@ void CGroup::UpdateBestCost(COptimizationContext *poc, CCostContext *pcc) {
   }
 
   // update best cost context
+  CAutoMutex am(m_mutex);
   CCostContext *pccBest = pocFound->PccBest();
   if (GPOPT_INVALID_COST != pcc->Cost() && (nullptr == pccBest || pcc->FBetterThan(pccBest))) {
     pocFound->SetBest(pcc);
@@ -1663,7 +1661,11 @@ IStatistics *CGroup::PstatsCompute(COptimizationContext *poc, CExpressionHandle
   GPOS_ASSERT(nullptr != pgexpr);
   GPOS_ASSERT(this == pgexpr->Pgroup());
 
-  IStatistics *stats = m_pstatsmap->Find(poc);
+  IStatistics *stats = nullptr;
+  {
+    CAutoMutex am(m_mutex);
+    stats = m_pstatsmap->Find(poc);
+  }
   if (nullptr != stats) {
     return stats;
   }
@@ -1671,7 +1673,14 @@ IStatistics *CGroup::PstatsCompute(COptimizationContext *poc, CExpressionHandle
   stats = CLogical::PopConvert(pgexpr->Pop())->PstatsDerive(m_mp, exprhdl, poc->Pdrgpstat());
   GPOS_ASSERT(nullptr != stats);
 
-  // add computed stats to local map
+  // add computed stats to local map, unless another worker got there first
+  CAutoMutex am(m_mutex);
+  IStatistics *statsFound = m_pstatsmap->Find(poc);
+  if (nullptr != statsFound) {
+    stats->Release();
+    return statsFound;
+  }
+
   poc->AddRef();
   bool fSuccess GPOS_ASSERTS_ONLY = m_pstatsmap->Insert(poc, stats);
   GPOS_ASSERT(fSuccess);
@@ -1730,9 +1739,12 @@ CCost CGroup::CostLowerBound(CMemoryPool *mp, CReqdPropPlan *prppInput) {
   GPOS_ASSERT(nullptr != prppInput);
   GPOS_ASSERT(!FScalar());
 
-  CCost *pcostLowerBound = m_pcostmap->Find(prppInput);
-  if (nullptr != pcostLowerBound) {
-    return *pcostLowerBound;
+  {
+    CAutoMutex am(m_mutex);
+    CCost *pcostLowerBound = m_pcostmap->Find(prppInput);
+    if (nullptr != pcostLowerBound) {
+      return *pcostLowerBound;
+    }
   }
 
   CCost costLowerBound = GPOPT_INFINITE_COST;
@@ -1765,9 +1777,13 @@ CCost CGroup::CostLowerBound(CMemoryPool *mp, CReqdPropPlan *prppInput) {
     }
   }
 
-  prppInput->AddRef();
-  bool fSuccess GPOS_ASSERTS_ONLY = m_pcostmap->Insert(prppInput, GPOS_NEW(mp) CCost(costLowerBound.Get()));
-  GPOS_ASSERT(fSuccess);
+  // another worker may have computed the same bound meanwhile
+  CAutoMutex am(m_mutex);
+  if (nullptr == m_pcostmap->Find(prppInput)) {
+    prppInput->AddRef();
+    bool fSuccess GPOS_ASSERTS_ONLY = m_pcostmap->Insert(prppInput, GPOS_NEW(mp) CCost(costLowerBound.Get()));
+    GPOS_ASSERT(fSuccess);
+  }
 
   return costLowerBound;
 }
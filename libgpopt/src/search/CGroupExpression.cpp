@@ -30,8 +30,6 @@
 
 using namespace gpopt;
 
-#define GPOPT_COSTCTXT_HT_BUCKETS 100
-
 // invalid group expression
 const CGroupExpression CGroupExpression::m_gexprInvalid{};
 
@@ -70,8 +68,7 @@ CGroupExpression::CGroupExpression(CMemoryPool *mp, COperator *pop, CGroupArray
   m_ppartialplancostmap = GPOS_NEW(mp) PartialPlanToCostMap(mp);
 
   // initialize cost contexts hash table
-  m_sht.Init(mp, GPOPT_COSTCTXT_HT_BUCKETS, GPOS_OFFSET(CCostContext, m_link), GPOS_OFFSET(CCostContext, m_poc),
-             &(COptimizationContext::m_pocInvalid), COptimizationContext::HashValue, COptimizationContext::Equals);
+  m_sht.Init(mp, GPOS_OFFSET(CCostContext, m_poc), COptimizationContext::HashValue, COptimizationContext::Equals);
 }
 
 //---------------------------------------------------------------------------
@@ -311,6 +308,9 @@ CCostContext *CGroupExpression::PccInsertBest(CCostContext *pcc) {
   COptimizationContext *poc = pcc->Poc();
   const uint32_t ulOptReq = pcc->UlOptReq();
 
+  // the remove and re-insert below must not interleave with another worker
+  CAutoMutex am(m_pgroup->m_mutex);
+
   // remove existing cost context, if any
   CCostContext *pccExisting = PccRemove(poc, ulOptReq);
   CCostContext *pccKept = nullptr;
@@ -420,15 +420,25 @@ CCost CGroupExpression::CostLowerBound(CMemoryPool *mp, CReqdPropPlan *prppInput
     pccChild->AddRef();
   }
   CPartialPlan *ppp = GPOS_NEW(mp) CPartialPlan(this, prppInput, pccChild, child_index);
-  CCost *pcostLowerBound = m_ppartialplancostmap->Find(ppp);
-  if (nullptr != pcostLowerBound) {
-    ppp->Release();
-    return *pcostLowerBound;
+  {
+    CAutoMutex am(m_pgroup->m_mutex);
+    CCost *pcostLowerBound = m_ppartialplancostmap->Find(ppp);
+    if (nullptr != pcostLowerBound) {
+      ppp->Release();
+      return *pcostLowerBound;
+    }
   }
 
   // compute partial plan cost
   CCost cost = ppp->CostCompute(mp);
 
+  // another worker may have computed the same bound meanwhile
+  CAutoMutex am(m_pgroup->m_mutex);
+  if (nullptr != m_ppartialplancostmap->Find(ppp)) {
+    ppp->Release();
+    return cost;
+  }
+
   bool fSuccess GPOS_ASSERTS_ONLY = m_ppartialplancostmap->Insert(ppp, GPOS_NEW(mp) CCost(cost.Get()));
   GPOS_ASSERT(fSuccess);
 
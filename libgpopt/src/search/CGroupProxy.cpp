@@ -17,7 +17,6 @@
 #include "gpopt/search/CGroupExpression.h"
 #include "gpopt/search/CJobGroup.h"
 #include "gpos/base.h"
-#include "gpos/common/CSyncHashtableAccessByKey.h"
 
 using namespace gpopt;
 
@@ -31,6 +30,8 @@ using namespace gpopt;
 //---------------------------------------------------------------------------
 CGroupProxy::CGroupProxy(CGroup *pgroup) : m_pgroup(pgroup) {
   GPOS_ASSERT(nullptr != pgroup);
+
+  m_pgroup->m_mutex.Lock();
 }
 
 //---------------------------------------------------------------------------
@@ -41,7 +42,9 @@ CGroupProxy::CGroupProxy(CGroup *pgroup) : m_pgroup(pgroup) {
 //		Dtor
 //
 //---------------------------------------------------------------------------
-CGroupProxy::~CGroupProxy() = default;
+CGroupProxy::~CGroupProxy() {
+  m_pgroup->m_mutex.Unlock();
+}
 
 //---------------------------------------------------------------------------
 //	@function:
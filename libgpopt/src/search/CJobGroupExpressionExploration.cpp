@@ -141,15 +141,19 @@ void CJobGroupExpressionExploration::Init(CGroupExpression *pgexpr) {
 void CJobGroupExpressionExploration::ScheduleApplicableTransformations(CSchedulerContext *psc) {
   GPOS_ASSERT(!FXformsScheduled());
 
-  // get all applicable xforms
-  COperator *pop = m_pgexpr->Pop();
-  CXformSet *xform_set = CLogical::PopConvert(pop)->PxfsCandidates(psc->GetGlobalMemoryPool());
-
-  // intersect them with required xforms and schedule jobs
-  xform_set->Intersection(CXformFactory::Pxff()->PxfsExploration());
-  xform_set->Intersection(psc->Peng()->PxfsCurrentStage());
-  ScheduleTransformations(psc, xform_set);
-  xform_set->Release();
+  // once the planning time budget is used up, the search makes do with the
+  // alternatives explored so far
+  if (!psc->Peng()->FBudgetExhausted()) {
+    // get all applicable xforms
+    COperator *pop = m_pgexpr->Pop();
+    CXformSet *xform_set = CLogical::PopConvert(pop)->PxfsCandidates(psc->GetGlobalMemoryPool());
+
+    // intersect them with required xforms and schedule jobs
+    xform_set->Intersection(CXformFactory::Pxff()->PxfsExploration());
+    xform_set->Intersection(psc->Peng()->PxfsCurrentStage());
+    ScheduleTransformations(psc, xform_set);
+    xform_set->Release();
+  }
 
   SetXformsScheduled();
 }
@@ -41,6 +41,8 @@ CJobQueue::EJobQueueResult CJobQueue::EjqrAdd(CJob *pj) {
 
   // check if job has completed before getting the lock
   if (!m_fCompleted) {
+    CAutoMutex am(m_mutex);
+
     // check if this is the main job
     if (pj == m_pj) {
       GPOS_ASSERT(!m_fCompleted);
@@ -79,8 +81,13 @@ CJobQueue::EJobQueueResult CJobQueue::EjqrAdd(CJob *pj) {
 //
 //---------------------------------------------------------------------------
 void CJobQueue::NotifyCompleted(CSchedulerContext *psc) {
-  GPOS_ASSERT(!m_fCompleted);
-  m_fCompleted = true;
+  // no job can be added once the flag is set under the lock
+  {
+    CAutoMutex am(m_mutex);
+
+    GPOS_ASSERT(!m_fCompleted);
+    m_fCompleted = true;
+  }
 
   GPOS_ASSERT(!m_listjQueued.IsEmpty());
   while (!m_listjQueued.IsEmpty()) {
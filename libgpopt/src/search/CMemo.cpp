@@ -23,16 +23,12 @@
 #include "gpopt/search/CGroupProxy.h"
 #include "gpos/base.h"
 #include "gpos/common/CAutoTimer.h"
-#include "gpos/common/CSyncHashtableAccessByIter.h"
-#include "gpos/common/CSyncHashtableAccessByKey.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/string/CWStringDynamic.h"
 
 using namespace gpopt;
 
-#define GPOPT_MEMO_HT_BUCKETS 50000
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CMemo::CMemo
@@ -44,9 +40,10 @@ using namespace gpopt;
 CMemo::CMemo(CMemoryPool *mp) : m_mp(mp), m_aul(0), m_pgroupRoot(nullptr), m_ulpGrps(0), m_pmemotmap(nullptr) {
   GPOS_ASSERT(nullptr != mp);
 
-  m_sht.Init(mp, GPOPT_MEMO_HT_BUCKETS, GPOS_OFFSET(CGroupExpression, m_linkMemo),
-             0, /*cKeyOffset (0 because we use CGroupExpression class as key)*/
-             &(CGroupExpression::m_gexprInvalid), CGroupExpression::HashValue, CGroupExpression::Equals);
+  // every search worker inserts and looks up group expressions here, the
+  // shards keep them from queueing on a single lock
+  m_sht.Init(mp, 0, /*cKeyOffset (0 because we use CGroupExpression class as key)*/
+             CGroupExpression::HashValue, CGroupExpression::Equals, GPOPT_MEMO_HT_SHARDS);
 
   m_listGroups.Init(GPOS_OFFSET(CGroup, m_link));
 }
@@ -157,6 +154,14 @@ CGroup *CMemo::PgroupInsert(CGroup *pgroupTarget, CGroupExpression *pgexpr, CExp
 
     if (fNewGroup) {
       Add(pgroupTarget, pexprOrigin);
+
+      // if a new scalar group is added, we materialize a scalar expression
+      // for statistics derivation purposes; this happens before the bucket
+      // is unlocked so that other workers never see the group without it
+      if (pgroupTarget->FScalar()) {
+        pgroupTarget->CreateScalarExpression();
+        pgroupTarget->CreateDummyCostContext();
+      }
     }
 
     return pgexpr->Pgroup();
@@ -227,17 +232,9 @@ CGroup *CMemo::PgroupInsert(CGroup *pgroupTarget, CExpression *pexprOrigin, CGro
 
   // if insertion failed, release group as needed
   if (nullptr == pgexpr->Pgroup() && fNewGroup) {
-    fNewGroup = false;
     pgroupTarget->Release();
   }
 
-  // if a new scalar group is added, we materialize a scalar expression
-  // for statistics derivation purposes
-  if (fNewGroup && pgroupTarget->FScalar()) {
-    pgroupTarget->CreateScalarExpression();
-    pgroupTarget->CreateDummyCostContext();
-  }
-
   return pgroupContainer;
 }
 
@@ -11,6 +11,9 @@
 
 #include "gpopt/search/CScheduler.h"
 
+#include <chrono>
+
+#include "gpopt/engine/CEngine.h"
 #include "gpopt/search/CJobFactory.h"
 #include "gpopt/search/CSchedulerContext.h"
 #include "gpos/base.h"
@@ -19,6 +22,12 @@
 
 using namespace gpopt;
 
+// queue owned by the worker of the current thread
+thread_local uint32_t CScheduler::m_ulCurrentQueue = 0;
+
+// interval at which idle workers check for abort and the planning budget
+#define OPT_SCHED_IDLE_WAIT_MSEC 10
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CScheduler::CScheduler
@@ -27,13 +36,18 @@ using namespace gpopt;
 //		Ctor
 //
 //---------------------------------------------------------------------------
-CScheduler::CScheduler(CMemoryPool *mp, uint32_t ulJobs
+CScheduler::CScheduler(CMemoryPool *mp, uint32_t ulJobs, uint32_t ulWorkers
 #ifdef GPOS_DEBUG
                        ,
                        bool fTrackingJobs
 #endif  // GPOS_DEBUG
                        )
-    : m_spjl(mp, ulJobs),
+    : m_mp(mp),
+      m_rgjq(nullptr),
+      m_ulQueues(std::max(ulWorkers, (uint32_t)1)),
+      m_ulNextQueue(0),
+      m_spjl(mp, ulJobs),
+      m_ulIdle(0),
       m_ulpTotal(0),
       m_ulpRunning(0),
       m_ulpQueued(0),
@@ -42,17 +56,22 @@ CScheduler::CScheduler(CMemoryPool *mp, uint32_t ulJobs
       m_ulpStatsSuspended(0),
       m_ulpStatsCompleted(0),
       m_ulpStatsCompletedQueued(0),
-      m_ulpStatsResumed(0)
+      m_ulpStatsResumed(0),
+      m_ulpStatsStolen(0)
 #ifdef GPOS_DEBUG
       ,
-      m_fTrackingJobs(fTrackingJobs)
+      // job lists are only kept while a single worker runs the jobs
+      m_fTrackingJobs(fTrackingJobs && 1 == ulWorkers)
 #endif  // GPOS_DEBUG
 {
   // initialize pool of job links
   m_spjl.Init(GPOS_OFFSET(SJobLink, m_id));
 
-  // initialize list of waiting new jobs
-  m_listjlWaiting.Init(GPOS_OFFSET(SJobLink, m_link));
+  // initialize queues of waiting new jobs
+  m_rgjq = GPOS_NEW_ARRAY(mp, SJobQueue, m_ulQueues);
+  for (uint32_t ul = 0; ul < m_ulQueues; ul++) {
+    m_rgjq[ul].m_listjl.Init(GPOS_OFFSET(SJobLink, m_link));
+  }
 
 #ifdef GPOS_DEBUG
   // initialize list of running jobs
@@ -73,6 +92,8 @@ CScheduler::CScheduler(CMemoryPool *mp, uint32_t ulJobs
 //---------------------------------------------------------------------------
 CScheduler::~CScheduler() {
   GPOS_ASSERT_IMP(!ITask::Self()->HasPendingExceptions(), 0 == m_ulpTotal);
+
+  GPOS_DELETE_ARRAY(m_rgjq);
 }
 
 //---------------------------------------------------------------------------
@@ -96,15 +117,33 @@ void *CScheduler::Run(void *pv) {
 //
 //	@doc:
 // 		Job processing loop;
-//		keeps executing jobs as long as there is work queued;
+//		keeps executing jobs as long as there is work queued; with several
+//		workers, an idle worker waits for more jobs until all jobs have
+//		completed, since running jobs may still schedule new ones
 //
 //---------------------------------------------------------------------------
 void CScheduler::ExecuteJobs(CSchedulerContext *psc) {
   CJob *pj = nullptr;
   uint32_t count = 0;
 
+  // claim a queue for the worker of this thread
+  m_ulCurrentQueue = m_ulNextQueue++ % m_ulQueues;
+
   // keep retrieving jobs
-  while (nullptr != (pj = PjRetrieve())) {
+  while (true) {
+    pj = PjRetrieve();
+    if (nullptr == pj) {
+      if (1 == m_ulQueues || IsEmpty()) {
+        break;
+      }
+
+      // wait for the other workers to schedule more jobs
+      WaitForJobs();
+      GPOS_CHECK_ABORT;
+      psc->Peng()->CheckBudget();
+      continue;
+    }
+
     // prepare for job execution
     PreExecute(pj);
 
@@ -151,6 +190,7 @@ void CScheduler::ExecuteJobs(CSchedulerContext *psc) {
 
     if (++count == OPT_SCHED_CFA) {
       GPOS_CHECK_ABORT;
+      psc->Peng()->CheckBudget();
       count = 0;
     }
   }
@@ -224,14 +264,66 @@ void CScheduler::Schedule(CJob *pj) {
   }
 #endif  // GPOS_DEBUG
 
-  // add to waiting list
-  m_listjlWaiting.Push(pjl);
+  // add to the waiting list of the current worker
+  {
+    SJobQueue &jq = JqCurrent();
+    CAutoMutex am(jq.m_mutex);
+    jq.m_listjl.Prepend(pjl);
+  }
 
   // increment number of queued jobs
   m_ulpQueued++;
 
   // update statistics
   m_ulpStatsQueued++;
+
+  WakeIdle(false /*fAll*/);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::WaitForJobs
+//
+//	@doc:
+//		Block an idle worker until a job is queued or all jobs have
+//		completed; the wait is bounded so that the worker still notices
+//		an abort of the optimization
+//
+//---------------------------------------------------------------------------
+void CScheduler::WaitForJobs() {
+  // announce the wait before the counters are checked, see WakeIdle()
+  m_ulIdle++;
+  {
+    std::unique_lock<std::mutex> lock(m_mutexIdle);
+    m_condIdle.wait_for(lock, std::chrono::milliseconds(OPT_SCHED_IDLE_WAIT_MSEC),
+                        [this] { return 0 < m_ulpQueued || IsEmpty(); });
+  }
+  m_ulIdle--;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CScheduler::WakeIdle
+//
+//	@doc:
+//		Wake up one or all idle workers after a job was queued or the last
+//		job completed; a worker counts itself idle before it checks the
+//		counters, so either it sees the change or it is woken up here
+//
+//---------------------------------------------------------------------------
+void CScheduler::WakeIdle(bool fAll) {
+  if (0 == m_ulIdle) {
+    return;
+  }
+
+  // a waiter between its check of the counters and its wait holds the lock
+  { std::lock_guard<std::mutex> lock(m_mutexIdle); }
+
+  if (fAll) {
+    m_condIdle.notify_all();
+  } else {
+    m_condIdle.notify_one();
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -337,10 +429,28 @@ CScheduler::EJobResult CScheduler::EjrPostExecute(CJob *pj, bool fCompleted) {
 //
 //---------------------------------------------------------------------------
 CJob *CScheduler::PjRetrieve() {
-  // retrieve runnable job from lists of waiting jobs
-  SJobLink *pjl = m_listjlWaiting.Pop();
+  SJobLink *pjl = nullptr;
   CJob *pj = nullptr;
 
+  // retrieve the most recent runnable job of the current worker
+  {
+    SJobQueue &jq = JqCurrent();
+    CAutoMutex am(jq.m_mutex);
+    if (!jq.m_listjl.IsEmpty()) {
+      pjl = jq.m_listjl.RemoveHead();
+    }
+  }
+
+  // otherwise steal the oldest runnable job of another worker
+  for (uint32_t ul = 1; nullptr == pjl && ul < m_ulQueues; ul++) {
+    SJobQueue &jq = m_rgjq[(m_ulCurrentQueue + ul) % m_ulQueues];
+    CAutoMutex am(jq.m_mutex);
+    if (!jq.m_listjl.IsEmpty()) {
+      pjl = jq.m_listjl.RemoveTail();
+      m_ulpStatsStolen++;
+    }
+  }
+
   if (nullptr != pjl) {
     pj = pjl->m_pj;
 
@@ -419,8 +529,11 @@ void CScheduler::Complete(CJob *pj) {
   ResumeParent(pj);
 
   // update statistics
-  m_ulpTotal--;
   m_ulpStatsCompleted++;
+
+  if (0 == --m_ulpTotal) {
+    WakeIdle(true /*fAll*/);
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -446,9 +559,12 @@ void CScheduler::CompleteQueued(CJob *pj) {
   ResumeParent(pj);
 
   // update statistics
-  m_ulpTotal--;
   m_ulpStatsCompleted++;
   m_ulpStatsCompletedQueued++;
+
+  if (0 == --m_ulpTotal) {
+    WakeIdle(true /*fAll*/);
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -493,9 +609,10 @@ void CScheduler::ResumeParent(CJob *pj) {
 void CScheduler::PrintStats() const {
   GPOS_TRACE_FORMAT(
       "Job statistics: Queued=%d Dequeued=%d Suspended=%d "
-      "Resumed=%d CompletedQueued=%d Completed=%d",
-      m_ulpStatsQueued, m_ulpStatsDequeued, m_ulpStatsSuspended, m_ulpStatsResumed, m_ulpStatsCompletedQueued,
-      m_ulpStatsCompleted);
+      "Resumed=%d CompletedQueued=%d Completed=%d Stolen=%d",
+      (uint32_t)m_ulpStatsQueued, (uint32_t)m_ulpStatsDequeued, (uint32_t)m_ulpStatsSuspended,
+      (uint32_t)m_ulpStatsResumed, (uint32_t)m_ulpStatsCompletedQueued, (uint32_t)m_ulpStatsCompleted,
+      (uint32_t)m_ulpStatsStolen);
 }
 
 #ifdef GPOS_DEBUG
@@ -520,10 +637,12 @@ IOstream &CScheduler::OsPrintActiveJobs(IOstream &os) {
 
   os << std::endl << "List of waiting jobs: " << std::endl;
 
-  SJobLink *pjl = m_listjlWaiting.PtFirst();
-  while (nullptr != pjl) {
-    pjl->m_pj->OsPrint(os);
-    pjl = m_listjlWaiting.Next(pjl);
+  for (uint32_t ul = 0; ul < m_ulQueues; ul++) {
+    SJobLink *pjl = m_rgjq[ul].m_listjl.First();
+    while (nullptr != pjl) {
+      pjl->m_pj->OsPrint(os);
+      pjl = m_rgjq[ul].m_listjl.Next(pjl);
+    }
   }
 
   os << std::endl << "List of suspended jobs: " << std::endl;
@@ -15,6 +15,7 @@
 #include "gpopt/search/CScheduler.h"
 #include "gpos/base.h"
 #include "gpos/memory/CMemoryPoolManager.h"
+#include "gpos/task/CTask.h"
 
 using namespace gpos;
 using namespace gpopt;
@@ -66,7 +67,11 @@ void CSchedulerContext::Init(CMemoryPool *pmpGlobal, CJobFactory *pjf, CSchedule
 
   GPOS_ASSERT(!FInit() && "Scheduling context is already initialized");
 
-  m_pmpLocal = CMemoryPoolManager::CreateMemoryPool();
+  // local allocations are short-lived, an arena pool recycles them cheaply
+  CMemoryPoolManager::EPoolKind pool_kind = gpdxl::OPTIMIZER_MEMORY_POOL_ARENA == GPOS_CONDIF(memory_pool)
+                                                ? CMemoryPoolManager::EpkArena
+                                                : CMemoryPoolManager::EpkDefault;
+  m_pmpLocal = CMemoryPoolManager::CreateMemoryPool(pool_kind);
 
   m_pmpGlobal = pmpGlobal;
   m_pjf = pjf;
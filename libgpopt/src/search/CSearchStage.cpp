@@ -11,11 +11,181 @@
 
 #include "gpopt/search/CSearchStage.h"
 
+#include "gpopt/exception.h"
 #include "gpopt/xforms/CXformFactory.h"
+#include "gpos/common/CAutoRef.h"
+#include "gpos/common/clibwrapper.h"
 
 using namespace gpopt;
 using namespace gpos;
 
+// maximum length of an xform name in a search strategy description
+#define GPOPT_SEARCH_STRATEGY_NAME_LENGTH 128
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CSearchStrategyParser
+//
+//	@doc:
+//		Reader of the JSON subset used to describe a search strategy:
+//		objects, arrays, strings without escapes and numbers
+//
+//---------------------------------------------------------------------------
+class CSearchStrategyParser {
+ private:
+  // start of the description
+  const char *m_szStart;
+
+  // current position
+  const char *m_sz;
+
+ public:
+  CSearchStrategyParser(const CSearchStrategyParser &) = delete;
+
+  // ctor
+  explicit CSearchStrategyParser(const char *sz) : m_szStart(sz), m_sz(sz) {}
+
+  // raise an error at the current position
+  void Raise(const char *szReason) const {
+    GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiInvalidSearchStrategy, (int)(m_sz - m_szStart), szReason);
+  }
+
+  // skip white space and return the next character
+  char ChPeek() {
+    while (' ' == *m_sz || '\t' == *m_sz || '\n' == *m_sz || '\r' == *m_sz) {
+      m_sz++;
+    }
+
+    return *m_sz;
+  }
+
+  // consume the next character if it is the given one
+  bool FConsume(char ch) {
+    if (ch != ChPeek()) {
+      return false;
+    }
+
+    m_sz++;
+    return true;
+  }
+
+  // consume the given character, which must come next
+  void Expect(char ch, const char *szReason) {
+    if (!FConsume(ch)) {
+      Raise(szReason);
+    }
+  }
+
+  // read a string into the given buffer
+  void ReadString(char *szBuffer, uint32_t ulSize) {
+    Expect('"', "string expected");
+
+    uint32_t ul = 0;
+    while ('"' != *m_sz) {
+      if ('\0' == *m_sz || '\\' == *m_sz || ul + 1 == ulSize) {
+        Raise("unterminated, escaped or overlong string");
+      }
+      szBuffer[ul++] = *m_sz++;
+    }
+    szBuffer[ul] = '\0';
+    m_sz++;
+  }
+
+  // read a non-negative number
+  double DReadNumber() {
+    char szNumber[GPOPT_SEARCH_STRATEGY_NAME_LENGTH];
+    uint32_t ul = 0;
+    (void)ChPeek();
+    while (('0' <= *m_sz && '9' >= *m_sz) || '.' == *m_sz || 'e' == *m_sz || 'E' == *m_sz || '+' == *m_sz ||
+           '-' == *m_sz) {
+      if (ul + 1 == GPOS_ARRAY_SIZE(szNumber)) {
+        Raise("overlong number");
+      }
+      szNumber[ul++] = *m_sz++;
+    }
+    szNumber[ul] = '\0';
+
+    if (0 == ul || '0' > szNumber[0] || '9' < szNumber[0]) {
+      Raise("non-negative number expected");
+    }
+
+    return clib::Strtod(szNumber);
+  }
+
+  // are all characters consumed?
+  bool FDone() { return '\0' == ChPeek(); }
+};
+
+// read a list of exploration xforms and add them to the given set
+static void ReadXforms(CSearchStrategyParser &parser, CXformSet *xform_set) {
+  parser.Expect('[', "array of xform names expected");
+  if (parser.FConsume(']')) {
+    return;
+  }
+
+  do {
+    char szName[GPOPT_SEARCH_STRATEGY_NAME_LENGTH];
+    parser.ReadString(szName, GPOS_ARRAY_SIZE(szName));
+
+    CXform *pxform = CXformFactory::Pxff()->Pxf(szName);
+    if (nullptr == pxform || !CXformFactory::Pxff()->PxfsExploration()->Get(pxform->Exfid())) {
+      parser.Raise("unknown exploration xform");
+    }
+    (void)xform_set->ExchangeSet(pxform->Exfid());
+  } while (parser.FConsume(','));
+
+  parser.Expect(']', "',' or ']' expected");
+}
+
+// read one stage
+static CSearchStage *PssRead(CMemoryPool *mp, CSearchStrategyParser &parser) {
+  CAutoRef<CXformSet> xform_set;
+  CAutoRef<CXformSet> pxfsExcluded(GPOS_NEW(mp) CXformSet(mp));
+  uint32_t ulTimeThreshold = UINT32_MAX;
+  CCost costThreshold(0.0);
+
+  parser.Expect('{', "stage object expected");
+  if (!parser.FConsume('}')) {
+    do {
+      char szKey[GPOPT_SEARCH_STRATEGY_NAME_LENGTH];
+      parser.ReadString(szKey, GPOS_ARRAY_SIZE(szKey));
+      parser.Expect(':', "':' expected");
+
+      if (0 == clib::Strcmp(szKey, "xforms") && nullptr == xform_set.Value()) {
+        xform_set = GPOS_NEW(mp) CXformSet(mp);
+        ReadXforms(parser, xform_set.Value());
+      } else if (0 == clib::Strcmp(szKey, "exclude")) {
+        ReadXforms(parser, pxfsExcluded.Value());
+      } else if (0 == clib::Strcmp(szKey, "time")) {
+        double dTime = parser.DReadNumber();
+        if (1.0 > dTime || (double)UINT32_MAX <= dTime) {
+          parser.Raise("time threshold out of range");
+        }
+        ulTimeThreshold = (uint32_t)dTime;
+      } else if (0 == clib::Strcmp(szKey, "cost")) {
+        costThreshold = CCost(parser.DReadNumber());
+      } else {
+        parser.Raise("unknown or repeated stage key");
+      }
+    } while (parser.FConsume(','));
+
+    parser.Expect('}', "',' or '}' expected");
+  }
+
+  // a stage explores with all xforms unless told otherwise
+  if (nullptr == xform_set.Value()) {
+    xform_set = GPOS_NEW(mp) CXformSet(mp);
+    xform_set->Union(CXformFactory::Pxff()->PxfsExploration());
+  }
+  xform_set->Difference(pxfsExcluded.Value());
+
+  if (0 == xform_set->Size()) {
+    parser.Raise("stage without exploration xforms");
+  }
+
+  return GPOS_NEW(mp) CSearchStage(xform_set.Reset(), ulTimeThreshold, costThreshold);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CSearchStage::CSearchStage
@@ -110,4 +280,39 @@ CSearchStageArray *CSearchStage::PdrgpssDefault(CMemoryPool *mp) {
   return search_stage_array;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CSearchStage::PdrgpssParse
+//
+//	@doc:
+//		Generate search strategy from its JSON description, an array with
+//		one object per stage, e.g.
+//
+//		[{"exclude": ["CXformJoinAssociativity"], "time": 500, "cost": 1e5}, {}]
+//
+//		"xforms" lists the exploration xforms of a stage, all of them when
+//		absent, and "exclude" removes xforms from that list; "time" is the
+//		stage's time threshold in milliseconds, and a plan cheaper than
+//		"cost" ends the search after the stage
+//
+//---------------------------------------------------------------------------
+CSearchStageArray *CSearchStage::PdrgpssParse(CMemoryPool *mp, const char *szStrategy) {
+  GPOS_ASSERT(nullptr != szStrategy);
+
+  CSearchStrategyParser parser(szStrategy);
+  CAutoRef<CSearchStageArray> search_stage_array(GPOS_NEW(mp) CSearchStageArray(mp));
+
+  parser.Expect('[', "array of stages expected");
+  do {
+    search_stage_array->Append(PssRead(mp, parser));
+  } while (parser.FConsume(','));
+  parser.Expect(']', "',' or ']' expected");
+
+  if (!parser.FDone()) {
+    parser.Raise("trailing characters");
+  }
+
+  return search_stage_array.Reset();
+}
+
 // EOF
@@ -23,6 +23,7 @@
 #include "gpopt/operators/CPhysicalInnerIndexNLJoin.h"
 #include "gpopt/operators/CPhysicalLeftOuterIndexNLJoin.h"
 #include "gpopt/operators/CPhysicalLimit.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 #include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/operators/CPhysicalPartitionSelector.h"
 #include "gpopt/operators/CPhysicalScalarAgg.h"
@@ -246,6 +247,8 @@ CDXLNode *CTranslatorExprToDXL::CreateDXLNode(CExpression *pexpr, CColRefArray *
       dxlnode = CTranslatorExprToDXL::PdxlnAggregateDedup(pexpr, colref_array);
       break;
     case COperator::EopPhysicalSort:
+    case COperator::EopPhysicalIncrementalSort:
+      // DXL has no incremental sort, a full sort delivers the same order
       dxlnode = CTranslatorExprToDXL::PdxlnSort(pexpr, colref_array);
       break;
     case COperator::EopPhysicalLimit:
@@ -312,6 +315,10 @@ CDXLNode *CTranslatorExprToDXL::CreateDXLNode(CExpression *pexpr, CColRefArray *
       dxlnode = CTranslatorExprToDXL::PdxlnCTEConsumer(pexpr, colref_array);
       break;
     case COperator::EopPhysicalFullMergeJoin:
+    case COperator::EopPhysicalInnerMergeJoin:
+    case COperator::EopPhysicalLeftOuterMergeJoin:
+    case COperator::EopPhysicalLeftSemiMergeJoin:
+    case COperator::EopPhysicalLeftAntiSemiMergeJoin:
       dxlnode = CTranslatorExprToDXL::PdxlnMergeJoin(pexpr, colref_array);
       break;
     default:
@@ -2995,18 +3002,34 @@ CDXLNode *CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ, CColRefArra
   GPOS_ASSERT(3 == pexprMJ->Arity());
 
   // extract components
-  CPhysical *pop = CPhysical::PopConvert(pexprMJ->Pop());
+  CPhysicalMergeJoin *popMJ = CPhysicalMergeJoin::PopConvert(pexprMJ->Pop());
 
   CExpression *pexprOuterChild = (*pexprMJ)[0];
   CExpression *pexprInnerChild = (*pexprMJ)[1];
   CExpression *pexprScalar = (*pexprMJ)[2];
 
   EdxlJoinType join_type = EdxljtSentinel;
-  switch (pop->Eopid()) {
+  switch (popMJ->Eopid()) {
     case COperator::EopPhysicalFullMergeJoin:
       join_type = EdxljtFull;
       break;
 
+    case COperator::EopPhysicalInnerMergeJoin:
+      join_type = EdxljtInner;
+      break;
+
+    case COperator::EopPhysicalLeftOuterMergeJoin:
+      join_type = EdxljtLeft;
+      break;
+
+    case COperator::EopPhysicalLeftSemiMergeJoin:
+      join_type = EdxljtIn;
+      break;
+
+    case COperator::EopPhysicalLeftAntiSemiMergeJoin:
+      join_type = EdxljtLeftAntiSemijoin;
+      break;
+
     default:
       GPOS_ASSERT(!"Invalid join type");
   }
@@ -3015,46 +3038,42 @@ CDXLNode *CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ, CColRefArra
   CDXLNode *pdxlnOuterChild = CreateDXLNode(pexprOuterChild, nullptr /*colref_array*/, false /*fRemap*/);
   CDXLNode *pdxlnInnerChild = CreateDXLNode(pexprInnerChild, nullptr /*colref_array*/, false /*fRemap*/);
 
+  // merge conditions are built from the merge keys of the operator, with
+  // the outer key on the left, in the order of the child sort orders
   CDXLNode *dxlnode_merge_conds = GPOS_NEW(m_mp) CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarMergeCondList(m_mp));
 
+  CExpressionArray *pdrgpexprOuterKeys = popMJ->PdrgpexprOuterKeys();
+  CExpressionArray *pdrgpexprInnerKeys = popMJ->PdrgpexprInnerKeys();
+  for (uint32_t ul = 0; ul < pdrgpexprOuterKeys->Size(); ul++) {
+    (*pdrgpexprOuterKeys)[ul]->AddRef();
+    (*pdrgpexprInnerKeys)[ul]->AddRef();
+    CExpression *pexprPred = CUtils::PexprScalarEqCmp(m_mp, (*pdrgpexprOuterKeys)[ul], (*pdrgpexprInnerKeys)[ul]);
+    dxlnode_merge_conds->AddChild(PdxlnScalar(pexprPred));
+    pexprPred->Release();
+  }
+
+  // conjuncts that are not merge-joinable make up the join filter
   CExpressionArray *pdrgpexprPredicates = CPredicateUtils::PdrgpexprConjuncts(m_mp, pexprScalar);
+  CExpressionArray *pdrgpexprRemainingPredicates = GPOS_NEW(m_mp) CExpressionArray(m_mp);
   const uint32_t length = pdrgpexprPredicates->Size();
   for (uint32_t ul = 0; ul < length; ul++) {
     CExpression *pexprPred = (*pdrgpexprPredicates)[ul];
-    // At this point, they all better be merge joinable
-    GPOS_ASSERT(CPhysicalJoin::FMergeJoinCompatible(pexprPred, pexprOuterChild, pexprInnerChild));
-    CExpression *pexprPredOuter = (*pexprPred)[0];
-    CExpression *pexprPredInner = (*pexprPred)[1];
-
-    // align extracted columns with outer and inner children of the join
-    CColRefSet *pcrsOuterChild = pexprOuterChild->DeriveOutputColumns();
-    CColRefSet *pcrsPredInner = pexprPredInner->DeriveUsedColumns();
-#ifdef GPOS_DEBUG
-    CColRefSet *pcrsInnerChild = pexprInnerChild->DeriveOutputColumns();
-    CColRefSet *pcrsPredOuter = pexprPredOuter->DeriveUsedColumns();
-#endif
-
-    if (pcrsOuterChild->ContainsAll(pcrsPredInner)) {
-      GPOS_ASSERT(pcrsInnerChild->ContainsAll(pcrsPredOuter));
-      std::swap(pexprPredOuter, pexprPredInner);
-#ifdef GPOS_DEBUG
-      std::swap(pcrsPredOuter, pcrsPredInner);
-#endif
-
-      pexprPredOuter->AddRef();
-      pexprPredInner->AddRef();
-      pexprPred = CUtils::PexprScalarEqCmp(m_mp, pexprPredOuter, pexprPredInner);
-    } else {
+    if (!CPhysicalJoin::FMergeJoinCompatible(pexprPred, pexprOuterChild, pexprInnerChild)) {
       pexprPred->AddRef();
+      pdrgpexprRemainingPredicates->Append(pexprPred);
     }
-
-    GPOS_ASSERT(pcrsOuterChild->ContainsAll(pcrsPredOuter) && pcrsInnerChild->ContainsAll(pcrsPredInner) &&
-                "merge join keys are not aligned with children");
-
-    dxlnode_merge_conds->AddChild(PdxlnScalar(pexprPred));
-    pexprPred->Release();
   }
   pdrgpexprPredicates->Release();
+  GPOS_ASSERT_IMP(EdxljtFull == join_type, 0 == pdrgpexprRemainingPredicates->Size());
+
+  CDXLNode *dxlnode_join_filter = GPOS_NEW(m_mp) CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarJoinFilter(m_mp));
+  if (0 < pdrgpexprRemainingPredicates->Size()) {
+    CExpression *pexprJoinCond = CPredicateUtils::PexprConjunction(m_mp, pdrgpexprRemainingPredicates);
+    dxlnode_join_filter->AddChild(PdxlnScalar(pexprJoinCond));
+    pexprJoinCond->Release();
+  } else {
+    pdrgpexprRemainingPredicates->Release();
+  }
 
   // construct a join node
   CDXLPhysicalMergeJoin *pdxlopMJ = GPOS_NEW(m_mp) CDXLPhysicalMergeJoin(m_mp, join_type, false /* is_unique_outer */);
@@ -3070,9 +3089,8 @@ CDXLNode *CTranslatorExprToDXL::PdxlnMergeJoin(CExpression *pexprMJ, CColRefArra
   CDXLPhysicalProperties *dxl_properties = GetProperties(pexprMJ);
   pdxlnMJ->SetProperties(dxl_properties);
 
-  // construct an empty plan filter and join filter
+  // construct an empty plan filter
   CDXLNode *filter_dxlnode = PdxlnFilter(nullptr);
-  CDXLNode *dxlnode_join_filter = GPOS_NEW(m_mp) CDXLNode(m_mp, GPOS_NEW(m_mp) CDXLScalarJoinFilter(m_mp));
 
   // add children
   pdxlnMJ->AddChild(proj_list_dxlnode);
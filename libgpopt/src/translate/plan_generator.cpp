@@ -1,5 +1,6 @@
 #include "gpopt/translate/plan_generator.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -8,24 +9,41 @@
 #include <vector>
 
 #include "gpopt/base/CColRefSetIter.h"
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/cost/ICostModel.h"
 #include "gpopt/exception.h"
 #include "gpopt/gpdbwrappers.h"
 #include "gpopt/operators/CExpression.h"
 #include "gpopt/operators/CPhysicalAgg.h"
+#include "gpopt/operators/CPhysicalBitmapTableScan.h"
 #include "gpopt/operators/CPhysicalConstTableGet.h"
+#include "gpopt/operators/CPhysicalCTEConsumer.h"
+#include "gpopt/operators/CPhysicalCTEProducer.h"
 #include "gpopt/operators/CPhysicalCorrelatedLeftOuterNLJoin.h"
+#include "gpopt/operators/CPhysicalForeignScan.h"
+#include "gpopt/operators/CPhysicalGather.h"
 #include "gpopt/operators/CPhysicalHashAgg.h"
+#include "gpopt/operators/CPhysicalHashAggDeduplicate.h"
 #include "gpopt/operators/CPhysicalHashJoin.h"
+#include "gpopt/operators/CPhysicalIncrementalSort.h"
+#include "gpopt/operators/CPhysicalIndexOnlyScan.h"
 #include "gpopt/operators/CPhysicalIndexScan.h"
+#include "gpopt/operators/CPhysicalInnerIndexNLJoin.h"
+#include "gpopt/operators/CPhysicalLeftOuterIndexNLJoin.h"
+#include "gpopt/operators/CPhysicalMergeJoin.h"
 #include "gpopt/operators/CPhysicalNLJoin.h"
 #include "gpopt/operators/CPhysicalScalarAgg.h"
+#include "gpopt/operators/CPhysicalSequenceProject.h"
 #include "gpopt/operators/CPhysicalSort.h"
 #include "gpopt/operators/CPhysicalStreamAgg.h"
+#include "gpopt/operators/CPhysicalStreamAggDeduplicate.h"
 #include "gpopt/operators/CPhysicalTVF.h"
 #include "gpopt/operators/CPhysicalTableScan.h"
 #include "gpopt/operators/CPhysicalUnionAll.h"
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarArray.h"
+#include "gpopt/operators/CScalarBitmapBoolOp.h"
+#include "gpopt/operators/CScalarBitmapIndexProbe.h"
 #include "gpopt/operators/CScalarCast.h"
 #include "gpopt/operators/CScalarCmp.h"
 #include "gpopt/operators/CScalarCoerceViaIO.h"
@@ -33,7 +51,11 @@
 #include "gpopt/operators/CScalarIdent.h"
 #include "gpopt/operators/CScalarIsDistinctFrom.h"
 #include "gpopt/operators/CScalarOp.h"
+#include "gpopt/operators/CScalarWindowFunc.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpopt/translate/CIndexQualInfo.h"
 #include "gpopt/translate/CTranslatorUtils.h"
+#include "gpos/string/CWStringDynamic.h"
 #include "naucrates/base/CDatumBoolGPDB.h"
 #include "naucrates/base/CDatumGenericGPDB.h"
 #include "naucrates/base/CDatumInt2GPDB.h"
@@ -42,11 +64,18 @@
 #include "naucrates/base/CDatumOidGPDB.h"
 #include "naucrates/exception.h"
 #include "naucrates/md/IMDAggregate.h"
+#include "naucrates/md/IMDIndex.h"
+#include "naucrates/md/IMDRelation.h"
 #include "naucrates/md/IMDScalarOp.h"
+#include "naucrates/statistics/CStatisticsUtils.h"
 
 extern "C" {
 #include <postgres.h>
 
+#include <access/htup_details.h>
+#include <catalog/pg_type.h>
+#include <executor/nodeHash.h>
+#include <executor/nodeMemoize.h>
 #include <nodes/makefuncs.h>
 #include <nodes/nodeFuncs.h>
 #include <nodes/nodes.h>
@@ -63,6 +92,32 @@ namespace gpopt {
 
 PlanGenerator::PlanGenerator(CMemoryPool *m_mp, CMDAccessor *catalog) : catalog_(catalog), m_mp(m_mp) {}
 
+// raise the exception COptimizer falls back to the DXL translation on
+[[noreturn]] static void RaiseUnsupported(CMemoryPool *mp, const COperator *pop) {
+  CWStringDynamic str(mp);
+  str.AppendFormat(GPOS_WSZ_LIT("%s"), pop->SzId());
+  GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, str.GetBuffer());
+}
+
+// operators that evaluate the filter and project list of their parent
+// themselves, anything else gets a Result node on top
+static bool IsProjectingScan(COperator::EOperatorId op_id) {
+  switch (op_id) {
+    case COperator::EopPhysicalTableScan:
+    case COperator::EopPhysicalIndexScan:
+    case COperator::EopPhysicalIndexOnlyScan:
+    case COperator::EopPhysicalBitmapTableScan:
+    case COperator::EopPhysicalConstTableGet:
+    case COperator::EopPhysicalTVF:
+    case COperator::EopPhysicalForeignScan:
+    case COperator::EopPhysicalCTEConsumer:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
 void FixTragetName(Plan *plan, gpmd::CMDNameArray *names) {
   auto *target_list = plan->targetlist;
   uint32_t idx = 0;
@@ -81,7 +136,17 @@ PlanResult *PlanGenerator::GeneratePlan(CExpression *pexpr, CColRefArray *colref
       .translate_ctxt = &tt_ctx,
   };
   auto *plan = GeneratePlanInternal(&ctx);
-  return new PlanResult{.plan = plan, .rtable = rtable_, .relationOids = relationOids_};
+
+  // like the CTEs of the Postgres planner, the producers are initplans of the
+  // top plan node
+  plan->initPlan = list_concat(plan->initPlan, cte_init_plans_);
+
+  return new PlanResult{.plan = plan,
+                        .rtable = rtable_,
+                        .relationOids = relationOids_,
+                        .parallel_mode_needed = parallel_mode_needed_,
+                        .param_exec_types = param_exec_types_,
+                        .subplans = subplans_};
 }
 
 Plan *PlanGenerator::GeneratePlanInternal(PlanGeneratorContext *ctx) {
@@ -108,14 +173,26 @@ Plan *PlanGenerator::GeneratePlanInternal(PlanGeneratorContext *ctx) {
     case COperator::EopPhysicalIndexScan:
       return GenerateIndexScanPlan(ctx);
 
+    case COperator::EopPhysicalIndexOnlyScan:
+      return GenerateIndexOnlyScanPlan(ctx);
+
+    case COperator::EopPhysicalBitmapTableScan:
+      return GenerateBitmapTableScanPlan(ctx);
+
     case COperator::EopPhysicalSort:
+    case COperator::EopPhysicalIncrementalSort:
       return GenerateSortPlan(ctx);
 
     case COperator::EopPhysicalScalarAgg:
     case COperator::EopPhysicalHashAgg:
     case COperator::EopPhysicalStreamAgg:
+    case COperator::EopPhysicalHashAggDeduplicate:
+    case COperator::EopPhysicalStreamAggDeduplicate:
       return GenerateAggPlan(ctx);
 
+    case COperator::EopPhysicalSequenceProject:
+      return GenerateWindowPlan(ctx);
+
     case COperator::EopPhysicalSerialUnionAll:
     case COperator::EopPhysicalParallelUnionAll:
       return GenerateAppendPlan(ctx);
@@ -141,20 +218,41 @@ Plan *PlanGenerator::GeneratePlanInternal(PlanGeneratorContext *ctx) {
     case COperator::EopPhysicalFullHashJoin:
       return GenerateHashJoinPlan(ctx);
 
+    case COperator::EopPhysicalFullMergeJoin:
+    case COperator::EopPhysicalInnerMergeJoin:
+    case COperator::EopPhysicalLeftOuterMergeJoin:
+    case COperator::EopPhysicalLeftSemiMergeJoin:
+    case COperator::EopPhysicalLeftAntiSemiMergeJoin:
+      return GenerateMergeJoinPlan(ctx);
+
+    case COperator::EopPhysicalGather:
+      return GenerateGatherPlan(ctx);
+
+    case COperator::EopPhysicalForeignScan:
+      return GenerateForeignScanPlan(ctx);
+
+    case COperator::EopPhysicalSequence:
+      return GenerateSequencePlan(ctx);
+
+    case COperator::EopPhysicalCTEConsumer:
+      return GenerateCTEConsumerPlan(ctx);
+
+    // Correlated joins have to become SubPlans evaluated per outer row, which
+    // GenerateCorrelatedNLJoinPlan() does not build yet. Partition selectors
+    // are not supported by the DXL translation either. CTE producers are
+    // generated by the sequence above them. All of them make COptimizer fall
+    // back to the DXL translation of the plan.
     case COperator::EopPhysicalCorrelatedInnerNLJoin:
     case COperator::EopPhysicalCorrelatedLeftOuterNLJoin:
     case COperator::EopPhysicalCorrelatedLeftSemiNLJoin:
     case COperator::EopPhysicalCorrelatedInLeftSemiNLJoin:
     case COperator::EopPhysicalCorrelatedLeftAntiSemiNLJoin:
     case COperator::EopPhysicalCorrelatedNotInLeftAntiSemiNLJoin:
-      return GenerateCorrelatedNLJoinPlan(ctx);
-
+    case COperator::EopPhysicalCTEProducer:
+    case COperator::EopPhysicalPartitionSelector:
     default:
-      return nullptr;
-      GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, expr->Pop()->SzId());
+      RaiseUnsupported(m_mp, expr->Pop());
   }
-
-  return nullptr;
 }
 
 static SubLinkType Edxlsubplantype(CExpression *expr) {
@@ -458,6 +556,199 @@ Plan *PlanGenerator::GenerateHashJoinPlan(PlanGeneratorContext *ctx) {
   return plan;
 }
 
+Plan *PlanGenerator::MaterializeForMarkRestore(Plan *plan) {
+  // the same node types ExecSupportsMarkRestore() accepts; sorts below a
+  // merge join are initialized for random access by the executor
+  if (IsA(plan, Sort) || IsA(plan, Material) || IsA(plan, IndexScan) || IsA(plan, IndexOnlyScan)) {
+    return plan;
+  }
+
+  Material *materialize = makeNode(Material);
+  Plan *mat_plan = &(materialize->plan);
+  mat_plan->plan_node_id = GetNextPlanNodeID();
+
+  foreach_node(TargetEntry, tle, plan->targetlist) {
+    Var *var = gpdb::MakeVarFromTargetEntry(OUTER_VAR, tle);
+    mat_plan->targetlist =
+        lappend(mat_plan->targetlist, gpdb::MakeTargetEntry((Expr *)var, tle->resno, tle->resname, tle->resjunk));
+  }
+
+  mat_plan->startup_cost = plan->startup_cost;
+  mat_plan->total_cost = plan->total_cost;
+  mat_plan->plan_rows = plan->plan_rows;
+  mat_plan->plan_width = plan->plan_width;
+  mat_plan->lefttree = plan;
+
+  return mat_plan;
+}
+
+Plan *PlanGenerator::GenerateMemoizePlan(Plan *inner_plan, CExpression *outer, CColRefArray *keys) {
+  Memoize *memoize = makeNode(Memoize);
+  Plan *plan = &(memoize->plan);
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  foreach_node(TargetEntry, tle, inner_plan->targetlist) {
+    Var *var = gpdb::MakeVarFromTargetEntry(OUTER_VAR, tle);
+    plan->targetlist =
+        lappend(plan->targetlist, gpdb::MakeTargetEntry((Expr *)var, tle->resno, tle->resname, tle->resjunk));
+  }
+
+  std::vector<uint32_t> colids;
+  memoize->numKeys = (int)keys->Size();
+  memoize->hashOperators = (Oid *)palloc(sizeof(Oid) * memoize->numKeys);
+  memoize->collations = (Oid *)palloc(sizeof(Oid) * memoize->numKeys);
+  for (uint32_t ul = 0; ul < keys->Size(); ul++) {
+    const CColRef *colref = (*keys)[ul];
+    const IMDType *md_type = colref->RetrieveType();
+    uint32_t param_id = nest_param_ids_.at(colref->Id());
+
+    memoize->hashOperators[ul] = CMDIdGPDB::CastMdid(md_type->GetMdidForCmpType(IMDType::EcmptEq))->Oid();
+    memoize->collations[ul] = gpdb::TypeCollation(CMDIdGPDB::CastMdid(md_type->MDId())->Oid());
+    memoize->param_exprs = lappend(memoize->param_exprs, CreateNestParam(colref, param_id));
+    memoize->keyparamids = bms_add_member(memoize->keyparamids, (int)param_id);
+    colids.push_back(colref->Id());
+  }
+  memoize->singlerow = false;
+  memoize->binary_mode = false;
+
+  // size the cache the way cost_memoize_rescan() does: one entry per
+  // distinct key of the outer rows, as far as they fit in hash_mem
+  CStatisticsConfig *stats_config = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetStatsConf();
+  IStatistics *outer_stats = const_cast<IStatistics *>(outer->Pstats());
+  double calls = std::max(outer_stats->Rows().Get(), 1.0);
+  double ndistinct =
+      std::min(CStatisticsUtils::Groups(m_mp, outer_stats, stats_config, colids, nullptr /*keys*/).Get(), calls);
+  double tuples = std::max(inner_plan->plan_rows / calls, 1.0);
+  double entry_bytes = tuples * (MAXALIGN(inner_plan->plan_width) + MAXALIGN(SizeofHeapTupleHeader)) +
+                       ExecEstimateCacheEntryOverheadBytes(tuples);
+  double cache_entries = floor((double)get_hash_memory_limit() / entry_bytes);
+  memoize->est_entries = (uint32)std::min({ndistinct, cache_entries, (double)PG_UINT32_MAX});
+
+  // the join accounts for the cache in its own cost
+  plan->startup_cost = inner_plan->startup_cost;
+  plan->total_cost = inner_plan->total_cost;
+  plan->plan_rows = inner_plan->plan_rows;
+  plan->plan_width = inner_plan->plan_width;
+  plan->lefttree = inner_plan;
+
+  return plan;
+}
+
+Plan *PlanGenerator::GenerateMergeJoinPlan(PlanGeneratorContext *ctx) {
+  auto *expr = ctx->expr;
+  CPhysicalMergeJoin *popMJ = CPhysicalMergeJoin::PopConvert(expr->Pop());
+
+  MergeJoin *merge_join = makeNode(MergeJoin);
+  Join *join = &(merge_join->join);
+  Plan *plan = &(join->plan);
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  switch (popMJ->Eopid()) {
+    case COperator::EopPhysicalInnerMergeJoin:
+      join->jointype = JOIN_INNER;
+      break;
+
+    case COperator::EopPhysicalLeftOuterMergeJoin:
+      join->jointype = JOIN_LEFT;
+      break;
+
+    case COperator::EopPhysicalLeftSemiMergeJoin:
+      join->jointype = JOIN_SEMI;
+      break;
+
+    case COperator::EopPhysicalLeftAntiSemiMergeJoin:
+      join->jointype = JOIN_ANTI;
+      break;
+
+    case COperator::EopPhysicalFullMergeJoin:
+      join->jointype = JOIN_FULL;
+      break;
+
+    default:
+      GPOS_ASSERT(!"Invalid join type");
+  }
+
+  CExpression *pexprOuterChild = (*expr)[0];
+  CExpression *pexprInnerChild = (*expr)[1];
+
+  CDXLTranslateContext l_ctx{false, ctx->translate_ctxt->GetColIdToParamIdMap()};
+  CDXLTranslateContext r_ctx{false, ctx->translate_ctxt->GetColIdToParamIdMap()};
+
+  PlanGeneratorContext left_ctx{
+      .expr = pexprOuterChild,
+      .out_cols = ctx->out_cols,
+      .translate_ctxt = &l_ctx,
+  };
+
+  PlanGeneratorContext right_ctx{
+      .expr = pexprInnerChild,
+      .translate_ctxt = &r_ctx,
+  };
+
+  plan->lefttree = GeneratePlanInternal(&left_ctx);
+  plan->righttree = MaterializeForMarkRestore(GeneratePlanInternal(&right_ctx));
+
+  child_ctx_.push_back(&l_ctx);
+  child_ctx_.push_back(&r_ctx);
+  output_context_ = ctx->translate_ctxt;
+
+  // merge clauses have the outer key on the left and follow the order of
+  // the merge keys, like the sort orders required from the children
+  CExpressionArray *pdrgpexprOuterKeys = popMJ->PdrgpexprOuterKeys();
+  CExpressionArray *pdrgpexprInnerKeys = popMJ->PdrgpexprInnerKeys();
+  for (uint32_t ul = 0; ul < pdrgpexprOuterKeys->Size(); ul++) {
+    (*pdrgpexprOuterKeys)[ul]->AddRef();
+    (*pdrgpexprInnerKeys)[ul]->AddRef();
+    CExpression *pexprCond = CUtils::PexprScalarEqCmp(m_mp, (*pdrgpexprOuterKeys)[ul], (*pdrgpexprInnerKeys)[ul]);
+
+    auto *qual = TransExpr(pexprCond);
+    pexprCond->Release();
+    if (!IsA(qual, OpExpr)) {
+      GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, GPOS_WSZ_LIT("Not an op expression in merge clause"));
+    }
+    merge_join->mergeclauses = lappend(merge_join->mergeclauses, qual);
+  }
+
+  // the remaining conjuncts are checked on rows with matching merge keys
+  CExpressionArray *pdrgpexprConds = CPredicateUtils::PdrgpexprConjuncts(m_mp, (*expr)[2]);
+  for (uint32_t ul = 0; ul < pdrgpexprConds->Size(); ul++) {
+    CExpression *pexprCond = (*pdrgpexprConds)[ul];
+    if (CPhysicalJoin::FMergeJoinCompatible(pexprCond, pexprOuterChild, pexprInnerChild)) {
+      continue;
+    }
+
+    GPOS_ASSERT(JOIN_FULL != join->jointype);
+    if (auto *qual = TransExpr(pexprCond); qual)
+      join->joinqual = lappend(join->joinqual, qual);
+  }
+  pdrgpexprConds->Release();
+
+  const uint32_t num_join_conds = list_length(merge_join->mergeclauses);
+  merge_join->mergeFamilies = (Oid *)palloc(sizeof(Oid) * num_join_conds);
+  merge_join->mergeStrategies = (int *)palloc(sizeof(int) * num_join_conds);
+  merge_join->mergeCollations = (Oid *)palloc(sizeof(Oid) * num_join_conds);
+  merge_join->mergeNullsFirst = (bool *)palloc(sizeof(bool) * num_join_conds);
+
+  uint32_t ul = 0;
+  foreach_node(OpExpr, opexpr, merge_join->mergeclauses) {
+    // pick the first family, the same as the DXL translation does
+    merge_join->mergeFamilies[ul] = gpdb::ListNthOid(gpdb::GetMergeJoinOpFamilies(opexpr->opno), 0);
+    merge_join->mergeCollations[ul] = gpdb::ExprCollation((Node *)linitial(opexpr->args));
+
+    // must match CPhysicalMergeJoin::PosMergeKeys()
+    merge_join->mergeStrategies[ul] = BTLessStrategyNumber;
+    merge_join->mergeNullsFirst[ul] = false;
+    ul++;
+  }
+
+  plan->targetlist = GeneratePlanTargetList(OUTER_VAR, expr->Prpp()->PcrsRequired(), ctx->out_cols);
+
+  ApplyPlanStats(plan, ctx->expr);
+  child_ctx_.clear();
+
+  return plan;
+}
+
 Plan *PlanGenerator::GenerateMaterializePlan(PlanGeneratorContext *ctx) {
   auto *expr = ctx->expr;
   Material *materialize = makeNode(Material);
@@ -491,6 +782,11 @@ Plan *PlanGenerator::GenerateNLJoinPlan(PlanGeneratorContext *ctx) {
   Plan *plan = &(join->plan);
   plan->plan_node_id = GetNextPlanNodeID();
 
+  // outer references of an index nested loop join, passed to its inner side
+  // as params
+  CColRefArray *outer_refs = nullptr;
+  bool memoize = false;
+
   switch (pop->Eopid()) {
     case COperator::EopPhysicalInnerNLJoin:
       join->jointype = JOIN_INNER;
@@ -498,10 +794,14 @@ Plan *PlanGenerator::GenerateNLJoinPlan(PlanGeneratorContext *ctx) {
 
     case COperator::EopPhysicalInnerIndexNLJoin:
       join->jointype = JOIN_INNER;
+      outer_refs = CPhysicalInnerIndexNLJoin::PopConvert(pop)->PdrgPcrOuterRefs();
+      memoize = CPhysicalInnerIndexNLJoin::PopConvert(pop)->FMemoize();
       break;
 
     case COperator::EopPhysicalLeftOuterIndexNLJoin:
       join->jointype = JOIN_LEFT;
+      outer_refs = CPhysicalLeftOuterIndexNLJoin::PopConvert(pop)->PdrgPcrOuterRefs();
+      memoize = CPhysicalLeftOuterIndexNLJoin::PopConvert(pop)->FMemoize();
       break;
 
     case COperator::EopPhysicalLeftOuterNLJoin:
@@ -535,11 +835,43 @@ Plan *PlanGenerator::GenerateNLJoinPlan(PlanGeneratorContext *ctx) {
   };
   left_plan = GeneratePlanInternal(&left_ctx);
 
+  // the outer references are columns of the left plan, inside the right
+  // plan they are params set by the join for every outer row
+  if (nullptr != outer_refs) {
+    for (uint32_t ul = 0; ul < outer_refs->Size(); ul++) {
+      CColRef *colref = (*outer_refs)[ul];
+      const TargetEntry *target_entry = l_ctx.GetTargetEntry(colref->Id());
+      if (nullptr == target_entry) {
+        RaiseUnsupported(m_mp, pop);
+      }
+
+      uint32_t param_id = GetNextParamId(CMDIdGPDB::CastMdid(colref->RetrieveType()->MDId())->Oid());
+      nest_param_ids_[colref->Id()] = param_id;
+
+      Var *var = gpdb::MakeVarFromTargetEntry(OUTER_VAR, const_cast<TargetEntry *>(target_entry));
+      NestLoopParam *nest_param = makeNode(NestLoopParam);
+      nest_param->paramno = param_id;
+      nest_param->paramval = var;
+      nested_loop->nestParams = lappend(nested_loop->nestParams, nest_param);
+    }
+  }
+
   PlanGeneratorContext right_ctx{
       .expr = (*expr)[1],
       .translate_ctxt = &r_ctx,
   };
   right_plan = GeneratePlanInternal(&right_ctx);
+
+  if (nullptr != outer_refs) {
+    if (memoize) {
+      right_plan = GenerateMemoizePlan(right_plan, (*expr)[0], outer_refs);
+    }
+
+    for (uint32_t ul = 0; ul < outer_refs->Size(); ul++) {
+      nest_param_ids_.erase((*outer_refs)[ul]->Id());
+    }
+  }
+
   child_ctx_.push_back(&l_ctx);
   child_ctx_.push_back(&r_ctx);
 
@@ -653,12 +985,16 @@ Plan *PlanGenerator::GenerateAggPlan(PlanGeneratorContext *ctx) {
   CPhysicalAgg *popAgg = nullptr;
 
   switch (expr->Pop()->Eopid()) {
-    case COperator::EopPhysicalStreamAgg: {
+    // the deduplicating variants only differ in the keys they require from
+    // their child, which the child's target list already accounts for
+    case COperator::EopPhysicalStreamAgg:
+    case COperator::EopPhysicalStreamAggDeduplicate: {
       agg->aggstrategy = AGG_SORTED;
       popAgg = CPhysicalStreamAgg::PopConvert(expr->Pop());
       break;
     }
-    case COperator::EopPhysicalHashAgg: {
+    case COperator::EopPhysicalHashAgg:
+    case COperator::EopPhysicalHashAggDeduplicate: {
       popAgg = CPhysicalHashAgg::PopConvert(expr->Pop());
       agg->aggstrategy = AGG_HASHED;
       break;
@@ -668,16 +1004,33 @@ Plan *PlanGenerator::GenerateAggPlan(PlanGeneratorContext *ctx) {
       agg->aggstrategy = AGG_PLAIN;
       break;
     }
-    default: {
-      return nullptr;  // to silence the compiler
-    }
+    default:
+      RaiseUnsupported(m_mp, expr->Pop());
   }
 
   const CColRefArray *pdrgpcrGroupingCols = popAgg->PdrgpcrGroupingCols();
-  (void)pdrgpcrGroupingCols;
+
+  // deduplicating aggs only group on the grouping columns that are either
+  // required or part of the join keys
+  CColRefSet *pcrsKeys = nullptr;
+  if (COperator::EopPhysicalStreamAggDeduplicate == expr->Pop()->Eopid()) {
+    pcrsKeys = GPOS_NEW(m_mp) CColRefSet(m_mp, CPhysicalStreamAggDeduplicate::PopConvert(expr->Pop())->PdrgpcrKeys());
+  } else if (COperator::EopPhysicalHashAggDeduplicate == expr->Pop()->Eopid()) {
+    pcrsKeys = GPOS_NEW(m_mp) CColRefSet(m_mp, CPhysicalHashAggDeduplicate::PopConvert(expr->Pop())->PdrgpcrKeys());
+  }
+
+  std::vector<const CColRef *> grouping_cols;
+  for (uint32_t ul = 0; ul < pdrgpcrGroupingCols->Size(); ul++) {
+    const CColRef *colref = (*pdrgpcrGroupingCols)[ul];
+    if (nullptr != pcrsKeys && !pcrsKeys->FMember(colref) && !expr->Prpp()->PcrsRequired()->FMember(colref)) {
+      continue;
+    }
+    grouping_cols.push_back(colref);
+  }
+  CRefCount::SafeRelease(pcrsKeys);
 
   // group
-  agg->numCols = pdrgpcrGroupingCols->Size();
+  agg->numCols = grouping_cols.size();
   if (agg->numCols > 0) {
     agg->grpColIdx = (AttrNumber *)palloc(agg->numCols * sizeof(AttrNumber));
     agg->grpOperators = (Oid *)palloc(agg->numCols * sizeof(Oid));
@@ -689,7 +1042,7 @@ Plan *PlanGenerator::GenerateAggPlan(PlanGeneratorContext *ctx) {
   }
 
   for (int i = 0; i < agg->numCols; i++) {
-    const CColRef *colref = (*pdrgpcrGroupingCols)[i];
+    const CColRef *colref = grouping_cols[i];
     auto [target_entry, _] = GetChildTarget(colref->Id());
     agg->grpColIdx[i] = target_entry->resno;
     Oid typeId = exprType((Node *)target_entry->expr);
@@ -697,10 +1050,129 @@ Plan *PlanGenerator::GenerateAggPlan(PlanGeneratorContext *ctx) {
     agg->grpCollations[i] = gpdb::ExprCollation((Node *)target_entry->expr);
   }
 
-  agg->numGroups = 1;
-
   ApplyPlanStats(plan, ctx->expr);
 
+  // sizes the hash table of a hashed aggregate
+  agg->numGroups = std::max(1L, (long)plan->plan_rows);
+
+  child_ctx_.clear();
+
+  return plan;
+}
+
+// frame options for one boundary of a window frame, the delayed variants
+// are told apart by the executor itself
+static int FrameBoundaryOptions(CWindowFrame::EFrameBoundary efb, bool is_leading) {
+  switch (efb) {
+    case CWindowFrame::EfbUnboundedPreceding:
+      return is_leading ? FRAMEOPTION_START_UNBOUNDED_PRECEDING : FRAMEOPTION_END_UNBOUNDED_PRECEDING;
+    case CWindowFrame::EfbBoundedPreceding:
+    case CWindowFrame::EfbDelayedBoundedPreceding:
+      return is_leading ? FRAMEOPTION_START_OFFSET_PRECEDING : FRAMEOPTION_END_OFFSET_PRECEDING;
+    case CWindowFrame::EfbCurrentRow:
+      return is_leading ? FRAMEOPTION_START_CURRENT_ROW : FRAMEOPTION_END_CURRENT_ROW;
+    case CWindowFrame::EfbBoundedFollowing:
+    case CWindowFrame::EfbDelayedBoundedFollowing:
+      return is_leading ? FRAMEOPTION_START_OFFSET_FOLLOWING : FRAMEOPTION_END_OFFSET_FOLLOWING;
+    case CWindowFrame::EfbUnboundedFollowing:
+      return is_leading ? FRAMEOPTION_START_UNBOUNDED_FOLLOWING : FRAMEOPTION_END_UNBOUNDED_FOLLOWING;
+    default:
+      GPOS_ASSERT(!"Unexpected window frame boundary");
+      return 0;
+  }
+}
+
+Plan *PlanGenerator::GenerateWindowPlan(PlanGeneratorContext *ctx) {
+  auto *expr = ctx->expr;
+  CPhysicalSequenceProject *popSeqPrj = CPhysicalSequenceProject::PopConvert(expr->Pop());
+
+  COrderSpecArray *pdrgpos = popSeqPrj->Pdrgpos();
+  if (pdrgpos->Size() > 1) {
+    GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, GPOS_WSZ_LIT("More than one window key"));
+  }
+
+  WindowAgg *window = makeNode(WindowAgg);
+  Plan *plan = &(window->plan);
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  CDXLTranslateContext tt_ctx{true, nullptr};
+
+  PlanGeneratorContext left_ctx{
+      .expr = (*expr)[0],
+      .translate_ctxt = &tt_ctx,
+  };
+
+  plan->lefttree = GeneratePlanInternal(&left_ctx);
+  child_ctx_.push_back(left_ctx.translate_ctxt);
+  output_context_ = ctx->translate_ctxt;
+
+  plan->targetlist = GeneratePlanTargetList((*expr)[1], expr->Prpp()->PcrsRequired(), ctx->out_cols);
+
+  foreach_node(TargetEntry, te, plan->targetlist) {
+    if (IsA(te->expr, WindowFunc)) {
+      window->winref = ((WindowFunc *)te->expr)->winref;
+      break;
+    }
+  }
+
+  // partition columns are not produced, as in the DXL translation
+  window->partNumCols = 0;
+  window->frameOptions = FRAMEOPTION_DEFAULTS;
+
+  if (1 == pdrgpos->Size()) {
+    COrderSpec *pos = (*pdrgpos)[0];
+    window->ordNumCols = pos->UlSortColumns();
+    window->ordColIdx = (AttrNumber *)palloc(window->ordNumCols * sizeof(AttrNumber));
+    window->ordOperators = (Oid *)palloc(window->ordNumCols * sizeof(Oid));
+    window->ordCollations = (Oid *)palloc(window->ordNumCols * sizeof(Oid));
+
+    for (uint32_t ul = 0; ul < pos->UlSortColumns(); ul++) {
+      auto [target_entry, _] = GetChildTarget(pos->Pcr(ul)->Id());
+      window->ordColIdx[ul] = target_entry->resno;
+      // the executor wants equality operators here, not ordering ones
+      window->ordOperators[ul] =
+          gpdb::GetEqualityOpForOrderingOp(CMDIdGPDB::CastMdid(pos->GetMdIdSortOp(ul))->Oid(), nullptr);
+      window->ordCollations[ul] = gpdb::ExprCollation((Node *)target_entry->expr);
+    }
+
+    CWindowFrame *pwf = 0 < popSeqPrj->Pdrgpwf()->Size() ? (*popSeqPrj->Pdrgpwf())[0] : nullptr;
+    if (nullptr != pwf && !CWindowFrame::IsEmpty(pwf)) {
+      window->frameOptions = FRAMEOPTION_NONDEFAULT;
+      if (CWindowFrame::EfsRows == pwf->Efs()) {
+        window->frameOptions |= FRAMEOPTION_ROWS;
+      } else if (CWindowFrame::EfsGroups == pwf->Efs()) {
+        window->frameOptions |= FRAMEOPTION_GROUPS;
+      } else {
+        window->frameOptions |= FRAMEOPTION_RANGE;
+      }
+
+      if (CWindowFrame::EfesCurrentRow == pwf->Efes()) {
+        window->frameOptions |= FRAMEOPTION_EXCLUDE_CURRENT_ROW;
+      } else if (CWindowFrame::EfseMatchingOthers == pwf->Efes()) {
+        window->frameOptions |= FRAMEOPTION_EXCLUDE_GROUP;
+      } else if (CWindowFrame::EfesTies == pwf->Efes()) {
+        window->frameOptions |= FRAMEOPTION_EXCLUDE_TIES;
+      }
+
+      window->frameOptions |= FrameBoundaryOptions(pwf->EfbLeading(), true);
+      window->frameOptions |= FrameBoundaryOptions(pwf->EfbTrailing(), false);
+
+      if (nullptr != pwf->PexprLeading()) {
+        window->startOffset = (Node *)TransExpr(pwf->PexprLeading());
+      }
+      if (nullptr != pwf->PexprTrailing()) {
+        window->endOffset = (Node *)TransExpr(pwf->PexprTrailing());
+      }
+
+      window->startInRangeFunc = pwf->StartInRangeFunc();
+      window->endInRangeFunc = pwf->EndInRangeFunc();
+      window->inRangeColl = pwf->InRangeColl();
+      window->inRangeAsc = pwf->InRangeAsc();
+      window->inRangeNullsFirst = pwf->InRangeNullsFirst();
+    }
+  }
+
+  ApplyPlanStats(plan, ctx->expr);
   child_ctx_.clear();
 
   return plan;
@@ -720,7 +1192,14 @@ Plan *PlanGenerator::GenerateSortPlan(PlanGeneratorContext *ctx) {
       .translate_ctxt = &tt_ctx,
   };
 
-  Sort *sort = makeNode(Sort);
+  Sort *sort = nullptr;
+  if (COperator::EopPhysicalIncrementalSort == popSort->Eopid()) {
+    IncrementalSort *incremental_sort = makeNode(IncrementalSort);
+    incremental_sort->nPresortedCols = (int)CPhysicalIncrementalSort::PopConvert(popSort)->UlPresortedCols();
+    sort = &(incremental_sort->sort);
+  } else {
+    sort = makeNode(Sort);
+  }
   Plan *plan = &(sort->plan);
   plan->plan_node_id = GetNextPlanNodeID();
 
@@ -752,12 +1231,95 @@ Plan *PlanGenerator::GenerateSortPlan(PlanGeneratorContext *ctx) {
   return plan;
 }
 
+// everything below a Gather is shipped to the workers, mark it as such
+static void MarkParallelSafe(Plan *plan) {
+  if (nullptr == plan) {
+    return;
+  }
+
+  plan->parallel_safe = true;
+  MarkParallelSafe(plan->lefttree);
+  MarkParallelSafe(plan->righttree);
+
+  if (IsA(plan, Append)) {
+    foreach_node(Plan, subplan, ((Append *)plan)->appendplans) {
+      MarkParallelSafe(subplan);
+    }
+  }
+}
+
+Plan *PlanGenerator::GenerateGatherPlan(PlanGeneratorContext *ctx) {
+  auto *expr = ctx->expr;
+  CPhysicalGather *popGather = CPhysicalGather::PopConvert(expr->Pop());
+  int num_workers = (int)COptCtxt::PoctxtFromTLS()->GetCostModel()->UlParallelWorkers();
+
+  CDXLTranslateContext l_ctx{false, ctx->translate_ctxt->GetColIdToParamIdMap()};
+
+  PlanGeneratorContext left_ctx{
+      .expr = (*expr)[0],
+      .out_cols = ctx->out_cols,
+      .translate_ctxt = &l_ctx,
+  };
+
+  Plan *plan = nullptr;
+  GatherMerge *gather_merge = nullptr;
+  if (popGather->FMerge()) {
+    gather_merge = makeNode(GatherMerge);
+    gather_merge->num_workers = num_workers;
+    gather_merge->rescan_param = -1;
+    plan = &(gather_merge->plan);
+  } else {
+    Gather *gather = makeNode(Gather);
+    gather->num_workers = num_workers;
+    gather->rescan_param = -1;
+    gather->single_copy = false;
+    gather->invisible = false;
+    plan = &(gather->plan);
+  }
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  in_parallel_ = true;
+  plan->lefttree = GeneratePlanInternal(&left_ctx);
+  in_parallel_ = false;
+  MarkParallelSafe(plan->lefttree);
+  child_ctx_.push_back(&l_ctx);
+  output_context_ = ctx->translate_ctxt;
+
+  plan->targetlist = GeneratePlanTargetList(OUTER_VAR, expr->Prpp()->PcrsRequired(), ctx->out_cols);
+
+  if (nullptr != gather_merge) {
+    auto *pos = popGather->Pos();
+    gather_merge->numCols = pos->UlSortColumns();
+    gather_merge->sortColIdx = (AttrNumber *)palloc(gather_merge->numCols * sizeof(AttrNumber));
+    gather_merge->sortOperators = (Oid *)palloc(gather_merge->numCols * sizeof(Oid));
+    gather_merge->collations = (Oid *)palloc(gather_merge->numCols * sizeof(Oid));
+    gather_merge->nullsFirst = (bool *)palloc(gather_merge->numCols * sizeof(bool));
+
+    for (uint32_t ul = 0; ul < pos->UlSortColumns(); ul++) {
+      const CColRef *colref = pos->Pcr(ul);
+      auto [target_entry, _] = GetChildTarget(colref->Id());
+      gather_merge->sortColIdx[ul] = target_entry->resno;
+      gather_merge->sortOperators[ul] = CMDIdGPDB::CastMdid(pos->GetMdIdSortOp(ul))->Oid();
+      gather_merge->nullsFirst[ul] = (pos->Ent(ul) == COrderSpec::EntFirst);
+      gather_merge->collations[ul] = gpdb::ExprCollation((Node *)target_entry->expr);
+    }
+  }
+
+  parallel_mode_needed_ = true;
+
+  ApplyPlanStats(plan, ctx->expr);
+  child_ctx_.clear();
+
+  return plan;
+}
+
 Plan *PlanGenerator::GenerateIndexScanPlan(PlanGeneratorContext *ctx) {
   CPhysicalIndexScan *popIs = CPhysicalIndexScan::PopConvert(ctx->expr->Pop());
   IndexScan *index_scan = makeNode(IndexScan);
 
   CMDIdGPDB *mdid_index = CMDIdGPDB::CastMdid(popIs->Pindexdesc()->MDId());
-  // const IMDIndex *md_index = catalog_->RetrieveIndex(mdid_index);
+  const IMDIndex *md_index = catalog_->RetrieveIndex(mdid_index);
+  const IMDRelation *md_rel = catalog_->RetrieveRel(popIs->Ptabdesc()->MDId());
 
   TranslateContextBaseTable base_table_context;
   translate_ctxt_base_table_ = &base_table_context;
@@ -771,28 +1333,305 @@ Plan *PlanGenerator::GenerateIndexScanPlan(PlanGeneratorContext *ctx) {
       (popIs->IndexScanDirection() == EForwardScan) ? EdxlisdForward : EdxlisdBackward);
 
   CExpression *index_cond = (*ctx->expr)[0];
-  CExpression *filter = (2 == ctx->expr->Arity()) ? (*ctx->expr)[1] : nullptr;
+  CExpression *residual = (2 == ctx->expr->Arity()) ? (*ctx->expr)[1] : nullptr;
 
   Plan *plan = &(index_scan->scan.plan);
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  auto *cols = ctx->upper_cols ? ctx->upper_cols : ctx->expr->Prpp()->PcrsRequired();
+  plan->targetlist = GeneratePlanTargetList(index_scan->scan.scanrelid, cols, ctx->out_cols);
+  GenerateProjectTargets(plan, ctx->target);
 
-  plan->targetlist =
-      GeneratePlanTargetList(index_scan->scan.scanrelid, ctx->expr->Prpp()->PcrsRequired(), ctx->out_cols);
+  if (nullptr != residual && !CUtils::FScalarConstTrue(residual)) {
+    plan->qual = lappend(plan->qual, TransExpr(residual));
+  }
 
-  // orca do this , check later
-  if (auto *qual = TransExpr(filter); qual)
+  if (auto *qual = TransExpr(ctx->filter); qual)
     plan->qual = lappend(plan->qual, qual);
 
-  if (auto *index_qual = TransExpr(index_cond); index_qual) {
-    index_scan->indexqual = lappend(index_scan->indexqual, index_qual);
-    index_scan->indexqualorig = (List *)copyObject(index_scan->indexqual);
+  TranslateIndexConditions(index_cond, md_index, md_rel, false /*is_bitmap_index_probe*/, &index_scan->indexqual,
+                           &index_scan->indexqualorig);
+
+  ApplyPlanStats(plan, ctx->expr);
+  translate_ctxt_base_table_ = nullptr;
+
+  return plan;
+}
+
+// Target list of an index only scan: the index key columns followed by the
+// INCLUDE columns. Column ids are mapped to their position in the index, which
+// is what Vars above the scan have to reference.
+static List *GenerateIndexTargetList(const IMDRelation *md_rel, const IMDIndex *md_index,
+                                     const CTableDescriptor *ptabdesc, const CColRefArray *pdrgpcrOutput,
+                                     uint32_t scanrelid, TranslateContextBaseTable &index_ctx) {
+  List *target_list = NIL;
+
+  const uint32_t num_keys = md_index->Keys();
+  for (uint32_t ul = 0; ul < num_keys + md_index->IncludedCols(); ul++) {
+    uint32_t colpos = (ul < num_keys) ? md_index->KeyAt(ul) : md_index->IncludedColAt(ul - num_keys);
+    const IMDColumn *col = md_rel->GetMdCol(colpos);
+    Oid type_oid = CMDIdGPDB::CastMdid(col->MdidType())->Oid();
+
+    Var *var = makeVar(scanrelid, col->AttrNum(), type_oid, col->TypeModifier(), gpdb::TypeCollation(type_oid), 0);
+    target_list = lappend(target_list, makeTargetEntry((Expr *)var, ul + 1, nullptr, false));
+
+    for (uint32_t j = 0; j < ptabdesc->ColumnCount(); j++) {
+      if (ptabdesc->Pcoldesc(j)->AttrNum() == col->AttrNum()) {
+        index_ctx.colid_to_attno_map[(*pdrgpcrOutput)[j]->Id()] = ul + 1;
+        break;
+      }
+    }
   }
 
+  return target_list;
+}
+
+Plan *PlanGenerator::GenerateIndexOnlyScanPlan(PlanGeneratorContext *ctx) {
+  CPhysicalIndexOnlyScan *popIos = CPhysicalIndexOnlyScan::PopConvert(ctx->expr->Pop());
+  IndexOnlyScan *index_scan = makeNode(IndexOnlyScan);
+
+  CMDIdGPDB *mdid_index = CMDIdGPDB::CastMdid(popIos->Pindexdesc()->MDId());
+  const IMDIndex *md_index = catalog_->RetrieveIndex(mdid_index);
+  const IMDRelation *md_rel = catalog_->RetrieveRel(popIos->Ptabdesc()->MDId());
+
+  TranslateContextBaseTable base_table_context;
+  output_context_ = ctx->translate_ctxt;
+
+  index_scan->scan.scanrelid = ProcessDXLTblDescr(popIos->Ptabdesc(), popIos->PdrgpcrOutput(), base_table_context);
+  index_scan->indexid = mdid_index->Oid();
+  index_scan->indexorderdir = CTranslatorUtils::GetScanDirection(
+      (popIos->IndexScanDirection() == EForwardScan) ? EdxlisdForward : EdxlisdBackward);
+
+  // the scan returns index tuples, columns above it are read by index position
+  TranslateContextBaseTable index_context;
+  index_context.rel_oid = base_table_context.rel_oid;
+  index_context.rte_index = INDEX_VAR;
+  index_scan->indextlist = GenerateIndexTargetList(md_rel, md_index, popIos->Ptabdesc(), popIos->PdrgpcrOutput(),
+                                                   index_scan->scan.scanrelid, index_context);
+
+  Plan *plan = &(index_scan->scan.plan);
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  CExpression *index_cond = (*ctx->expr)[0];
+  CExpression *residual = (2 == ctx->expr->Arity()) ? (*ctx->expr)[1] : nullptr;
+
+  translate_ctxt_base_table_ = &index_context;
+
+  auto *cols = ctx->upper_cols ? ctx->upper_cols : ctx->expr->Prpp()->PcrsRequired();
+  plan->targetlist = GeneratePlanTargetList(INDEX_VAR, cols, ctx->out_cols);
+  GenerateProjectTargets(plan, ctx->target);
+
+  if (nullptr != residual && !CUtils::FScalarConstTrue(residual)) {
+    plan->qual = lappend(plan->qual, TransExpr(residual));
+  }
+
+  if (auto *qual = TransExpr(ctx->filter); qual)
+    plan->qual = lappend(plan->qual, qual);
+
+  // index conditions are translated against the table and remapped to index
+  // key positions afterwards
+  translate_ctxt_base_table_ = &base_table_context;
+
+  List *index_qual_orig = NIL;
+  TranslateIndexConditions(index_cond, md_index, md_rel, false /*is_bitmap_index_probe*/, &index_scan->indexqual,
+                           &index_qual_orig);
+
+  ApplyPlanStats(plan, ctx->expr);
+  translate_ctxt_base_table_ = nullptr;
+
+  return plan;
+}
+
+Plan *PlanGenerator::GenerateBitmapTableScanPlan(PlanGeneratorContext *ctx) {
+  CPhysicalBitmapTableScan *popScan = CPhysicalBitmapTableScan::PopConvert(ctx->expr->Pop());
+  BitmapHeapScan *bitmap_tbl_scan = makeNode(BitmapHeapScan);
+
+  const IMDRelation *md_rel = catalog_->RetrieveRel(popScan->Ptabdesc()->MDId());
+
+  TranslateContextBaseTable base_table_context;
+  translate_ctxt_base_table_ = &base_table_context;
+
+  output_context_ = ctx->translate_ctxt;
+
+  bitmap_tbl_scan->scan.scanrelid =
+      ProcessDXLTblDescr(popScan->Ptabdesc(), popScan->PdrgpcrOutput(), base_table_context);
+
+  Plan *plan = &(bitmap_tbl_scan->scan.plan);
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  auto *cols = ctx->upper_cols ? ctx->upper_cols : ctx->expr->Prpp()->PcrsRequired();
+  plan->targetlist = GeneratePlanTargetList(bitmap_tbl_scan->scan.scanrelid, cols, ctx->out_cols, true);
+  GenerateProjectTargets(plan, ctx->target);
+
+  if (auto *qual = TransExpr(ctx->filter); qual)
+    plan->qual = lappend(plan->qual, qual);
+
+  // the recheck condition is evaluated on the heap tuples of lossy pages
+  CExpressionArray *pdrgpexprRecheck = CPredicateUtils::PdrgpexprConjuncts(m_mp, (*ctx->expr)[0]);
+  for (uint32_t ul = 0; ul < pdrgpexprRecheck->Size(); ul++) {
+    bitmap_tbl_scan->bitmapqualorig = lappend(bitmap_tbl_scan->bitmapqualorig, TransExpr((*pdrgpexprRecheck)[ul]));
+  }
+  pdrgpexprRecheck->Release();
+
+  plan->lefttree = GenerateBitmapAccessPathPlan((*ctx->expr)[1], md_rel, bitmap_tbl_scan->scan.scanrelid);
+
   ApplyPlanStats(plan, ctx->expr);
   translate_ctxt_base_table_ = nullptr;
 
   return plan;
 }
 
+Plan *PlanGenerator::GenerateBitmapAccessPathPlan(CExpression *expr, const IMDRelation *md_rel, uint32_t scanrelid) {
+  switch (expr->Pop()->Eopid()) {
+    case COperator::EopScalarBitmapIndexProbe: {
+      CScalarBitmapIndexProbe *popProbe = CScalarBitmapIndexProbe::PopConvert(expr->Pop());
+      BitmapIndexScan *bitmap_idx_scan = makeNode(BitmapIndexScan);
+      bitmap_idx_scan->scan.scanrelid = scanrelid;
+
+      CMDIdGPDB *mdid_index = CMDIdGPDB::CastMdid(popProbe->Pindexdesc()->MDId());
+      bitmap_idx_scan->indexid = mdid_index->Oid();
+
+      Plan *plan = &(bitmap_idx_scan->scan.plan);
+      plan->plan_node_id = GetNextPlanNodeID();
+
+      TranslateIndexConditions((*expr)[0], catalog_->RetrieveIndex(mdid_index), md_rel,
+                               true /*is_bitmap_index_probe*/, &bitmap_idx_scan->indexqual,
+                               &bitmap_idx_scan->indexqualorig);
+      return plan;
+    }
+
+    case COperator::EopScalarBitmapBoolOp: {
+      CScalarBitmapBoolOp *popBoolOp = CScalarBitmapBoolOp::PopConvert(expr->Pop());
+      List *bitmapplans = list_make2(GenerateBitmapAccessPathPlan((*expr)[0], md_rel, scanrelid),
+                                     GenerateBitmapAccessPathPlan((*expr)[1], md_rel, scanrelid));
+
+      if (CScalarBitmapBoolOp::EbitmapboolAnd == popBoolOp->Ebitmapboolop()) {
+        BitmapAnd *bitmapand = makeNode(BitmapAnd);
+        bitmapand->plan.plan_node_id = GetNextPlanNodeID();
+        bitmapand->bitmapplans = bitmapplans;
+        return (Plan *)bitmapand;
+      }
+
+      BitmapOr *bitmapor = makeNode(BitmapOr);
+      bitmapor->plan.plan_node_id = GetNextPlanNodeID();
+      bitmapor->bitmapplans = bitmapplans;
+      return (Plan *)bitmapor;
+    }
+
+    default:
+      RaiseUnsupported(m_mp, expr->Pop());
+  }
+}
+
+struct SIndexVarAttnoContext {
+  const IMDRelation *md_rel;
+  const IMDIndex *md_index;
+};
+
+// set the attnos of index key Vars to their position in the index
+static bool SetIndexVarAttnoWalker(Node *node, void *context) {
+  if (nullptr == node) {
+    return false;
+  }
+
+  if (IsA(node, Var) && ((Var *)node)->varno != OUTER_VAR) {
+    auto *ctxt = (SIndexVarAttnoContext *)context;
+    Var *var = (Var *)node;
+
+    for (uint32_t col_pos = 0; col_pos < ctxt->md_rel->ColumnCount(); col_pos++) {
+      if (var->varattno == ctxt->md_rel->GetMdCol(col_pos)->AttrNum()) {
+        var->varattno = 1 + ctxt->md_index->GetKeyPos(col_pos);
+        break;
+      }
+    }
+
+    return false;
+  }
+
+  return expression_tree_walker(node, SetIndexVarAttnoWalker, context);
+}
+
+void PlanGenerator::TranslateIndexConditions(CExpression *index_cond, const IMDIndex *md_index,
+                                             const IMDRelation *md_rel, bool is_bitmap_index_probe,
+                                             List **index_qual, List **index_qual_orig) {
+  CIndexQualInfoArray *index_qual_info_array = GPOS_NEW(m_mp) CIndexQualInfoArray(m_mp);
+  CExpressionArray *pdrgpexprConds = CPredicateUtils::PdrgpexprConjuncts(m_mp, index_cond);
+
+  for (uint32_t ul = 0; ul < pdrgpexprConds->Size(); ul++) {
+    Expr *original_index_cond_expr = TransExpr((*pdrgpexprConds)[ul]);
+
+    // 'x IS NOT NULL' arrives as 'NOT (x IS NULL)', index quals have to be
+    // an OpExpr, a ScalarArrayOpExpr or a NullTest
+    if (IsA(original_index_cond_expr, BoolExpr) && NOT_EXPR == ((BoolExpr *)original_index_cond_expr)->boolop &&
+        IsA(linitial(((BoolExpr *)original_index_cond_expr)->args), NullTest)) {
+      NullTest *null_test = (NullTest *)linitial(((BoolExpr *)original_index_cond_expr)->args);
+      null_test->nulltesttype = IS_NOT_NULL;
+      original_index_cond_expr = (Expr *)null_test;
+    }
+
+    if (!IsA(original_index_cond_expr, OpExpr) && !IsA(original_index_cond_expr, ScalarArrayOpExpr) &&
+        !IsA(original_index_cond_expr, NullTest)) {
+      GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, GPOS_WSZ_LIT("Index condition"));
+    }
+
+    // allow index quals with scalar arrays only for bitmap and btree indexes
+    if (!is_bitmap_index_probe && IsA(original_index_cond_expr, ScalarArrayOpExpr) &&
+        !(IMDIndex::EmdindBitmap == md_index->IndexType() || IMDIndex::EmdindBtree == md_index->IndexType())) {
+      GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp,
+                 GPOS_WSZ_LIT("ScalarArrayOpExpr condition on index scan"));
+    }
+
+    Expr *index_cond_expr = (Expr *)copyObject(original_index_cond_expr);
+    SIndexVarAttnoContext index_varattno_ctxt{.md_rel = md_rel, .md_index = md_index};
+    SetIndexVarAttnoWalker((Node *)index_cond_expr, &index_varattno_ctxt);
+
+    Node *left_arg = nullptr;
+    Node *right_arg = nullptr;
+    if (IsA(index_cond_expr, NullTest)) {
+      left_arg = (Node *)((NullTest *)index_cond_expr)->arg;
+    } else {
+      List **args = IsA(index_cond_expr, OpExpr) ? &((OpExpr *)index_cond_expr)->args
+                                                 : &((ScalarArrayOpExpr *)index_cond_expr)->args;
+      left_arg = (Node *)linitial(*args);
+      right_arg = (Node *)llast(*args);
+
+      // strip binary compatible casts off the index key
+      if (IsA(left_arg, RelabelType) && IsA(((RelabelType *)left_arg)->arg, Var)) {
+        left_arg = (Node *)((RelabelType *)left_arg)->arg;
+        *args = list_make2(left_arg, right_arg);
+      } else if (IsA(right_arg, RelabelType) && IsA(((RelabelType *)right_arg)->arg, Var)) {
+        right_arg = (Node *)((RelabelType *)right_arg)->arg;
+        *args = list_make2(left_arg, right_arg);
+      }
+    }
+
+    AttrNumber attno = 0;
+    if (IsA(left_arg, Var) && ((Var *)left_arg)->varno != OUTER_VAR) {
+      // index key is on the left side
+      attno = ((Var *)left_arg)->varattno;
+      ((Var *)left_arg)->varno = INDEX_VAR;
+    } else if (nullptr != right_arg && IsA(right_arg, Var) && ((Var *)right_arg)->varno != OUTER_VAR) {
+      attno = ((Var *)right_arg)->varattno;
+    } else {
+      GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, GPOS_WSZ_LIT("Index condition without index key"));
+    }
+
+    index_qual_info_array->Append(GPOS_NEW(m_mp) CIndexQualInfo(attno, index_cond_expr, original_index_cond_expr));
+  }
+
+  // the index quals must be ordered by attribute number
+  index_qual_info_array->Sort(CIndexQualInfo::IndexQualInfoCmp);
+
+  for (uint32_t ul = 0; ul < index_qual_info_array->Size(); ul++) {
+    CIndexQualInfo *index_qual_info = (*index_qual_info_array)[ul];
+    *index_qual = lappend(*index_qual, index_qual_info->m_expr);
+    *index_qual_orig = lappend(*index_qual_orig, index_qual_info->m_original_expr);
+  }
+
+  pdrgpexprConds->Release();
+  index_qual_info_array->Release();
+}
+
 Plan *PlanGenerator::GenerateLimitPlan(PlanGeneratorContext *ctx) {
   CExpression *pexprChild = (*ctx->expr)[0];
   CExpression *pexprOffset = (*ctx->expr)[1];
@@ -838,11 +1677,45 @@ Plan *PlanGenerator::GenerateComputeScalarPlan(PlanGeneratorContext *ctx) {
       .translate_ctxt = ctx->translate_ctxt,
   };
 
-  auto *plan = GeneratePlanInternal(&child_ctx);
+  Plan *plan = nullptr;
+  if (IsProjectingScan(child_ctx.expr->Pop()->Eopid())) {
+    plan = GeneratePlanInternal(&child_ctx);
+  } else {
+    child_ctx.out_cols = ctx->out_cols;
+    child_ctx.upper_cols = ctx->expr->Prpp()->PcrsRequired();
+    plan = GenerateResultPlan(&child_ctx);
+  }
   ApplyPlanStats(plan, ctx->expr);
   return plan;
 }
 
+Plan *PlanGenerator::GenerateResultPlan(PlanGeneratorContext *ctx) {
+  Result *result = makeNode(Result);
+  Plan *plan = &(result->plan);
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  CDXLTranslateContext l_ctx{false, ctx->translate_ctxt->GetColIdToParamIdMap()};
+
+  PlanGeneratorContext child_ctx{
+      .expr = ctx->expr,
+      .translate_ctxt = &l_ctx,
+  };
+  plan->lefttree = GeneratePlanInternal(&child_ctx);
+  child_ctx_.push_back(&l_ctx);
+  output_context_ = ctx->translate_ctxt;
+
+  auto *cols = ctx->upper_cols ? ctx->upper_cols : ctx->expr->Prpp()->PcrsRequired();
+  plan->targetlist = GeneratePlanTargetList(ctx->target, cols, ctx->out_cols);
+
+  if (auto *qual = TransExpr(ctx->filter); qual)
+    plan->qual = lappend(plan->qual, qual);
+
+  ApplyPlanStats(plan, ctx->expr);
+  child_ctx_.clear();
+
+  return plan;
+}
+
 Plan *PlanGenerator::GenerateConstTableGetPlan(PlanGeneratorContext *ctx) {
   CPhysicalConstTableGet *popCTG = CPhysicalConstTableGet::PopConvert(ctx->expr->Pop());
   CColRefArray *pdrgpcrCTGOutput = popCTG->PdrgpcrOutput();
@@ -898,19 +1771,7 @@ Plan *PlanGenerator::GenerateConstTableGetPlan(PlanGeneratorContext *ctx) {
     plan = &result->plan;
     // TODO: select 1;   values(1);
     if (ctx->target) {
-      auto *target_exprs = ctx->target;
-      int resno = list_length(plan->targetlist) + 1;
-      for (uint32_t ul = 0; ul < target_exprs->Arity(); ul++) {
-        CExpression *pexprProjElem = (*target_exprs)[ul];
-
-        const CScalarProjectElement *popScPrEl = CScalarProjectElement::PopConvert(pexprProjElem->Pop());
-
-        char *name =
-            CTranslatorUtils::CreateMultiByteCharStringFromWCString(popScPrEl->Pcr()->Name().Pstr()->GetBuffer());
-        auto *target_entry = makeTargetEntry(TransExpr((*pexprProjElem)[0]), resno++, name, false);
-        plan->targetlist = lappend(plan->targetlist, target_entry);
-        output_context_->InsertMapping(popScPrEl->Pcr()->Id(), target_entry);
-      }
+      GenerateProjectTargets(plan, ctx->target);
     } else {
       for (uint32_t ulTuplePos = 0; ulTuplePos < ulRows; ulTuplePos++) {
         IDatumArray *pdrgpdatum = (*pdrgpdrgdatum)[ulTuplePos];
@@ -948,41 +1809,23 @@ Plan *PlanGenerator::GenerateFilterPlan(PlanGeneratorContext *ctx) {
   CExpression *pexprRelational = (*pexprFilter)[0];
   CExpression *pexprScalar = (*pexprFilter)[1];
 
-  switch (pexprRelational->Pop()->Eopid()) {
-    case COperator::EopPhysicalTableScan:
-    case COperator::EopPhysicalForeignScan: {
-      PlanGeneratorContext scan_ctx{
-          .expr = pexprRelational,
-          .upper_cols = pexprFilter->Prpp()->PcrsRequired(),
-          .filter = pexprScalar,
-          .target = ctx->target,
-          .translate_ctxt = ctx->translate_ctxt,
-      };
-      auto *plan = GeneratePlanInternal(&scan_ctx);
-      ApplyPlanStats(plan, ctx->expr);
-      return plan;
-    }
-
-    case COperator::EopPhysicalBitmapTableScan: {
-    }
-    case COperator::EopPhysicalIndexOnlyScan:
-    case COperator::EopPhysicalIndexScan: {
-    }
+  PlanGeneratorContext scan_ctx{
+      .expr = pexprRelational,
+      .upper_cols = pexprFilter->Prpp()->PcrsRequired(),
+      .filter = pexprScalar,
+      .target = ctx->target,
+      .translate_ctxt = ctx->translate_ctxt,
+  };
 
-    default: {
-      PlanGeneratorContext scan_ctx{
-          .expr = pexprRelational,
-          .filter = pexprScalar,
-          .target = ctx->target,
-          .translate_ctxt = ctx->translate_ctxt,
-      };
-      auto *plan = GeneratePlanInternal(&scan_ctx);
-      ApplyPlanStats(plan, ctx->expr);
-      return plan;
-    }
+  Plan *plan = nullptr;
+  if (IsProjectingScan(pexprRelational->Pop()->Eopid())) {
+    plan = GeneratePlanInternal(&scan_ctx);
+  } else {
+    scan_ctx.out_cols = ctx->out_cols;
+    plan = GenerateResultPlan(&scan_ctx);
   }
-
-  return nullptr;
+  ApplyPlanStats(plan, ctx->expr);
+  return plan;
 }
 
 Plan *PlanGenerator::GenerateTVFPlan(PlanGeneratorContext *ctx) {
@@ -1044,22 +1887,9 @@ Plan *PlanGenerator::GenerateTVFPlan(PlanGeneratorContext *ctx) {
   func_scan->functions = list_make1(rtfunc);
 
   func_scan->scan.scanrelid = list_length(rtable_);
-  plan->targetlist = nullptr;
-  if (ctx->target) {
-    auto *target_exprs = ctx->target;
-    int resno = list_length(plan->targetlist) + 1;
-    for (uint32_t ul = 0; ul < target_exprs->Arity(); ul++) {
-      CExpression *pexprProjElem = (*target_exprs)[ul];
-
-      const CScalarProjectElement *popScPrEl = CScalarProjectElement::PopConvert(pexprProjElem->Pop());
-
-      char *name =
-          CTranslatorUtils::CreateMultiByteCharStringFromWCString(popScPrEl->Pcr()->Name().Pstr()->GetBuffer());
-      auto *target_entry = makeTargetEntry(TransExpr((*pexprProjElem)[0]), resno++, name, false);
-      plan->targetlist = lappend(plan->targetlist, target_entry);
-      output_context_->InsertMapping(popScPrEl->Pcr()->Id(), target_entry);
-    }
-  } else
+  if (ctx->target)
+    GenerateProjectTargets(plan, ctx->target);
+  else
     plan->targetlist = GeneratePlanTargetList(func_scan->scan.scanrelid, pcrsOutput, nullptr);
 
   if (ctx->filter) {
@@ -1089,24 +1919,193 @@ Plan *PlanGenerator::GenerateSeqScanPlan(PlanGeneratorContext *ctx) {
 
   auto *plan = &seq_scan->scan.plan;
   plan->plan_node_id = GetNextPlanNodeID();
+  plan->parallel_aware = popTblScan->FParallel();
   plan->targetlist = GeneratePlanTargetList(seq_scan->scan.scanrelid, cols, ctx->out_cols, true);
 
-  if (ctx->target) {
-    auto *target_exprs = ctx->target;
-    int resno = list_length(plan->targetlist) + 1;
-    for (uint32_t ul = 0; ul < target_exprs->Arity(); ul++) {
-      CExpression *pexprProjElem = (*target_exprs)[ul];
+  GenerateProjectTargets(plan, ctx->target);
 
-      const CScalarProjectElement *popScPrEl = CScalarProjectElement::PopConvert(pexprProjElem->Pop());
+  if (ctx->filter) {
+    if (auto *qual = TransExpr(ctx->filter); qual)
+      plan->qual = lappend(plan->qual, qual);
+  }
 
-      char *name =
-          CTranslatorUtils::CreateMultiByteCharStringFromWCString(popScPrEl->Pcr()->Name().Pstr()->GetBuffer());
-      auto *target_entry = makeTargetEntry(TransExpr((*pexprProjElem)[0]), resno++, name, false);
-      plan->targetlist = lappend(plan->targetlist, target_entry);
-      output_context_->InsertMapping(popScPrEl->Pcr()->Id(), target_entry);
-    }
+  ApplyPlanStats(plan, ctx->expr);
+  translate_ctxt_base_table_ = nullptr;
+
+  return plan;
+}
+
+Plan *PlanGenerator::GenerateForeignScanPlan(PlanGeneratorContext *ctx) {
+  auto *popForeignScan = CPhysicalForeignScan::PopConvert(ctx->expr->Pop());
+
+  TranslateContextBaseTable base_table_context;
+  translate_ctxt_base_table_ = &base_table_context;
+
+  output_context_ = ctx->translate_ctxt;
+
+  auto scanrelid = ProcessDXLTblDescr(popForeignScan->Ptabdesc(), popForeignScan->PdrgpcrOutput(), base_table_context);
+
+  auto *cols = ctx->expr->Prpp()->PcrsRequired();
+  if (ctx->upper_cols)
+    cols = ctx->upper_cols;
+
+  // the target list and quals are handed to the FDW, which decides what it
+  // evaluates remotely and builds the ForeignScan
+  Plan scan{};
+  scan.targetlist = GeneratePlanTargetList(scanrelid, cols, ctx->out_cols, true);
+  GenerateProjectTargets(&scan, ctx->target);
+
+  if (ctx->filter) {
+    if (auto *qual = TransExpr(ctx->filter); qual)
+      scan.qual = make_ands_implicit(qual);
   }
 
+  RangeTblEntry *rte = (RangeTblEntry *)llast(rtable_);
+  ForeignScan *foreign_scan =
+      gpdb::CreateForeignScan(base_table_context.rel_oid, scanrelid, scan.qual, scan.targetlist, nullptr, rte);
+  foreign_scan->scan.scanrelid = scanrelid;
+
+  auto *plan = &foreign_scan->scan.plan;
+  plan->plan_node_id = GetNextPlanNodeID();
+
+  ApplyPlanStats(plan, ctx->expr);
+  translate_ctxt_base_table_ = nullptr;
+
+  return plan;
+}
+
+void PlanGenerator::GenerateCTEProducerPlan(CExpression *expr) {
+  auto *popProducer = CPhysicalCTEProducer::PopConvert(expr->Pop());
+  CColRefArray *colrefs = popProducer->Pdrgpcr();
+
+  CDXLTranslateContext tt_ctx{false, nullptr};
+
+  PlanGeneratorContext child_ctx{
+      .expr = (*expr)[0],
+      .out_cols = colrefs,
+      .translate_ctxt = &tt_ctx,
+  };
+  Plan *plan = GeneratePlanInternal(&child_ctx);
+
+  CTEPlan cte_plan{.targetlist = plan->targetlist};
+  for (uint32_t ul = 0; ul < colrefs->Size(); ul++) {
+    const uint32_t colid = (*colrefs)[ul]->Id();
+    const TargetEntry *target_entry = tt_ctx.GetTargetEntry(colid);
+    if (nullptr == target_entry)
+      GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiDXL2PlStmtAttributeNotFound, colid);
+
+    cte_plan.attnos.push_back(target_entry->resno);
+  }
+
+  subplans_ = lappend(subplans_, plan);
+  cte_plan.plan_id = list_length(subplans_);
+  cte_plan.param_id = (int)GetNextParamId(InvalidOid);
+
+  // initplan of the CTE, as built by SS_process_ctes(), the CteScans pass the
+  // tuplestore around in its param
+  SubPlan *subplan = makeNode(SubPlan);
+  subplan->subLinkType = CTE_SUBLINK;
+  subplan->plan_id = cte_plan.plan_id;
+  subplan->plan_name = psprintf("CTE cte%u", popProducer->UlCTEId());
+  subplan->firstColType = VOIDOID;
+  subplan->firstColTypmod = -1;
+  subplan->firstColCollation = InvalidOid;
+  if (NIL != plan->targetlist) {
+    auto *target_entry = linitial_node(TargetEntry, plan->targetlist);
+    subplan->firstColType = gpdb::ExprType((Node *)target_entry->expr);
+    subplan->firstColTypmod = gpdb::ExprTypeMod((Node *)target_entry->expr);
+    subplan->firstColCollation = gpdb::ExprCollation((Node *)target_entry->expr);
+  }
+  subplan->setParam = list_make1_int(cte_plan.param_id);
+  subplan->startup_cost = plan->total_cost;
+  subplan->per_call_cost = 0;
+
+  cte_init_plans_ = lappend(cte_init_plans_, subplan);
+  cte_plans_[popProducer->UlCTEId()] = cte_plan;
+}
+
+Plan *PlanGenerator::GenerateSequencePlan(PlanGeneratorContext *ctx) {
+  auto *expr = ctx->expr;
+  const uint32_t arity = expr->Arity();
+
+  for (uint32_t ul = 0; ul + 1 < arity; ul++) {
+    CExpression *pexprChild = (*expr)[ul];
+    if (COperator::EopPhysicalCTEProducer != pexprChild->Pop()->Eopid())
+      RaiseUnsupported(m_mp, pexprChild->Pop());
+
+    GenerateCTEProducerPlan(pexprChild);
+  }
+
+  // the last child produces the output of the sequence
+  PlanGeneratorContext child_ctx = *ctx;
+  child_ctx.expr = (*expr)[arity - 1];
+
+  Plan *plan = GeneratePlanInternal(&child_ctx);
+  ApplyPlanStats(plan, expr);
+
+  return plan;
+}
+
+Plan *PlanGenerator::GenerateCTEConsumerPlan(PlanGeneratorContext *ctx) {
+  auto *popConsumer = CPhysicalCTEConsumer::PopConvert(ctx->expr->Pop());
+  const uint32_t cte_id = popConsumer->UlCTEId();
+
+  // the producer was not below a sequence the generator has seen, or the scan
+  // would run in parallel workers, which cannot read the leader's tuplestore
+  if (!cte_plans_.contains(cte_id) || in_parallel_)
+    RaiseUnsupported(m_mp, popConsumer);
+
+  const CTEPlan &cte_plan = cte_plans_.at(cte_id);
+
+  TranslateContextBaseTable base_table_context;
+  translate_ctxt_base_table_ = &base_table_context;
+
+  output_context_ = ctx->translate_ctxt;
+
+  Alias *alias = makeNode(Alias);
+  alias->aliasname = psprintf("cte%u", cte_id);
+
+  RangeTblEntry *rte = makeNode(RangeTblEntry);
+  rte->rtekind = RTE_CTE;
+  rte->ctename = alias->aliasname;
+  rte->ctelevelsup = 0;
+  rte->self_reference = false;
+  rte->inFromCl = true;
+
+  // the columns of the CteScan are those of the producer plan
+  foreach_node(TargetEntry, target_entry, cte_plan.targetlist) {
+    char *colname = pstrdup(nullptr != target_entry->resname ? target_entry->resname : "?column?");
+    alias->colnames = lappend(alias->colnames, makeString(colname));
+    rte->coltypes = lappend_oid(rte->coltypes, gpdb::ExprType((Node *)target_entry->expr));
+    rte->coltypmods = lappend_int(rte->coltypmods, gpdb::ExprTypeMod((Node *)target_entry->expr));
+    rte->colcollations = lappend_oid(rte->colcollations, gpdb::ExprCollation((Node *)target_entry->expr));
+  }
+  rte->eref = alias;
+
+  rtable_ = lappend(rtable_, rte);
+
+  base_table_context.rel_oid = InvalidOid;
+  base_table_context.rte_index = list_length(rtable_);
+
+  CColRefArray *colrefs = popConsumer->Pdrgpcr();
+  for (uint32_t ul = 0; ul < colrefs->Size(); ul++)
+    base_table_context.colid_to_attno_map[(*colrefs)[ul]->Id()] = cte_plan.attnos[ul];
+
+  CteScan *cte_scan = makeNode(CteScan);
+  cte_scan->scan.scanrelid = base_table_context.rte_index;
+  cte_scan->ctePlanId = cte_plan.plan_id;
+  cte_scan->cteParam = cte_plan.param_id;
+
+  auto *cols = ctx->expr->Prpp()->PcrsRequired();
+  if (ctx->upper_cols)
+    cols = ctx->upper_cols;
+
+  auto *plan = &cte_scan->scan.plan;
+  plan->plan_node_id = GetNextPlanNodeID();
+  plan->targetlist = GeneratePlanTargetList(cte_scan->scan.scanrelid, cols, ctx->out_cols, true);
+
+  GenerateProjectTargets(plan, ctx->target);
+
   if (ctx->filter) {
     if (auto *qual = TransExpr(ctx->filter); qual)
       plan->qual = lappend(plan->qual, qual);
@@ -1133,9 +2132,12 @@ Var *PlanGenerator::CreateVar(CColRef *colref) {
   const uint32_t colid = colref->Id();
   if (translate_ctxt_base_table_) {
     varno = translate_ctxt_base_table_->rte_index;
-    attno = translate_ctxt_base_table_->colid_to_attno_map.contains(colid)
-                ? (AttrNumber)translate_ctxt_base_table_->colid_to_attno_map.at(colid)
-                : 0;
+    if (!translate_ctxt_base_table_->colid_to_attno_map.contains(colid)) {
+      // outer reference other than those of an index nested loop join,
+      // which are params, see TransExpr()
+      GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, GPOS_WSZ_LIT("Outer reference in scan"));
+    }
+    attno = (AttrNumber)translate_ctxt_base_table_->colid_to_attno_map.at(colid);
     varnosyn = varno;
     varattnosyn = varnosyn;
   }
@@ -1164,6 +2166,26 @@ Var *PlanGenerator::CreateVar(CColRef *colref) {
   return var;
 }
 
+Param *PlanGenerator::CreateNestParam(const CColRef *colref, uint32_t param_id) {
+  Oid type_oid = CMDIdGPDB::CastMdid(colref->RetrieveType()->MDId())->Oid();
+
+  Param *param = makeNode(Param);
+  param->paramkind = PARAM_EXEC;
+  param->paramid = (int)param_id;
+  param->paramtype = type_oid;
+  param->paramtypmod = colref->TypeModifier();
+  param->paramcollid = gpdb::TypeCollation(type_oid);
+  param->location = -1;
+
+  return param;
+}
+
+uint32_t PlanGenerator::GetNextParamId(uint32_t type_oid) {
+  param_exec_types_ = lappend_oid(param_exec_types_, type_oid);
+
+  return list_length(param_exec_types_) - 1;
+}
+
 List *PlanGenerator::GeneratePlanTargetList(uint32_t varno, const CColRefSet *pcrsOutput, CColRefArray *colref_array,
                                             bool base_table) {
   List *target_list = NIL;
@@ -1360,6 +2382,23 @@ Const *PlanGenerator::CreateConstFromItem(gpnaucrates::IDatum *datum) {
                    constvalue, constisnull, datum_type == IMDType::EtiGeneric ? type->IsPassedByValue() : true);
 }
 
+void PlanGenerator::GenerateProjectTargets(Plan *plan, CExpression *pexprProjList) {
+  if (nullptr == pexprProjList)
+    return;
+
+  int resno = list_length(plan->targetlist) + 1;
+  for (uint32_t ul = 0; ul < pexprProjList->Arity(); ul++) {
+    CExpression *pexprProjElem = (*pexprProjList)[ul];
+
+    const CScalarProjectElement *popScPrEl = CScalarProjectElement::PopConvert(pexprProjElem->Pop());
+
+    char *name = CTranslatorUtils::CreateMultiByteCharStringFromWCString(popScPrEl->Pcr()->Name().Pstr()->GetBuffer());
+    auto *target_entry = makeTargetEntry(TransExpr((*pexprProjElem)[0]), resno++, name, false);
+    plan->targetlist = lappend(plan->targetlist, target_entry);
+    output_context_->InsertMapping(popScPrEl->Pcr()->Id(), target_entry);
+  }
+}
+
 List *PlanGenerator::TransExprList(CExpression *expr) {
   if (!expr)
     return nullptr;
@@ -1381,6 +2420,9 @@ Expr *PlanGenerator::TransExpr(CExpression *expr) {
       CScalarIdent *popScId = CScalarIdent::PopConvert(expr->Pop());
       CColRef *colref = const_cast<CColRef *>(popScId->Pcr());
 
+      if (auto it = nest_param_ids_.find(colref->Id()); it != nest_param_ids_.end())
+        return (Expr *)CreateNestParam(colref, it->second);
+
       return (Expr *)CreateVar(colref);
     }
 
@@ -1578,7 +2620,7 @@ Expr *PlanGenerator::TransExpr(CExpression *expr) {
           aggref->aggsplit = AGGSPLIT_FINAL_DESERIAL;
           break;
         default:
-          return nullptr;
+          RaiseUnsupported(m_mp, popScAggFunc);
       }
 
       List *args = TransExprList((*expr)[EdxlscalaraggrefIndexArgs]);
@@ -1668,13 +2710,30 @@ Expr *PlanGenerator::TransExpr(CExpression *expr) {
       return (Expr *)func_expr;
     }
 
-    default: {
-      auto type = expr->Pop()->Eopid();
-      (void)type;
-      GPOS_ASSERT(!"Invalid expr type");
+    case COperator::EopScalarWindowFunc: {
+      CScalarWindowFunc *popWindowFunc = CScalarWindowFunc::PopConvert(expr->Pop());
+      if (CScalarWindowFunc::EwsImmediate != popWindowFunc->Ews()) {
+        GPOS_RAISE(gpopt::ExmaGPOPT, gpopt::ExmiUnsupportedOp, GPOS_WSZ_LIT("Window function stage"));
+      }
+
+      WindowFunc *window_func = makeNode(WindowFunc);
+      window_func->winfnoid = CMDIdGPDB::CastMdid(popWindowFunc->FuncMdId())->Oid();
+      window_func->wintype = CMDIdGPDB::CastMdid(popWindowFunc->MdidType())->Oid();
+      // a sequence project evaluates a single window clause
+      window_func->winref = 1;
+      window_func->winstar = popWindowFunc->IsStarArg();
+      window_func->winagg = popWindowFunc->IsSimpleAgg();
+      window_func->location = -1;
+      window_func->args = TransExprList(expr);
+      window_func->wincollid = gpdb::TypeCollation(window_func->wintype);
+      window_func->inputcollid = gpdb::ExprCollation((Node *)window_func->args);
+
+      return (Expr *)window_func;
     }
+
+    default:
+      RaiseUnsupported(m_mp, expr->Pop());
   }
-  return nullptr;
 }
 
 List *PlanGenerator::GeneratePlanTargetList(const CExpression *pexprProjList, const CColRefSet *pcrsRequired) {
@@ -1710,7 +2769,7 @@ List *PlanGenerator::GeneratePlanTargetList(const CExpression *pexprProjList, co
     CColRef *colref = crsi.Pcr();
     auto *expr = (Expr *)CreateVar(colref);
     char *name = CTranslatorUtils::CreateMultiByteCharStringFromWCString(colref->Name().Pstr()->GetBuffer());
-    auto *target_entry = makeTargetEntry(expr, ul++, name, false);
+    auto *target_entry = makeTargetEntry(expr, ++ul, name, false);
     if (translate_ctxt_base_table_) {
       target_entry->resorigtbl = translate_ctxt_base_table_->rel_oid;
     } else {
@@ -0,0 +1,847 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CJoinOrderDPhyp.cpp
+//
+//	@doc:
+//		Implementation of join order generation over the connected
+//		subgraphs of the join hypergraph
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CJoinOrderDPhyp.h"
+
+#include "gpopt/base/COptCtxt.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CLogicalInnerJoin.h"
+#include "gpopt/operators/CLogicalLeftOuterJoin.h"
+#include "gpopt/operators/CLogicalSelect.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpos/base.h"
+#include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
+#include "gpos/common/clibwrapper.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::CJoinOrderDPhyp
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CJoinOrderDPhyp::CJoinOrderDPhyp(CMemoryPool *mp, CExpressionArray *pdrgpexprAtoms,
+                                 CExpressionArray *innerJoinConjuncts, CExpressionArray *onPredConjuncts,
+                                 ULongPtrArray *childPredIndexes)
+    : CJoinOrder(mp, pdrgpexprAtoms, innerJoinConjuncts, onPredConjuncts, childPredIndexes),
+      m_neighbors(nullptr),
+      m_hyperedges(nullptr),
+      m_num_hyperedges(0),
+      m_edge_atoms(nullptr),
+      m_loj_right_atoms(0),
+      m_loj_edges(nullptr),
+      m_plans(nullptr),
+      m_num_plans(0),
+      m_index(mp),
+      m_exhausted(false) {
+  GPOS_ASSERT(m_ulComps <= MaxAtoms);
+
+  // the edges hold their own references to the ON predicates
+  onPredConjuncts->Release();
+  CRefCount::SafeRelease(childPredIndexes);
+
+  m_neighbors = GPOS_NEW_ARRAY(mp, Mask, m_ulComps);
+  m_loj_edges = GPOS_NEW_ARRAY(mp, uint32_t, m_ulComps);
+  for (uint32_t ul = 0; ul < m_ulComps; ul++) {
+    m_neighbors[ul] = 0;
+    m_loj_edges[ul] = UINT32_MAX;
+  }
+
+  // an edge of the base class yields at most one hyperedge, and there are
+  // fewer cross product edges than atoms
+  m_hyperedges = GPOS_NEW_ARRAY(mp, SHyperedge, m_ulEdges + m_ulComps);
+  m_edge_atoms = GPOS_NEW_ARRAY(mp, Mask, m_ulEdges);
+
+  for (uint32_t ulEdge = 0; ulEdge < m_ulEdges; ulEdge++) {
+    SEdge *pedge = m_rgpedge[ulEdge];
+
+    Mask atoms = 0;
+    CBitSetIter bsi(*pedge->m_pbs);
+    while (bsi.Advance()) {
+      atoms |= Bit(bsi.Bit());
+    }
+    m_edge_atoms[ulEdge] = atoms;
+
+    if (0 < pedge->m_loj_num) {
+      // ON predicate of a left outer join, an edge from the atoms it
+      // references to the right child of the join
+      uint32_t right = 0;
+      while ((int32_t)pedge->m_loj_num != m_rgpcomp[right]->ParentLojId()) {
+        right++;
+        GPOS_ASSERT(right < m_ulComps);
+      }
+
+      m_loj_right_atoms |= Bit(right);
+      m_loj_edges[right] = ulEdge;
+
+      if (0 != (atoms & ~Bit(right))) {
+        AddEdge(atoms & ~Bit(right), Bit(right));
+      }
+    } else if (0 != (atoms & (atoms - 1))) {
+      // inner join predicate over two or more atoms
+      AddEdge(Lowest(atoms), atoms & ~Lowest(atoms));
+    }
+  }
+
+  AddCrossProductEdges();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::~CJoinOrderDPhyp
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CJoinOrderDPhyp::~CJoinOrderDPhyp() {
+  for (uint32_t ul = 0; ul < m_num_plans; ul++) {
+    m_plans[ul].m_pexpr->Release();
+  }
+
+  GPOS_DELETE_ARRAY(m_plans);
+  GPOS_DELETE_ARRAY(m_edge_atoms);
+  GPOS_DELETE_ARRAY(m_hyperedges);
+  GPOS_DELETE_ARRAY(m_loj_edges);
+  GPOS_DELETE_ARRAY(m_neighbors);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::AddEdge
+//
+//	@doc:
+//		Add an edge between two disjoint sets of atoms; edges between two
+//		single atoms are kept as neighbors of the atoms
+//
+//---------------------------------------------------------------------------
+void CJoinOrderDPhyp::AddEdge(Mask left, Mask right) {
+  GPOS_ASSERT(0 != left && 0 != right && 0 == (left & right));
+
+  if (0 == (left & (left - 1)) && 0 == (right & (right - 1))) {
+    m_neighbors[__builtin_ctzll(left)] |= right;
+    m_neighbors[__builtin_ctzll(right)] |= left;
+    return;
+  }
+
+  m_hyperedges[m_num_hyperedges].m_left = left;
+  m_hyperedges[m_num_hyperedges].m_right = right;
+  m_num_hyperedges++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::AddCrossProductEdges
+//
+//	@doc:
+//		Connect the parts of a disconnected join graph; an edge between two
+//		whole parts only lets a cross product join them once each of them
+//		is joined completely
+//
+//---------------------------------------------------------------------------
+void CJoinOrderDPhyp::AddCrossProductEdges() {
+  Mask remaining = Prefix(m_ulComps - 1);
+  Mask previous = 0;
+
+  while (0 != remaining) {
+    // grow the part containing the lowest remaining atom until no edge
+    // leads out of it
+    Mask part = Lowest(remaining);
+    Mask grown = 0;
+    while (grown != part) {
+      grown = part;
+      for (Mask atoms = grown; 0 != atoms; atoms &= atoms - 1) {
+        part |= m_neighbors[__builtin_ctzll(atoms)];
+      }
+      for (uint32_t ul = 0; ul < m_num_hyperedges; ul++) {
+        const SHyperedge &edge = m_hyperedges[ul];
+        if (0 != ((edge.m_left | edge.m_right) & grown)) {
+          part |= edge.m_left | edge.m_right;
+        }
+      }
+    }
+
+    if (0 != previous) {
+      AddEdge(previous, part);
+    }
+
+    previous = part;
+    remaining &= ~part;
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::Neighborhood
+//
+//	@doc:
+//		Atoms adjacent to the given set and not excluded; of the far side of
+//		a hyperedge only its lowest atom is included, which is enough to
+//		reach the rest of it when growing the set
+//
+//---------------------------------------------------------------------------
+CJoinOrderDPhyp::Mask CJoinOrderDPhyp::Neighborhood(Mask atoms, Mask excluded) const {
+  excluded |= atoms;
+
+  Mask neighbors = 0;
+  for (Mask rest = atoms; 0 != rest; rest &= rest - 1) {
+    neighbors |= m_neighbors[__builtin_ctzll(rest)];
+  }
+
+  for (uint32_t ul = 0; ul < m_num_hyperedges; ul++) {
+    const SHyperedge &edge = m_hyperedges[ul];
+    if (edge.m_left == (edge.m_left & atoms) && 0 == (edge.m_right & excluded)) {
+      neighbors |= Lowest(edge.m_right);
+    } else if (edge.m_right == (edge.m_right & atoms) && 0 == (edge.m_left & excluded)) {
+      neighbors |= Lowest(edge.m_left);
+    }
+  }
+
+  return neighbors & ~excluded;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::FConnected
+//
+//	@doc:
+//		Is there an edge between the two given disjoint sets
+//
+//---------------------------------------------------------------------------
+bool CJoinOrderDPhyp::FConnected(Mask fst, Mask snd) const {
+  for (Mask rest = fst; 0 != rest; rest &= rest - 1) {
+    if (0 != (m_neighbors[__builtin_ctzll(rest)] & snd)) {
+      return true;
+    }
+  }
+
+  for (uint32_t ul = 0; ul < m_num_hyperedges; ul++) {
+    const SHyperedge &edge = m_hyperedges[ul];
+    if ((edge.m_left == (edge.m_left & fst) && edge.m_right == (edge.m_right & snd)) ||
+        (edge.m_left == (edge.m_left & snd) && edge.m_right == (edge.m_right & fst))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::Lookup
+//
+//	@doc:
+//		Plan for the given set of atoms, UINT32_MAX if there is none
+//
+//---------------------------------------------------------------------------
+uint32_t CJoinOrderDPhyp::Lookup(Mask atoms) const {
+  uint32_t slot = m_index.Find(HashValue(atoms), [&](uint32_t plan) { return atoms == m_plans[plan].m_atoms; });
+  if (UINT32_MAX == slot) {
+    return UINT32_MAX;
+  }
+
+  return m_index.Entry(slot);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::AddPlan
+//
+//	@doc:
+//		Add a plan joining the given plans for a set of atoms not in the DP
+//		table yet, or an atom if they are UINT32_MAX; takes ownership of
+//		the expression, whose stats must be derived
+//
+//---------------------------------------------------------------------------
+uint32_t CJoinOrderDPhyp::AddPlan(Mask atoms, uint32_t left, uint32_t right, CExpression *pexpr) {
+  GPOS_ASSERT(UINT32_MAX == Lookup(atoms));
+  GPOS_ASSERT(nullptr != pexpr->Pstats());
+
+  uint32_t capacity = m_index.Capacity();
+  if (m_num_plans == CHashIndex::MaxEntries(capacity)) {
+    // grow the table and rebuild its index
+    capacity = CHashIndex::NextCapacity(capacity);
+    SPlan *plans = GPOS_NEW_ARRAY(m_mp, SPlan, CHashIndex::MaxEntries(capacity));
+    for (uint32_t ul = 0; ul < m_num_plans; ul++) {
+      plans[ul] = m_plans[ul];
+    }
+    GPOS_DELETE_ARRAY(m_plans);
+    m_plans = plans;
+
+    m_index.Reset(capacity);
+    for (uint32_t ul = 0; ul < m_num_plans; ul++) {
+      m_index.Insert(HashValue(m_plans[ul].m_atoms), ul);
+    }
+  }
+
+  SPlan &plan = m_plans[m_num_plans];
+  plan.m_atoms = atoms;
+  plan.m_left = left;
+  plan.m_right = right;
+  plan.m_rows = pexpr->Pstats()->Rows().Get();
+  plan.m_cost = 0.0;
+  if (UINT32_MAX != left) {
+    plan.m_cost = plan.m_rows + m_plans[left].m_cost + m_plans[right].m_cost;
+  }
+  plan.m_pexpr = pexpr;
+  m_index.Insert(HashValue(atoms), m_num_plans);
+
+  return m_num_plans++;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprPred
+//
+//	@doc:
+//		Predicate joining the two given sets: the ON predicate if the right
+//		set is the right child of a left outer join, otherwise all inner
+//		join predicates over both sets; edges used are recorded in the
+//		given set if any
+//
+//---------------------------------------------------------------------------
+CExpression *CJoinOrderDPhyp::PexprPred(Mask left, Mask right, CBitSet *used_edges) {
+  if (FLojRightAtom(right)) {
+    uint32_t ulEdge = m_loj_edges[__builtin_ctzll(right)];
+    if (nullptr != used_edges) {
+      (void)used_edges->ExchangeSet(ulEdge);
+    }
+
+    CExpression *pexprPred = m_rgpedge[ulEdge]->m_pexpr;
+    pexprPred->AddRef();
+
+    return pexprPred;
+  }
+
+  CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+  for (uint32_t ulEdge = 0; ulEdge < m_ulEdges; ulEdge++) {
+    Mask atoms = m_edge_atoms[ulEdge];
+    if (0 == m_rgpedge[ulEdge]->m_loj_num && atoms == (atoms & (left | right)) && 0 != (atoms & left) &&
+        0 != (atoms & right)) {
+      if (nullptr != used_edges) {
+        (void)used_edges->ExchangeSet(ulEdge);
+      }
+
+      m_rgpedge[ulEdge]->m_pexpr->AddRef();
+      pdrgpexpr->Append(m_rgpedge[ulEdge]->m_pexpr);
+    }
+  }
+
+  // no predicate makes this a cross product
+  return CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprJoin
+//
+//	@doc:
+//		Join of the two given expressions producing the given sets; takes
+//		ownership of the expressions
+//
+//---------------------------------------------------------------------------
+CExpression *CJoinOrderDPhyp::PexprJoin(Mask left, Mask right, CExpression *pexprLeft, CExpression *pexprRight,
+                                        CBitSet *used_edges) {
+  GPOS_ASSERT(FValidJoin(left, right));
+
+  CExpression *pexprScalar = PexprPred(left, right, used_edges);
+  if (FLojRightAtom(right)) {
+    return CUtils::PexprLogicalJoin<CLogicalLeftOuterJoin>(m_mp, pexprLeft, pexprRight, pexprScalar);
+  }
+
+  return CUtils::PexprLogicalJoin<CLogicalInnerJoin>(m_mp, pexprLeft, pexprRight, pexprScalar);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::FValidJoin
+//
+//	@doc:
+//		Can the first set be the outer and the second set the inner side
+//		of a join; the right child of a left outer join may only appear
+//		alone on the inner side, joined to a set that produces all the
+//		columns its ON predicate references
+//
+//---------------------------------------------------------------------------
+bool CJoinOrderDPhyp::FValidJoin(Mask left, Mask right) const {
+  if (FLojRightAtom(left)) {
+    return false;
+  }
+
+  if (FLojRightAtom(right)) {
+    Mask required = m_edge_atoms[m_loj_edges[__builtin_ctzll(right)]] & ~right;
+    return required == (required & left);
+  }
+
+  return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::AddJoin
+//
+//	@doc:
+//		Add a plan joining the given plans of two sets whose union is not
+//		in the DP table yet, deriving the stats of the join
+//
+//---------------------------------------------------------------------------
+uint32_t CJoinOrderDPhyp::AddJoin(Mask left, Mask right, uint32_t ulLeft, uint32_t ulRight) {
+  CExpression *pexprLeft = m_plans[ulLeft].m_pexpr;
+  CExpression *pexprRight = m_plans[ulRight].m_pexpr;
+  pexprLeft->AddRef();
+  pexprRight->AddRef();
+  CExpression *pexprJoin = PexprJoin(left, right, pexprLeft, pexprRight, nullptr /*used_edges*/);
+  DeriveStats(pexprJoin);
+
+  return AddPlan(left | right, ulLeft, ulRight, pexprJoin);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EmitCsgCmp
+//
+//	@doc:
+//		Consider joining the given pair of connected subgraphs, in either
+//		order; the first join of a set derives its stats, later ones only
+//		replace the best split if they are cheaper. The cost of a join is
+//		the number of rows it produces plus the cost of its children.
+//
+//---------------------------------------------------------------------------
+void CJoinOrderDPhyp::EmitCsgCmp(Mask fst, Mask snd) {
+  Mask left = fst;
+  Mask right = snd;
+  if (!FValidJoin(left, right)) {
+    std::swap(left, right);
+    if (!FValidJoin(left, right)) {
+      return;
+    }
+  }
+
+  uint32_t ulLeft = Lookup(left);
+  uint32_t ulRight = Lookup(right);
+  GPOS_ASSERT(UINT32_MAX != ulLeft && UINT32_MAX != ulRight);
+
+  uint32_t ulPlan = Lookup(left | right);
+  if (UINT32_MAX != ulPlan) {
+    SPlan &plan = m_plans[ulPlan];
+    double dCost = plan.m_rows + m_plans[ulLeft].m_cost + m_plans[ulRight].m_cost;
+    if (dCost < plan.m_cost) {
+      plan.m_left = ulLeft;
+      plan.m_right = ulRight;
+      plan.m_cost = dCost;
+    }
+
+    return;
+  }
+
+  if (MaxPlans <= m_num_plans) {
+    m_exhausted = true;
+    return;
+  }
+
+  (void)AddJoin(left, right, ulLeft, ulRight);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EmitCsg
+//
+//	@doc:
+//		Enumerate the connected complements of the given connected subgraph
+//		that only hold atoms above its lowest one
+//
+//---------------------------------------------------------------------------
+void CJoinOrderDPhyp::EmitCsg(Mask atoms) {
+  if (m_exhausted) {
+    return;
+  }
+
+  Mask excluded = atoms | Prefix(__builtin_ctzll(atoms));
+  Mask neighbors = Neighborhood(atoms, excluded);
+
+  // start from the highest neighbor, so that each complement is only
+  // grown from its lowest atom
+  for (Mask rest = neighbors; 0 != rest;) {
+    uint32_t atom = 63 - __builtin_clzll(rest);
+    rest &= ~Bit(atom);
+
+    if (FConnected(atoms, Bit(atom))) {
+      EmitCsgCmp(atoms, Bit(atom));
+    }
+
+    EnumerateCmpRec(atoms, Bit(atom), excluded | (neighbors & Prefix(atom)));
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EnumerateCsgRec
+//
+//	@doc:
+//		Grow the given connected subgraph by subsets of its neighborhood,
+//		emitting those that are connected, i.e. have a plan
+//
+//---------------------------------------------------------------------------
+void CJoinOrderDPhyp::EnumerateCsgRec(Mask atoms, Mask excluded) {
+  GPOS_CHECK_STACK_SIZE;
+  GPOS_CHECK_ABORT;
+
+  if (m_exhausted) {
+    return;
+  }
+
+  Mask neighbors = Neighborhood(atoms, excluded);
+  for (Mask subset = neighbors & (0 - neighbors); 0 != subset; subset = (subset - neighbors) & neighbors) {
+    if (UINT32_MAX != Lookup(atoms | subset)) {
+      EmitCsg(atoms | subset);
+    }
+  }
+
+  for (Mask subset = neighbors & (0 - neighbors); 0 != subset; subset = (subset - neighbors) & neighbors) {
+    EnumerateCsgRec(atoms | subset, excluded | neighbors);
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::EnumerateCmpRec
+//
+//	@doc:
+//		Grow the given complement of a connected subgraph by subsets of its
+//		neighborhood, emitting those that are connected and have an edge
+//		to the subgraph
+//
+//---------------------------------------------------------------------------
+void CJoinOrderDPhyp::EnumerateCmpRec(Mask csg, Mask atoms, Mask excluded) {
+  GPOS_CHECK_STACK_SIZE;
+  GPOS_CHECK_ABORT;
+
+  if (m_exhausted) {
+    return;
+  }
+
+  Mask neighbors = Neighborhood(atoms, excluded);
+  for (Mask subset = neighbors & (0 - neighbors); 0 != subset; subset = (subset - neighbors) & neighbors) {
+    if (UINT32_MAX != Lookup(atoms | subset) && FConnected(csg, atoms | subset)) {
+      EmitCsgCmp(csg, atoms | subset);
+    }
+  }
+
+  for (Mask subset = neighbors & (0 - neighbors); 0 != subset; subset = (subset - neighbors) & neighbors) {
+    EnumerateCmpRec(csg, atoms | subset, excluded | neighbors);
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::CountCsgRec
+//
+//	@doc:
+//		Count the subgraphs EnumerateCsgRec grows from the given one, until
+//		the count exceeds the limit; an upper bound of the connected ones,
+//		as growing over a hyperedge may give a set that is not connected
+//
+//---------------------------------------------------------------------------
+void CJoinOrderDPhyp::CountCsgRec(Mask atoms, Mask excluded, uint32_t limit, uint32_t *count) const {
+  GPOS_CHECK_STACK_SIZE;
+
+  Mask neighbors = Neighborhood(atoms, excluded);
+  for (Mask subset = neighbors & (0 - neighbors); 0 != subset; subset = (subset - neighbors) & neighbors) {
+    if (limit < ++*count) {
+      return;
+    }
+  }
+
+  for (Mask subset = neighbors & (0 - neighbors); 0 != subset && limit >= *count;
+       subset = (subset - neighbors) & neighbors) {
+    CountCsgRec(atoms | subset, excluded | neighbors, limit, count);
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::FEnumerate
+//
+//	@doc:
+//		Enumerate joins of up to optimizer_join_order_threshold atoms, and
+//		larger ones if they have no more connected subgraphs than a join of
+//		that many atoms could have, so that e.g. long chains still are,
+//		while large stars, whose subgraphs grow exponentially, are not
+//
+//---------------------------------------------------------------------------
+bool CJoinOrderDPhyp::FEnumerate() const {
+  const CHint *phint = COptCtxt::PoctxtFromTLS()->GetOptimizerConfig()->GetHint();
+  const uint32_t threshold = phint->UlJoinOrderDPLimit();
+
+  if (m_ulComps <= threshold) {
+    return true;
+  }
+
+  uint32_t limit = MaxPlans;
+  if (threshold < 16) {
+    limit = ((uint32_t)1 << threshold) - 1;
+  }
+
+  uint32_t count = 0;
+  for (uint32_t ul = m_ulComps; 0 < ul && limit >= count; ul--) {
+    count++;
+    CountCsgRec(Bit(ul - 1), Prefix(ul - 1), limit, &count);
+  }
+
+  return limit >= count;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::UlGreedyPlan
+//
+//	@doc:
+//		Plan for the union of the two given disjoint sets, in whichever
+//		order is valid; the DP table keeps the plans of the pairs already
+//		considered, and those enumeration found before it gave up
+//
+//---------------------------------------------------------------------------
+uint32_t CJoinOrderDPhyp::UlGreedyPlan(Mask fst, Mask snd) {
+  Mask left = fst;
+  Mask right = snd;
+  if (!FValidJoin(left, right)) {
+    std::swap(left, right);
+    if (!FValidJoin(left, right)) {
+      return UINT32_MAX;
+    }
+  }
+
+  uint32_t ulPlan = Lookup(left | right);
+  if (UINT32_MAX != ulPlan) {
+    return ulPlan;
+  }
+
+  return AddJoin(left, right, Lookup(left), Lookup(right));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprGreedy
+//
+//	@doc:
+//		Join the atoms greedily: of all pairs of connected sets joined so
+//		far, join the one producing the fewest rows, until one set is left;
+//		returns NULL if no pair can be joined before that
+//
+//---------------------------------------------------------------------------
+CExpression *CJoinOrderDPhyp::PexprGreedy(CBitSet *used_edges) {
+  // plans of the sets joined so far
+  uint32_t *sets = GPOS_NEW_ARRAY(m_mp, uint32_t, m_ulComps);
+  uint32_t num_sets = m_ulComps;
+  for (uint32_t ul = 0; ul < m_ulComps; ul++) {
+    sets[ul] = Lookup(Bit(ul));
+  }
+
+  while (1 < num_sets) {
+    GPOS_CHECK_ABORT;
+
+    uint32_t ulBest = UINT32_MAX;
+    uint32_t ulFst = 0;
+    uint32_t ulSnd = 0;
+    for (uint32_t ul = 0; ul < num_sets; ul++) {
+      for (uint32_t ulOther = ul + 1; ulOther < num_sets; ulOther++) {
+        Mask fst = m_plans[sets[ul]].m_atoms;
+        Mask snd = m_plans[sets[ulOther]].m_atoms;
+        if (!FConnected(fst, snd)) {
+          continue;
+        }
+
+        uint32_t ulPlan = UlGreedyPlan(fst, snd);
+        if (UINT32_MAX != ulPlan &&
+            (UINT32_MAX == ulBest || m_plans[ulPlan].m_rows < m_plans[ulBest].m_rows ||
+             (m_plans[ulPlan].m_rows == m_plans[ulBest].m_rows && m_plans[ulPlan].m_cost < m_plans[ulBest].m_cost))) {
+          ulBest = ulPlan;
+          ulFst = ul;
+          ulSnd = ulOther;
+        }
+      }
+    }
+
+    if (UINT32_MAX == ulBest) {
+      GPOS_DELETE_ARRAY(sets);
+      return nullptr;
+    }
+
+    // replace the pair by their join
+    sets[ulFst] = ulBest;
+    sets[ulSnd] = sets[--num_sets];
+  }
+
+  uint32_t ulRoot = sets[0];
+  GPOS_DELETE_ARRAY(sets);
+
+  return PexprBuild(ulRoot, used_edges);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprBuild
+//
+//	@doc:
+//		Expression for the best join order of the given plan
+//
+//---------------------------------------------------------------------------
+CExpression *CJoinOrderDPhyp::PexprBuild(uint32_t ulPlan, CBitSet *used_edges) {
+  GPOS_CHECK_STACK_SIZE;
+
+  const SPlan &plan = m_plans[ulPlan];
+  if (UINT32_MAX == plan.m_left) {
+    plan.m_pexpr->AddRef();
+    return plan.m_pexpr;
+  }
+
+  CExpression *pexprLeft = PexprBuild(plan.m_left, used_edges);
+  CExpression *pexprRight = PexprBuild(plan.m_right, used_edges);
+
+  return PexprJoin(m_plans[plan.m_left].m_atoms, m_plans[plan.m_right].m_atoms, pexprLeft, pexprRight, used_edges);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprQueryOrder
+//
+//	@doc:
+//		Left-deep join of the atoms in their order in the query, used when
+//		neither enumeration nor the greedy search could place every left
+//		outer join; each then has all atoms its ON predicate references on
+//		its outer side
+//
+//---------------------------------------------------------------------------
+CExpression *CJoinOrderDPhyp::PexprQueryOrder(CBitSet *used_edges) {
+  CExpression *pexpr = m_rgpcomp[0]->m_pexpr;
+  pexpr->AddRef();
+
+  for (uint32_t ul = 1; ul < m_ulComps; ul++) {
+    CExpression *pexprAtom = m_rgpcomp[ul]->m_pexpr;
+    pexprAtom->AddRef();
+    pexpr = PexprJoin(Prefix(ul - 1), Bit(ul), pexpr, pexprAtom, used_edges);
+  }
+
+  return pexpr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprAddRemainingEdges
+//
+//	@doc:
+//		Add a select with the predicates no join used: those over a single
+//		atom or outer references only, and inner join predicates covered by
+//		a left outer join first
+//
+//---------------------------------------------------------------------------
+CExpression *CJoinOrderDPhyp::PexprAddRemainingEdges(CExpression *pexpr, CBitSet *used_edges) {
+  CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+  for (uint32_t ulEdge = 0; ulEdge < m_ulEdges; ulEdge++) {
+    if (!used_edges->Get(ulEdge)) {
+      GPOS_ASSERT(0 == m_rgpedge[ulEdge]->m_loj_num);
+
+      m_rgpedge[ulEdge]->m_pexpr->AddRef();
+      pdrgpexpr->Append(m_rgpedge[ulEdge]->m_pexpr);
+    }
+  }
+
+  if (0 == pdrgpexpr->Size()) {
+    pdrgpexpr->Release();
+    return pexpr;
+  }
+
+  return GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CLogicalSelect(m_mp), pexpr,
+                                    CPredicateUtils::PexprConjunction(m_mp, pdrgpexpr));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::PexprExpand
+//
+//	@doc:
+//		Create join order; enumerates the connected subgraphs growing from
+//		each atom, highest first, over atoms above it only, so that every
+//		subgraph is emitted after all of its own subgraphs. Joins too large
+//		to enumerate are ordered greedily.
+//
+//---------------------------------------------------------------------------
+CExpression *CJoinOrderDPhyp::PexprExpand() {
+  for (uint32_t ul = 0; ul < m_ulComps; ul++) {
+    CExpression *pexprAtom = m_rgpcomp[ul]->m_pexpr;
+    DeriveStats(pexprAtom);
+    pexprAtom->AddRef();
+    (void)AddPlan(Bit(ul), UINT32_MAX, UINT32_MAX, pexprAtom);
+  }
+
+  if (FEnumerate()) {
+    for (uint32_t ul = m_ulComps; 0 < ul; ul--) {
+      EmitCsg(Bit(ul - 1));
+      EnumerateCsgRec(Bit(ul - 1), Prefix(ul - 1));
+    }
+  }
+
+  CBitSet *used_edges = GPOS_NEW(m_mp) CBitSet(m_mp, m_ulEdges);
+  CExpression *pexprResult = nullptr;
+
+  uint32_t ulPlan = Lookup(Prefix(m_ulComps - 1));
+  if (UINT32_MAX != ulPlan) {
+    pexprResult = PexprBuild(ulPlan, used_edges);
+  } else {
+    // too many connected subgraphs
+    pexprResult = PexprGreedy(used_edges);
+  }
+
+  if (nullptr == pexprResult) {
+    // a left outer join could not be placed
+    pexprResult = PexprQueryOrder(used_edges);
+  }
+
+  pexprResult = PexprAddRemainingEdges(pexprResult, used_edges);
+  used_edges->Release();
+
+  return pexprResult;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CJoinOrderDPhyp::OsPrint
+//
+//	@doc:
+//		Print the DP table
+//
+//---------------------------------------------------------------------------
+IOstream &CJoinOrderDPhyp::OsPrint(IOstream &os) const {
+  for (uint32_t ul = 0; ul < m_num_plans; ul++) {
+    const SPlan &plan = m_plans[ul];
+
+    os << "Atoms: ";
+    for (Mask atoms = plan.m_atoms; 0 != atoms; atoms &= atoms - 1) {
+      os << __builtin_ctzll(atoms) << (0 != (atoms & (atoms - 1)) ? "," : "");
+    }
+    os << " Rows: " << plan.m_rows << " Cost: " << plan.m_cost;
+    if (UINT32_MAX != plan.m_left) {
+      os << " Split: " << plan.m_left << " x " << plan.m_right;
+    }
+    os << std::endl;
+  }
+
+  if (m_exhausted) {
+    os << "Enumeration stopped after " << m_num_plans << " plans" << std::endl;
+  }
+
+  return os;
+}
+
+// EOF
@@ -184,6 +184,7 @@ CBitSet *CXform::PbsJoinOrderInQueryXforms(CMemoryPool *mp) {
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfJoinAssociativity));
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfInnerJoinCommutativity));
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinGreedy));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDPhyp));
 
   return pbs;
 }
@@ -195,6 +196,7 @@ CBitSet *CXform::PbsJoinOrderOnGreedyXforms(CMemoryPool *mp) {
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDPv2));
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfJoinAssociativity));
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfInnerJoinCommutativity));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDPhyp));
 
   return pbs;
 }
@@ -203,6 +205,7 @@ CBitSet *CXform::PbsJoinOrderOnExhaustiveXforms(CMemoryPool *mp) {
   CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, EopttraceSentinel);
 
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDPv2));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDPhyp));
 
   return pbs;
 }
@@ -210,6 +213,22 @@ CBitSet *CXform::PbsJoinOrderOnExhaustiveXforms(CMemoryPool *mp) {
 CBitSet *CXform::PbsJoinOrderOnExhaustive2Xforms(CMemoryPool *mp) {
   CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, EopttraceSentinel);
 
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoin));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDP));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinMinCard));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinGreedy));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfPushDownLeftOuterJoin));
+  (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDPhyp));
+  (void)pbs->ExchangeSet(EopttraceEnableLOJInNAryJoin);
+
+  return pbs;
+}
+
+// like exhaustive2, with the DPhyp enumerator in place of DPv2; DPv2 stays
+// enabled for the joins with more atoms than DPhyp takes
+CBitSet *CXform::PbsJoinOrderOnDPhypXforms(CMemoryPool *mp) {
+  CBitSet *pbs = GPOS_NEW(mp) CBitSet(mp, EopttraceSentinel);
+
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoin));
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinDP));
   (void)pbs->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfExpandNAryJoinMinCard));
@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CXformExpandNAryJoinDPhyp.cpp
+//
+//	@doc:
+//		Implementation of n-ary join expansion using dynamic programming
+//		over connected subgraphs
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformExpandNAryJoinDPhyp.h"
+
+#include "gpopt/base/CUtils.h"
+#include "gpopt/operators/CLogicalNAryJoin.h"
+#include "gpopt/operators/CNormalizer.h"
+#include "gpopt/operators/CPatternMultiLeaf.h"
+#include "gpopt/operators/CPatternTree.h"
+#include "gpopt/operators/CPredicateUtils.h"
+#include "gpopt/operators/CScalarNAryJoinPredList.h"
+#include "gpopt/xforms/CJoinOrderDPhyp.h"
+#include "gpopt/xforms/CXformUtils.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformExpandNAryJoinDPhyp::CXformExpandNAryJoinDPhyp
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CXformExpandNAryJoinDPhyp::CXformExpandNAryJoinDPhyp(CMemoryPool *mp)
+    : CXformExploration(
+          // pattern
+          GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CLogicalNAryJoin(mp),
+                                   GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternMultiLeaf(mp)),
+                                   GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp)))) {}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformExpandNAryJoinDPhyp::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise CXformExpandNAryJoinDPhyp::Exfp(CExpressionHandle &exprhdl) const {
+  // joins above optimizer_join_order_threshold are still expanded, as
+  // this is the join order xform of the dphyp setting; the join order
+  // then decides whether to enumerate or search greedily
+
+  // since the last child of the join operator is a scalar child
+  // defining the join predicate, ignore it; larger joins are left to
+  // the DPv2 xform, see CXformExpandNAryJoinDPv2::Exfp
+  if (exprhdl.Arity() - 1 > CJoinOrderDPhyp::MaxAtoms) {
+    return CXform::ExfpNone;
+  }
+
+  return CXformUtils::ExfpExpandJoinOrder(exprhdl, this);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformExpandNAryJoinDPhyp::Transform
+//
+//	@doc:
+//		Actual transformation of n-ary join to cluster of inner and left
+//		outer joins
+//
+//---------------------------------------------------------------------------
+void CXformExpandNAryJoinDPhyp::Transform(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr) const {
+  GPOS_ASSERT(nullptr != pxfctxt);
+  GPOS_ASSERT(nullptr != pxfres);
+  GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+  GPOS_ASSERT(FCheckPattern(pexpr));
+
+  CMemoryPool *mp = pxfctxt->Pmp();
+
+  const uint32_t arity = pexpr->Arity();
+  GPOS_ASSERT(arity >= 3);
+
+  CExpressionArray *pdrgpexpr = GPOS_NEW(mp) CExpressionArray(mp);
+  for (uint32_t ul = 0; ul < arity - 1; ul++) {
+    CExpression *pexprChild = (*pexpr)[ul];
+    pexprChild->AddRef();
+    pdrgpexpr->Append(pexprChild);
+  }
+
+  // split the predicates into inner join conjuncts and the ON predicates
+  // of left outer joins, as for DPv2
+  CLogicalNAryJoin *naryJoin = CLogicalNAryJoin::PopConvert(pexpr->Pop());
+  CExpression *pexprScalar = (*pexpr)[arity - 1];
+  CExpressionArray *innerJoinPreds = nullptr;
+  CExpressionArray *onPreds = GPOS_NEW(mp) CExpressionArray(mp);
+  ULongPtrArray *childPredIndexes = nullptr;
+
+  if (nullptr != CScalarNAryJoinPredList::PopConvert(pexprScalar->Pop())) {
+    innerJoinPreds = CPredicateUtils::PdrgpexprConjuncts(mp, (*pexprScalar)[0]);
+
+    for (uint32_t ul = 1; ul < pexprScalar->Arity(); ul++) {
+      (*pexprScalar)[ul]->AddRef();
+      onPreds->Append((*pexprScalar)[ul]);
+    }
+
+    childPredIndexes = naryJoin->GetLojChildPredIndexes();
+    GPOS_ASSERT(nullptr != childPredIndexes);
+    childPredIndexes->AddRef();
+  } else {
+    innerJoinPreds = CPredicateUtils::PdrgpexprConjuncts(mp, pexprScalar);
+  }
+
+  CJoinOrderDPhyp jodp(mp, pdrgpexpr, innerJoinPreds, onPreds, childPredIndexes);
+  CExpression *pexprResult = jodp.PexprExpand();
+
+  CExpression *pexprNormalized = CNormalizer::PexprNormalize(mp, pexprResult);
+  pexprResult->Release();
+  pxfres->Add(pexprNormalized);
+}
+
+// EOF
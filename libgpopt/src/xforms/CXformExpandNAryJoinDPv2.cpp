@@ -20,6 +20,7 @@
 #include "gpopt/operators/CPredicateUtils.h"
 #include "gpopt/operators/CScalarNAryJoinPredList.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
+#include "gpopt/xforms/CJoinOrderDPhyp.h"
 #include "gpopt/xforms/CJoinOrderDPv2.h"
 #include "gpopt/xforms/CXformUtils.h"
 #include "gpos/base.h"
@@ -50,6 +51,13 @@ CXformExpandNAryJoinDPv2::CXformExpandNAryJoinDPv2(CMemoryPool *mp)
 //
 //---------------------------------------------------------------------------
 CXform::EXformPromise CXformExpandNAryJoinDPv2::Exfp(CExpressionHandle &exprhdl) const {
+  // with the dphyp join order this is only the fallback for joins with more
+  // atoms than the DPhyp enumerator takes; the last child is the scalar
+  // join predicate
+  if (GPOPT_FENABLED_XFORM(CXform::ExfExpandNAryJoinDPhyp) && exprhdl.Arity() - 1 <= CJoinOrderDPhyp::MaxAtoms) {
+    return CXform::ExfpNone;
+  }
+
   return CXformUtils::ExfpExpandJoinOrder(exprhdl, this);
 }
 
@@ -11,6 +11,7 @@
 
 #include "gpopt/xforms/CXformGet2TableScan.h"
 
+#include "gpopt/base/COptCtxt.h"
 #include "gpopt/metadata/CTableDescriptor.h"
 #include "gpopt/operators/CExpressionHandle.h"
 #include "gpopt/operators/CLogicalGet.h"
@@ -85,6 +86,16 @@ void CXformGet2TableScan::Transform(CXformContext *pxfctxt, CXformResult *pxfres
       GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPhysicalTableScan(mp, pname, ptabdesc, pdrgpcrOutput));
   // add alternative to transformation result
   pxfres->Add(pexprAlt);
+
+  // add a parallel-aware scan when the plan may use parallel workers
+  if (0 < COptCtxt::PoctxtFromTLS()->GetCostModel()->UlParallelWorkers()) {
+    ptabdesc->AddRef();
+    pdrgpcrOutput->AddRef();
+    CExpression *pexprParallel = GPOS_NEW(mp) CExpression(
+        mp, GPOS_NEW(mp) CPhysicalTableScan(mp, GPOS_NEW(mp) CName(mp, popGet->Name()), ptabdesc, pdrgpcrOutput,
+                                            true /*parallel*/));
+    pxfres->Add(pexprParallel);
+  }
 }
 
 // EOF
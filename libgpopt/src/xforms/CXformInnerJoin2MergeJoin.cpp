@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CXformInnerJoin2MergeJoin.cpp
+//
+//	@doc:
+//		Implementation of transform
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformInnerJoin2MergeJoin.h"
+
+#include "gpopt/operators/CLogicalInnerJoin.h"
+#include "gpopt/operators/CPatternLeaf.h"
+#include "gpopt/operators/CPhysicalInnerMergeJoin.h"
+#include "gpopt/xforms/CXformUtils.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoin2MergeJoin::CXformInnerJoin2MergeJoin
+//
+//	@doc:
+//		ctor
+//
+//---------------------------------------------------------------------------
+CXformInnerJoin2MergeJoin::CXformInnerJoin2MergeJoin(CMemoryPool *mp)
+    :  // pattern
+      CXformImplementation(GPOS_NEW(mp)
+                               CExpression(mp, GPOS_NEW(mp) CLogicalInnerJoin(mp),
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // left child
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // right child
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))   // predicate
+                                           )) {}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoin2MergeJoin::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle;
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise CXformInnerJoin2MergeJoin::Exfp(CExpressionHandle &exprhdl) const {
+  return CXformUtils::ExfpLogicalJoin2PhysicalJoin(exprhdl);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformInnerJoin2MergeJoin::Transform
+//
+//	@doc:
+//		actual transformation
+//
+//---------------------------------------------------------------------------
+void CXformInnerJoin2MergeJoin::Transform(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr) const {
+  GPOS_ASSERT(nullptr != pxfctxt);
+  GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+  GPOS_ASSERT(FCheckPattern(pexpr));
+
+  CXformUtils::ImplementMergeJoinWithFilter<CPhysicalInnerMergeJoin>(pxfctxt, pxfres, pexpr);
+}
+
+// EOF
@@ -0,0 +1,65 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CXformLeftAntiSemiJoin2MergeJoin.cpp
+//
+//	@doc:
+//		Implementation of transform
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformLeftAntiSemiJoin2MergeJoin.h"
+
+#include "gpopt/operators/CLogicalLeftAntiSemiJoin.h"
+#include "gpopt/operators/CPatternLeaf.h"
+#include "gpopt/operators/CPhysicalLeftAntiSemiMergeJoin.h"
+#include "gpopt/xforms/CXformUtils.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftAntiSemiJoin2MergeJoin::CXformLeftAntiSemiJoin2MergeJoin
+//
+//	@doc:
+//		ctor
+//
+//---------------------------------------------------------------------------
+CXformLeftAntiSemiJoin2MergeJoin::CXformLeftAntiSemiJoin2MergeJoin(CMemoryPool *mp)
+    :  // pattern
+      CXformImplementation(GPOS_NEW(mp)
+                               CExpression(mp, GPOS_NEW(mp) CLogicalLeftAntiSemiJoin(mp),
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // left child
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // right child
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))   // predicate
+                                           )) {}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftAntiSemiJoin2MergeJoin::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle;
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise CXformLeftAntiSemiJoin2MergeJoin::Exfp(CExpressionHandle &exprhdl) const {
+  return CXformUtils::ExfpLogicalJoin2PhysicalJoin(exprhdl);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftAntiSemiJoin2MergeJoin::Transform
+//
+//	@doc:
+//		actual transformation
+//
+//---------------------------------------------------------------------------
+void CXformLeftAntiSemiJoin2MergeJoin::Transform(CXformContext *pxfctxt, CXformResult *pxfres,
+                                                 CExpression *pexpr) const {
+  GPOS_ASSERT(nullptr != pxfctxt);
+  GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+  GPOS_ASSERT(FCheckPattern(pexpr));
+
+  CXformUtils::ImplementMergeJoinWithFilter<CPhysicalLeftAntiSemiMergeJoin>(pxfctxt, pxfres, pexpr);
+}
+
+// EOF
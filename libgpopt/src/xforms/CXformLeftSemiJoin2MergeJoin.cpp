@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CXformLeftSemiJoin2MergeJoin.cpp
+//
+//	@doc:
+//		Implementation of transform
+//---------------------------------------------------------------------------
+
+#include "gpopt/xforms/CXformLeftSemiJoin2MergeJoin.h"
+
+#include "gpopt/operators/CLogicalLeftSemiJoin.h"
+#include "gpopt/operators/CPatternLeaf.h"
+#include "gpopt/operators/CPhysicalLeftSemiMergeJoin.h"
+#include "gpopt/xforms/CXformUtils.h"
+#include "gpos/base.h"
+
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftSemiJoin2MergeJoin::CXformLeftSemiJoin2MergeJoin
+//
+//	@doc:
+//		ctor
+//
+//---------------------------------------------------------------------------
+CXformLeftSemiJoin2MergeJoin::CXformLeftSemiJoin2MergeJoin(CMemoryPool *mp)
+    :  // pattern
+      CXformImplementation(GPOS_NEW(mp)
+                               CExpression(mp, GPOS_NEW(mp) CLogicalLeftSemiJoin(mp),
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // left child
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternLeaf(mp)),  // right child
+                                           GPOS_NEW(mp) CExpression(mp, GPOS_NEW(mp) CPatternTree(mp))   // predicate
+                                           )) {}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftSemiJoin2MergeJoin::Exfp
+//
+//	@doc:
+//		Compute xform promise for a given expression handle;
+//
+//---------------------------------------------------------------------------
+CXform::EXformPromise CXformLeftSemiJoin2MergeJoin::Exfp(CExpressionHandle &exprhdl) const {
+  return CXformUtils::ExfpLogicalJoin2PhysicalJoin(exprhdl);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CXformLeftSemiJoin2MergeJoin::Transform
+//
+//	@doc:
+//		actual transformation
+//
+//---------------------------------------------------------------------------
+void CXformLeftSemiJoin2MergeJoin::Transform(CXformContext *pxfctxt, CXformResult *pxfres, CExpression *pexpr) const {
+  GPOS_ASSERT(nullptr != pxfctxt);
+  GPOS_ASSERT(FPromising(pxfctxt->Pmp(), this, pexpr));
+  GPOS_ASSERT(FCheckPattern(pexpr));
+
+  CXformUtils::ImplementMergeJoinWithFilter<CPhysicalLeftSemiMergeJoin>(pxfctxt, pxfres, pexpr);
+}
+
+// EOF
@@ -55,12 +55,13 @@ CXformPushGbBelowJoin::CXformPushGbBelowJoin(CExpression *pexprPattern) : CXform
 //
 //	@doc:
 //		Compute xform promise for a given expression handle;
-//		we only push down global aggregates
+//		we push down global aggregates, and the local half of a split one
+//		to pre-aggregate the join's outer child
 //
 //---------------------------------------------------------------------------
 CXform::EXformPromise CXformPushGbBelowJoin::Exfp(CExpressionHandle &exprhdl) const {
   CLogicalGbAgg *popGbAgg = CLogicalGbAgg::PopConvert(exprhdl.Pop());
-  if (!popGbAgg->FGlobal()) {
+  if (COperator::EgbaggtypeIntermediate == popGbAgg->Egbaggtype()) {
     return CXform::ExfpNone;
   }
 
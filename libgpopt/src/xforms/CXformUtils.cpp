@@ -126,10 +126,11 @@ CXform::EXformPromise CXformUtils::ExfpExpandJoinOrder(CExpressionHandle &exprhd
   // With optimizer_join_order set to 'query' or 'exhaustive', the
   // 'query' join order will expand the join even if it contains
   // outer refs, using another method to get the promise.
-  // Therefore we also allow expansion for 'exhaustive2'
+  // Therefore we also allow expansion for 'exhaustive2' and 'dphyp'
   // when we have outer refs.
   if (exprhdl.DeriveHasSubquery(exprhdl.Arity() - 1) ||
-      (exprhdl.HasOuterRefs() && CXform::ExfExpandNAryJoinDPv2 != xform->Exfid())) {
+      (exprhdl.HasOuterRefs() && CXform::ExfExpandNAryJoinDPv2 != xform->Exfid() &&
+       CXform::ExfExpandNAryJoinDPhyp != xform->Exfid())) {
     // subqueries must be unnested before applying xform
     return CXform::ExfpNone;
   }
@@ -1737,7 +1738,7 @@ CExpression *CXformUtils::PexprBuildBtreeIndexPlan(CMemoryPool *mp, CMDAccessor
   GPOS_ASSERT(nullptr != pmdindex);
   GPOS_ASSERT(nullptr != pmdrel);
 
-  COperator::EOperatorId op_id = pexprGet->Pop()->Eopid();
+  COperator::EOperatorId op_id GPOS_ASSERTS_ONLY = pexprGet->Pop()->Eopid();
   GPOS_ASSERT(CLogical::EopLogicalGet == op_id);
 
   CTableDescriptorHashSet *ptabdescset = pexprGet->DeriveTableDescriptor();
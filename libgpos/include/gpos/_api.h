@@ -45,14 +45,15 @@ struct gpos_exec_params {
   void *result;          /* task result */
   void *stack_start;     /* start of current thread's stack */
   void *config;
-  char *error_buffer;    /* buffer used to store error messages */
-  int error_buffer_size; /* size of error message buffer */
+  void *error_string;    /* CWString used to store error messages, may be NULL */
+  int max_trace_size;    /* max number of trace characters written to error_string, 0 for no limit */
   bool *abort_requested; /* flag indicating if abort is requested */
 };
 
 /* struct containing initialization parameters for gpos */
 struct gpos_init_params {
   bool (*abort_requested)(void); /* callback to report abort requests */
+  void *(*host_call)(void *(*func)(void *), void *arg); /* callback to run calls into the host system */
 };
 
 /* initialize GPOS memory pool, worker pool and message repository */
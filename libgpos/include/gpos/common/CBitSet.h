@@ -6,13 +6,14 @@
 //		CBitSet.h
 //
 //	@doc:
-//		Implementation of bitset as linked list of bitvectors
+//		Implementation of bitset as contiguous array of words
 //---------------------------------------------------------------------------
 #ifndef GPOS_CBitSet_H
 #define GPOS_CBitSet_H
 
+#include <atomic>
+
 #include "gpos/base.h"
-#include "gpos/common/CBitVector.h"
 #include "gpos/common/CDynamicPtrArray.h"
 #include "gpos/common/CList.h"
 
@@ -22,7 +23,11 @@ namespace gpos {
 //		CBitSet
 //
 //	@doc:
-//		Linked list of CBitSetLink's
+//		Set of small non-negative integers kept as an array of 64-bit words;
+//		sets of up to 256 elements use the words embedded in the object, larger
+//		ones move to an array from the memory pool that grows on demand.
+//		Words beyond the capacity of a set read as zero, so sets of different
+//		capacity compare word by word.
 //
 //---------------------------------------------------------------------------
 class CBitSet : public CRefCount {
@@ -30,73 +35,53 @@ class CBitSet : public CRefCount {
   friend class CBitSetIter;
 
  protected:
-  //---------------------------------------------------------------------------
-  //	@class:
-  //		CBitSetLink
-  //
-  //	@doc:
-  //		bit vector + offset + link
-  //
-  //---------------------------------------------------------------------------
-  class CBitSetLink {
-   private:
-    // offset
-    uint32_t m_offset;
-
-    // bitvector
-    CBitVector *m_vec;
-
-   public:
-    CBitSetLink(const CBitSetLink &) = delete;
-
-    // ctor
-    explicit CBitSetLink(CMemoryPool *, uint32_t offset, uint32_t vector_size);
-
-    explicit CBitSetLink(CMemoryPool *, const CBitSetLink &);
-
-    // dtor
-    ~CBitSetLink();
-
-    // accessor
-    uint32_t GetOffset() const { return m_offset; }
-
-    // accessor
-    CBitVector *GetVec() const { return m_vec; }
+  // word type and width
+  using Word = uint64_t;
+  static const uint32_t BitsPerWord = 64;
 
-    // list link
-    SLink m_link;
+  // number of words stored inline
+  static const uint32_t InlineWords = 4;
 
-  };  // class CBitSetLink
-
-  // list of bit set links
-  CList<CBitSetLink> m_bsllist;
-
-  // pool to allocate links from
+  // pool to allocate words from
   CMemoryPool *m_mp;
 
-  // size of individual bitvectors
-  uint32_t m_vector_size;
+  // words in use, either m_inline_words or an array from the pool
+  Word *m_words;
+
+  // number of words available in m_words
+  uint32_t m_capacity;
 
   // number of elements
   uint32_t m_size;
 
+  // cached hash value, valid if m_hash_valid is set; the flag is published
+  // after the value as sets may be hashed by several search workers
+  mutable uint32_t m_hash;
+  mutable std::atomic<bool> m_hash_valid;
+
+  // inline storage for small sets
+  Word m_inline_words[InlineWords];
+
   // private copy ctor
   CBitSet(const CBitSet &);
 
-  // find link with offset less or equal to given value
-  CBitSetLink *FindLinkByOffset(uint32_t, CBitSetLink * = nullptr) const;
+  // make room for at least the given number of words
+  void EnsureCapacity(uint32_t num_words);
+
+  // number of words up to and including the highest non-zero one
+  uint32_t UsedWords() const;
+
+  // word at given index, zero past capacity
+  Word GetWord(uint32_t index) const { return index < m_capacity ? m_words[index] : 0; }
 
   // reset set
   void Clear();
 
-  // compute target offset
-  uint32_t ComputeOffset(uint32_t) const;
-
   // re-compute size of set
   void RecomputeSize();
 
  public:
-  // ctor
+  // ctor; storage grows on demand, vector_size is kept for compatibility
   CBitSet(CMemoryPool *mp, uint32_t vector_size = 256);
   CBitSet(CMemoryPool *mp, const CBitSet &);
 
@@ -21,7 +21,7 @@ namespace gpos {
 //
 //	@doc:
 //		Iterator for bitset's; defined as friend, ie can access bitset's
-//		internal links
+//		internal words
 //
 //---------------------------------------------------------------------------
 class CBitSetIter {
@@ -29,12 +29,9 @@ class CBitSetIter {
   // bitset
   const CBitSet &m_bs;
 
-  // current cursor position (in current link)
+  // current cursor position
   uint32_t m_cursor;
 
-  // current cursor link
-  CBitSet::CBitSetLink *m_bsl;
-
   // is iterator active or exhausted
   bool m_active;
 
@@ -0,0 +1,232 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CHashIndex.h
+//
+//	@doc:
+//		Open-addressing index over the entry arrays of CHashMap and CHashSet;
+//		one control byte per slot holds seven bits of the hash of the entry
+//		in that slot, so a whole group of slots is probed with a handful of
+//		instructions and entries are only compared on a hash match
+//---------------------------------------------------------------------------
+#ifndef GPOS_CHashIndex_H
+#define GPOS_CHashIndex_H
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "gpos/base.h"
+#include "gpos/common/clibwrapper.h"
+
+namespace gpos {
+//---------------------------------------------------------------------------
+//	@class:
+//		CHashIndex
+//
+//	@doc:
+//		Maps hashes to positions in a client-owned entry array. Slots are
+//		probed group by group; a group is 16 control bytes compared with SSE2
+//		where available, and 8 bytes compared within a 64-bit word elsewhere.
+//		The number of slots is a power of two and at least one group.
+//		Clients compare entries themselves, the index only narrows down the
+//		candidates, and rebuild it through Reset when MaxEntries is reached.
+//
+//---------------------------------------------------------------------------
+class CHashIndex {
+ private:
+  // control byte of an empty slot
+  static const uint8_t Empty = 0x80;
+
+  // control byte of a slot whose entry was erased
+  static const uint8_t Deleted = 0xFE;
+
+#if defined(__SSE2__)
+  // number of slots probed at once
+  static const uint32_t GroupSize = 16;
+
+  // bit mask of the slots in a group, one bit per slot
+  using Mask = uint32_t;
+
+  // position of the lowest slot set in mask
+  static uint32_t Lowest(Mask mask) { return (uint32_t)__builtin_ctz(mask); }
+
+  // group of control bytes starting at given slot
+  __m128i Group(uint32_t slot) const { return _mm_loadu_si128((const __m128i *)(m_ctrl + slot)); }
+
+  // slots of group whose control byte equals given byte
+  static Mask MatchByte(__m128i group, uint8_t byte) {
+    return (Mask)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte)));
+  }
+
+  // slots of group that are empty
+  static Mask MatchEmpty(__m128i group) { return MatchByte(group, Empty); }
+
+  // slots of group that are empty or deleted, i.e. whose top bit is set
+  static Mask MatchFree(__m128i group) { return (Mask)_mm_movemask_epi8(group); }
+#else
+  // number of slots probed at once
+  static const uint32_t GroupSize = 8;
+
+  // bit mask of the slots in a group, top bit of each slot's byte
+  using Mask = uint64_t;
+
+  static const uint64_t Lsbs = 0x0101010101010101ULL;
+  static const uint64_t Msbs = 0x8080808080808080ULL;
+
+  // position of the lowest slot set in mask
+  static uint32_t Lowest(Mask mask) { return (uint32_t)__builtin_ctzll(mask) / 8; }
+
+  // group of control bytes starting at given slot
+  uint64_t Group(uint32_t slot) const {
+    uint64_t group;
+    (void)clib::Memcpy(&group, m_ctrl + slot, sizeof(group));
+    return group;
+  }
+
+  // slots of group whose control byte equals given byte; may report a
+  // false positive next to a true one, which the client comparison rejects
+  static Mask MatchByte(uint64_t group, uint8_t byte) {
+    uint64_t x = group ^ (Lsbs * byte);
+    return (x - Lsbs) & ~x & Msbs;
+  }
+
+  // slots of group that are empty: top bit set, bit 1 clear
+  static Mask MatchEmpty(uint64_t group) { return group & ~(group << 6) & Msbs; }
+
+  // slots of group that are empty or deleted, i.e. whose top bit is set
+  static Mask MatchFree(uint64_t group) { return group & Msbs; }
+#endif  // __SSE2__
+
+  // memory pool
+  CMemoryPool *m_mp;
+
+  // control bytes, one per slot
+  uint8_t *m_ctrl;
+
+  // entry index of each slot
+  uint32_t *m_entries;
+
+  // number of slots
+  uint32_t m_capacity;
+
+  // scramble hash so that weak client hash functions spread over slots
+  static uint64_t Mix(uint32_t hash) { return (uint64_t)hash * 0x9E3779B97F4A7C15ULL; }
+
+  // control byte stored for a hash
+  static uint8_t H2(uint64_t mixed) { return (uint8_t)((mixed >> 25) & 0x7F); }
+
+  // first group probed for a hash
+  uint32_t H1(uint64_t mixed) const { return (uint32_t)(mixed >> 32) & (m_capacity - 1) & ~(GroupSize - 1); }
+
+ public:
+  CHashIndex(const CHashIndex &) = delete;
+
+  // ctor; no memory is allocated until the first Reset
+  explicit CHashIndex(CMemoryPool *mp) : m_mp(mp), m_ctrl(nullptr), m_entries(nullptr), m_capacity(0) {}
+
+  // dtor
+  ~CHashIndex() {
+    GPOS_DELETE_ARRAY(m_ctrl);
+    GPOS_DELETE_ARRAY(m_entries);
+  }
+
+  // number of slots
+  uint32_t Capacity() const { return m_capacity; }
+
+  // number of entries, including erased ones, the index may hold
+  static uint32_t MaxEntries(uint32_t capacity) { return capacity - capacity / 8; }
+
+  // smallest capacity larger than the given one
+  static uint32_t NextCapacity(uint32_t capacity) { return 0 == capacity ? GroupSize : 2 * capacity; }
+
+  // drop all slots and allocate the given number of empty ones
+  void Reset(uint32_t capacity) {
+    GPOS_ASSERT(GroupSize <= capacity && 0 == (capacity & (capacity - 1)));
+
+    uint8_t *ctrl = GPOS_NEW_ARRAY(m_mp, uint8_t, capacity);
+    uint32_t *entries = GPOS_NEW_ARRAY(m_mp, uint32_t, capacity);
+    (void)clib::Memset(ctrl, Empty, capacity);
+
+    GPOS_DELETE_ARRAY(m_ctrl);
+    GPOS_DELETE_ARRAY(m_entries);
+
+    m_ctrl = ctrl;
+    m_entries = entries;
+    m_capacity = capacity;
+  }
+
+  // find the slot of the entry with given hash for which pred holds;
+  // returns UINT32_MAX if there is none
+  template <class Pred>
+  uint32_t Find(uint32_t hash, Pred pred) const {
+    if (0 == m_capacity) {
+      return UINT32_MAX;
+    }
+
+    uint64_t mixed = Mix(hash);
+    uint8_t h2 = H2(mixed);
+    uint32_t slot = H1(mixed);
+
+    for (uint32_t step = GroupSize; step <= m_capacity; step += GroupSize) {
+      auto group = Group(slot);
+      for (Mask match = MatchByte(group, h2); 0 != match; match &= match - 1) {
+        uint32_t candidate = slot + Lowest(match);
+        if (pred(m_entries[candidate])) {
+          return candidate;
+        }
+      }
+
+      if (0 != MatchEmpty(group)) {
+        break;
+      }
+
+      slot = (slot + step) & (m_capacity - 1);
+    }
+
+    return UINT32_MAX;
+  }
+
+  // entry index stored in given slot
+  uint32_t Entry(uint32_t slot) const {
+    GPOS_ASSERT(slot < m_capacity);
+
+    return m_entries[slot];
+  }
+
+  // add entry with given hash, the client makes sure there is room
+  void Insert(uint32_t hash, uint32_t entry) {
+    GPOS_ASSERT(0 < m_capacity);
+
+    uint64_t mixed = Mix(hash);
+    uint32_t slot = H1(mixed);
+
+    for (uint32_t step = GroupSize;; step += GroupSize) {
+      GPOS_ASSERT(step <= m_capacity && "Hash index is full");
+
+      Mask free = MatchFree(Group(slot));
+      if (0 != free) {
+        slot += Lowest(free);
+        break;
+      }
+
+      slot = (slot + step) & (m_capacity - 1);
+    }
+
+    m_ctrl[slot] = H2(mixed);
+    m_entries[slot] = entry;
+  }
+
+  // erase entry in given slot
+  void Erase(uint32_t slot) {
+    GPOS_ASSERT(slot < m_capacity && 0 == (m_ctrl[slot] & Empty));
+
+    m_ctrl[slot] = Deleted;
+  }
+
+};  // class CHashIndex
+
+}  // namespace gpos
+
+#endif  // !GPOS_CHashIndex_H
+
+// EOF
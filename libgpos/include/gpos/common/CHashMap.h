@@ -17,6 +17,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CHashIndex.h"
 #include "gpos/common/CRefCount.h"
 
 namespace gpos {
@@ -30,7 +31,10 @@ class CHashMapIter;
 //		CHashMap
 //
 //	@doc:
-//		Hash map
+//		Hash map; entries are kept in insertion order in a flat array that
+//		is located through a CHashIndex. Deleting an entry leaves a hole
+//		that is squeezed out when the array is rebuilt on growth, so
+//		iteration order is insertion order.
 //
 //---------------------------------------------------------------------------
 template <class K, class T, uint32_t (*HashFn)(const K *), bool (*EqFn)(const K *, const K *), void (*DestroyKFn)(K *),
@@ -41,161 +45,124 @@ class CHashMap : public CRefCount {
   friend class CHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn>;
 
  private:
-  //---------------------------------------------------------------------------
-  //	@class:
-  //		CHashMapElem
-  //
-  //	@doc:
-  //		Anchor for key/value pair
-  //
-  //---------------------------------------------------------------------------
-  class CHashMapElem {
-   private:
-    // key/value pair
+  // key/value pair, key is nullptr once the entry is deleted
+  struct SEntry {
     K *m_key;
     T *m_value;
+    uint32_t m_hash;
+  };
 
-    // own objects
-    bool m_owns_objects;
-
-   public:
-    CHashMapElem(const CHashMapElem &) = delete;
+  // memory pool
+  CMemoryPool *const m_mp;
 
-    // ctor
-    CHashMapElem(K *key, T *value, bool fOwn) : m_key(key), m_value(value), m_owns_objects(fOwn) {
-      GPOS_ASSERT(nullptr != key);
-    }
+  // number of entries
+  uint32_t m_size;
 
-    // dtor
-    ~CHashMapElem() {
-      // in case of a temporary hashmap element for lookup we do NOT own the
-      // objects, otherwise call destroy functions
-      if (m_owns_objects) {
-        DestroyKFn(m_key);
-        DestroyTFn(m_value);
-      }
-    }
+  // number of used positions in entry array, including deleted entries
+  uint32_t m_num_entries;
 
-    // key accessor
-    K *Key() const { return m_key; }
+  // entries in insertion order
+  SEntry *m_entries;
 
-    // value accessor
-    T *Value() const { return m_value; }
+  // index over entries
+  CHashIndex m_index;
 
-    // replace value
-    void ReplaceValue(T *new_value) {
-      if (m_owns_objects) {
-        DestroyTFn(m_value);
-      }
-      m_value = new_value;
+  // rebuild entry array and index with room for at least one more entry
+  void Grow() {
+    uint32_t capacity = CHashIndex::NextCapacity(0);
+    while (2 * (m_size + 1) > CHashIndex::MaxEntries(capacity)) {
+      capacity = CHashIndex::NextCapacity(capacity);
     }
 
-    // equality operator -- map elements are equal if their keys match
-    bool operator==(const CHashMapElem &elem) const { return EqFn(m_key, elem.m_key); }
-  };
-
-  // memory pool
-  CMemoryPool *const m_mp;
-
-  // size
-  uint32_t m_num_chains;
-
-  // number of entries
-  uint32_t m_size;
+    if (capacity < m_index.Capacity()) {
+      // mostly deleted entries, compact at current size
+      capacity = m_index.Capacity();
+    }
 
-  // each hash chain is an array of hashmap elements
-  using CHashSetElemArray = CDynamicPtrArray<CHashMapElem, CleanupDelete>;
-  CHashSetElemArray **const m_chains;
+    SEntry *entries = GPOS_NEW_ARRAY(m_mp, SEntry, CHashIndex::MaxEntries(capacity));
+    m_index.Reset(capacity);
 
-  // array for keys
-  // We use CleanupNULL because the keys are owned by the hash table
-  using Keys = CDynamicPtrArray<K, CleanupNULL>;
-  Keys *const m_keys;
+    uint32_t num_entries = 0;
+    for (uint32_t ul = 0; ul < m_num_entries; ul++) {
+      if (nullptr != m_entries[ul].m_key) {
+        entries[num_entries] = m_entries[ul];
+        m_index.Insert(entries[num_entries].m_hash, num_entries);
+        num_entries++;
+      }
+    }
+    GPOS_ASSERT(num_entries == m_size);
 
-  IntPtrArray *const m_filled_chains;
+    GPOS_DELETE_ARRAY(m_entries);
+    m_entries = entries;
+    m_num_entries = num_entries;
+  }
 
-  // lookup appropriate hash chain in static table, may be NULL if
-  // no elements have been inserted yet
-  CHashSetElemArray **GetChain(const K *key) const {
-    GPOS_ASSERT(nullptr != m_chains);
-    return &m_chains[HashFn(key) % m_num_chains];
+  // lookup the slot of an entry by its key
+  uint32_t Lookup(const K *key, uint32_t hash) const {
+    return m_index.Find(hash, [&](uint32_t entry) {
+      return m_entries[entry].m_hash == hash && EqFn(m_entries[entry].m_key, key);
+    });
   }
 
-  // clear elements
-  void Clear() {
-    for (uint32_t i = 0; i < m_filled_chains->Size(); i++) {
-      // release each hash chain
-      m_chains[*(*m_filled_chains)[i]]->Release();
+  // lookup an entry by its key
+  SEntry *Lookup(const K *key) const {
+    if (0 == m_size) {
+      return nullptr;
     }
-    m_size = 0;
-    m_filled_chains->Clear();
-  }
 
-  // lookup an element by its key
-  CHashMapElem *Lookup(const K *key) const {
-    CHashMapElem hme(const_cast<K *>(key), nullptr /*T*/, false /*fOwn*/);
-    CHashMapElem *found_hme = nullptr;
-    CHashSetElemArray **chain = GetChain(key);
-    if (nullptr != *chain) {
-      found_hme = (*chain)->Find(&hme);
-      GPOS_ASSERT_IMP(nullptr != found_hme, *found_hme == hme);
+    uint32_t slot = Lookup(key, HashFn(key));
+    if (UINT32_MAX == slot) {
+      return nullptr;
     }
 
-    return found_hme;
+    return &m_entries[m_index.Entry(slot)];
   }
 
  public:
   CHashMap(const CHashMap<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn> &) = delete;
 
-  // ctor
-  CHashMap(CMemoryPool *mp, uint32_t num_chains = 127)
-      : m_mp(mp),
-        m_num_chains(num_chains),
-        m_size(0),
-        m_chains(GPOS_NEW_ARRAY(m_mp, CHashSetElemArray *, m_num_chains)),
-        m_keys(GPOS_NEW(m_mp) Keys(m_mp)),
-        m_filled_chains(GPOS_NEW(mp) IntPtrArray(mp)) {
-    GPOS_ASSERT(m_num_chains > 0);
-    (void)clib::Memset(m_chains, 0, m_num_chains * sizeof(CHashSetElemArray *));
-  }
+  // ctor; storage grows on demand, num_chains is kept for compatibility
+  CHashMap(CMemoryPool *mp, uint32_t = 127)
+      : m_mp(mp), m_size(0), m_num_entries(0), m_entries(nullptr), m_index(mp) {}
 
   // dtor
   ~CHashMap() override {
-    // release all hash chains
-    Clear();
+    for (uint32_t ul = 0; ul < m_num_entries; ul++) {
+      if (nullptr != m_entries[ul].m_key) {
+        DestroyKFn(m_entries[ul].m_key);
+        DestroyTFn(m_entries[ul].m_value);
+      }
+    }
 
-    GPOS_DELETE_ARRAY(m_chains);
-    m_keys->Release();
-    m_filled_chains->Release();
+    GPOS_DELETE_ARRAY(m_entries);
   }
 
   // insert an element if key is not yet present
   bool Insert(K *key, T *value) {
-    if (nullptr != Find(key)) {
+    GPOS_ASSERT(nullptr != key);
+
+    uint32_t hash = HashFn(key);
+    if (0 < m_size && UINT32_MAX != Lookup(key, hash)) {
       return false;
     }
 
-    CHashSetElemArray **chain = GetChain(key);
-    if (nullptr == *chain) {
-      *chain = GPOS_NEW(m_mp) CHashSetElemArray(m_mp);
-      int32_t chain_idx = HashFn(key) % m_num_chains;
-      m_filled_chains->Append(GPOS_NEW(m_mp) int32_t(chain_idx));
+    if (m_num_entries == CHashIndex::MaxEntries(m_index.Capacity())) {
+      Grow();
     }
 
-    CHashMapElem *elem = GPOS_NEW(m_mp) CHashMapElem(key, value, true /*fOwn*/);
-    (*chain)->Append(elem);
-
+    m_entries[m_num_entries] = SEntry{key, value, hash};
+    m_index.Insert(hash, m_num_entries);
+    m_num_entries++;
     m_size++;
-    m_keys->Append(key);
 
     return true;
   }
 
   // lookup a value by its key
   T *Find(const K *key) const {
-    CHashMapElem *elem = Lookup(key);
-    if (nullptr != elem) {
-      return elem->Value();
+    SEntry *entry = Lookup(key);
+    if (nullptr != entry) {
+      return entry->m_value;
     }
 
     return nullptr;
@@ -205,38 +172,42 @@ class CHashMap : public CRefCount {
   bool Replace(const K *key, T *ptNew) {
     GPOS_ASSERT(nullptr != key);
 
-    bool fSuccess = false;
-    CHashMapElem *elem = Lookup(key);
-    if (nullptr != elem) {
-      elem->ReplaceValue(ptNew);
-      fSuccess = true;
+    SEntry *entry = Lookup(key);
+    if (nullptr == entry) {
+      return false;
     }
 
-    return fSuccess;
+    DestroyTFn(entry->m_value);
+    entry->m_value = ptNew;
+
+    return true;
   }
 
+  // delete the entry for the given key, destroying key and value
   bool Delete(const K *key) {
-    CHashSetElemArray **chain = GetChain(key);
-
-    if (nullptr != *chain) {
-      for (uint32_t ul = 0; ul < (*chain)->Size(); ul++) {
-        if (EqFn((**chain)[ul]->Key(), key)) {
-          // found the entry, now remove it by putting it last,
-          // then removing the last element
-          (*chain)->Swap(ul, (*chain)->Size() - 1);
-          CHashMapElem *to_delete = (*chain)->RemoveLast();
-          CleanupDelete(to_delete);
-          return true;
-        }
-      }
+    if (0 == m_size) {
+      return false;
+    }
+
+    uint32_t slot = Lookup(key, HashFn(key));
+    if (UINT32_MAX == slot) {
+      return false;
     }
-    return false;
+
+    SEntry &entry = m_entries[m_index.Entry(slot)];
+    DestroyKFn(entry.m_key);
+    DestroyTFn(entry.m_value);
+    entry.m_key = nullptr;
+    entry.m_value = nullptr;
+
+    m_index.Erase(slot);
+    m_size--;
+
+    return true;
   }
 
   // return number of map entries
   uint32_t Size() const { return m_size; }
-
-  Keys *GetKeys() const { return m_keys; }
 };  // class CHashMap
 
 using UlongToUlongMap = CHashMap<uint32_t, uint32_t, gpos::HashValue<uint32_t>, gpos::Equals<uint32_t>,
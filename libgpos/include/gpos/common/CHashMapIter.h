@@ -35,38 +35,25 @@ class CHashMapIter : public CStackObject {
   // map to iterate
   const TMap *m_map;
 
-  // current hashchain
-  uint32_t m_chain_idx;
-
-  // current key
-  uint32_t m_key_idx;
-
-  // is initialized?
-  bool m_is_initialized;
-
-  // method to return the current element
-  const typename TMap::CHashMapElem *Get() const {
-    typename TMap::CHashMapElem *elem = nullptr;
-    K *k = (*(m_map->m_keys))[m_key_idx - 1];
-    elem = m_map->Lookup(k);
-
-    return elem;
-  }
+  // position of current entry plus one, zero before first advance
+  uint32_t m_entry_idx;
 
  public:
   CHashMapIter(const CHashMapIter<K, T, HashFn, EqFn, DestroyKFn, DestroyTFn> &) = delete;
 
   // ctor
-  CHashMapIter(TMap *ptm) : m_map(ptm), m_chain_idx(0), m_key_idx(0) { GPOS_ASSERT(nullptr != ptm); }
+  CHashMapIter(TMap *ptm) : m_map(ptm), m_entry_idx(0) { GPOS_ASSERT(nullptr != ptm); }
 
   // dtor
   virtual ~CHashMapIter() = default;
 
-  // advance iterator to next element
+  // advance iterator to next element, skipping deleted entries
   bool Advance() {
-    if (m_key_idx < m_map->m_keys->Size()) {
-      m_key_idx++;
-      return true;
+    while (m_entry_idx < m_map->m_num_entries) {
+      m_entry_idx++;
+      if (nullptr != m_map->m_entries[m_entry_idx - 1].m_key) {
+        return true;
+      }
     }
 
     return false;
@@ -74,20 +61,16 @@ class CHashMapIter : public CStackObject {
 
   // current key
   const K *Key() const {
-    const typename TMap::CHashMapElem *elem = Get();
-    if (nullptr != elem) {
-      return elem->Key();
-    }
-    return nullptr;
+    GPOS_ASSERT(0 < m_entry_idx && "Iterator's advance is not called");
+
+    return m_map->m_entries[m_entry_idx - 1].m_key;
   }
 
   // current value
   const T *Value() const {
-    const typename TMap::CHashMapElem *elem = Get();
-    if (nullptr != elem) {
-      return elem->Value();
-    }
-    return nullptr;
+    GPOS_ASSERT(0 < m_entry_idx && "Iterator's advance is not called");
+
+    return m_map->m_entries[m_entry_idx - 1].m_value;
   }
 
 };  // class CHashMapIter
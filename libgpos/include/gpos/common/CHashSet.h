@@ -24,6 +24,7 @@
 
 #include "gpos/base.h"
 #include "gpos/common/CDynamicPtrArray.h"
+#include "gpos/common/CHashIndex.h"
 #include "gpos/common/CRefCount.h"
 
 namespace gpos {
@@ -36,7 +37,8 @@ class CHashSetIter;
 //		CHashSet
 //
 //	@doc:
-//		Hash set
+//		Hash set; elements are kept in insertion order in a flat array that
+//		is located through a CHashIndex
 //
 //---------------------------------------------------------------------------
 template <class T, uint32_t (*HashFn)(const T *), bool (*EqFn)(const T *, const T *), void (*CleanupFn)(T *)>
@@ -45,163 +47,93 @@ class CHashSet : public CRefCount {
   friend class CHashSetIter<T, HashFn, EqFn, CleanupFn>;
 
  private:
-  //---------------------------------------------------------------------------
-  //	@class:
-  //		CHashSetElem
-  //
-  //	@doc:
-  //		Anchor for set element
-  //
-  //---------------------------------------------------------------------------
-  class CHashSetElem {
-   private:
-    // pointer to object
+  // set element with its hash
+  struct SEntry {
     T *m_value;
-
-    // does hash set element own object?
-    bool m_owns_object;
-
-   public:
-    CHashSetElem(const CHashSetElem &) = delete;
-
-    // ctor
-    CHashSetElem(T *value, bool fOwn) : m_value(value), m_owns_object(fOwn) { GPOS_ASSERT(nullptr != value); }
-
-    // dtor
-    ~CHashSetElem() {
-      // in case of a temporary HashSet element for lookup we do NOT own the
-      // objects, otherwise call destroy functions
-      if (m_owns_object) {
-        CleanupFn(m_value);
-      }
-    }
-
-    // object accessor
-    T *Value() const { return m_value; }
-
-    // equality operator
-    bool operator==(const CHashSetElem &hse) const { return EqFn(m_value, hse.m_value); }
-  };  // class CHashSetElem
+    uint32_t m_hash;
+  };
 
   // memory pool
   CMemoryPool *m_mp;
 
-  // number of hash chains
-  uint32_t m_num_chains;
-
   // total number of entries
   uint32_t m_size;
 
-  // each hash chain is an array of hashset elements
-  using HashSetElemArray = CDynamicPtrArray<CHashSetElem, CleanupDelete>;
-  HashSetElemArray **m_chains;
+  // entries in insertion order
+  SEntry *m_entries;
 
-  // array for elements
-  // We use CleanupNULL because the elements are owned by the hash table
-  using Elements = CDynamicPtrArray<T, CleanupNULL>;
-  Elements *const m_elements;
+  // index over entries
+  CHashIndex m_index;
 
-  IntPtrArray *const m_filled_chains;
-
-  // lookup appropriate hash chain in static table, may be NULL if
-  // no elements have been inserted yet
-  HashSetElemArray **GetChain(const T *value) const {
-    GPOS_ASSERT(nullptr != m_chains);
-    return &m_chains[HashFn(value) % m_num_chains];
-  }
+  // rebuild entry array and index with room for at least one more entry
+  void Grow() {
+    uint32_t capacity = CHashIndex::NextCapacity(m_index.Capacity());
+    SEntry *entries = GPOS_NEW_ARRAY(m_mp, SEntry, CHashIndex::MaxEntries(capacity));
+    m_index.Reset(capacity);
 
-  // clear elements
-  void Clear() {
-    for (uint32_t i = 0; i < m_filled_chains->Size(); i++) {
-      // release each hash chain
-      m_chains[*(*m_filled_chains)[i]]->Release();
+    for (uint32_t ul = 0; ul < m_size; ul++) {
+      entries[ul] = m_entries[ul];
+      m_index.Insert(entries[ul].m_hash, ul);
     }
-    m_size = 0;
-    m_filled_chains->Clear();
-  }
 
-  // lookup an element by its key
-  CHashSetElem *Lookup(const T *value) const {
-    CHashSetElem hse(const_cast<T *>(value), false /*fOwn*/);
-    CHashSetElem *found_hse = nullptr;
-    HashSetElemArray **chain = GetChain(value);
-    if (nullptr != *chain) {
-      found_hse = (*chain)->Find(&hse);
-      GPOS_ASSERT_IMP(nullptr != found_hse, *found_hse == hse);
-    }
+    GPOS_DELETE_ARRAY(m_entries);
+    m_entries = entries;
+  }
 
-    return found_hse;
+  // lookup the slot of an element
+  uint32_t Lookup(const T *value, uint32_t hash) const {
+    return m_index.Find(hash, [&](uint32_t entry) {
+      return m_entries[entry].m_hash == hash && EqFn(m_entries[entry].m_value, value);
+    });
   }
 
  public:
   CHashSet(const CHashSet<T, HashFn, EqFn, CleanupFn> &) = delete;
 
-  // ctor
-  CHashSet(CMemoryPool *mp, uint32_t size = 127)
-      : m_mp(mp),
-        m_num_chains(size),
-        m_size(0),
-        m_chains(GPOS_NEW_ARRAY(m_mp, HashSetElemArray *, m_num_chains)),
-        m_elements(GPOS_NEW(m_mp) Elements(m_mp)),
-        m_filled_chains(GPOS_NEW(mp) IntPtrArray(mp)) {
-    GPOS_ASSERT(size > 0);
-    (void)clib::Memset(m_chains, 0, m_num_chains * sizeof(HashSetElemArray *));
-  }
+  // ctor; storage grows on demand, size is kept for compatibility
+  CHashSet(CMemoryPool *mp, uint32_t = 127) : m_mp(mp), m_size(0), m_entries(nullptr), m_index(mp) {}
 
   // dtor
   ~CHashSet() override {
-    // release all hash chains
-    Clear();
+    for (uint32_t ul = 0; ul < m_size; ul++) {
+      CleanupFn(m_entries[ul].m_value);
+    }
 
-    GPOS_DELETE_ARRAY(m_chains);
-    m_elements->Release();
-    m_filled_chains->Release();
+    GPOS_DELETE_ARRAY(m_entries);
   }
 
   // insert an element if not present
   bool Insert(T *value) {
-    if (Contains(value)) {
+    GPOS_ASSERT(nullptr != value);
+
+    uint32_t hash = HashFn(value);
+    if (0 < m_size && UINT32_MAX != Lookup(value, hash)) {
       return false;
     }
 
-    HashSetElemArray **chain = GetChain(value);
-    if (nullptr == *chain) {
-      *chain = GPOS_NEW(m_mp) HashSetElemArray(m_mp);
-      int32_t chain_idx = HashFn(value) % m_num_chains;
-      m_filled_chains->Append(GPOS_NEW(m_mp) int32_t(chain_idx));
+    if (m_size == CHashIndex::MaxEntries(m_index.Capacity())) {
+      Grow();
     }
 
-    CHashSetElem *elem = GPOS_NEW(m_mp) CHashSetElem(value, true /*fOwn*/);
-    (*chain)->Append(elem);
-
+    m_entries[m_size] = SEntry{value, hash};
+    m_index.Insert(hash, m_size);
     m_size++;
-    m_elements->Append(value);
 
     return true;
   }
 
   // lookup element
-  bool Contains(const T *value) const {
-    CHashSetElem hse(const_cast<T *>(value), false /*fOwn*/);
-    HashSetElemArray **chain = GetChain(value);
-    if (nullptr != *chain) {
-      CHashSetElem *found_hse = (*chain)->Find(&hse);
-
-      return (nullptr != found_hse);
-    }
-
-    return false;
-  }
+  bool Contains(const T *value) const { return 0 < m_size && UINT32_MAX != Lookup(value, HashFn(value)); }
 
   // return number of map entries
   uint32_t Size() const { return m_size; }
 
   T *First() {
-    if (m_elements->Size() == 0 || m_size == 0) {
+    if (m_size == 0) {
       return nullptr;
     }
 
-    return (*m_elements)[0];
+    return m_entries[0].m_value;
   }
 
 };  // class CHashSet
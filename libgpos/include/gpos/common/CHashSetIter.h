@@ -22,27 +22,21 @@ class CHashSetIter : public CStackObject {
   // set to iterate
   const TSet *m_set;
 
-  // current hashchain
-  uint32_t m_chain_idx;
-
-  // current element
+  // position of current element plus one, zero before first advance
   uint32_t m_elem_idx;
 
-  // is initialized?
-  bool m_is_initialized;
-
  public:
   CHashSetIter(const CHashSetIter<T, HashFn, EqFn, CleanupFn> &) = delete;
 
   // ctor
-  CHashSetIter(TSet *set) : m_set(set), m_chain_idx(0), m_elem_idx(0) { GPOS_ASSERT(nullptr != set); }
+  CHashSetIter(TSet *set) : m_set(set), m_elem_idx(0) { GPOS_ASSERT(nullptr != set); }
 
   // dtor
   virtual ~CHashSetIter() = default;
 
   // advance iterator to next element
   bool Advance() {
-    if (m_elem_idx < m_set->m_elements->Size()) {
+    if (m_elem_idx < m_set->m_size) {
       m_elem_idx++;
       return true;
     }
@@ -52,13 +46,9 @@ class CHashSetIter : public CStackObject {
 
   // current element
   const T *Get() const {
-    const typename TSet::CHashSetElem *elem = nullptr;
-    T *t = (*(m_set->m_elements))[m_elem_idx - 1];
-    elem = m_set->Lookup(t);
-    if (nullptr != elem) {
-      return elem->Value();
-    }
-    return nullptr;
+    GPOS_ASSERT(0 < m_elem_idx && "Iterator's advance is not called");
+
+    return m_set->m_entries[m_elem_idx - 1].m_value;
   }
 
 };  // class CHashSetIter
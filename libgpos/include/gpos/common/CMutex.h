@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CMutex.h
+//
+//	@doc:
+//		Mutex used by the shared structures of the optimizer
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMutex_H
+#define GPOS_CMutex_H
+
+#include <mutex>
+
+#include "gpos/common/CStackObject.h"
+#include "gpos/types.h"
+
+namespace gpos {
+//---------------------------------------------------------------------------
+//	@class:
+//		CMutex
+//
+//	@doc:
+//		Recursive mutex that only locks while concurrent execution is
+//		enabled. The optimizer normally runs on a single worker and pays
+//		nothing for the locks; the flag is switched by the owner of the
+//		helper workers while it is the only thread running and holds no
+//		mutex.
+//
+//---------------------------------------------------------------------------
+class CMutex {
+ private:
+  // are several workers running?
+  inline static bool m_enabled{false};
+
+  // underlying mutex
+  std::recursive_mutex m_mutex;
+
+ public:
+  CMutex(const CMutex &) = delete;
+
+  // ctor
+  CMutex() = default;
+
+  // acquire
+  void Lock() {
+    if (m_enabled) {
+      m_mutex.lock();
+    }
+  }
+
+  // release
+  void Unlock() {
+    if (m_enabled) {
+      m_mutex.unlock();
+    }
+  }
+
+  // is locking enabled?
+  static bool IsEnabled() { return m_enabled; }
+
+  // switch locking on or off, only while a single thread is running
+  static void Enable(bool enabled) { m_enabled = enabled; }
+
+};  // class CMutex
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CAutoMutex
+//
+//	@doc:
+//		Holds a mutex for the lifetime of the object
+//
+//---------------------------------------------------------------------------
+class CAutoMutex : public CStackObject {
+ private:
+  CMutex &m_mutex;
+
+ public:
+  CAutoMutex(const CAutoMutex &) = delete;
+
+  // ctor
+  explicit CAutoMutex(CMutex &mutex) : m_mutex(mutex) { m_mutex.Lock(); }
+
+  // dtor
+  ~CAutoMutex() { m_mutex.Unlock(); }
+
+};  // class CAutoMutex
+}  // namespace gpos
+
+#endif  // !GPOS_CMutex_H
+
+// EOF
@@ -0,0 +1,525 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		COpenHashtable.h
+//
+//	@doc:
+//		Growable open-addressing hashtable of client objects;
+//
+//		1)	slots hold pointers to client objects together with the hash of
+//			their key, entries are found by linear probing;
+//		2)	the slot array is only allocated on the first insert and doubles
+//			when three quarters of the slots are taken, so empty tables cost
+//			nothing and large ones keep short probe sequences;
+//		3)	expects target type to have a Key member at a fixed offset, see
+//			CSyncHashtable; several entries may share the same key;
+//		4)	entries are spread over a power of two number of shards by their
+//			hash; every shard has its own slot array and lock, so workers
+//			touching different shards do not wait for each other; the lock
+//			is only taken while helper workers are running, see CMutex;
+//---------------------------------------------------------------------------
+#ifndef GPOS_COpenHashtable_H
+#define GPOS_COpenHashtable_H
+
+#include "gpos/base.h"
+#include "gpos/common/CMutex.h"
+
+namespace gpos {
+// prototypes
+template <class T, class K>
+class COpenHashtableAccessByKey;
+
+template <class T, class K>
+class COpenHashtableIter;
+
+template <class T, class K>
+class COpenHashtableAccessByIter;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashtable<T, K>
+//
+//	@doc:
+//		Open-addressing hash table; entries are accessed through the
+//		accessor and iterator classes below, which hold the lock of the
+//		shard they work on
+//
+//---------------------------------------------------------------------------
+template <class T, class K>
+class COpenHashtable {
+  // accessor and iterator classes are friends
+  friend class COpenHashtableAccessByKey<T, K>;
+  friend class COpenHashtableIter<T, K>;
+  friend class COpenHashtableAccessByIter<T, K>;
+
+ private:
+  // slot of the table; a removed entry leaves a tombstone behind so that
+  // probe sequences running through it stay intact
+  struct SSlot {
+    // client object, nullptr if slot is empty or removed
+    T *m_value;
+
+    // hash of the object's key
+    uint32_t m_hash;
+
+    // was the slot taken before?
+    bool m_removed;
+  };
+
+  // independently locked and grown part of the table
+  struct SShard {
+    // slot array, nullptr until the first insert
+    SSlot *m_slots{nullptr};
+
+    // number of slots, always a power of two
+    uint32_t m_nslots{0};
+
+    // shift taking the slot index from the top bits of a scrambled hash
+    uint32_t m_shift{32};
+
+    // number of entries
+    uint32_t m_size{0};
+
+    // number of tombstones
+    uint32_t m_nremoved{0};
+
+    // lock protecting the shard
+    CMutex m_mutex;
+
+    // first slot of the probe sequence for the given hash; the hash is
+    // scrambled so that clients with weak hash functions do not cluster
+    uint32_t Home(uint32_t hash) const {
+      GPOS_ASSERT(0 < m_nslots);
+
+      return (hash * 2654435769U) >> m_shift;
+    }
+
+    // next slot of a probe sequence
+    uint32_t Probe(uint32_t slot) const { return (slot + 1) & (m_nslots - 1); }
+  };
+
+  // number of slots allocated on first insert
+  static const uint32_t MinSlots = 8;
+
+  // memory pool
+  CMemoryPool *m_mp{nullptr};
+
+  // the only shard of an unsharded table
+  SShard m_shard;
+
+  // shards, points to m_shard unless the table is sharded
+  SShard *m_shards{&m_shard};
+
+  // number of shards, always a power of two
+  uint32_t m_nshards{1};
+
+  // shift taking the shard index from the top bits of a scrambled hash
+  uint32_t m_shard_shift{32};
+
+  // offset of key
+  uint32_t m_key_offset{UINT32_MAX};
+
+  // pointer to hashing function
+  uint32_t (*m_hashfn)(const K &){nullptr};
+
+  // pointer to key equality function
+  bool (*m_eqfn)(const K &, const K &){nullptr};
+
+  // extract key out of type
+  K &Key(T *value) const {
+    GPOS_ASSERT(UINT32_MAX != m_key_offset && "Key offset not initialized.");
+
+    return *(K *)((uint8_t *)value + m_key_offset);
+  }
+
+  // shard holding the entries with the given hash; scrambled with another
+  // multiplier than the slot index so that a shard's entries do not share
+  // the top bits of their home slot
+  SShard &Shard(uint32_t hash) const {
+    if (1 == m_nshards) {
+      return m_shards[0];
+    }
+
+    return m_shards[(hash * 2246822519U) >> m_shard_shift];
+  }
+
+  // rebuild slot array of a shard with the given number of slots, dropping
+  // tombstones
+  void Resize(SShard &shard, uint32_t nslots) {
+    GPOS_ASSERT(shard.m_size < nslots);
+
+    SSlot *slots = GPOS_NEW_ARRAY(m_mp, SSlot, nslots);
+    for (uint32_t ul = 0; ul < nslots; ul++) {
+      slots[ul] = SSlot{nullptr, 0, false};
+    }
+
+    SSlot *old_slots = shard.m_slots;
+    uint32_t old_nslots = shard.m_nslots;
+
+    shard.m_slots = slots;
+    shard.m_nslots = nslots;
+    shard.m_shift = 32 - (uint32_t)__builtin_ctz(nslots);
+    shard.m_nremoved = 0;
+
+    // probe sequences never run through a slot that was never taken, so
+    // walking the old slots from such a slot, wrapping around the end,
+    // visits entries with equal keys in their order and reinserts them in
+    // that order; the load limit leaves at least one such slot
+    uint32_t start = 0;
+    while (start < old_nslots && (nullptr != old_slots[start].m_value || old_slots[start].m_removed)) {
+      start++;
+    }
+    GPOS_ASSERT_IMP(0 < old_nslots, start < old_nslots);
+
+    for (uint32_t ul = 0; ul < old_nslots; ul++) {
+      SSlot &old_slot = old_slots[(start + ul) & (old_nslots - 1)];
+      if (nullptr != old_slot.m_value) {
+        uint32_t slot = shard.Home(old_slot.m_hash);
+        while (nullptr != shard.m_slots[slot].m_value) {
+          slot = shard.Probe(slot);
+        }
+
+        shard.m_slots[slot] = old_slot;
+      }
+    }
+
+    GPOS_DELETE_ARRAY(old_slots);
+  }
+
+  // add entry with the given hash to its shard; entries with equal keys
+  // are kept in insertion order along the probe sequence
+  void InsertSlot(SShard &shard, T *value, uint32_t hash) {
+    if (4 * (shard.m_size + shard.m_nremoved + 1) > 3 * shard.m_nslots) {
+      // grow unless it is mostly tombstones that fill up the shard
+      uint32_t nslots = MinSlots < shard.m_nslots ? shard.m_nslots : MinSlots;
+      while (2 * (shard.m_size + 1) > nslots) {
+        nslots *= 2;
+      }
+
+      Resize(shard, nslots);
+    }
+
+    uint32_t slot = shard.Home(hash);
+    while (nullptr != shard.m_slots[slot].m_value || shard.m_slots[slot].m_removed) {
+      slot = shard.Probe(slot);
+    }
+
+    shard.m_slots[slot] = SSlot{value, hash, false};
+    shard.m_size++;
+  }
+
+  // replace entry in given slot of a shard with a tombstone
+  static void RemoveSlot(SShard &shard, uint32_t slot) {
+    GPOS_ASSERT(slot < shard.m_nslots && nullptr != shard.m_slots[slot].m_value);
+
+    shard.m_slots[slot].m_value = nullptr;
+    shard.m_slots[slot].m_removed = true;
+    shard.m_size--;
+    shard.m_nremoved++;
+  }
+
+ public:
+  COpenHashtable(const COpenHashtable<T, K> &) = delete;
+
+  // ctor
+  COpenHashtable() = default;
+
+  // dtor
+  // deallocates hashtable internals, does not destroy
+  // client objects
+  ~COpenHashtable() {
+    for (uint32_t ul = 0; ul < m_nshards; ul++) {
+      GPOS_DELETE_ARRAY(m_shards[ul].m_slots);
+    }
+
+    if (&m_shard != m_shards) {
+      GPOS_DELETE_ARRAY(m_shards);
+    }
+  }
+
+  // initialization of hashtable; slots are not allocated until the first
+  // insert into a shard, tables shared by concurrent workers are split into
+  // several shards
+  void Init(CMemoryPool *mp, uint32_t key_offset, uint32_t (*func_hash)(const K &),
+            bool (*func_equal)(const K &, const K &), uint32_t nshards = 1) {
+    GPOS_ASSERT(&m_shard == m_shards && nullptr == m_shard.m_slots);
+    GPOS_ASSERT(nullptr != func_hash);
+    GPOS_ASSERT(nullptr != func_equal);
+    GPOS_ASSERT(0 < nshards && 0 == (nshards & (nshards - 1)) && "Number of shards must be a power of two");
+
+    m_mp = mp;
+    m_key_offset = key_offset;
+    m_hashfn = func_hash;
+    m_eqfn = func_equal;
+
+    if (1 < nshards) {
+      m_shards = GPOS_NEW_ARRAY(mp, SShard, nshards);
+      m_nshards = nshards;
+      m_shard_shift = 32 - (uint32_t)__builtin_ctz(nshards);
+    }
+  }
+
+  // return number of entries
+  uintptr_t Size() const {
+    uintptr_t size = 0;
+    for (uint32_t ul = 0; ul < m_nshards; ul++) {
+      size += m_shards[ul].m_size;
+    }
+
+    return size;
+  }
+
+};  // class COpenHashtable
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashtableAccessByKey<T, K>
+//
+//	@doc:
+//		Accessor to the entries matching a given key; holds the lock of the
+//		key's shard for its lifetime
+//
+//---------------------------------------------------------------------------
+template <class T, class K>
+class COpenHashtableAccessByKey : public CStackObject {
+ private:
+  // target hashtable
+  COpenHashtable<T, K> &m_ht;
+
+  // target key
+  const K &m_key;
+
+  // hash of target key
+  uint32_t m_hash;
+
+  // shard holding the entries with target key
+  typename COpenHashtable<T, K>::SShard &m_shard;
+
+  // slot of the last entry returned, UINT32_MAX if none
+  uint32_t m_cursor;
+
+  // entry last returned
+  T *m_cursor_value;
+
+  // finds the first matching entry starting from the given slot
+  T *NextMatch(uint32_t slot) {
+    for (uint32_t ul = 0; ul < m_shard.m_nslots; ul++) {
+      typename COpenHashtable<T, K>::SSlot &s = m_shard.m_slots[slot];
+      if (nullptr == s.m_value && !s.m_removed) {
+        break;
+      }
+
+      if (nullptr != s.m_value && m_hash == s.m_hash && m_ht.m_eqfn(m_ht.Key(s.m_value), m_key)) {
+        m_cursor = slot;
+        m_cursor_value = s.m_value;
+
+        return s.m_value;
+      }
+
+      slot = m_shard.Probe(slot);
+    }
+
+    m_cursor = UINT32_MAX;
+    m_cursor_value = nullptr;
+
+    return nullptr;
+  }
+
+  // finds the slot of the given entry, UINT32_MAX if not found
+  uint32_t Locate(T *value) const {
+    uint32_t slot = m_shard.Home(m_hash);
+    for (uint32_t ul = 0; ul < m_shard.m_nslots; ul++) {
+      typename COpenHashtable<T, K>::SSlot &s = m_shard.m_slots[slot];
+      if (value == s.m_value) {
+        return slot;
+      }
+
+      if (nullptr == s.m_value && !s.m_removed) {
+        break;
+      }
+
+      slot = m_shard.Probe(slot);
+    }
+
+    return UINT32_MAX;
+  }
+
+ public:
+  COpenHashtableAccessByKey(const COpenHashtableAccessByKey<T, K> &) = delete;
+
+  // ctor
+  COpenHashtableAccessByKey(COpenHashtable<T, K> &ht, const K &key)
+      : m_ht(ht),
+        m_key(key),
+        m_hash(ht.m_hashfn(key)),
+        m_shard(ht.Shard(m_hash)),
+        m_cursor(UINT32_MAX),
+        m_cursor_value(nullptr) {
+    m_shard.m_mutex.Lock();
+  }
+
+  // dtor
+  ~COpenHashtableAccessByKey() { m_shard.m_mutex.Unlock(); }
+
+  // finds the first entry with a matching key
+  T *Find() {
+    if (0 == m_shard.m_size) {
+      return nullptr;
+    }
+
+    return NextMatch(m_shard.Home(m_hash));
+  }
+
+  // finds the next entry with a matching key after the given one; the
+  // given entry may have been returned by another accessor, or removed
+  // by this one
+  T *Next(T *value) {
+    GPOS_ASSERT(nullptr != value);
+
+    if (value != m_cursor_value) {
+      m_cursor = Locate(value);
+      if (UINT32_MAX == m_cursor) {
+        return nullptr;
+      }
+    }
+
+    return NextMatch(m_shard.Probe(m_cursor));
+  }
+
+  // insert entry with target key
+  void Insert(T *value) {
+    GPOS_ASSERT(nullptr != value);
+    GPOS_ASSERT(m_ht.m_eqfn(m_ht.Key(value), m_key));
+
+    m_ht.InsertSlot(m_shard, value, m_hash);
+
+    // slots may have moved
+    m_cursor = UINT32_MAX;
+    m_cursor_value = nullptr;
+  }
+
+  // remove entry with target key
+  void Remove(T *value) {
+    GPOS_ASSERT(nullptr != value);
+
+    if (value != m_cursor_value) {
+      m_cursor = Locate(value);
+      m_cursor_value = value;
+    }
+
+    GPOS_ASSERT(UINT32_MAX != m_cursor && "Entry not in table");
+
+    COpenHashtable<T, K>::RemoveSlot(m_shard, m_cursor);
+  }
+
+};  // class COpenHashtableAccessByKey
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashtableIter<T, K>
+//
+//	@doc:
+//		Iterator over all entries in shard and slot order; holds the lock of
+//		the shard it is in, so the slots cannot move underneath it. Entries
+//		may be removed through the iterator's accessor while iterating.
+//
+//---------------------------------------------------------------------------
+template <class T, class K>
+class COpenHashtableIter : public CStackObject {
+  // iterator accessor class is a friend
+  friend class COpenHashtableAccessByIter<T, K>;
+
+ private:
+  // target hashtable
+  COpenHashtable<T, K> &m_ht;
+
+  // current shard, its lock is held while the iterator is in it
+  uint32_t m_shard;
+
+  // current slot in current shard, UINT32_MAX before first advance
+  uint32_t m_slot;
+
+  // current shard's state
+  typename COpenHashtable<T, K>::SShard &Shard() const { return m_ht.m_shards[m_shard]; }
+
+ public:
+  COpenHashtableIter(const COpenHashtableIter<T, K> &) = delete;
+
+  // ctor
+  explicit COpenHashtableIter(COpenHashtable<T, K> &ht) : m_ht(ht), m_shard(0), m_slot(UINT32_MAX) {
+    Shard().m_mutex.Lock();
+  }
+
+  // dtor
+  ~COpenHashtableIter() {
+    if (m_shard < m_ht.m_nshards) {
+      Shard().m_mutex.Unlock();
+    }
+  }
+
+  // advances iterator to the next entry
+  bool Advance() {
+    GPOS_ASSERT(m_shard < m_ht.m_nshards && "Advancing an exhausted iterator");
+
+    while (true) {
+      for (m_slot++; m_slot < Shard().m_nslots; m_slot++) {
+        if (nullptr != Shard().m_slots[m_slot].m_value) {
+          return true;
+        }
+      }
+
+      // move on to the next shard
+      Shard().m_mutex.Unlock();
+      m_shard++;
+      m_slot = UINT32_MAX;
+      if (m_shard == m_ht.m_nshards) {
+        return false;
+      }
+
+      Shard().m_mutex.Lock();
+    }
+  }
+
+};  // class COpenHashtableIter
+
+//---------------------------------------------------------------------------
+//	@class:
+//		COpenHashtableAccessByIter<T, K>
+//
+//	@doc:
+//		Accessor to the entry at the iterator's position
+//
+//---------------------------------------------------------------------------
+template <class T, class K>
+class COpenHashtableAccessByIter : public CStackObject {
+ private:
+  // target iterator
+  COpenHashtableIter<T, K> &m_iter;
+
+ public:
+  COpenHashtableAccessByIter(const COpenHashtableAccessByIter<T, K> &) = delete;
+
+  // ctor
+  explicit COpenHashtableAccessByIter(COpenHashtableIter<T, K> &iter) : m_iter(iter) {}
+
+  // returns the entry at the iterator's position, nullptr if it was removed
+  T *Value() const {
+    GPOS_ASSERT(m_iter.m_shard < m_iter.m_ht.m_nshards && m_iter.m_slot < m_iter.Shard().m_nslots &&
+                "Iterator's advance is not called");
+
+    return m_iter.Shard().m_slots[m_iter.m_slot].m_value;
+  }
+
+  // removes the entry at the iterator's position
+  void Remove(T *value) {
+    GPOS_ASSERT(value == Value());
+
+    COpenHashtable<T, K>::RemoveSlot(m_iter.Shard(), m_iter.m_slot);
+  }
+
+};  // class COpenHashtableAccessByIter
+
+}  // namespace gpos
+
+#endif  // !GPOS_COpenHashtable_H
+
+// EOF
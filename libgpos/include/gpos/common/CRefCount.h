@@ -7,15 +7,18 @@
 //
 //	@doc:
 //		Base class for reference counting in the optimizer;
-//		Ref-counting is single-threaded only;
+//		Counts are updated atomically while helper workers are running;
 //		Enforces allocation on the heap, i.e. no deletion unless the
 //		count has really dropped to zero
 //---------------------------------------------------------------------------
 #ifndef GPOS_CRefCount_H
 #define GPOS_CRefCount_H
 
+#include <atomic>
+
 #include "gpos/assert.h"
 #include "gpos/common/CHeapObject.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/error/CException.h"
 #include "gpos/task/ITask.h"
 #include "gpos/types.h"
@@ -37,13 +40,13 @@ namespace gpos {
 class CRefCount : public CHeapObject {
  private:
   // reference counter -- first in class to be in sync with Check()
-  uintptr_t m_refs{1};
+  std::atomic<uintptr_t> m_refs{1};
 
 #ifdef GPOS_DEBUG
   // sanity check to detect deleted memory
   void Check() const {
     // assert that first member of class has not been wiped
-    GPOS_ASSERT(m_refs != GPOS_WIPED_MEM_PATTERN);
+    GPOS_ASSERT(m_refs.load(std::memory_order_relaxed) != GPOS_WIPED_MEM_PATTERN);
   }
 #endif  // GPOS_DEBUG
 
@@ -62,7 +65,7 @@ class CRefCount : public CHeapObject {
   }
 
   // return ref-count
-  uintptr_t RefCount() const { return m_refs; }
+  uintptr_t RefCount() const { return m_refs.load(std::memory_order_relaxed); }
 
   // return true if calling object's destructor is allowed
   virtual bool Deletable() const { return true; }
@@ -72,7 +75,11 @@ class CRefCount : public CHeapObject {
 #ifdef GPOS_DEBUG
     Check();
 #endif  // GPOS_DEBUG
-    m_refs++;
+    if (CMutex::IsEnabled()) {
+      m_refs.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      m_refs.store(m_refs.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
   }
 
   // count down
@@ -80,9 +87,15 @@ class CRefCount : public CHeapObject {
 #ifdef GPOS_DEBUG
     Check();
 #endif  // GPOS_DEBUG
-    m_refs--;
+    uintptr_t refs;
+    if (CMutex::IsEnabled()) {
+      refs = m_refs.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    } else {
+      refs = m_refs.load(std::memory_order_relaxed) - 1;
+      m_refs.store(refs, std::memory_order_relaxed);
+    }
 
-    if (0 == m_refs) {
+    if (0 == refs) {
       if (!Deletable()) {
         // restore ref-count
         AddRef();
@@ -15,14 +15,18 @@
 //		2)	expects target type to have SLink (see CList.h) and Key
 //			members with appopriate accessors;
 //		3)	clients must provide their own hash function;
-//		4)	hashtable is not thread-safe, despite the name;
+//		4)	buckets are locked by accessors while helper workers are
+//			running, see CMutex;
 //---------------------------------------------------------------------------
 #ifndef GPOS_CSyncHashtable_H
 #define GPOS_CSyncHashtable_H
 
+#include <atomic>
+
 #include "gpos/base.h"
 #include "gpos/common/CAutoRg.h"
 #include "gpos/common/CList.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/task/CAutoSuspendAbort.h"
 
 namespace gpos {
@@ -72,6 +76,9 @@ class CSyncHashtable {
     // hash chain
     CList<T> m_chain;
 
+    // lock protecting the chain
+    CMutex m_mutex;
+
 #ifdef GPOS_DEBUG
     // bucket number
     uint32_t m_bucket_idx;
@@ -85,7 +92,7 @@ class CSyncHashtable {
   uint32_t m_nbuckets{0};
 
   // number of ht entries
-  uintptr_t m_size{0};
+  std::atomic<uintptr_t> m_size{0};
 
   // offset of key
   uint32_t m_key_offset{UINT32_MAX};
@@ -221,6 +228,7 @@ class CSyncHashtable {
 
     // determine target bucket
     SBucket &bucket = GetBucket(GetBucketIndex(key));
+    CAutoMutex am(bucket.m_mutex);
 
     // inserting at bucket's head is required by hashtable iteration
     bucket.m_chain.Prepend(value);
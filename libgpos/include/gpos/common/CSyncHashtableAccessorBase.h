@@ -44,10 +44,12 @@ class CSyncHashtableAccessorBase : public CStackObject {
  protected:
   // ctor - protected to restrict instantiation to children
   CSyncHashtableAccessorBase(CSyncHashtable<T, K> &ht, uint32_t bucket_idx)
-      : m_ht(ht), m_bucket(m_ht.GetBucket(bucket_idx)) {}
+      : m_ht(ht), m_bucket(m_ht.GetBucket(bucket_idx)) {
+    m_bucket.m_mutex.Lock();
+  }
 
   // dtor
-  virtual ~CSyncHashtableAccessorBase() = default;
+  virtual ~CSyncHashtableAccessorBase() { m_bucket.m_mutex.Unlock(); }
 
   // accessor to hashtable
   CSyncHashtable<T, K> &GetHashTable() const { return m_ht; }
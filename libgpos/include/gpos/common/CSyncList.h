@@ -6,7 +6,8 @@
 //		CSyncList.h
 //
 //	@doc:
-//		Template-based synchronized list class - no longer thread-safe
+//		Template-based synchronized list class; push and pop are locked
+//		while helper workers are running
 //
 //		It requires that the elements are only inserted once, as their address
 //		is used for identification;
@@ -19,6 +20,7 @@
 #define GPOS_CSyncList_H
 
 #include "gpos/common/CList.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/types.h"
 
 namespace gpos {
@@ -37,6 +39,9 @@ class CSyncList {
   // underlying list
   CList<T> m_list;
 
+  // lock protecting the list
+  CMutex m_mutex;
+
  public:
   CSyncList(const CSyncList &) = delete;
 
@@ -50,10 +55,14 @@ class CSyncList {
   void Init(uint32_t offset) { m_list.Init(offset); }
 
   // insert element at the head of the list;
-  void Push(T *elem) { m_list.Prepend(elem); }
+  void Push(T *elem) {
+    CAutoMutex am(m_mutex);
+    m_list.Prepend(elem);
+  }
 
   // remove element from the head of the list;
   T *Pop() {
+    CAutoMutex am(m_mutex);
     if (!m_list.IsEmpty()) {
       return m_list.RemoveHead();
     }
@@ -21,6 +21,7 @@
 #define GPOS_CSyncPool_H
 
 #include "gpos/common/CAutoP.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/task/ITask.h"
 #include "gpos/types.h"
 #include "gpos/utils.h"
@@ -34,7 +35,8 @@ namespace gpos {
 //		CSyncPool<class T>
 //
 //	@doc:
-//		Object pool class (not thread-safe, despite the name)
+//		Object pool class; retrieval and recycling are locked while
+//		helper workers are running
 //
 //---------------------------------------------------------------------------
 template <class T>
@@ -64,6 +66,9 @@ class CSyncPool {
   // offset of id inside the object
   uint32_t m_id_offset;
 
+  // lock protecting the bitmaps and the clock index
+  CMutex m_mutex;
+
   // atomically set bit if it is unset
   bool SetBit(uint32_t *dest, uint32_t bit_val) {
     GPOS_ASSERT(nullptr != dest);
@@ -177,6 +182,8 @@ class CSyncPool {
   T *PtRetrieve() {
     GPOS_ASSERT(UINT32_MAX != m_id_offset && "Id offset not initialized.");
 
+    CAutoMutex am(m_mutex);
+
     // iterate over all objects twice (two full clock rotations);
     // objects marked as recycled cannot be reserved on the first round;
     for (uint32_t i = 0; i < 2 * m_numobjs; i++) {
@@ -240,6 +247,8 @@ class CSyncPool {
     uint32_t bit_offset = offset % BITS_PER_ULONG;
     uint32_t bit_val = 1 << bit_offset;
 
+    CAutoMutex am(m_mutex);
+
 #ifdef GPOS_DEBUG
     uint32_t reserved = m_objs_reserved[elem_offset];
     GPOS_ASSERT((bit_val == (bit_val & reserved)) && "Object is not reserved");
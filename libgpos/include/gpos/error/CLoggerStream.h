@@ -29,18 +29,23 @@ class CLoggerStream : public CLogger {
   // log stream
   IOstream &m_os;
 
+  // maximum number of characters of trace messages to write, 0 for no limit
+  uint32_t m_max_trace_length;
+
+  // number of characters of trace messages written so far
+  uint32_t m_trace_length{0};
+
+  // were trace messages dropped because of the limit
+  bool m_trace_truncated{false};
+
   // write string to stream
-  void Write(const wchar_t *log_entry,
-             uint32_t  // severity
-             ) override {
-    m_os = m_os << log_entry;
-  }
+  void Write(const wchar_t *log_entry, uint32_t severity) override;
 
  public:
   CLoggerStream(const CLoggerStream &) = delete;
 
   // ctor
-  CLoggerStream(IOstream &os);
+  CLoggerStream(IOstream &os, uint32_t max_trace_length = 0);
 
   // dtor
   ~CLoggerStream() override;
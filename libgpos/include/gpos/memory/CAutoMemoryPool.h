@@ -58,7 +58,8 @@ class CAutoMemoryPool : public CStackObject {
   CAutoMemoryPool(const CAutoMemoryPool &) = delete;
 
   // ctor
-  CAutoMemoryPool(ELeakCheck leak_check_type = ElcExc);
+  CAutoMemoryPool(ELeakCheck leak_check_type = ElcExc,
+                  CMemoryPoolManager::EPoolKind pool_kind = CMemoryPoolManager::EpkDefault);
 
   // FIXME: should mark this noexcept in non-assert builds
   // dtor
@@ -19,6 +19,7 @@
 #include "gpos/base.h"
 #include "gpos/common/CAutoTimer.h"
 #include "gpos/common/CList.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/common/CSyncHashtable.h"
 #include "gpos/common/CSyncHashtableAccessByIter.h"
 #include "gpos/common/CSyncHashtableAccessByKey.h"
@@ -74,6 +75,9 @@ class CCache {
   using HashFuncPtr = uint32_t (*)(const K &);
   using EqualFuncPtr = bool (*)(const K &, const K &);
 
+  // type definition of predicate selecting entries for targeted eviction
+  using MatchFuncPtr = bool (*)(const K &, T, void *);
+
  private:
   using CCacheHashTableEntry = CCacheEntry<T, K>;
 
@@ -119,10 +123,15 @@ class CCache {
   // the clock hand for gclock eviction policy
   CCacheHashtableIter *m_clock_hand;
 
+  // protects the cache size and the clock hand; taken before any bucket
+  CMutex m_mutex;
+
   // inserts a new object
   CCacheHashTableEntry *InsertEntry(CCacheHashTableEntry *entry) {
     GPOS_ASSERT(nullptr != entry);
 
+    CAutoMutex am(m_mutex);
+
     if (0 != m_cache_quota && m_cache_size > m_cache_quota) {
       EvictEntries();
     }
@@ -193,6 +202,7 @@ class CCache {
 
   // returns the first object matching the given key
   CCacheHashTableEntry *Get(const K key) {
+    CAutoMutex am(m_mutex);
     CCacheHashtableAccessor acc(m_hash_table, key);
 
     // look for the first unmarked entry matching the given key
@@ -223,6 +233,8 @@ class CCache {
 
     // scope for hashtable accessor
     {
+      CAutoMutex am(m_mutex);
+
       // Extend the lifetime of temporary with a const ref
       // See comments in InsertEntry
       const K &key = entry->Key();
@@ -233,6 +245,7 @@ class CCache {
         // remove entry from hash table
         acc.Remove(entry);
         deleted = true;
+        m_cache_size -= entry->Pmp()->TotalAllocatedSize();
       }
     }
 
@@ -248,6 +261,7 @@ class CCache {
 
     CCacheHashTableEntry *current = entry;
     K key = current->Key();
+    CAutoMutex am(m_mutex);
     CCacheHashtableAccessor acc(m_hash_table, key);
 
     // move forward until we find unmarked entry with the same key
@@ -429,6 +443,67 @@ class CCache {
   // return eviction factor (what percentage of cache size to evict)
   float GetEvictionFactor() { return m_eviction_factor; }
 
+  // return number of entries currently pinned by an accessor
+  uint64_t PinnedEntries() {
+    uint64_t num_pinned = 0;
+
+    CCacheHashtableIter iter(m_hash_table);
+    while (iter.Advance()) {
+      CCacheHashtableIterAccessor acc(iter);
+
+      CCacheHashTableEntry *entry = acc.Value();
+      if (nullptr != entry && EXPECTED_REF_COUNT_FOR_DELETE < entry->RefCount()) {
+        num_pinned++;
+      }
+    }
+
+    return num_pinned;
+  }
+
+  // Evict all entries accepted by the given predicate regardless of their
+  // gclock counter. Entries still pinned by an accessor are marked for
+  // deletion and freed once their last reference is released. Returns the
+  // number of evicted entries.
+  uint64_t EvictMatching(MatchFuncPtr match_func, void *arg) {
+    GPOS_ASSERT(nullptr != match_func);
+
+    CAutoMutex am(m_mutex);
+
+    uint64_t num_evicted = 0;
+    bool advanced = false;
+
+    CCacheHashtableIter iter(m_hash_table);
+    while (advanced || iter.Advance()) {
+      advanced = false;
+      CCacheHashTableEntry *entry = nullptr;
+      bool deleted = false;
+      // Scope for CCacheHashtableIterAccessor
+      {
+        CCacheHashtableIterAccessor acc(iter);
+
+        entry = acc.Value();
+        if (nullptr != entry && !entry->IsMarkedForDeletion() && match_func(entry->Key(), entry->Val(), arg)) {
+          num_evicted++;
+          if (EXPECTED_REF_COUNT_FOR_DELETE == entry->RefCount()) {
+            // successfully removing an entry automatically advances the iterator
+            acc.Remove(entry);
+            deleted = true;
+            advanced = true;
+            m_cache_size -= entry->Pmp()->TotalAllocatedSize();
+          } else {
+            entry->MarkForDeletion();
+          }
+        }
+      }
+
+      if (deleted) {
+        DestroyCacheEntry(entry);
+      }
+    }
+
+    return num_evicted;
+  }
+
 };  //  CCache
 
 // invalid key
@@ -95,6 +95,23 @@ class CMemoryPool {
  public:
   enum EAllocationType { EatUnknown = 0x00, EatSingleton = 0x7f, EatArray = 0x7e };
 
+  // kind of pool owning an allocation
+  enum EAllocationOwner : uint32_t { EaoTracker = 0x7ac4e401, EaoArena = 0xa4e4a401, EaoPalloc = 0x9a11c401 };
+
+  // Trailing part of the header of every allocation, placed right in front of
+  // the user data, so that an allocation can be freed without knowing the
+  // type of the pool it came from
+  struct SAllocTrailer {
+    // user requested size
+    uint32_t m_user_size;
+
+    // kind of pool owning the allocation
+    uint32_t m_owner;
+  };
+
+  // trailer of the given allocation
+  static const SAllocTrailer *Trailer(const void *ptr) { return static_cast<const SAllocTrailer *>(ptr) - 1; }
+
   CMemoryPool()
       // MAX LONG is invalid hash key, so skip that hash value.
       : m_distribution(0, std::numeric_limits<uint32_t>::max() - 1), m_hash_key(m_distribution(m_generator)) {}
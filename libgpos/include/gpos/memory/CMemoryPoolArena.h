@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CMemoryPoolArena.h
+//
+//	@doc:
+//		Memory pool that bump-allocates from large chunks and releases
+//		all of them at once when the pool is destroyed
+//
+//---------------------------------------------------------------------------
+#ifndef GPOS_CMemoryPoolArena_H
+#define GPOS_CMemoryPoolArena_H
+
+#include "gpos/assert.h"
+#include "gpos/common/CMutex.h"
+#include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolStatistics.h"
+#include "gpos/types.h"
+
+// allocations up to this size are recycled through free lists
+#define GPOS_MEM_ARENA_MAX_RECYCLED_SIZE (512)
+
+namespace gpos {
+//---------------------------------------------------------------------------
+//	@class:
+//		CMemoryPoolArena
+//
+//	@doc:
+//		Arena memory pool. Allocations carry a small header only and are
+//		carved out of chunks obtained from malloc(). Freed small blocks are
+//		kept on per-size free lists for reuse, everything else is reclaimed
+//		when the pool is torn down. Does not support live object walks, so
+//		leak checking is not available for arena pools.
+//
+//---------------------------------------------------------------------------
+class CMemoryPoolArena : public CMemoryPool {
+ private:
+  // header of every allocation, ends with the trailer shared by all pools
+  struct SAllocHeader {
+    // pointer to pool
+    CMemoryPoolArena *m_mp;
+
+    // user requested size and owner tag
+    SAllocTrailer m_trailer;
+  };
+
+  // header of a chunk, followed by the chunk's usable memory
+  struct SChunk {
+    // next chunk of the pool
+    SChunk *m_next;
+
+    // usable size in bytes
+    uint64_t m_size;
+  };
+
+  // free block on a free list
+  struct SFreeBlock {
+    SFreeBlock *m_next;
+  };
+
+  // number of free lists, one per aligned size
+  static const uint32_t m_num_free_lists = GPOS_MEM_ARENA_MAX_RECYCLED_SIZE / GPOS_MEM_ARCH + 1;
+
+  // statistics
+  CMemoryPoolStatistics m_memory_pool_statistics;
+
+  // chunks allocated so far, most recent first
+  SChunk *m_chunks{nullptr};
+
+  // bump pointer and end of the current chunk
+  uint8_t *m_cursor{nullptr};
+  uint8_t *m_limit{nullptr};
+
+  // size of the next chunk to allocate
+  uint64_t m_next_chunk_size;
+
+  // total size of all chunks
+  uint64_t m_total_chunk_size{0};
+
+  // recycled blocks, indexed by aligned user size
+  SFreeBlock *m_free_lists[m_num_free_lists];
+
+  // protects the chunks, the cursor and the free lists
+  CMutex m_mutex;
+
+  // allocate a new chunk with at least the given usable size
+  SChunk *NewChunk(uint64_t size);
+
+  // record a free and recycle the block if possible
+  void Free(SAllocHeader *header);
+
+ protected:
+  // dtor
+  ~CMemoryPoolArena() override;
+
+ public:
+  CMemoryPoolArena(CMemoryPoolArena &) = delete;
+
+  // ctor
+  CMemoryPoolArena();
+
+  // prepare the memory pool to be deleted
+  void TearDown() override;
+
+  // allocate memory
+  void *NewImpl(const uint32_t bytes, const char *file, const uint32_t line, CMemoryPool::EAllocationType eat) override;
+
+  // free memory allocation
+  static void DeleteImpl(void *ptr, EAllocationType eat);
+
+  // get user requested size of allocation
+  static uint32_t UserSizeOfAlloc(const void *ptr);
+
+  // was the allocation made from an arena pool?
+  static bool IsArenaAllocation(const void *ptr) { return EaoArena == Trailer(ptr)->m_owner; }
+
+  // return total allocated size
+  uint64_t TotalAllocatedSize() const override { return m_memory_pool_statistics.TotalAllocatedSize(); }
+
+  // return total size of the chunks held by the pool
+  uint64_t TotalChunkSize() const { return m_total_chunk_size; }
+
+  // statistics accessor
+  const CMemoryPoolStatistics &Statistics() const { return m_memory_pool_statistics; }
+};
+}  // namespace gpos
+
+#endif  // !GPOS_CMemoryPoolArena_H
+
+// EOF
@@ -98,8 +98,14 @@ class CMemoryPoolManager {
  public:
   CMemoryPoolManager(const CMemoryPoolManager &) = delete;
 
+  // kind of memory pool to create
+  enum EPoolKind {
+    EpkDefault,  // pool type handled by the manager
+    EpkArena     // bump allocating pool, see CMemoryPoolArena
+  };
+
   // create new memory pool
-  static CMemoryPool *CreateMemoryPool();
+  static CMemoryPool *CreateMemoryPool(EPoolKind kind = EpkDefault);
 
   // release memory pool
   static void Destroy(CMemoryPool *);
@@ -20,6 +20,7 @@
 
 #include "gpos/assert.h"
 #include "gpos/common/CList.h"
+#include "gpos/common/CMutex.h"
 #include "gpos/common/CStackDescriptor.h"
 #include "gpos/memory/CMemoryPool.h"
 #include "gpos/memory/CMemoryPoolStatistics.h"
@@ -32,16 +33,11 @@ class CMemoryPoolTracker : public CMemoryPool {
  private:
   // Defines memory block header layout for all allocations;
   // does not include the pointer to the pool;
+  // the user size and the owner tag must come last, see CMemoryPool::SAllocTrailer
   struct SAllocHeader {
     // pointer to pool
     CMemoryPoolTracker *m_mp;
 
-    // total allocation size (including headers)
-    uint32_t m_alloc_size;
-
-    // user requested size
-    uint32_t m_user_size;
-
     // sequence number
     uint64_t m_serial;
 
@@ -51,6 +47,9 @@ class CMemoryPoolTracker : public CMemoryPool {
     // line in file
     uint32_t m_line;
 
+    // total allocation size (including headers)
+    uint32_t m_alloc_size;
+
 #ifdef GPOS_DEBUG
     // allocation stack
     CStackDescriptor m_stack_desc;
@@ -58,6 +57,12 @@ class CMemoryPoolTracker : public CMemoryPool {
 
     // link for allocation list
     SLink m_link;
+
+    // user requested size
+    uint32_t m_user_size;
+
+    // kind of pool owning the allocation
+    uint32_t m_owner;
   };
 
   // statistics
@@ -69,6 +74,9 @@ class CMemoryPoolTracker : public CMemoryPool {
   // list of allocated (live) objects
   CList<SAllocHeader> m_allocations_list;
 
+  // protects the statistics and the allocation list
+  CMutex m_mutex;
+
   // record a successful allocation
   void RecordAllocation(SAllocHeader *header);
 
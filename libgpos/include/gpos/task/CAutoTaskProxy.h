@@ -77,6 +77,10 @@ class CAutoTaskProxy : CStackObject {
   // execute task in thread owning ATP (synchronous execution)
   void Execute(CTask *task) const;
 
+  // execute scheduled tasks on helper workers and wait until all of them
+  // have finished; the error of the first failed task is propagated
+  void ExecuteScheduled();
+
   // cancel task
   void Cancel(CTask *task);
 
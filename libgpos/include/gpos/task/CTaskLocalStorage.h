@@ -16,7 +16,6 @@
 #define GPOS_CTaskLocalStorage_H
 
 #include "gpos/base.h"
-#include "gpos/common/CSyncHashtable.h"
 
 namespace gpos {
 // fwd declaration
@@ -28,7 +27,9 @@ class CTaskLocalStorageObject;
 //
 //	@doc:
 //		TLS implementation; single instance of this class per task; initialized
-//		and destroyed during task setup/tear down
+//		and destroyed during task setup/tear down. Objects are kept in one
+//		slot per index; a helper task may share the objects of the task that
+//		spawned it, see Inherit().
 //
 //---------------------------------------------------------------------------
 class CTaskLocalStorage {
@@ -38,13 +39,12 @@ class CTaskLocalStorage {
   enum Etlsidx {
     EtlsidxTest,     // unittest slot
     EtlsidxOptCtxt,  // optimizer context
-    EtlsidxInvalid,  // used only for hashtable iteration
 
     EtlsidxSentinel
   };
 
   // ctor
-  CTaskLocalStorage() = default;
+  CTaskLocalStorage();
 
   // dtor
   ~CTaskLocalStorage();
@@ -59,23 +59,13 @@ class CTaskLocalStorage {
   // delete object
   void Remove(CTaskLocalStorageObject *);
 
-  // equality function -- used for hashtable
-  static bool Equals(const CTaskLocalStorage::Etlsidx &idx, const CTaskLocalStorage::Etlsidx &idx_other) {
-    return idx == idx_other;
-  }
-
-  // hash function
-  static uint32_t HashIdx(const CTaskLocalStorage::Etlsidx &idx) {
-    // keys are unique
-    return static_cast<uint32_t>(idx);
-  }
-
-  // invalid Etlsidx
-  static const Etlsidx m_invalid_idx;
+  // share the objects stored by another task; the other task keeps
+  // ownership and must outlive this one
+  void Inherit(const CTaskLocalStorage &tls);
 
  private:
-  // hash table
-  CSyncHashtable<CTaskLocalStorageObject, Etlsidx> m_hash_table;
+  // stored objects, indexed by slot
+  CTaskLocalStorageObject *m_objects[EtlsidxSentinel];
 
 };  // class CTaskLocalStorage
 }  // namespace gpos
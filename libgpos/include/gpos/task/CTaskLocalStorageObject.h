@@ -20,8 +20,7 @@ namespace gpos {
 //		CTaskLocalStorageObject
 //
 //	@doc:
-//		Abstract TLS object base class; provides hooks for hash table, key, and
-//		hash function;
+//		Abstract TLS object base class; provides the slot index of the object;
 //
 //---------------------------------------------------------------------------
 class CTaskLocalStorageObject {
@@ -40,9 +39,6 @@ class CTaskLocalStorageObject {
   // accessor
   const CTaskLocalStorage::Etlsidx &idx() const { return m_etlsidx; }
 
-  // link
-  SLink m_link;
-
   // key
   const CTaskLocalStorage::Etlsidx m_etlsidx;
 
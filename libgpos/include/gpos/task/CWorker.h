@@ -33,6 +33,7 @@ class CTask;
 
 class CWorker : public IWorker {
   friend class CAutoTaskProxy;
+  friend class CWorkerPoolManager;
 
  private:
   // current task
@@ -44,6 +45,9 @@ class CWorker : public IWorker {
   // start address of current thread's stack
   const uintptr_t m_stack_start;
 
+  // is this a helper of the main worker?
+  const bool m_is_helper;
+
   // execute single task
   void Execute(CTask *task);
 
@@ -54,7 +58,7 @@ class CWorker : public IWorker {
   CWorker(const CWorker &) = delete;
 
   // ctor
-  CWorker(uint32_t stack_size, uintptr_t stack_start);
+  CWorker(uint32_t stack_size, uintptr_t stack_start, bool is_helper = false);
 
   // dtor
   ~CWorker() override;
@@ -68,6 +72,9 @@ class CWorker : public IWorker {
   // accessor
   inline CTask *GetTask() override { return m_task; }
 
+  // is this a helper of the main worker?
+  bool IsHelper() const { return m_is_helper; }
+
   // slink for hashtable
   SLink m_link;
 
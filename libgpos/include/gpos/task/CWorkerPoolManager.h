@@ -10,10 +10,14 @@
 //		* maintains worker local storage
 //		* hosts task scheduler
 //		* assigns tasks to workers
+//		* runs scheduled tasks on helper threads
 //-----------------------------------------------------------------------------
 #ifndef GPOS_CWorkerPoolManager_H
 #define GPOS_CWorkerPoolManager_H
 
+#include <condition_variable>
+#include <mutex>
+
 #include "gpos/base.h"
 #include "gpos/common/CSyncHashtable.h"
 #include "gpos/common/CSyncHashtableAccessByKey.h"
@@ -35,12 +39,37 @@ namespace gpos {
 //		maintains WLS (worker local storage);
 //		assigns tasks to workers;
 //
+//		The worker owning the host backend is the main worker. Scheduled
+//		tasks run on helper workers, one thread each, while the main worker
+//		waits for them; helpers must not enter the host system themselves
+//		and forward such calls to the main worker, see ExecuteOnMainWorker.
+//
 //------------------------------------------------------------------------
 class CWorkerPoolManager {
   friend class CWorker;
   friend class CAutoTaskProxy;
 
  private:
+  // call forwarded by a helper worker to the main worker
+  struct SRequest {
+    // function and argument
+    void *(*m_func)(void *);
+    void *m_arg;
+
+    // result
+    void *m_res;
+
+    // error context of the requesting task
+    IErrorContext *m_err_ctxt;
+
+    // has the call been executed, did it raise
+    bool m_done;
+    bool m_failed;
+
+    // link for request list
+    SLink m_link;
+  };
+
   // response to worker scheduling request
   enum EScheduleResponse {
     EsrExecTask,   // run assigned task
@@ -59,9 +88,28 @@ class CWorkerPoolManager {
   // active flag
   bool m_active;
 
-  // we only support a single worker now
+  // main worker
   CWorker *m_single_worker;
 
+  // helper worker of the current thread
+  static thread_local CWorker *m_helper_worker;
+
+  // are helper workers running?
+  bool m_concurrent;
+
+  // protects the request list and signals requests and finished helpers
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+
+  // requests waiting for the main worker
+  CList<SRequest> m_requests;
+
+  // number of helpers still running
+  uint32_t m_running_helpers;
+
+  // has a helper finished with an error?
+  bool m_helper_failed;
+
   // task storage
   CSyncHashtable<CTask, CTaskId> m_shtTS;
 
@@ -81,6 +129,15 @@ class CWorkerPoolManager {
     m_auto_task_proxy_counter--;
   }
 
+  // run all scheduled tasks on helper workers and wait for them
+  void ExecuteScheduled();
+
+  // execute requests forwarded by helpers
+  void ServeRequests(std::unique_lock<std::mutex> &lock);
+
+  // entry point of helper threads
+  static void RunHelper(CTask *task);
+
   // insert task in table
   void RegisterTask(CTask *task);
 
@@ -111,7 +168,12 @@ class CWorkerPoolManager {
   CWorkerPoolManager(const CWorkerPoolManager &) = delete;
 
   // lookup own worker
-  inline CWorker *Self() { return m_single_worker; }
+  inline CWorker *Self() {
+    if (m_concurrent && nullptr != m_helper_worker) {
+      return m_helper_worker;
+    }
+    return m_single_worker;
+  }
 
   // dtor
   ~CWorkerPoolManager() { GPOS_ASSERT(nullptr == m_worker_pool_manager && "Worker pool has not been shut down"); }
@@ -128,6 +190,14 @@ class CWorkerPoolManager {
   // cancel task by task id
   void Cancel(CTaskId tid);
 
+  // execute function on the main worker; called by helper workers for
+  // anything that may enter the host system
+  static void *ExecuteOnMainWorker(void *(*func)(void *), void *arg);
+
+  // host system callback running a forwarded call on the main worker; it
+  // turns the errors of the host system into exceptions
+  static void *(*host_call)(void *(*func)(void *), void *arg);
+
 };  // class CWorkerPoolManager
 
 }  // namespace gpos
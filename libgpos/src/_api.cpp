@@ -19,7 +19,7 @@
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/memory/CCacheFactory.h"
-#include "gpos/string/CWStringStatic.h"
+#include "gpos/string/CWString.h"
 #include "gpos/task/CAutoTaskProxy.h"
 #include "gpos/task/CWorkerPoolManager.h"
 #include "naucrates/exception.h"
@@ -89,6 +89,7 @@ bool IsLoggableFailure(gpos::CException &exc) {
 //---------------------------------------------------------------------------
 void gpos_init(struct gpos_init_params *params) {
   CWorker::abort_requested_by_system = params->abort_requested;
+  CWorkerPoolManager::host_call = params->host_call;
 
   CMemoryPoolManager::Init();
   CWorkerPoolManager::Init();
@@ -155,18 +156,13 @@ int gpos_exec(gpos_exec_params *params) {
         // init TLS
         ptsk->GetTls().Reset(mp);
 
-        CAutoP<CWStringStatic> apwstr;
         CAutoP<COstreamString> aposs;
         CAutoP<CLoggerStream> aplogger;
 
-        // use passed buffer for logging
-        if (nullptr != params->error_buffer) {
-          GPOS_ASSERT(0 < params->error_buffer_size);
-
-          apwstr = GPOS_NEW(mp)
-              CWStringStatic((wchar_t *)params->error_buffer, params->error_buffer_size / GPOS_SIZEOF(wchar_t));
-          aposs = GPOS_NEW(mp) COstreamString(apwstr.Value());
-          aplogger = GPOS_NEW(mp) CLoggerStream(*aposs.Value());
+        // use passed string for logging
+        if (nullptr != params->error_string) {
+          aposs = GPOS_NEW(mp) COstreamString(static_cast<CWString *>(params->error_string));
+          aplogger = GPOS_NEW(mp) CLoggerStream(*aposs.Value(), params->max_trace_size);
 
           CTaskContext *ptskctxt = ptsk->GetTaskCtxt();
           ptskctxt->SetLogOut(aplogger.Value());
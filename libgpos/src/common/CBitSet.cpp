@@ -8,14 +8,14 @@
 //	@doc:
 //		Implementation of bit sets
 //
-//		Underlying assumption: a set contains only a few links of bitvectors
-//		hence, keeping them in a linked list is efficient;
+//		Underlying assumption: most sets hold column or component ids that
+//		are small and dense, hence a flat array of words is cheaper than any
+//		sparse representation; set algebra is a single pass over the words
 //---------------------------------------------------------------------------
 
 #include "gpos/common/CBitSet.h"
 
 #include "gpos/base.h"
-#include "gpos/common/CAutoRef.h"
 #include "gpos/common/CBitSetIter.h"
 
 #ifdef GPOS_DEBUG
@@ -26,77 +26,51 @@ using namespace gpos;
 
 //---------------------------------------------------------------------------
 //	@function:
-//		CBitSetLink
+//		CBitSet::EnsureCapacity
 //
 //	@doc:
-//		ctor
+//		Make room for at least the given number of words; capacity at least
+//		doubles so that sets built bit by bit grow in few steps
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, uint32_t offset, uint32_t vector_size) : m_offset(offset) {
-  m_vec = GPOS_NEW(mp) CBitVector(mp, vector_size);
-}
+void CBitSet::EnsureCapacity(uint32_t num_words) {
+  if (num_words <= m_capacity) {
+    return;
+  }
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSetLink
-//
-//	@doc:
-//		copy ctor
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink::CBitSetLink(CMemoryPool *mp, const CBitSetLink &bsl) : m_offset(bsl.m_offset) {
-  m_vec = GPOS_NEW(mp) CBitVector(mp, *bsl.GetVec());
+  uint32_t capacity = std::max(num_words, 2 * m_capacity);
+  Word *words = GPOS_NEW_ARRAY(m_mp, Word, capacity);
+
+  for (uint32_t ul = 0; ul < m_capacity; ul++) {
+    words[ul] = m_words[ul];
+  }
+  for (uint32_t ul = m_capacity; ul < capacity; ul++) {
+    words[ul] = 0;
+  }
+
+  if (m_words != m_inline_words) {
+    GPOS_DELETE_ARRAY(m_words);
+  }
+
+  m_words = words;
+  m_capacity = capacity;
 }
 
 //---------------------------------------------------------------------------
 //	@function:
-//		~CBitSetLink
+//		CBitSet::UsedWords
 //
 //	@doc:
-//		ctor
+//		Number of words up to and including the highest non-zero one
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSetLink::~CBitSetLink() {
-  GPOS_DELETE(m_vec);
-}
-
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::FindLinkByOffset
-//
-//	@doc:
-//		Find bit set link for a given offset; if non-existent return previous
-//		link (may be NULL);
-//		By providing a starting link we can implement a number of operations
-//		in one sweep, ie O(N)
-//
-//---------------------------------------------------------------------------
-CBitSet::CBitSetLink *CBitSet::FindLinkByOffset(uint32_t offset, CBitSetLink *bsl) const {
-  CBitSetLink *found = nullptr;
-  CBitSetLink *cursor = bsl;
-
-  if (nullptr == bsl) {
-    // if no cursor provided start with first element
-    cursor = m_bsllist.First();
-  } else {
-    GPOS_ASSERT(bsl->GetOffset() <= offset && "invalid start cursor");
-    found = bsl;
-  }
-
-  GPOS_ASSERT_IMP(nullptr != cursor, GPOS_OK == m_bsllist.Find(cursor) && "cursor not in list");
-
-  while (true) {
-    // no more links or we've overshot the target
-    if (nullptr == cursor || cursor->GetOffset() > offset) {
-      break;
-    }
-
-    found = cursor;
-    cursor = m_bsllist.Next(cursor);
+uint32_t CBitSet::UsedWords() const {
+  uint32_t used = m_capacity;
+  while (0 < used && 0 == m_words[used - 1]) {
+    used--;
   }
 
-  GPOS_ASSERT_IMP(found, found->GetOffset() <= offset);
-  return found;
+  return used;
 }
 
 //---------------------------------------------------------------------------
@@ -104,16 +78,17 @@ CBitSet::CBitSetLink *CBitSet::FindLinkByOffset(uint32_t offset, CBitSetLink *bs
 //		CBitSet::RecomputeSize
 //
 //	@doc:
-//		Compute size of set by adding up sizes of links
+//		Compute size of set by counting the bits of all words; invalidates
+//		the cached hash value as every caller has modified the set
 //
 //---------------------------------------------------------------------------
 void CBitSet::RecomputeSize() {
   m_size = 0;
-  CBitSetLink *bsl = nullptr;
-
-  for (bsl = m_bsllist.First(); bsl != nullptr; bsl = m_bsllist.Next(bsl)) {
-    m_size += bsl->GetVec()->CountSetBits();
+  for (uint32_t ul = 0; ul < m_capacity; ul++) {
+    m_size += (uint32_t)__builtin_popcountll(m_words[ul]);
   }
+
+  m_hash_valid.store(false, std::memory_order_relaxed);
 }
 
 //---------------------------------------------------------------------------
@@ -121,35 +96,23 @@ void CBitSet::RecomputeSize() {
 //		CBitSet::Clear
 //
 //	@doc:
-//		release all links
+//		release all words
 //
 //---------------------------------------------------------------------------
 void CBitSet::Clear() {
-  CBitSetLink *bsl = nullptr;
-
-  while (nullptr != (bsl = m_bsllist.First())) {
-    CBitSetLink *bsl_to_remove = bsl;
-    bsl = m_bsllist.Next(bsl);
+  if (m_words != m_inline_words) {
+    GPOS_DELETE_ARRAY(m_words);
+  }
 
-    m_bsllist.Remove(bsl_to_remove);
-    GPOS_DELETE(bsl_to_remove);
+  m_words = m_inline_words;
+  m_capacity = InlineWords;
+  for (uint32_t ul = 0; ul < InlineWords; ul++) {
+    m_inline_words[ul] = 0;
   }
 
   RecomputeSize();
 }
 
-//---------------------------------------------------------------------------
-//	@function:
-//		CBitSet::GetOffset
-//
-//	@doc:
-//		Compute offset
-//
-//---------------------------------------------------------------------------
-uint32_t CBitSet::ComputeOffset(uint32_t ul) const {
-  return (ul / m_vector_size) * m_vector_size;
-}
-
 //---------------------------------------------------------------------------
 //	@function:
 //		CBitSet::CBitSet
@@ -158,8 +121,11 @@ uint32_t CBitSet::ComputeOffset(uint32_t ul) const {
 //		ctor
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSet(CMemoryPool *mp, uint32_t vector_size) : m_mp(mp), m_vector_size(vector_size), m_size(0) {
-  m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
+CBitSet::CBitSet(CMemoryPool *mp, uint32_t)
+    : m_mp(mp), m_words(m_inline_words), m_capacity(InlineWords), m_size(0), m_hash(0), m_hash_valid(false) {
+  for (uint32_t ul = 0; ul < InlineWords; ul++) {
+    m_inline_words[ul] = 0;
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -170,8 +136,12 @@ CBitSet::CBitSet(CMemoryPool *mp, uint32_t vector_size) : m_mp(mp), m_vector_siz
 //		copy ctor;
 //
 //---------------------------------------------------------------------------
-CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs) : m_mp(mp), m_vector_size(bs.m_vector_size), m_size(0) {
-  m_bsllist.Init(GPOS_OFFSET(CBitSetLink, m_link));
+CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs)
+    : m_mp(mp), m_words(m_inline_words), m_capacity(InlineWords), m_size(0), m_hash(0), m_hash_valid(false) {
+  for (uint32_t ul = 0; ul < InlineWords; ul++) {
+    m_inline_words[ul] = 0;
+  }
+
   Union(&bs);
 }
 
@@ -184,7 +154,9 @@ CBitSet::CBitSet(CMemoryPool *mp, const CBitSet &bs) : m_mp(mp), m_vector_size(b
 //
 //---------------------------------------------------------------------------
 CBitSet::~CBitSet() {
-  Clear();
+  if (m_words != m_inline_words) {
+    GPOS_DELETE_ARRAY(m_words);
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -196,14 +168,7 @@ CBitSet::~CBitSet() {
 //
 //---------------------------------------------------------------------------
 bool CBitSet::Get(uint32_t pos) const {
-  uint32_t offset = ComputeOffset(pos);
-
-  CBitSetLink *bsl = FindLinkByOffset(offset);
-  if (nullptr != bsl && bsl->GetOffset() == offset) {
-    return bsl->GetVec()->Get(pos - offset);
-  }
-
-  return false;
+  return 0 != (GetWord(pos / BitsPerWord) & ((Word)1 << (pos % BitsPerWord)));
 }
 
 //---------------------------------------------------------------------------
@@ -211,30 +176,20 @@ bool CBitSet::Get(uint32_t pos) const {
 //		CBitSet::ExchangeSet
 //
 //	@doc:
-//		Set given bit; return previous value; allocate new link if necessary
+//		Set given bit; return previous value; grow storage if necessary
 //
 //---------------------------------------------------------------------------
 bool CBitSet::ExchangeSet(uint32_t pos) {
-  uint32_t offset = ComputeOffset(pos);
-
-  CBitSetLink *bsl = FindLinkByOffset(offset);
-  if (nullptr == bsl || bsl->GetOffset() != offset) {
-    CBitSetLink *pbsl_new = GPOS_NEW(m_mp) CBitSetLink(m_mp, offset, m_vector_size);
-    if (nullptr == bsl) {
-      m_bsllist.Prepend(pbsl_new);
-    } else {
-      // insert after found link
-      m_bsllist.Append(pbsl_new, bsl);
-    }
-
-    bsl = pbsl_new;
-  }
+  uint32_t index = pos / BitsPerWord;
+  Word mask = (Word)1 << (pos % BitsPerWord);
 
-  GPOS_ASSERT(bsl->GetOffset() == offset);
+  EnsureCapacity(index + 1);
 
-  bool bit = bsl->GetVec()->ExchangeSet(pos - offset);
+  bool bit = 0 != (m_words[index] & mask);
   if (!bit) {
+    m_words[index] |= mask;
     m_size++;
+    m_hash_valid.store(false, std::memory_order_relaxed);
   }
 
   return bit;
@@ -249,26 +204,17 @@ bool CBitSet::ExchangeSet(uint32_t pos) {
 //
 //---------------------------------------------------------------------------
 bool CBitSet::ExchangeClear(uint32_t pos) {
-  uint32_t offset = ComputeOffset(pos);
-
-  CBitSetLink *bsl = FindLinkByOffset(offset);
-  if (nullptr != bsl && bsl->GetOffset() == offset) {
-    bool bit = bsl->GetVec()->ExchangeClear(pos - offset);
-
-    // remove empty link
-    if (bsl->GetVec()->IsEmpty()) {
-      m_bsllist.Remove(bsl);
-      GPOS_DELETE(bsl);
-    }
-
-    if (bit) {
-      m_size--;
-    }
-
-    return bit;
+  uint32_t index = pos / BitsPerWord;
+  Word mask = (Word)1 << (pos % BitsPerWord);
+
+  bool bit = 0 != (GetWord(index) & mask);
+  if (bit) {
+    m_words[index] &= ~mask;
+    m_size--;
+    m_hash_valid.store(false, std::memory_order_relaxed);
   }
 
-  return false;
+  return bit;
 }
 
 //---------------------------------------------------------------------------
@@ -276,62 +222,17 @@ bool CBitSet::ExchangeClear(uint32_t pos) {
 //		CBitSet::Union
 //
 //	@doc:
-//		Union with given other set;
-//		(1) determine which links need to be allocated before(!) modifying
-//			the set allocate and copy missing links aside
-//		(2) insert the new links into the list
-//		(3) union all links, old and new, on a per-bitvector basis
-//
-//		For clarity step (2) and (3) are separated;
+//		Union with given other set; grow storage to the other's highest word
+//		first, then OR word by word
 //
 //---------------------------------------------------------------------------
 void CBitSet::Union(const CBitSet *pbsOther) {
-  CBitSetLink *bsl = nullptr;
-  CBitSetLink *bsl_other = nullptr;
-
-  // dynamic array of CBitSetLink
-  using CBitSetLinkArray = CDynamicPtrArray<CBitSetLink, CleanupNULL>;
-
-  CAutoRef<CBitSetLinkArray> a_drgpbsl;
-  a_drgpbsl = GPOS_NEW(m_mp) CBitSetLinkArray(m_mp);
-
-  // iterate through other's links and copy missing links to array
-  for (bsl_other = pbsOther->m_bsllist.First(); bsl_other != nullptr; bsl_other = pbsOther->m_bsllist.Next(bsl_other)) {
-    bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-    if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset()) {
-      // need to copy this link
-      CAutoP<CBitSetLink> a_pbsl;
-      a_pbsl = GPOS_NEW(m_mp) CBitSetLink(m_mp, *bsl_other);
-      a_drgpbsl->Append(a_pbsl.Value());
-
-      a_pbsl.Reset();
-    }
-  }
-
-  // insert all new links
-  bsl = nullptr;
-  for (uint32_t i = 0; i < a_drgpbsl->Size(); i++) {
-    CBitSetLink *pbslInsert = (*a_drgpbsl)[i];
-    bsl = FindLinkByOffset(pbslInsert->GetOffset(), bsl);
-
-    GPOS_ASSERT_IMP(nullptr != bsl, bsl->GetOffset() < pbslInsert->GetOffset());
-    if (nullptr == bsl) {
-      m_bsllist.Prepend(pbslInsert);
-    } else {
-      m_bsllist.Append(pbslInsert, bsl);
-    }
-  }
-
-  // iterate through all links and union them up
-  bsl_other = nullptr;
-  bsl = m_bsllist.First();
-  while (nullptr != bsl) {
-    bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-    if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset()) {
-      bsl->GetVec()->Or(bsl_other->GetVec());
-    }
+  uint32_t used = pbsOther->UsedWords();
+  EnsureCapacity(used);
 
-    bsl = m_bsllist.Next(bsl);
+  const Word *other = pbsOther->m_words;
+  for (uint32_t ul = 0; ul < used; ul++) {
+    m_words[ul] |= other[ul];
   }
 
   RecomputeSize();
@@ -342,7 +243,7 @@ void CBitSet::Union(const CBitSet *pbsOther) {
 //		CBitSet::Intersection
 //
 //	@doc:
-//		Iterate through all links and intersect them; release unused links
+//		AND word by word; words beyond the other's capacity are cleared
 //
 //---------------------------------------------------------------------------
 void CBitSet::Intersection(const CBitSet *pbsOther) {
@@ -350,32 +251,13 @@ void CBitSet::Intersection(const CBitSet *pbsOther) {
     return;
   }
 
-  CBitSetLink *bsl_other = nullptr;
-  CBitSetLink *bsl = m_bsllist.First();
-
-  while (nullptr != bsl) {
-    CBitSetLink *bsl_to_remove = nullptr;
-
-    bsl_other = pbsOther->FindLinkByOffset(bsl->GetOffset(), bsl_other);
-    if (nullptr != bsl_other && bsl_other->GetOffset() == bsl->GetOffset()) {
-      bsl->GetVec()->And(bsl_other->GetVec());
-      CBitSetLink *bsl_prev = bsl;
-
-      bsl = m_bsllist.Next(bsl);
-      // If vector is empty after "ANDing", remove the vector, otherwise
-      // we can get into a situation where an empty vector exists
-      // and causes wrong results for equals/contains operations later
-      if (bsl_prev->GetVec()->IsEmpty()) {
-        m_bsllist.Remove(bsl_prev);
-        GPOS_DELETE(bsl_prev);
-      }
-    } else {
-      bsl_to_remove = bsl;
-      bsl = m_bsllist.Next(bsl);
-
-      m_bsllist.Remove(bsl_to_remove);
-      GPOS_DELETE(bsl_to_remove);
-    }
+  uint32_t common = std::min(m_capacity, pbsOther->m_capacity);
+  const Word *other = pbsOther->m_words;
+  for (uint32_t ul = 0; ul < common; ul++) {
+    m_words[ul] &= other[ul];
+  }
+  for (uint32_t ul = common; ul < m_capacity; ul++) {
+    m_words[ul] = 0;
   }
 
   RecomputeSize();
@@ -386,19 +268,18 @@ void CBitSet::Intersection(const CBitSet *pbsOther) {
 //		CBitSet::Difference
 //
 //	@doc:
-//		Substract other set from this by iterating through other set and
-//		explicit removal of elements;
+//		Substract other set from this by clearing the other's bits word by
+//		word
 //
 //---------------------------------------------------------------------------
 void CBitSet::Difference(const CBitSet *pbs) {
-  if (IsDisjoint(pbs)) {
-    return;
+  uint32_t common = std::min(m_capacity, pbs->m_capacity);
+  const Word *other = pbs->m_words;
+  for (uint32_t ul = 0; ul < common; ul++) {
+    m_words[ul] &= ~other[ul];
   }
 
-  CBitSetIter bsiter(*pbs);
-  while (bsiter.Advance()) {
-    (void)ExchangeClear(bsiter.Bit());
-  }
+  RecomputeSize();
 }
 
 //---------------------------------------------------------------------------
@@ -415,20 +296,18 @@ bool CBitSet::ContainsAll(const CBitSet *bs) const {
     return false;
   }
 
-  CBitSetLink *bsl = nullptr;
-  CBitSetLink *bsl_other = nullptr;
-
-  // iterate through other's links and check for subsets
-  for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr; bsl_other = bs->m_bsllist.Next(bsl_other)) {
-    bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
+  uint32_t used = bs->UsedWords();
+  if (used > m_capacity) {
+    return false;
+  }
 
-    if (nullptr == bsl || bsl->GetOffset() != bsl_other->GetOffset() ||
-        !bsl->GetVec()->ContainsAll(bsl_other->GetVec())) {
-      return false;
-    }
+  const Word *other = bs->m_words;
+  Word missing = 0;
+  for (uint32_t ul = 0; ul < used; ul++) {
+    missing |= other[ul] & ~m_words[ul];
   }
 
-  return true;
+  return 0 == missing;
 }
 
 //---------------------------------------------------------------------------
@@ -450,21 +329,16 @@ bool CBitSet::Equals(const CBitSet *bs) const {
     return false;
   }
 
-  CBitSetLink *bsl = m_bsllist.First();
-  CBitSetLink *bsl_other = bs->m_bsllist.First();
-
-  while (nullptr != bsl) {
-    if (nullptr == bsl_other || bsl->GetOffset() != bsl_other->GetOffset() ||
-        !bsl->GetVec()->Equals(bsl_other->GetVec())) {
-      return false;
-    }
-
-    bsl = m_bsllist.Next(bsl);
-    bsl_other = bs->m_bsllist.Next(bsl_other);
+  // sets of equal size that agree on the common words cannot differ in the
+  // remaining ones, as those would hold extra bits on one side only
+  uint32_t common = std::min(m_capacity, bs->m_capacity);
+  const Word *other = bs->m_words;
+  Word diff = 0;
+  for (uint32_t ul = 0; ul < common; ul++) {
+    diff |= m_words[ul] ^ other[ul];
   }
 
-  // same length implies bsl_other must have reached end as well
-  return bsl_other == nullptr;
+  return 0 == diff;
 }
 
 //---------------------------------------------------------------------------
@@ -476,20 +350,14 @@ bool CBitSet::Equals(const CBitSet *bs) const {
 //
 //---------------------------------------------------------------------------
 bool CBitSet::IsDisjoint(const CBitSet *bs) const {
-  CBitSetLink *bsl = nullptr;
-  CBitSetLink *bsl_other = nullptr;
-
-  // iterate through other's links an check if disjoint
-  for (bsl_other = bs->m_bsllist.First(); bsl_other != nullptr; bsl_other = bs->m_bsllist.Next(bsl_other)) {
-    bsl = FindLinkByOffset(bsl_other->GetOffset(), bsl);
-
-    if (nullptr != bsl && bsl->GetOffset() == bsl_other->GetOffset() &&
-        !bsl->GetVec()->IsDisjoint(bsl_other->GetVec())) {
-      return false;
-    }
+  uint32_t common = std::min(m_capacity, bs->m_capacity);
+  const Word *other = bs->m_words;
+  Word overlap = 0;
+  for (uint32_t ul = 0; ul < common; ul++) {
+    overlap |= m_words[ul] & other[ul];
   }
 
-  return true;
+  return 0 == overlap;
 }
 
 //---------------------------------------------------------------------------
@@ -497,18 +365,25 @@ bool CBitSet::IsDisjoint(const CBitSet *bs) const {
 //		CBitSet::HashValue
 //
 //	@doc:
-//		Compute hash value for set
+//		Compute hash value for set over the words up to the highest non-zero
+//		one, so equal sets hash alike regardless of capacity; the value is
+//		cached until the set is modified
 //
 //---------------------------------------------------------------------------
 uint32_t CBitSet::HashValue() const {
-  uint32_t ulHash = 0;
+  if (m_hash_valid.load(std::memory_order_acquire)) {
+    return m_hash;
+  }
 
-  CBitSetLink *bsl = m_bsllist.First();
-  while (nullptr != bsl) {
-    ulHash = gpos::CombineHashes(ulHash, bsl->GetVec()->HashValue());
-    bsl = m_bsllist.Next(bsl);
+  uint32_t ulHash = 0;
+  uint32_t used = UsedWords();
+  for (uint32_t ul = 0; ul < used; ul++) {
+    ulHash = gpos::CombineHashes(ulHash, gpos::HashValue<Word>(&m_words[ul]));
   }
 
+  m_hash = ulHash;
+  m_hash_valid.store(true, std::memory_order_release);
+
   return ulHash;
 }
 
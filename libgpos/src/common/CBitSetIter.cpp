@@ -24,33 +24,39 @@ using namespace gpos;
 //		ctor
 //
 //---------------------------------------------------------------------------
-CBitSetIter::CBitSetIter(const CBitSet &bs) : m_bs(bs), m_cursor((uint32_t)-1), m_bsl(nullptr), m_active(true) {}
+CBitSetIter::CBitSetIter(const CBitSet &bs) : m_bs(bs), m_cursor((uint32_t)-1), m_active(true) {}
 
 //---------------------------------------------------------------------------
 //	@function:
 //		CBitSetIter::Advance
 //
 //	@doc:
-//		Move to next bit
+//		Move to next bit; skips empty words and finds the lowest remaining
+//		bit of a word by counting trailing zeros
 //
 //---------------------------------------------------------------------------
 bool CBitSetIter::Advance() {
   GPOS_ASSERT(m_active && "called advance on exhausted iterator");
 
-  if (nullptr == m_bsl) {
-    m_bsl = m_bs.m_bsllist.First();
-  }
+  // cursor starts at -1, so the first candidate is bit 0
+  uint32_t pos = m_cursor + 1;
+  uint32_t index = pos / CBitSet::BitsPerWord;
+
+  if (index < m_bs.m_capacity) {
+    // mask off the bits already visited in the current word
+    CBitSet::Word word = m_bs.m_words[index] & (~(CBitSet::Word)0 << (pos % CBitSet::BitsPerWord));
 
-  while (nullptr != m_bsl) {
-    if (m_cursor + 1 <= m_bs.m_vector_size && m_bsl->GetVec()->GetNextSetBit(m_cursor + 1, m_cursor)) {
-      break;
+    while (0 == word && ++index < m_bs.m_capacity) {
+      word = m_bs.m_words[index];
     }
 
-    m_bsl = m_bs.m_bsllist.Next(m_bsl);
-    m_cursor = (uint32_t)-1;
+    if (0 != word) {
+      m_cursor = index * CBitSet::BitsPerWord + (uint32_t)__builtin_ctzll(word);
+      return true;
+    }
   }
 
-  m_active = (nullptr != m_bsl);
+  m_active = false;
   return m_active;
 }
 
@@ -63,10 +69,10 @@ bool CBitSetIter::Advance() {
 //
 //---------------------------------------------------------------------------
 uint32_t CBitSetIter::Bit() const {
-  GPOS_ASSERT(m_active && nullptr != m_bsl && "iterator uninitialized");
-  GPOS_ASSERT(m_bsl->GetVec()->Get(m_cursor));
+  GPOS_ASSERT(m_active && "iterator uninitialized");
+  GPOS_ASSERT(m_bs.Get(m_cursor));
 
-  return m_bsl->GetOffset() + m_cursor;
+  return m_cursor;
 }
 
 // EOF
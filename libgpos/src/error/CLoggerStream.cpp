@@ -25,7 +25,8 @@ CLoggerStream CLoggerStream::m_stderr_stream_logger(oswcerr);
 //	@doc:
 //
 //---------------------------------------------------------------------------
-CLoggerStream::CLoggerStream(IOstream &os) : CLogger(), m_os(os) {}
+CLoggerStream::CLoggerStream(IOstream &os, uint32_t max_trace_length)
+    : CLogger(), m_os(os), m_max_trace_length(max_trace_length) {}
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -36,4 +37,29 @@ CLoggerStream::CLoggerStream(IOstream &os) : CLogger(), m_os(os) {}
 //---------------------------------------------------------------------------
 CLoggerStream::~CLoggerStream() = default;
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CLoggerStream::Write
+//
+//	@doc:
+//		Write string to stream; trace messages that would exceed the trace
+//		limit are dropped, errors are always written
+//
+//---------------------------------------------------------------------------
+void CLoggerStream::Write(const wchar_t *log_entry, uint32_t severity) {
+  if (0 < m_max_trace_length && CException::ExsevTrace == severity) {
+    uint32_t length = GPOS_WSZ_LENGTH(log_entry);
+    if (m_trace_length + length > m_max_trace_length) {
+      if (!m_trace_truncated) {
+        m_os = m_os << GPOS_WSZ_LIT("trace output truncated, size limit reached\n");
+        m_trace_truncated = true;
+      }
+      return;
+    }
+    m_trace_length += length;
+  }
+
+  m_os = m_os << log_entry;
+}
+
 // EOF
@@ -38,12 +38,12 @@ using namespace gpos;
 //  	the CMemoryPoolManager global instance
 //
 //---------------------------------------------------------------------------
-CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY)
+CAutoMemoryPool::CAutoMemoryPool(ELeakCheck leak_check_type GPOS_ASSERTS_ONLY, CMemoryPoolManager::EPoolKind pool_kind)
 #ifdef GPOS_DEBUG
     : m_leak_check_type(leak_check_type)
 #endif
 {
-  m_mp = CMemoryPoolManager::CreateMemoryPool();
+  m_mp = CMemoryPoolManager::CreateMemoryPool(pool_kind);
 }
 
 //---------------------------------------------------------------------------
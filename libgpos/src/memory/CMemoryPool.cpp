@@ -14,6 +14,7 @@
 
 #include "gpos/memory/CMemoryPool.h"
 
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryPoolManager.h"
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
@@ -28,10 +29,18 @@ const uintptr_t CMemoryPool::m_invalid = UINT64_MAX;
 uint32_t CMemoryPool::UserSizeOfAlloc(const void *ptr) {
   GPOS_ASSERT(nullptr != ptr);
 
+  if (CMemoryPoolArena::IsArenaAllocation(ptr)) {
+    return CMemoryPoolArena::UserSizeOfAlloc(ptr);
+  }
   return CMemoryPoolManager::GetMemoryPoolMgr()->UserSizeOfAlloc(ptr);
 }
 
 void CMemoryPool::DeleteImpl(void *ptr, EAllocationType eat) {
+  // arena pools can be created under any manager
+  if (CMemoryPoolArena::IsArenaAllocation(ptr)) {
+    CMemoryPoolArena::DeleteImpl(ptr, eat);
+    return;
+  }
   CMemoryPoolManager::GetMemoryPoolMgr()->DeleteImpl(ptr, eat);
 }
 
@@ -0,0 +1,158 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CMemoryPoolArena.cpp
+//
+//	@doc:
+//		Implementation of the arena memory pool
+//
+//---------------------------------------------------------------------------
+
+#include "gpos/memory/CMemoryPoolArena.h"
+
+#include "gpos/assert.h"
+#include "gpos/common/clibwrapper.h"
+#include "gpos/types.h"
+#include "gpos/utils.h"
+
+using namespace gpos;
+
+// size of the first chunk of a pool
+#define GPOS_MEM_ARENA_INITIAL_CHUNK_SIZE (16 * 1024)
+
+// chunks stop growing once they reach this size
+#define GPOS_MEM_ARENA_MAX_CHUNK_SIZE (1024 * 1024)
+
+// ctor
+CMemoryPoolArena::CMemoryPoolArena() : CMemoryPool(), m_next_chunk_size(GPOS_MEM_ARENA_INITIAL_CHUNK_SIZE) {
+  GPOS_CPL_ASSERT(GPOS_MEM_ALIGNED_STRUCT_SIZE(SAllocHeader) == sizeof(SAllocHeader), "");
+  GPOS_CPL_ASSERT(GPOS_MEM_ALIGNED_STRUCT_SIZE(SChunk) == sizeof(SChunk), "");
+
+  for (uint32_t ul = 0; ul < m_num_free_lists; ul++) {
+    m_free_lists[ul] = nullptr;
+  }
+}
+
+// dtor
+CMemoryPoolArena::~CMemoryPoolArena() {
+  GPOS_ASSERT(nullptr == m_chunks);
+}
+
+// allocate a new chunk with at least the given usable size
+CMemoryPoolArena::SChunk *CMemoryPoolArena::NewChunk(uint64_t size) {
+  void *ptr = clib::Malloc(sizeof(SChunk) + size);
+  GPOS_OOM_CHECK(ptr);
+
+  SChunk *chunk = static_cast<SChunk *>(ptr);
+  chunk->m_size = size;
+  chunk->m_next = m_chunks;
+  m_chunks = chunk;
+  m_total_chunk_size += sizeof(SChunk) + size;
+
+  return chunk;
+}
+
+void *CMemoryPoolArena::NewImpl(const uint32_t bytes, const char *, const uint32_t, CMemoryPool::EAllocationType) {
+  GPOS_ASSERT(bytes <= GPOS_MEM_ALLOC_MAX);
+
+  uint32_t aligned_size = GPOS_MEM_ALIGNED_SIZE(bytes);
+  uint32_t alloc_size = sizeof(SAllocHeader) + aligned_size;
+  SAllocHeader *header = nullptr;
+
+  CAutoMutex am(m_mutex);
+
+  if (aligned_size <= GPOS_MEM_ARENA_MAX_RECYCLED_SIZE && nullptr != m_free_lists[aligned_size / GPOS_MEM_ARCH]) {
+    // reuse a block freed earlier
+    SFreeBlock *block = m_free_lists[aligned_size / GPOS_MEM_ARCH];
+    m_free_lists[aligned_size / GPOS_MEM_ARCH] = block->m_next;
+    header = reinterpret_cast<SAllocHeader *>(block) - 1;
+  } else if ((uint64_t)(m_limit - m_cursor) < alloc_size) {
+    if (alloc_size > m_next_chunk_size / 4) {
+      // large allocations get a chunk of their own and leave the current
+      // chunk in place for subsequent small allocations
+      header = reinterpret_cast<SAllocHeader *>(NewChunk(alloc_size) + 1);
+    } else {
+      SChunk *chunk = NewChunk(m_next_chunk_size);
+      m_cursor = reinterpret_cast<uint8_t *>(chunk + 1);
+      m_limit = m_cursor + chunk->m_size;
+      m_next_chunk_size = std::min(m_next_chunk_size * 2, (uint64_t)GPOS_MEM_ARENA_MAX_CHUNK_SIZE);
+    }
+  }
+
+  if (nullptr == header) {
+    header = reinterpret_cast<SAllocHeader *>(m_cursor);
+    m_cursor += alloc_size;
+  }
+
+  header->m_mp = this;
+  header->m_trailer.m_user_size = bytes;
+  header->m_trailer.m_owner = EaoArena;
+  m_memory_pool_statistics.RecordAllocation(bytes, alloc_size);
+
+  void *ptr_result = header + 1;
+
+#ifdef GPOS_DEBUG
+  clib::Memset(ptr_result, GPOS_MEM_INIT_PATTERN_CHAR, bytes);
+#endif  // GPOS_DEBUG
+
+  return ptr_result;
+}
+
+// record a free and recycle the block if possible
+void CMemoryPoolArena::Free(SAllocHeader *header) {
+  uint32_t user_size = header->m_trailer.m_user_size;
+  uint32_t aligned_size = GPOS_MEM_ALIGNED_SIZE(user_size);
+
+  CAutoMutex am(m_mutex);
+  m_memory_pool_statistics.RecordFree(user_size, sizeof(SAllocHeader) + aligned_size);
+
+  uint8_t *block = reinterpret_cast<uint8_t *>(header + 1);
+
+#ifdef GPOS_DEBUG
+  // mark user memory as unused in debug mode
+  clib::Memset(block, GPOS_MEM_FREED_PATTERN_CHAR, user_size);
+#endif  // GPOS_DEBUG
+
+  if (block + aligned_size == m_cursor) {
+    // most recent allocation of the current chunk, just move the cursor back
+    m_cursor = reinterpret_cast<uint8_t *>(header);
+  } else if (sizeof(SFreeBlock) <= aligned_size && aligned_size <= GPOS_MEM_ARENA_MAX_RECYCLED_SIZE) {
+    SFreeBlock *free_block = reinterpret_cast<SFreeBlock *>(block);
+    free_block->m_next = m_free_lists[aligned_size / GPOS_MEM_ARCH];
+    m_free_lists[aligned_size / GPOS_MEM_ARCH] = free_block;
+  }
+}
+
+// free memory allocation
+void CMemoryPoolArena::DeleteImpl(void *ptr, EAllocationType) {
+  GPOS_ASSERT(IsArenaAllocation(ptr));
+
+  SAllocHeader *header = static_cast<SAllocHeader *>(ptr) - 1;
+  GPOS_ASSERT(nullptr != header->m_mp);
+  header->m_mp->Free(header);
+}
+
+// get user requested size of allocation
+uint32_t CMemoryPoolArena::UserSizeOfAlloc(const void *ptr) {
+  GPOS_ASSERT(IsArenaAllocation(ptr));
+
+  return Trailer(ptr)->m_user_size;
+}
+
+// Release all chunks at once; objects still alive at this point are
+// dropped without running their destructors, like with the tracker pool
+void CMemoryPoolArena::TearDown() {
+  while (nullptr != m_chunks) {
+    SChunk *next = m_chunks->m_next;
+    clib::Free(m_chunks);
+    m_chunks = next;
+  }
+
+  m_cursor = nullptr;
+  m_limit = nullptr;
+  m_total_chunk_size = 0;
+  for (uint32_t ul = 0; ul < m_num_free_lists; ul++) {
+    m_free_lists[ul] = nullptr;
+  }
+}
+
+// EOF
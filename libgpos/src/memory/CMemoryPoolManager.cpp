@@ -18,6 +18,7 @@
 #include "gpos/common/clibwrapper.h"
 #include "gpos/error/CAutoTrace.h"
 #include "gpos/memory/CMemoryPool.h"
+#include "gpos/memory/CMemoryPoolArena.h"
 #include "gpos/memory/CMemoryPoolTracker.h"
 #include "gpos/memory/CMemoryVisitorPrint.h"
 #include "gpos/task/CAutoSuspendAbort.h"
@@ -58,9 +59,14 @@ void CMemoryPoolManager::Init() {
   }
 }
 
-CMemoryPool *CMemoryPoolManager::CreateMemoryPool() {
+CMemoryPool *CMemoryPoolManager::CreateMemoryPool(EPoolKind kind) {
   GPOS_ASSERT(nullptr != m_memory_pool_mgr);
-  CMemoryPool *mp = m_memory_pool_mgr->NewMemoryPool();
+  CMemoryPool *mp = nullptr;
+  if (EpkArena == kind) {
+    mp = GPOS_NEW(m_memory_pool_mgr->m_internal_memory_pool) CMemoryPoolArena();
+  } else {
+    mp = m_memory_pool_mgr->NewMemoryPool();
+  }
 
   // accessor scope
   {
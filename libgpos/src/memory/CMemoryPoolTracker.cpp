@@ -34,6 +34,10 @@ using namespace gpos;
 
 // ctor
 CMemoryPoolTracker::CMemoryPoolTracker() : CMemoryPool() {
+  // the header must end with the fields shared by all pool types
+  GPOS_CPL_ASSERT(GPOS_MEM_ALLOC_HEADER_SIZE == sizeof(SAllocHeader), "");
+  GPOS_CPL_ASSERT(offsetof(SAllocHeader, m_user_size) + sizeof(SAllocTrailer) == sizeof(SAllocHeader), "");
+
   m_allocations_list.Init(GPOS_OFFSET(SAllocHeader, m_link));
 }
 
@@ -43,11 +47,15 @@ CMemoryPoolTracker::~CMemoryPoolTracker() {
 }
 
 void CMemoryPoolTracker::RecordAllocation(SAllocHeader *header) {
+  CAutoMutex am(m_mutex);
+  header->m_serial = m_alloc_sequence;
+  ++m_alloc_sequence;
   m_memory_pool_statistics.RecordAllocation(header->m_user_size, header->m_alloc_size);
   m_allocations_list.Prepend(header);
 }
 
 void CMemoryPoolTracker::RecordFree(SAllocHeader *header) {
+  CAutoMutex am(m_mutex);
   m_memory_pool_statistics.RecordFree(header->m_user_size, header->m_alloc_size);
   m_allocations_list.Remove(header);
 }
@@ -65,14 +73,12 @@ void *CMemoryPoolTracker::NewImpl(const uint32_t bytes, const char *file, const
 
   // successful allocation: update header information and any memory pool data
   SAllocHeader *header = static_cast<SAllocHeader *>(ptr);
-  header->m_serial = m_alloc_sequence;
-  ++m_alloc_sequence;
-
   header->m_alloc_size = alloc_size;
   header->m_mp = this;
   header->m_filename = file;
   header->m_line = line;
   header->m_user_size = bytes;
+  header->m_owner = EaoTracker;
 
   RecordAllocation(header);
 
@@ -270,6 +270,37 @@ void CAutoTaskProxy::Execute(CTask *task) const {
   task->SetReported();
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CAutoTaskProxy::ExecuteScheduled
+//
+//	@doc:
+//		Execute scheduled tasks on helper workers (asynchronous execution);
+//		the owner of the ATP serves the requests of the helpers meanwhile
+//
+//---------------------------------------------------------------------------
+void CAutoTaskProxy::ExecuteScheduled() {
+  m_pwpm->ExecuteScheduled();
+
+  // report the error that made the other tasks abort first
+  for (CTask *task = m_list.First(); nullptr != task; task = m_list.Next(task)) {
+    if (task->IsScheduled() && !task->IsReported() && task->HasPendingExceptions() &&
+        CException::ExmiAbort != task->GetErrCtxt()->GetException().Minor()) {
+      task->SetReported();
+      CheckError(task);
+    }
+  }
+
+  for (CTask *task = m_list.First(); nullptr != task; task = m_list.Next(task)) {
+    if (task->IsScheduled() && !task->IsReported()) {
+      GPOS_ASSERT(task->IsFinished());
+
+      task->SetReported();
+      CheckError(task);
+    }
+  }
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CAutoTaskProxy::Cancel
@@ -11,16 +11,21 @@
 
 #include "gpos/task/CTaskLocalStorage.h"
 
-#include "gpos/common/CSyncHashtableAccessByKey.h"
 #include "gpos/task/CTaskLocalStorageObject.h"
 
 using namespace gpos;
 
-// shorthand for HT accessor
-using HashTableAccessor = CSyncHashtableAccessByKey<CTaskLocalStorageObject, CTaskLocalStorage::Etlsidx>;
-
-// invalid idx
-const CTaskLocalStorage::Etlsidx CTaskLocalStorage::m_invalid_idx = EtlsidxInvalid;
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskLocalStorage::CTaskLocalStorage
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CTaskLocalStorage::CTaskLocalStorage() {
+  Reset(nullptr);
+}
 
 //---------------------------------------------------------------------------
 //	@function:
@@ -40,15 +45,10 @@ CTaskLocalStorage::~CTaskLocalStorage() = default;
 //		(re-)init TLS
 //
 //---------------------------------------------------------------------------
-void CTaskLocalStorage::Reset(CMemoryPool *mp) {
-  // destroy old
-  m_hash_table.Cleanup();
-
-  // realloc
-  m_hash_table.Init(mp,
-                    128,  // number of hashbuckets
-                    GPOS_OFFSET(CTaskLocalStorageObject, m_link), GPOS_OFFSET(CTaskLocalStorageObject, m_etlsidx),
-                    &(CTaskLocalStorage::m_invalid_idx), CTaskLocalStorage::HashIdx, CTaskLocalStorage::Equals);
+void CTaskLocalStorage::Reset(CMemoryPool *) {
+  for (uint32_t ul = 0; ul < EtlsidxSentinel; ul++) {
+    m_objects[ul] = nullptr;
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -61,15 +61,9 @@ void CTaskLocalStorage::Reset(CMemoryPool *mp) {
 //---------------------------------------------------------------------------
 void CTaskLocalStorage::Store(CTaskLocalStorageObject *obj) {
   GPOS_ASSERT(nullptr != obj);
+  GPOS_ASSERT(nullptr == m_objects[obj->idx()] && "Duplicate TLS object key");
 
-#ifdef GPOS_DEBUG
-  {
-    HashTableAccessor HashTableAccessor(m_hash_table, obj->idx());
-    GPOS_ASSERT(nullptr == HashTableAccessor.Find() && "Duplicate TLS object key");
-  }
-#endif  // GPOS_DEBUG
-
-  m_hash_table.Insert(obj);
+  m_objects[obj->idx()] = obj;
 }
 
 //---------------------------------------------------------------------------
@@ -81,8 +75,9 @@ void CTaskLocalStorage::Store(CTaskLocalStorageObject *obj) {
 //
 //---------------------------------------------------------------------------
 CTaskLocalStorageObject *CTaskLocalStorage::Get(CTaskLocalStorage::Etlsidx idx) {
-  HashTableAccessor HashTableAccessor(m_hash_table, idx);
-  return HashTableAccessor.Find();
+  GPOS_ASSERT(EtlsidxSentinel > idx);
+
+  return m_objects[idx];
 }
 
 //---------------------------------------------------------------------------
@@ -95,12 +90,23 @@ CTaskLocalStorageObject *CTaskLocalStorage::Get(CTaskLocalStorage::Etlsidx idx)
 //---------------------------------------------------------------------------
 void CTaskLocalStorage::Remove(CTaskLocalStorageObject *obj) {
   GPOS_ASSERT(nullptr != obj);
+  GPOS_ASSERT(obj == m_objects[obj->idx()] && "Object not found in TLS");
 
-  // lookup object
-  HashTableAccessor HashTableAccessor(m_hash_table, obj->idx());
-  GPOS_ASSERT(nullptr != HashTableAccessor.Find() && "Object not found in TLS");
+  m_objects[obj->idx()] = nullptr;
+}
 
-  HashTableAccessor.Remove(obj);
+//---------------------------------------------------------------------------
+//	@function:
+//		CTaskLocalStorage::Inherit
+//
+//	@doc:
+//		Share the objects stored in the given TLS
+//
+//---------------------------------------------------------------------------
+void CTaskLocalStorage::Inherit(const CTaskLocalStorage &tls) {
+  for (uint32_t ul = 0; ul < EtlsidxSentinel; ul++) {
+    m_objects[ul] = tls.m_objects[ul];
+  }
 }
 
 // EOF
@@ -29,12 +29,12 @@ bool (*CWorker::abort_requested_by_system)(void);
 //		ctor
 //
 //---------------------------------------------------------------------------
-CWorker::CWorker(uint32_t stack_size, uintptr_t stack_start)
-    : m_task(nullptr), m_stack_size(stack_size), m_stack_start(stack_start) {
+CWorker::CWorker(uint32_t stack_size, uintptr_t stack_start, bool is_helper)
+    : m_task(nullptr), m_stack_size(stack_size), m_stack_start(stack_start), m_is_helper(is_helper) {
   GPOS_ASSERT(stack_size >= 2 * 1024 && "Worker has to have at least 2KB stack");
 
-  // register worker
-  GPOS_ASSERT(nullptr == Self() && "Found registered worker!");
+  // register worker; helpers are only started by the main worker
+  GPOS_ASSERT((is_helper ? nullptr != Self() : nullptr == Self()) && "Found registered worker!");
 
   CWorkerPoolManager::WorkerPoolManager()->RegisterWorker(this);
   GPOS_ASSERT(this == CWorkerPoolManager::WorkerPoolManager()->Self());
@@ -92,7 +92,10 @@ void CWorker::CheckForAbort(const char *, uint32_t) {
   if (nullptr != m_task && m_task->IsRunning() && !m_task->IsAbortSuspended()) {
     GPOS_ASSERT(!m_task->GetErrCtxt()->IsPending() && "Check-For-Abort while an exception is pending");
 
-    if ((nullptr != abort_requested_by_system && abort_requested_by_system()) || m_task->IsCanceled()) {
+    // helpers must not call into the host system, the main worker
+    // cancels them when it receives an abort request
+    if ((!m_is_helper && nullptr != abort_requested_by_system && abort_requested_by_system()) ||
+        m_task->IsCanceled()) {
       // raise exception
       GPOS_ABORT;
     }
@@ -10,10 +10,21 @@
 //		* maintains worker local storage
 //		* hosts task scheduler
 //		* assigns tasks to workers
+//		* runs scheduled tasks on helper threads
 //---------------------------------------------------------------------------
 
 #include "gpos/task/CWorkerPoolManager.h"
 
+#include <pthread.h>
+#include <signal.h>
+
+#include <chrono>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "gpos/common/CMutex.h"
+#include "gpos/error/CErrorContext.h"
 #include "gpos/memory/CMemoryPool.h"
 #include "gpos/memory/CMemoryPoolManager.h"
 
@@ -24,6 +35,15 @@ using namespace gpos;
 //---------------------------------------------------------------------------
 CWorkerPoolManager *CWorkerPoolManager::m_worker_pool_manager = nullptr;
 
+// helper worker of the current thread
+thread_local CWorker *CWorkerPoolManager::m_helper_worker = nullptr;
+
+// host system callback running forwarded calls
+void *(*CWorkerPoolManager::host_call)(void *(*func)(void *), void *arg) = nullptr;
+
+// interval at which the main worker checks for abort while waiting
+#define GPOS_WORKERPOOL_WAIT_MSEC 10
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CWorkerPoolManager::CWorkerPoolManager
@@ -33,7 +53,15 @@ CWorkerPoolManager *CWorkerPoolManager::m_worker_pool_manager = nullptr;
 //
 //---------------------------------------------------------------------------
 CWorkerPoolManager::CWorkerPoolManager(CMemoryPool *mp)
-    : m_mp(mp), m_auto_task_proxy_counter(0), m_active(false), m_single_worker(nullptr) {
+    : m_mp(mp),
+      m_auto_task_proxy_counter(0),
+      m_active(false),
+      m_single_worker(nullptr),
+      m_concurrent(false),
+      m_running_helpers(0),
+      m_helper_failed(false) {
+  m_requests.Init(GPOS_OFFSET(SRequest, m_link));
+
   // initialize hash table
   m_shtTS.Init(mp, GPOS_WORKERPOOL_HT_SIZE, GPOS_OFFSET(CTask, m_worker_pool_manager_link), GPOS_OFFSET(CTask, m_tid),
                &(CTaskId::m_invalid_tid), CTaskId::HashValue, CTaskId::Equals);
@@ -97,6 +125,13 @@ void CWorkerPoolManager::Shutdown() {
 //---------------------------------------------------------------------------
 void CWorkerPoolManager::RegisterWorker(CWorker *worker) {
   GPOS_ASSERT(nullptr != worker);
+
+  if (worker->IsHelper()) {
+    GPOS_ASSERT(m_concurrent && nullptr == m_helper_worker);
+    m_helper_worker = worker;
+    return;
+  }
+
   GPOS_ASSERT(nullptr == m_single_worker);
   m_single_worker = worker;
 }
@@ -110,6 +145,11 @@ void CWorkerPoolManager::RegisterWorker(CWorker *worker) {
 //
 //---------------------------------------------------------------------------
 void CWorkerPoolManager::RemoveWorker() {
+  if (nullptr != m_helper_worker) {
+    m_helper_worker = nullptr;
+    return;
+  }
+
   m_single_worker = nullptr;
 }
 
@@ -214,4 +254,203 @@ void CWorkerPoolManager::Cancel(CTaskId tid) {
   }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::ExecuteScheduled
+//
+//	@doc:
+//		Start a helper thread for every scheduled task and serve their
+//		requests until all of them have finished. An abort request, a
+//		failed helper or a thread that cannot be started cancels all
+//		helpers; errors are reported once every helper has been joined.
+//
+//---------------------------------------------------------------------------
+void CWorkerPoolManager::ExecuteScheduled() {
+  GPOS_ASSERT(m_active && "Worker pool is not operating");
+  GPOS_ASSERT(!m_concurrent && nullptr != m_single_worker);
+
+  std::vector<CTask *> tasks;
+  while (!m_task_scheduler.IsEmpty()) {
+    tasks.push_back(m_task_scheduler.Dequeue());
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(tasks.size());
+
+  m_running_helpers = 0;
+  m_helper_failed = false;
+  m_concurrent = true;
+  CMutex::Enable(true);
+
+  // helpers must never receive the signals of the host process
+  sigset_t sigs;
+  sigset_t old_sigs;
+  sigfillset(&sigs);
+  pthread_sigmask(SIG_SETMASK, &sigs, &old_sigs);
+
+  bool out_of_threads = false;
+  for (CTask *task : tasks) {
+    if (!out_of_threads) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running_helpers++;
+      }
+
+      try {
+        threads.emplace_back(RunHelper, task);
+        continue;
+      } catch (const std::system_error &) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running_helpers--;
+        out_of_threads = true;
+      }
+    }
+
+    task->Cancel();
+    task->SetStatus(CTask::EtsError);
+  }
+
+  pthread_sigmask(SIG_SETMASK, &old_sigs, nullptr);
+
+  bool canceled = false;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (0 < m_running_helpers || !m_requests.IsEmpty()) {
+      ServeRequests(lock);
+
+      if (!canceled &&
+          (out_of_threads || m_helper_failed ||
+           (nullptr != CWorker::abort_requested_by_system && CWorker::abort_requested_by_system()))) {
+        // helpers stop at their next abort check
+        canceled = true;
+        for (CTask *task : tasks) {
+          task->Cancel();
+        }
+      }
+
+      if (0 < m_running_helpers && m_requests.IsEmpty()) {
+        m_cond.wait_for(lock, std::chrono::milliseconds(GPOS_WORKERPOOL_WAIT_MSEC));
+      }
+    }
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  CMutex::Enable(false);
+  m_concurrent = false;
+
+  GPOS_CHECK_ABORT;
+
+  if (out_of_threads) {
+    GPOS_RAISE(CException::ExmaSystem, CException::ExmiOOM);
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::ServeRequests
+//
+//	@doc:
+//		Execute the requests forwarded by helpers; called by the main
+//		worker with the lock held, which is released around every call.
+//		Calls go through the host callback, so an error of the host system
+//		fails the request instead of unwinding past the running helpers
+//
+//---------------------------------------------------------------------------
+void CWorkerPoolManager::ServeRequests(std::unique_lock<std::mutex> &lock) {
+  while (!m_requests.IsEmpty()) {
+    SRequest *request = m_requests.RemoveHead();
+    lock.unlock();
+
+    CTask *task = CTask::Self();
+    GPOS_TRY {
+      if (nullptr != host_call) {
+        request->m_res = host_call(request->m_func, request->m_arg);
+      } else {
+        request->m_res = request->m_func(request->m_arg);
+      }
+    }
+    GPOS_CATCH_EX(ex) {
+      // hand the error over to the requesting helper
+      request->m_err_ctxt->CopyPropErrCtxt(task->GetErrCtxt());
+      task->GetErrCtxt()->Reset();
+      request->m_failed = true;
+    }
+    GPOS_CATCH_END;
+
+    lock.lock();
+    request->m_done = true;
+    m_cond.notify_all();
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::RunHelper
+//
+//	@doc:
+//		Entry point of helper threads; runs the task on a helper worker
+//
+//---------------------------------------------------------------------------
+void CWorkerPoolManager::RunHelper(CTask *task) {
+  CWorkerPoolManager *worker_pool_manager = WorkerPoolManager();
+
+  // the stack of the helper starts here
+  CWorker worker(GPOS_WORKER_STACK_SIZE, (uintptr_t)&worker_pool_manager, true /*is_helper*/);
+
+  task->SetStatus(CTask::EtsDequeued);
+  try {
+    worker.Execute(task);
+  } catch (...) {
+    task->SetStatus(CTask::EtsError);
+  }
+
+  std::lock_guard<std::mutex> lock(worker_pool_manager->m_mutex);
+  if (CTask::EtsError == task->GetStatus()) {
+    worker_pool_manager->m_helper_failed = true;
+  }
+  worker_pool_manager->m_running_helpers--;
+  worker_pool_manager->m_cond.notify_all();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CWorkerPoolManager::ExecuteOnMainWorker
+//
+//	@doc:
+//		Execute function on the main worker; a helper worker blocks until
+//		the main worker has served the request and re-raises its error
+//
+//---------------------------------------------------------------------------
+void *CWorkerPoolManager::ExecuteOnMainWorker(void *(*func)(void *), void *arg) {
+  CWorkerPoolManager *worker_pool_manager = WorkerPoolManager();
+  if (!worker_pool_manager->m_concurrent || nullptr == m_helper_worker) {
+    return func(arg);
+  }
+
+  CTask *task = CTask::Self();
+  SRequest request;
+  request.m_func = func;
+  request.m_arg = arg;
+  request.m_res = nullptr;
+  request.m_err_ctxt = task->GetErrCtxt();
+  request.m_done = false;
+  request.m_failed = false;
+
+  {
+    std::unique_lock<std::mutex> lock(worker_pool_manager->m_mutex);
+    worker_pool_manager->m_requests.Append(&request);
+    worker_pool_manager->m_cond.notify_all();
+    worker_pool_manager->m_cond.wait(lock, [&request] { return request.m_done; });
+  }
+
+  if (request.m_failed) {
+    CException::Reraise(task->GetErrCtxt()->GetException(), true /*propagate*/);
+  }
+
+  return request.m_res;
+}
+
 // EOF
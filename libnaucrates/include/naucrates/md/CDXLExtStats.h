@@ -50,11 +50,13 @@ class CDXLExtStats : public IMDExtStats {
 
   CMDNDistinctArray *m_ndistinct_array;
 
+  CMDMCVItemArray *m_mcv_array;
+
  public:
   CDXLExtStats(const CDXLExtStats &) = delete;
 
   CDXLExtStats(CMemoryPool *mp, IMDId *rel_stats_mdid, CMDName *mdname, CMDDependencyArray *extstats_dependency_array,
-               CMDNDistinctArray *ndistinct_array);
+               CMDNDistinctArray *ndistinct_array, CMDMCVItemArray *mcv_array);
 
   ~CDXLExtStats() override;
 
@@ -72,6 +74,8 @@ class CDXLExtStats : public IMDExtStats {
 
   CMDNDistinctArray *GetNDistinctList() const override { return m_ndistinct_array; }
 
+  CMDMCVItemArray *GetMCVList() const override { return m_mcv_array; }
+
 #ifdef GPOS_DEBUG
   // debug print of the metadata ext stats
   void DebugPrint(IOstream &os GPOS_UNUSED) const override {}
@@ -0,0 +1,56 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CMDMCVItem.h
+//
+//	@doc:
+//		Class representing an item of an MD extended stats multi-column MCV
+//		list.
+//
+//		The structure mirrors MCVItem in statistics.h. Values are stored in
+//		the order of the attributes of the statistics object, a NULL value
+//		is represented by a NULL datum rather than a separate flag.
+//---------------------------------------------------------------------------
+#ifndef GPMD_CMDMCVItem_H
+#define GPMD_CMDMCVItem_H
+
+#include "gpos/base.h"
+#include "gpos/common/CDouble.h"
+#include "naucrates/base/IDatum.h"
+
+namespace gpmd {
+using namespace gpos;
+using namespace gpnaucrates;
+
+class CMDMCVItem : public CRefCount {
+ private:
+  // frequency of the combination of values
+  CDouble m_frequency;
+
+  // frequency if the columns were independent
+  CDouble m_base_frequency;
+
+  // value of each dimension
+  IDatumArray *m_values;
+
+ public:
+  CMDMCVItem(double frequency, double base_frequency, IDatumArray *values)
+      : m_frequency(frequency), m_base_frequency(base_frequency), m_values(values) {}
+
+  ~CMDMCVItem() override { m_values->Release(); }
+
+  CDouble GetFrequency() const { return m_frequency; }
+
+  CDouble GetBaseFrequency() const { return m_base_frequency; }
+
+  IDatum *GetValue(uint32_t dim) const { return (*m_values)[dim]; }
+
+  uint32_t GetNDimensions() const { return m_values->Size(); }
+};
+
+using CMDMCVItemArray = CDynamicPtrArray<CMDMCVItem, CleanupRelease>;
+
+}  // namespace gpmd
+
+#endif  // !GPMD_CMDMCVItem_H
+
+// EOF
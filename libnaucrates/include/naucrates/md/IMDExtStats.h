@@ -14,6 +14,7 @@
 
 #include "gpos/base.h"
 #include "naucrates/md/CMDDependency.h"
+#include "naucrates/md/CMDMCVItem.h"
 #include "naucrates/md/CMDNDistinct.h"
 #include "naucrates/md/IMDCacheObject.h"
 #include "naucrates/statistics/IStatistics.h"
@@ -41,6 +42,8 @@ class IMDExtStats : public IMDCacheObject {
   virtual CMDDependencyArray *GetDependencies() const = 0;
 
   virtual CMDNDistinctArray *GetNDistinctList() const = 0;
+
+  virtual CMDMCVItemArray *GetMCVList() const = 0;
 };
 
 }  // namespace gpmd
@@ -15,6 +15,14 @@
 
 namespace gpnaucrates {
 class CExtendedStatsProcessor {
+ private:
+  // estimate predicates on correlated columns with multi-column MCV lists
+  static void ApplyMCVStatsToScaleFactorFilterCalculation(CDoubleArray *scale_factors,
+                                                          CStatsPredConj *conjunctive_pred_stats,
+                                                          const IMDExtStatsInfo *md_statsinfo,
+                                                          UlongToIntMap *colid_to_attno_mapping, CMemoryPool *mp,
+                                                          UlongToHistogramMap *result_histograms);
+
  public:
   static void ApplyCorrelatedStatsToScaleFactorFilterCalculation(CDoubleArray *scale_factors,
                                                                  CStatsPredConj *conjunctive_pred_stats,
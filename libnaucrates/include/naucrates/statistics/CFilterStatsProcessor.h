@@ -44,6 +44,14 @@ class CFilterStatsProcessor {
                                                CHistogram *hist_before, CDouble *last_scale_factor,
                                                uint32_t *target_last_colid);
 
+  // create a new histogram after applying a col <> ALL(ARRAY[...]) filter
+  static CHistogram *MakeHistArrayCmpAllFilter(CMemoryPool *mp, CStatsPredArrayCmp *pred_stats, CBitSet *filter_colids,
+                                               CHistogram *hist_before, CDouble *last_scale_factor,
+                                               uint32_t *target_last_colid);
+
+  // sort the points of an array comparison, dropping NULLs and duplicates
+  static CPointArray *MakeSortedDedupedPoints(CMemoryPool *mp, CPointArray *points);
+
   // create a new hash map of histograms after applying a conjunctive or disjunctive filter
   static UlongToHistogramMap *MakeHistHashMapConjOrDisjFilter(CMemoryPool *mp, const CStatisticsConfig *stats_config,
                                                               UlongToHistogramMap *input_histograms, CDouble input_rows,
@@ -199,6 +199,13 @@ enum EOptTraceFlag {
   // Ordered Agg
   EopttraceDisableOrderedAgg = 103047,
 
+  // disable caching the inner side of index nested loop joins
+  EopttraceDisableMemoize = 103048,
+
+  // disable sorting inputs that already provide a prefix of the order
+  // group by group
+  EopttraceDisableIncrementalSort = 103049,
+
   ///////////////////////////////////////////////////////
   ///////////////////// statistics flags ////////////////
   //////////////////////////////////////////////////////
@@ -20,12 +20,14 @@ using namespace gpdxl;
 using namespace gpmd;
 
 CDXLExtStats::CDXLExtStats(CMemoryPool *mp, IMDId *rel_stats_mdid, CMDName *mdname,
-                           CMDDependencyArray *extstats_dependency_array, CMDNDistinctArray *ndistinct_array)
+                           CMDDependencyArray *extstats_dependency_array, CMDNDistinctArray *ndistinct_array,
+                           CMDMCVItemArray *mcv_array)
     : m_mp(mp),
       m_rel_stats_mdid(rel_stats_mdid),
       m_mdname(mdname),
       m_dependency_array(extstats_dependency_array),
-      m_ndistinct_array(ndistinct_array) {
+      m_ndistinct_array(ndistinct_array),
+      m_mcv_array(mcv_array) {
   GPOS_ASSERT(rel_stats_mdid->IsValid());
 }
 
@@ -37,6 +39,7 @@ CDXLExtStats::~CDXLExtStats() {
   m_rel_stats_mdid->Release();
   m_dependency_array->Release();
   m_ndistinct_array->Release();
+  m_mcv_array->Release();
 }
 
 //---------------------------------------------------------------------------
@@ -82,8 +85,10 @@ CDXLExtStats *CDXLExtStats::CreateDXLDummyExtStats(CMemoryPool *mp, IMDId *mdid)
 
   CMDNDistinctArray *extstats_ndistinct_array = GPOS_NEW(mp) CMDNDistinctArray(mp);
 
-  ext_stats_dxl =
-      GPOS_NEW(mp) CDXLExtStats(mp, mdid, mdname.Value(), extstats_dependency_array, extstats_ndistinct_array);
+  CMDMCVItemArray *extstats_mcv_array = GPOS_NEW(mp) CMDMCVItemArray(mp);
+
+  ext_stats_dxl = GPOS_NEW(mp)
+      CDXLExtStats(mp, mdid, mdname.Value(), extstats_dependency_array, extstats_ndistinct_array, extstats_mcv_array);
   mdname.Reset();
   return ext_stats_dxl.Reset();
 }
@@ -19,7 +19,9 @@
 #include "naucrates/statistics/CExtendedStatsProcessor.h"
 
 #include "gpos/common/CBitSet.h"
+#include "gpos/common/CBitSetIter.h"
 #include "naucrates/md/CMDExtStatsInfo.h"
+#include "naucrates/md/CMDMCVItem.h"
 #include "naucrates/statistics/CFilterStatsProcessor.h"
 
 #define STATS_MAX_DIMENSIONS 8 /* max number of attributes */
@@ -200,15 +202,248 @@ static CMDDependency *find_strongest_dependency(CMDDependencyArray *dependencies
   return strongest;
 }
 
+/*
+ * is_mcv_compatible_predicate
+ *		check that the predicate is a comparison of a column with a non-NULL
+ *		constant that can be evaluated on the items of an MCV list
+ *
+ * NB: This function is a simplified version of
+ *     statext_is_compatible_clause() in extended_stats.c.
+ */
+static bool is_mcv_compatible_predicate(CStatsPred *child_pred, UlongToIntMap *colid_to_attno_mapping) {
+  if (child_pred->IsAlreadyUsedInScaleFactorEstimation() ||
+      CStatsPred::EsptPoint != child_pred->GetPredStatsType()) {
+    return false;
+  }
+
+  CStatsPredPoint *point_pred = CStatsPredPoint::ConvertPredStats(child_pred);
+  switch (point_pred->GetCmpType()) {
+    case CStatsPred::EstatscmptEq:
+    case CStatsPred::EstatscmptNEq:
+    case CStatsPred::EstatscmptL:
+    case CStatsPred::EstatscmptLEq:
+    case CStatsPred::EstatscmptG:
+    case CStatsPred::EstatscmptGEq:
+      break;
+    default:
+      return false;
+  }
+
+  IDatum *datum = point_pred->GetPredPoint()->GetDatum();
+  if (datum->IsNull() || !datum->StatsAreComparable(datum)) {
+    return false;
+  }
+
+  uint32_t colid = child_pred->GetColId();
+  return nullptr != colid_to_attno_mapping->Find(&colid);
+}
+
+/*
+ * mcv_value_matches
+ *		evaluate a comparison of an MCV item value with a constant
+ *
+ * NB: As in mcv_get_match_bitmap() in mcv.c, NULL values never match.
+ */
+static bool mcv_value_matches(IDatum *value, CStatsPred::EStatsCmpType cmp_type, IDatum *datum) {
+  if (value->IsNull() || !value->StatsAreComparable(datum)) {
+    return false;
+  }
+
+  switch (cmp_type) {
+    case CStatsPred::EstatscmptEq:
+      return value->StatsAreEqual(datum);
+    case CStatsPred::EstatscmptNEq:
+      return !value->StatsAreEqual(datum);
+    case CStatsPred::EstatscmptL:
+      return value->StatsAreLessThan(datum);
+    case CStatsPred::EstatscmptLEq:
+      return value->StatsAreLessThan(datum) || value->StatsAreEqual(datum);
+    case CStatsPred::EstatscmptG:
+      return value->StatsAreGreaterThan(datum);
+    case CStatsPred::EstatscmptGEq:
+      return value->StatsAreGreaterThan(datum) || value->StatsAreEqual(datum);
+    default:
+      GPOS_ASSERT(false && "Unsupported comparison for MCV list");
+      return false;
+  }
+}
+
+/*
+ * mcv_clauselist_selectivity
+ *		estimate the selectivity of the compatible predicates on the keys of
+ *		an MCV statistics object and mark them as estimated
+ *
+ * The MCV list gives the exact selectivity for the part of the data it
+ * covers. For the rest, the selectivity assuming independent columns is
+ * corrected by the base frequency of the matching items, which is what the
+ * per-column histograms attribute to them:
+ *
+ *   sel = mcv_sel + min(max(simple_sel - mcv_basesel, 0), 1 - mcv_totalsel)
+ *
+ * The per-column histograms are filtered along the way, so that the
+ * predicates marked as estimated are still reflected in the output
+ * histograms.
+ *
+ * NB: This function is modified version of
+ *     statext_mcv_clauselist_selectivity() in extended_stats.c.
+ */
+static double mcv_clauselist_selectivity(CMemoryPool *mp, CStatsPredConj *conjunctive_pred_stats,
+                                         CMDExtStatsInfo *stat, CMDMCVItemArray *mcv_items,
+                                         UlongToIntMap *colid_to_attno_mapping,
+                                         UlongToHistogramMap *result_histograms) {
+  CBitSet *keys = stat->GetStatKeys();
+
+  /* the dimension of each attnum is its position among the keys */
+  UlongToUlongMap *attno_to_dim = GPOS_NEW(mp) UlongToUlongMap(mp);
+  CBitSetIter keys_iter(*keys);
+  uint32_t dim = 0;
+  while (keys_iter.Advance()) {
+    attno_to_dim->Insert(GPOS_NEW(mp) uint32_t(keys_iter.Bit()), GPOS_NEW(mp) uint32_t(dim++));
+  }
+
+  /* predicates covered by the statistics object */
+  CStatsPredPtrArry *clauses = GPOS_NEW(mp) CStatsPredPtrArry(mp);
+  ULongPtrArray *clause_dims = GPOS_NEW(mp) ULongPtrArray(mp);
+  for (uint32_t ul = 0; ul < conjunctive_pred_stats->GetNumPreds(); ul++) {
+    CStatsPred *child_pred = conjunctive_pred_stats->GetPredStats(ul);
+    if (!is_mcv_compatible_predicate(child_pred, colid_to_attno_mapping)) {
+      continue;
+    }
+
+    uint32_t colid = child_pred->GetColId();
+    uint32_t attnum = (uint32_t)*colid_to_attno_mapping->Find(&colid);
+    if (!keys->Get(attnum)) {
+      continue;
+    }
+
+    child_pred->AddRef();
+    clauses->Append(child_pred);
+    clause_dims->Append(GPOS_NEW(mp) uint32_t(*attno_to_dim->Find(&attnum)));
+  }
+  attno_to_dim->Release();
+
+  /* evaluate the predicates on the MCV items */
+  double mcv_sel = 0.0;
+  double mcv_basesel = 0.0;
+  double mcv_totalsel = 0.0;
+  for (uint32_t i = 0; i < mcv_items->Size(); i++) {
+    CMDMCVItem *item = (*mcv_items)[i];
+    mcv_totalsel += item->GetFrequency().Get();
+
+    bool matches = true;
+    for (uint32_t ul = 0; ul < clauses->Size() && matches; ul++) {
+      CStatsPredPoint *point_pred = CStatsPredPoint::ConvertPredStats((*clauses)[ul]);
+      matches = mcv_value_matches(item->GetValue(*(*clause_dims)[ul]), point_pred->GetCmpType(),
+                                  point_pred->GetPredPoint()->GetDatum());
+    }
+
+    if (matches) {
+      mcv_sel += item->GetFrequency().Get();
+      mcv_basesel += item->GetBaseFrequency().Get();
+    }
+  }
+
+  /* selectivity assuming independent columns, from the histograms */
+  double simple_sel = 1.0;
+  for (uint32_t ul = 0; ul < clauses->Size(); ul++) {
+    CStatsPredPoint *point_pred = CStatsPredPoint::ConvertPredStats((*clauses)[ul]);
+    uint32_t colid = point_pred->GetColId();
+
+    CDouble local_scale_factor(1.0);
+    CHistogram *histogram = result_histograms->Find(&colid)->MakeHistogramFilterNormalize(
+        point_pred->GetCmpType(), point_pred->GetPredPoint(), &local_scale_factor);
+    simple_sel /= local_scale_factor.Get();
+
+    CStatisticsUtils::AddHistogram(mp, colid, histogram, result_histograms, true /* fReplaceOld */);
+    GPOS_DELETE(histogram);
+
+    /* mark this one as done, so we don't touch it again. */
+    point_pred->SetEstimated();
+  }
+
+  clauses->Release();
+  clause_dims->Release();
+
+  /* combine, as in mcv_combine_selectivities() */
+  double other_sel = std::max(simple_sel - mcv_basesel, 0.0);
+  other_sel = std::min(other_sel, std::max(1.0 - mcv_totalsel, 0.0));
+
+  return std::min(mcv_sel + other_sel, 1.0);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CExtendedStatsProcessor::ApplyMCVStatsToScaleFactorFilterCalculation
+//
+//	@doc:
+//		Estimate conjunctive equality and range predicates on correlated
+//		columns with the multi-column MCV lists of extended statistics, one
+//		scale factor per statistics object applied. The widest statistics
+//		objects are applied first, until fewer than two columns with
+//		compatible predicates remain.
+//
+//---------------------------------------------------------------------------
+void CExtendedStatsProcessor::ApplyMCVStatsToScaleFactorFilterCalculation(CDoubleArray *scale_factors,
+                                                                          CStatsPredConj *conjunctive_pred_stats,
+                                                                          const IMDExtStatsInfo *md_statsinfo,
+                                                                          UlongToIntMap *colid_to_attno_mapping,
+                                                                          CMemoryPool *mp,
+                                                                          UlongToHistogramMap *result_histograms) {
+  if (nullptr == colid_to_attno_mapping) {
+    return;
+  }
+
+  const COptCtxt *poctxt = COptCtxt::PoctxtFromTLS();
+  CMDAccessor *md_accessor = poctxt->Pmda();
+
+  while (true) {
+    CBitSet *clauses_attnums = GPOS_NEW(mp) CBitSet(mp);
+    for (uint32_t ul = 0; ul < conjunctive_pred_stats->GetNumPreds(); ul++) {
+      CStatsPred *child_pred = conjunctive_pred_stats->GetPredStats(ul);
+      if (is_mcv_compatible_predicate(child_pred, colid_to_attno_mapping)) {
+        uint32_t colid = child_pred->GetColId();
+        clauses_attnums->ExchangeSet(*colid_to_attno_mapping->Find(&colid));
+      }
+    }
+
+    CMDExtStatsInfo *stat = nullptr;
+    if (clauses_attnums->Size() >= 2) {
+      stat = choose_best_statistics(mp, md_statsinfo->GetExtStatInfoArray(), clauses_attnums,
+                                    CMDExtStatsInfo::EstatMCV);
+    }
+    clauses_attnums->Release();
+
+    if (nullptr == stat) {
+      return;
+    }
+
+    CMDIdGPDB *pmdid = GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidExtStats, stat->GetStatOid());
+    const IMDExtStats *extstats = md_accessor->RetrieveExtStats(pmdid);
+    pmdid->Release();
+
+    CMDMCVItemArray *mcv_items = extstats->GetMCVList();
+    if (0 == mcv_items->Size()) {
+      return;
+    }
+
+    double sel = mcv_clauselist_selectivity(mp, conjunctive_pred_stats, stat, mcv_items, colid_to_attno_mapping,
+                                            result_histograms);
+    sel = std::max(sel, CStatistics::Epsilon.Get());
+
+    scale_factors->Append(GPOS_NEW(mp) CDouble(1.0 / sel));
+  }
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CExtendedStatsProcessor::ApplyCorrelatedStatsToScaleFactorFilterCalculation
 //
 //	@doc:
 //		This function is essentially an ORCA version of the dependencies.c
-//		function dependencies_clauselist_selectivity(). It determines the most
-//		suitable extended statistic to apply and computes the scale factor for
-//		the conjunctive_pred_stats.
+//		function dependencies_clauselist_selectivity(), preceded by the
+//		multi-column MCV lists. It determines the most suitable extended
+//		statistic to apply and computes the scale factor for the
+//		conjunctive_pred_stats.
 //
 //---------------------------------------------------------------------------
 void CExtendedStatsProcessor::ApplyCorrelatedStatsToScaleFactorFilterCalculation(
@@ -220,6 +455,15 @@ void CExtendedStatsProcessor::ApplyCorrelatedStatsToScaleFactorFilterCalculation
     return;
   }
 
+  /*
+   * As in statext_clauselist_selectivity(), apply the MCV lists first:
+   * they also handle range predicates and capture the actual frequency of
+   * combinations of values. The functional dependencies are then applied
+   * to the predicates not estimated yet.
+   */
+  ApplyMCVStatsToScaleFactorFilterCalculation(scale_factors, conjunctive_pred_stats, md_statsinfo,
+                                              colid_to_attno_mapping, mp, result_histograms);
+
   double s1 = 1.0;
   CMDExtStatsInfo *stat;
   CMDDependencyArray *dependencies;
@@ -543,6 +543,11 @@ CHistogram *CFilterStatsProcessor::MakeHistSimpleFilter(CMemoryPool *mp, CStatsP
   if (CStatsPred::EsptArrayCmp == pred_stats->GetPredStatsType()) {
     CStatsPredArrayCmp *arraycmp_pred_stats = CStatsPredArrayCmp::ConvertPredStats(pred_stats);
 
+    if (CStatsPred::EstatscmptNEq == arraycmp_pred_stats->GetCmpType()) {
+      return MakeHistArrayCmpAllFilter(mp, arraycmp_pred_stats, filter_colids, hist_before, last_scale_factor,
+                                       target_last_colid);
+    }
+
     return MakeHistArrayCmpAnyFilter(mp, arraycmp_pred_stats, filter_colids, hist_before, last_scale_factor,
                                      target_last_colid);
   }
@@ -653,28 +658,7 @@ CHistogram *CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp, CS
   // 4. Compute and adjust the resultant scale factor for the filter.
 
   // First, de-duplicate the constants in the array list
-  CPointArray *points = pred_stats->GetPoints();
-  if (points->Size() > 1) {
-    points->Sort(&CUtils::CPointCmp);
-  }
-
-  CPointArray *deduped_points = GPOS_NEW(mp) CPointArray(mp);
-  IDatum *prev_datum = nullptr;
-
-  for (uint32_t ul = 0; ul < points->Size(); ++ul) {
-    CPoint *point = (*points)[ul];
-    IDatum *datum = point->GetDatum();
-    GPOS_ASSERT(datum->StatsAreComparable(datum));
-    if (datum->IsNull()) {
-      continue;
-    }
-    if (prev_datum != nullptr && prev_datum->StatsAreEqual(datum)) {
-      continue;
-    }
-    point->AddRef();
-    deduped_points->Append(point);
-    prev_datum = datum;
-  }
+  CPointArray *deduped_points = MakeSortedDedupedPoints(mp, pred_stats->GetPoints());
   CDouble dummy_rows(deduped_points->Size());
 
   // Create buckets for the result histogram using the same bucket boundaries
@@ -751,6 +735,123 @@ CHistogram *CFilterStatsProcessor::MakeHistArrayCmpAnyFilter(CMemoryPool *mp, CS
   return result_histogram;
 }
 
+// create a new histogram after applying a col <> ALL(ARRAY[...]) filter
+CHistogram *CFilterStatsProcessor::MakeHistArrayCmpAllFilter(CMemoryPool *mp, CStatsPredArrayCmp *pred_stats,
+                                                             CBitSet *filter_colids, CHistogram *base_histogram,
+                                                             CDouble *last_scale_factor, uint32_t *target_last_colid) {
+  GPOS_ASSERT(nullptr != pred_stats);
+  GPOS_ASSERT(nullptr != filter_colids);
+  GPOS_ASSERT(nullptr != base_histogram);
+  GPOS_ASSERT(pred_stats->GetCmpType() == CStatsPred::EstatscmptNEq);
+
+  const uint32_t colid = pred_stats->GetColId();
+  (void)filter_colids->ExchangeSet(colid);
+  *target_last_colid = colid;
+
+  // "col <> NULL" is never true, and so neither is a NOT IN list with a NULL
+  CPointArray *points = pred_stats->GetPoints();
+  for (uint32_t ul = 0; ul < points->Size(); ++ul) {
+    if ((*points)[ul]->GetDatum()->IsNull()) {
+      *last_scale_factor = CDouble(GPOS_FP_ABS_MAX);
+      return GPOS_NEW(mp) CHistogram(mp, GPOS_NEW(mp) CBucketArray(mp), true /* is_well_defined */,
+                                     CDouble(0.0) /* null_freq */, CDouble(0.0) /* distinct_remain */,
+                                     CDouble(0.0) /* freq_remain */);
+    }
+  }
+
+  if (!base_histogram->IsWellDefined()) {
+    *last_scale_factor = *last_scale_factor / CHistogram::DefaultSelectivity;
+    return GPOS_NEW(mp) CHistogram(mp, false /* is_well_defined */);
+  }
+
+  // Applying each "col <> const" in turn splits the bucket holding the
+  // constant and copies the whole histogram, which is quadratic in the size
+  // of the list. Instead, walk the sorted and de-duplicated constants along
+  // the bucket boundaries once, and remove 1/NDV of the frequency of a
+  // bucket for every constant falling into it. Constants outside of all
+  // buckets leave the histogram unchanged, as for a single "col <> const".
+  CPointArray *deduped_points = MakeSortedDedupedPoints(mp, pred_stats->GetPoints());
+  const uint32_t num_points = deduped_points->Size();
+
+  const CBucketArray *base_buckets = base_histogram->GetBuckets();
+  CBucketArray *result_buckets = GPOS_NEW(mp) CBucketArray(mp);
+  uint32_t point_iter = 0;
+  for (uint32_t bucket_iter = 0; bucket_iter < base_buckets->Size(); ++bucket_iter) {
+    CBucket *bucket = (*base_buckets)[bucket_iter];
+
+    // skip constants before the bucket
+    while (point_iter < num_points && bucket->IsBefore((*deduped_points)[point_iter])) {
+      point_iter++;
+    }
+
+    // count the constants that map to the current bucket
+    uint32_t ndv = 0;
+    while (point_iter < num_points && bucket->Contains((*deduped_points)[point_iter])) {
+      ndv++;
+      point_iter++;
+    }
+
+    if (0 == ndv) {
+      result_buckets->Append(bucket->MakeBucketCopy(mp));
+      continue;
+    }
+
+    CDouble distinct = bucket->GetNumDistinct();
+    if (bucket->IsSingleton() || distinct <= CDouble(ndv)) {
+      // every value of the bucket is excluded
+      continue;
+    }
+
+    CBucket *result_bucket = bucket->MakeBucketCopy(mp);
+    result_bucket->SetFrequency(bucket->GetFrequency() * (CDouble(1.0) - CDouble(ndv) / distinct));
+    result_bucket->SetDistinct(distinct - CDouble(ndv));
+    result_buckets->Append(result_bucket);
+  }
+  deduped_points->Release();
+
+  // NULLs never qualify
+  CHistogram *result_histogram =
+      GPOS_NEW(mp) CHistogram(mp, result_buckets, true /* is_well_defined */, CDouble(0.0) /* null_freq */,
+                              base_histogram->GetDistinctRemain(), base_histogram->GetFreqRemain());
+
+  CDouble local_scale_factor = result_histogram->NormalizeHistogram();
+  GPOS_ASSERT(double(1.0) <= local_scale_factor.Get());
+
+  *last_scale_factor = *last_scale_factor * local_scale_factor;
+
+  return result_histogram;
+}
+
+// sort the points of an array comparison, dropping NULLs and duplicates; an
+// IN list matches no NULL row, a NOT IN list with a NULL is handled by the caller
+CPointArray *CFilterStatsProcessor::MakeSortedDedupedPoints(CMemoryPool *mp, CPointArray *points) {
+  GPOS_ASSERT(nullptr != points);
+
+  if (points->Size() > 1) {
+    points->Sort(&CUtils::CPointCmp);
+  }
+
+  CPointArray *deduped_points = GPOS_NEW(mp) CPointArray(mp);
+  IDatum *prev_datum = nullptr;
+
+  for (uint32_t ul = 0; ul < points->Size(); ++ul) {
+    CPoint *point = (*points)[ul];
+    IDatum *datum = point->GetDatum();
+    GPOS_ASSERT(datum->StatsAreComparable(datum));
+    if (datum->IsNull()) {
+      continue;
+    }
+    if (prev_datum != nullptr && prev_datum->StatsAreEqual(datum)) {
+      continue;
+    }
+    point->AddRef();
+    deduped_points->Append(point);
+    prev_datum = datum;
+  }
+
+  return deduped_points;
+}
+
 // check if the column is a new column for statistic calculation
 bool CFilterStatsProcessor::IsNewStatsColumn(uint32_t colid, uint32_t last_colid) {
   return (UINT32_MAX == colid || colid != last_colid);
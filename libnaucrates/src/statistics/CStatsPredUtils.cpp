@@ -884,6 +884,7 @@ void CStatsPredUtils::ProcessArrayCmp(CMemoryPool *mp, CExpression *predicate_ex
   CPointArray *points = nullptr;
   bool is_array_cmp_any = (CScalarArrayCmp::EarrcmpAny == scalar_array_cmp_op->Earrcmpt());
   bool is_array_cmp_eq = (stats_cmp_type == CStatsPred::EstatscmptEq);
+  bool is_array_cmp_neq = (stats_cmp_type == CStatsPred::EstatscmptNEq);
 
   if (is_array_cmp_any) {
     // in case of exprs of the form "a op ANY (ARRAY[...])", each element
@@ -902,6 +903,12 @@ void CStatsPredUtils::ProcessArrayCmp(CMemoryPool *mp, CExpression *predicate_ex
     // in case of exprs of the form "a op ALL (ARRAY[...])", each element
     // is implicitly AND-ed, and so can be directly added to result_pred_stats
     pred_stats = result_pred_stats;
+
+    // "a <> ALL (ARRAY[...])" has a similar fast-path, so that long NOT IN
+    // lists do not produce one histogram per element
+    if (is_array_cmp_neq) {
+      points = GPOS_NEW(mp) CPointArray(mp);
+    }
   }
 
   const uint32_t num_array_elems = CUtils::UlScalarArrayArity(expr_scalar_array);
@@ -916,7 +923,7 @@ void CStatsPredUtils::ProcessArrayCmp(CMemoryPool *mp, CExpression *predicate_ex
         // stats calculations on such datums unsupported
         CStatsPred *child_pred_stats = GPOS_NEW(mp) CStatsPredUnsupported(col_ref->Id(), stats_cmp_type);
         pred_stats->Append(child_pred_stats);
-      } else if (is_array_cmp_any && is_array_cmp_eq) {
+      } else if ((is_array_cmp_any && is_array_cmp_eq) || (!is_array_cmp_any && is_array_cmp_neq)) {
         // fast-path using CStatsPredArrayCmp
         GPOS_ASSERT(points != nullptr);
         datum->AddRef();
@@ -943,6 +950,12 @@ void CStatsPredUtils::ProcessArrayCmp(CMemoryPool *mp, CExpression *predicate_ex
     result_pred_stats->Append(pred_stats_disj);
   } else {
     GPOS_ASSERT(CScalarArrayCmp::EarrcmpAll == scalar_array_cmp_op->Earrcmpt());
+    if (is_array_cmp_neq) {
+      // "a <> ALL (ARRAY[...])"
+      CStatsPredArrayCmp *pred_stats_array_cmp = GPOS_NEW(mp) CStatsPredArrayCmp(col_ref->Id(), stats_cmp_type, points);
+      result_pred_stats->Append(pred_stats_array_cmp);
+    }
+
     // "a op ALL (ARRAY[...])"
     // no additional work needed here, since we already added the preds to the result_pred_stats
   }
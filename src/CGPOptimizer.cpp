@@ -39,18 +39,24 @@ extern MemoryContext MessageContext;
 //		Optimize given query using GP optimizer
 //
 //---------------------------------------------------------------------------
-PlannedStmt *CGPOptimizer::GPOPTOptimizedPlan(Query *query, gpdxl::OptConfig *config) {
+PlannedStmt *CGPOptimizer::GPOPTOptimizedPlan(Query *query, gpdxl::OptConfig *config, uint32_t parallel_workers) {
   SOptContext gpopt_context;
   PlannedStmt *plStmt = nullptr;
 
   gpopt_context.config = config;
+  gpopt_context.m_parallel_workers = parallel_workers;
+
+  // only enforced by palloc memory pools
+  CMemoryPoolPalloc::SetQueryMemoryLimit((uint64_t)config->optimizer_memory_limit * 1024);
 
   GPOS_TRY {
     plStmt = COptTasks::GPOPTOptimizedPlan(query, &gpopt_context);
+    CMemoryPoolPalloc::SetQueryMemoryLimit(0);
     // clean up context
     gpopt_context.Free(gpopt_context.epinQuery, gpopt_context.epinPlStmt);
   }
   GPOS_CATCH_EX(ex) {
+    CMemoryPoolPalloc::SetQueryMemoryLimit(0);
     // clone the error message before context free.
     char *serialized_error_msg = gpopt_context.CloneErrorMsg(MessageContext);
     // clean up context
@@ -95,6 +101,40 @@ PlannedStmt *CGPOptimizer::GPOPTOptimizedPlan(Query *query, gpdxl::OptConfig *co
   return plStmt;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CGPOptimizer::FValidSearchStrategy
+//
+//	@doc:
+//		Check the search strategy of the given config; if it is invalid
+//		return false and the parser's message in error_msg
+//
+//---------------------------------------------------------------------------
+bool CGPOptimizer::FValidSearchStrategy(gpdxl::OptConfig *config, char **error_msg) {
+  SOptContext gpopt_context;
+  bool is_valid = true;
+
+  gpopt_context.config = config;
+
+  GPOS_TRY {
+    COptTasks::ValidateSearchStrategy(&gpopt_context);
+  }
+  GPOS_CATCH_EX(ex) {
+    *error_msg = gpopt_context.CloneErrorMsg(CurrentMemoryContext);
+    gpopt_context.Free(gpopt_context.epinQuery, gpopt_context.epinPlStmt);
+
+    if (GPOS_MATCH_EX(ex, gpdxl::ExmaGPDB, gpdxl::ExmiGPDBError)) {
+      PG_RE_THROW();
+    }
+
+    GPOS_RESET_EX;
+    is_valid = false;
+  }
+  GPOS_CATCH_END;
+
+  return is_valid;
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		InitGPOPT()
@@ -103,12 +143,13 @@ PlannedStmt *CGPOptimizer::GPOPTOptimizedPlan(Query *query, gpdxl::OptConfig *co
 //		Initialize GPTOPT and dependent libraries
 //
 //---------------------------------------------------------------------------
-void CGPOptimizer::InitGPOPT() {
-  if (false) {
+void CGPOptimizer::InitGPOPT(const gpdxl::OptConfig *config) {
+  // must come before gpos_init(), which sets up the default manager
+  if (config->palloc_memory_pools) {
     CMemoryPoolPallocManager::Init();
   }
 
-  struct gpos_init_params params = {gpdb::IsAbortRequested};
+  struct gpos_init_params params = {gpdb::IsAbortRequested, gpdb::ExecuteHostCall};
 
   gpos_init(&params);
   gpdxl_init();
@@ -139,10 +180,10 @@ void CGPOptimizer::TerminateGPOPT() {
 //---------------------------------------------------------------------------
 extern "C" {
 
-void InitGPOPT() {
+void InitGPOPT(const gpdxl::OptConfig *config) {
   GPOS_TRY {
     try {
-      CGPOptimizer::InitGPOPT();
+      CGPOptimizer::InitGPOPT(config);
     } catch (CException ex) {
       throw ex;
     } catch (...) {
@@ -16,11 +16,15 @@
 extern "C" {
 #include <postgres.h>
 
+#include <common/pg_prng.h>
+#include <optimizer/cost.h>
 #include <utils/guc.h>
 }
 
 #include "gpopt/config/CConfigParamMapping.h"
+#include "gpopt/config/config.h"
 #include "gpopt/xforms/CXform.h"
+#include "gpos/task/CTask.h"
 
 using namespace gpos;
 using namespace gpdxl;
@@ -105,7 +109,6 @@ int optimizer_samples_number = 1000;
 int optimizer_join_arity_for_associativity_commutativity = 18;
 int optimizer_array_expansion_threshold = 20;
 int optimizer_join_order_threshold = 10;
-int optimizer_join_order;
 int optimizer_cte_inlining_bound;
 int optimizer_push_group_by_below_setop_threshold = 10;
 int optimizer_xform_bind_threshold;
@@ -135,11 +138,6 @@ bool optimizer_enable_orderedagg;
 #define OPTIMIZER_XFORMS_COUNT 400
 bool optimizer_xforms[OPTIMIZER_XFORMS_COUNT] = {0};
 
-#define JOIN_ORDER_IN_QUERY 0
-#define JOIN_ORDER_GREEDY_SEARCH 1
-#define JOIN_ORDER_EXHAUSTIVE_SEARCH 2
-#define JOIN_ORDER_EXHAUSTIVE2_SEARCH 3
-
 #define OPTIMIZER_GPDB_LEGACY 0       /* GPDB's legacy cost model */
 #define OPTIMIZER_GPDB_CALIBRATED 1   /* GPDB's calibrated cost model */
 #define OPTIMIZER_GPDB_EXPERIMENTAL 2 /* GPDB's experimental cost model */
@@ -361,6 +359,13 @@ CConfigParamMapping::SConfigMappingElem CConfigParamMapping::m_elements[] = {
     {EopttraceDisableInnerNLJ, &optimizer_enable_nljoin,
      true,  // m_negate_param
      GPOS_WSZ_LIT("Enable nested loop join alternatives")},
+    {EopttraceDisableMemoize, &enable_memoize,
+     true,  // m_negate_param
+     GPOS_WSZ_LIT("Cache the inner side of index nested loop joins, follows the enable_memoize setting")},
+
+    {EopttraceDisableIncrementalSort, &enable_incremental_sort,
+     true,  // m_negate_param
+     GPOS_WSZ_LIT("Sort presorted inputs incrementally, follows the enable_incremental_sort setting")},
 
 };
 
@@ -393,6 +398,28 @@ CBitSet *CConfigParamMapping::PackConfigParamInBitset(CMemoryPool *mp,
     }
   }
 
+  // only the plan generator emits Memoize and Incremental Sort nodes, the DXL
+  // translators would drop the cache and turn the sort into a full one
+  if (!GPOS_CONDIF(enable_new_planner_generation)) {
+    traceflag_bitset->ExchangeSet(EopttraceDisableMemoize);
+    traceflag_bitset->ExchangeSet(EopttraceDisableIncrementalSort);
+  }
+
+  // trace dumps requested through pg_orca.trace_level, for a sample of the statements
+  int trace_level = GPOS_CONDIF(trace_level);
+  if (OPTIMIZER_TRACE_OFF != trace_level && pg_prng_double(&pg_global_prng_state) < GPOS_CONDIF(trace_sample_rate)) {
+    traceflag_bitset->ExchangeSet(EopttracePrintPlan);
+
+    if (OPTIMIZER_TRACE_QUERY <= trace_level) {
+      traceflag_bitset->ExchangeSet(EopttracePrintQuery);
+    }
+
+    if (OPTIMIZER_TRACE_VERBOSE <= trace_level) {
+      traceflag_bitset->ExchangeSet(EopttracePrintMemoAfterOptimization);
+      traceflag_bitset->ExchangeSet(EopttracePrintOptimizationStatistics);
+    }
+  }
+
   // pack disable flags of xforms
   for (uint32_t ul = 0; ul < xform_id; ul++) {
     GPOS_ASSERT(!traceflag_bitset->Get(EopttraceDisableXformBase + ul) && "xform trace flag already set");
@@ -470,23 +497,34 @@ CBitSet *CConfigParamMapping::PackConfigParamInBitset(CMemoryPool *mp,
     traceflag_bitset->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfImplementFullOuterMergeJoin));
   }
 
+  // the merge joins other than the full one are opt in
+  if (!optimizer_enable_mergejoin || !GPOS_CONDIF(enable_mergejoin)) {
+    traceflag_bitset->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfInnerJoin2MergeJoin));
+    traceflag_bitset->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfLeftOuterJoin2MergeJoin));
+    traceflag_bitset->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfLeftSemiJoin2MergeJoin));
+    traceflag_bitset->ExchangeSet(GPOPT_DISABLE_XFORM_TF(CXform::ExfLeftAntiSemiJoin2MergeJoin));
+  }
+
   CBitSet *join_heuristic_bitset = nullptr;
-  switch (optimizer_join_order) {
-    case JOIN_ORDER_IN_QUERY:
+  switch (GPOS_CONDIF(join_order)) {
+    case OPTIMIZER_JOIN_ORDER_QUERY:
       join_heuristic_bitset = CXform::PbsJoinOrderInQueryXforms(mp);
       break;
-    case JOIN_ORDER_GREEDY_SEARCH:
+    case OPTIMIZER_JOIN_ORDER_GREEDY:
       join_heuristic_bitset = CXform::PbsJoinOrderOnGreedyXforms(mp);
       break;
-    case JOIN_ORDER_EXHAUSTIVE_SEARCH:
+    case OPTIMIZER_JOIN_ORDER_EXHAUSTIVE:
       join_heuristic_bitset = CXform::PbsJoinOrderOnExhaustiveXforms(mp);
       break;
-    case JOIN_ORDER_EXHAUSTIVE2_SEARCH:
+    case OPTIMIZER_JOIN_ORDER_EXHAUSTIVE2:
       join_heuristic_bitset = CXform::PbsJoinOrderOnExhaustive2Xforms(mp);
       break;
+    case OPTIMIZER_JOIN_ORDER_DPHYP:
+      join_heuristic_bitset = CXform::PbsJoinOrderOnDPhypXforms(mp);
+      break;
     default:
       elog(ERROR,
-           "Invalid value for optimizer_join_order, must \
+           "Invalid value for pg_orca.join_order, must \
 				 not come here");
       break;
   }
@@ -25,6 +25,7 @@
 #include <limits>  // std::numeric_limits
 
 #include "catalog/pg_collation.h"
+#include "gpopt/utils/CSharedMDCache.h"
 #include "gpos/base.h"
 #include "gpos/error/CAutoExceptionStack.h"
 #include "gpos/error/CException.h"
@@ -34,8 +35,12 @@ extern "C" {
 
 #include <access/amapi.h>
 #include <access/genam.h>
+#include <access/sysattr.h>
 #include <catalog/pg_aggregate.h>
 #include <catalog/pg_inherits.h>
+#include <catalog/pg_statistic_ext.h>
+#include <catalog/pg_statistic_ext_data.h>
+#include <catalog/pg_type.h>
 #include <commands/defrem.h>
 #include <foreign/fdwapi.h>
 #include <funcapi.h>
@@ -43,13 +48,18 @@ extern "C" {
 #include <nodes/nodeFuncs.h>
 #include <optimizer/clauses.h>
 #include <optimizer/optimizer.h>
+#include <optimizer/pathnode.h>
 #include <optimizer/plancat.h>
+#include <optimizer/restrictinfo.h>
 #include <optimizer/subselect.h>
 #include <optimizer/tlist.h>
 #include <parser/parse_agg.h>
 #include <parser/parse_oper.h>
 #include <partitioning/partdesc.h>
+#include <statistics/extended_stats_internal.h>
+#include <statistics/statistics.h>
 #include <storage/lmgr.h>
+#include <utils/array.h>
 #include <utils/builtins.h>
 #include <utils/datum.h>
 #include <utils/fmgroids.h>
@@ -57,6 +67,7 @@ extern "C" {
 #include <utils/memutils.h>
 #include <utils/numeric.h>
 #include <utils/partcache.h>
+#include <utils/relcache.h>
 #include <utils/syscache.h>
 }
 
@@ -483,7 +494,44 @@ bool gpdb::IsRepSafeAgg(Oid aggid) {
 bool gpdb::IsAggPartialCapable(Oid aggid) {
   {
     /* catalog tables: pg_aggregate */
-    return false;
+    HeapTuple tp = SearchSysCache1(AGGFNOID, ObjectIdGetDatum(aggid));
+    if (!HeapTupleIsValid(tp))
+      elog(ERROR, "cache lookup failed for aggregate %u", aggid);
+
+    Form_pg_aggregate aggform = (Form_pg_aggregate)GETSTRUCT(tp);
+
+    // partial states are combined by the final aggregate; internal states
+    // additionally have to be (de)serialized to cross a Gather, and the
+    // type of a polymorphic state is only known once resolved per call
+    bool result = OidIsValid(aggform->aggcombinefn) && !IsPolymorphicType(aggform->aggtranstype);
+    if (result && INTERNALOID == aggform->aggtranstype) {
+      result = OidIsValid(aggform->aggserialfn) && OidIsValid(aggform->aggdeserialfn);
+    }
+
+    ReleaseSysCache(tp);
+    return result;
+  }
+
+  return false;
+}
+
+bool gpdb::IsAggHashCapable(Oid aggid) {
+  {
+    /* catalog tables: pg_aggregate */
+    HeapTuple tp = SearchSysCache1(AGGFNOID, ObjectIdGetDatum(aggid));
+    if (!HeapTupleIsValid(tp))
+      elog(ERROR, "cache lookup failed for aggregate %u", aggid);
+
+    Form_pg_aggregate aggform = (Form_pg_aggregate)GETSTRUCT(tp);
+
+    // a hash table spills input tuples, not states, so no combine function
+    // is needed; but an internal state without a size estimate, such as
+    // the one of array_agg, may grow without bound per group, which the
+    // cost model cannot account for
+    bool result = INTERNALOID != aggform->aggtranstype || 0 < aggform->aggtransspace;
+
+    ReleaseSysCache(tp);
+    return result;
   }
 
   return false;
@@ -522,23 +570,115 @@ HeapTuple gpdb::GetAttStats(Oid relid, AttrNumber attnum) {
   return nullptr;
 }
 
+// kinds of the given statistics object that ANALYZE has built; the load
+// functions raise an error for the others
+static List *GetBuiltExtStatsKinds(HeapTuple stat_tuple, Oid stat_oid) {
+  List *kinds = NIL;
+
+  HeapTuple data_tuple = SearchSysCache2(STATEXTDATASTXOID, ObjectIdGetDatum(stat_oid), BoolGetDatum(false));
+  if (!HeapTupleIsValid(data_tuple)) {
+    return NIL;
+  }
+
+  bool isnull = false;
+  Datum datum = SysCacheGetAttr(STATEXTOID, stat_tuple, Anum_pg_statistic_ext_stxkind, &isnull);
+  ArrayType *arr = DatumGetArrayTypeP(datum);
+  char *enabled = (char *)ARR_DATA_PTR(arr);
+
+  for (int i = 0; i < ARR_DIMS(arr)[0]; i++) {
+    if (statext_is_kind_built(data_tuple, enabled[i])) {
+      kinds = lappend_int(kinds, enabled[i]);
+    }
+  }
+
+  ReleaseSysCache(data_tuple);
+
+  return kinds;
+}
+
 List *gpdb::GetExtStats(Relation rel) {
   {
-    /* catalog tables: pg_statistic_ext */
-    return nullptr;
+    /* catalog tables: pg_statistic_ext, pg_statistic_ext_data */
+    List *stats = NIL;
+    List *stat_oids = RelationGetStatExtList(rel);
+
+    ListCell *lc = nullptr;
+    foreach (lc, stat_oids) {
+      Oid stat_oid = lfirst_oid(lc);
+
+      HeapTuple stat_tuple = SearchSysCache1(STATEXTOID, ObjectIdGetDatum(stat_oid));
+      if (!HeapTupleIsValid(stat_tuple)) {
+        elog(ERROR, "cache lookup failed for statistics object %u", stat_oid);
+      }
+
+      // the dimensions of statistics on expressions do not map to
+      // attributes, which is all the optimizer matches predicates on
+      bool has_exprs = !heap_attisnull(stat_tuple, Anum_pg_statistic_ext_stxexprs, nullptr);
+
+      Form_pg_statistic_ext stat_form = (Form_pg_statistic_ext)GETSTRUCT(stat_tuple);
+      Bitmapset *keys = nullptr;
+      for (int i = 0; i < stat_form->stxkeys.dim1; i++) {
+        keys = bms_add_member(keys, stat_form->stxkeys.values[i]);
+      }
+
+      List *kinds = has_exprs ? NIL : GetBuiltExtStatsKinds(stat_tuple, stat_oid);
+
+      ListCell *lc_kind = nullptr;
+      foreach (lc_kind, kinds) {
+        StatisticExtInfo *info = makeNode(StatisticExtInfo);
+        info->statOid = stat_oid;
+        info->inherit = false;
+        info->rel = nullptr;
+        info->kind = (char)lfirst_int(lc_kind);
+        info->keys = bms_copy(keys);
+        info->exprs = NIL;
+
+        stats = lappend(stats, info);
+      }
+
+      list_free(kinds);
+      bms_free(keys);
+      ReleaseSysCache(stat_tuple);
+    }
+
+    list_free(stat_oids);
+
+    return stats;
   }
 
   return nullptr;
 }
 
 char *gpdb::GetExtStatsName(Oid statOid) {
-  { return nullptr; }
+  {
+    /* catalog tables: pg_statistic_ext */
+    HeapTuple stat_tuple = SearchSysCache1(STATEXTOID, ObjectIdGetDatum(statOid));
+    if (!HeapTupleIsValid(stat_tuple)) {
+      elog(ERROR, "cache lookup failed for statistics object %u", statOid);
+    }
+
+    char *name = pstrdup(NameStr(((Form_pg_statistic_ext)GETSTRUCT(stat_tuple))->stxname));
+    ReleaseSysCache(stat_tuple);
+
+    return name;
+  }
 
   return nullptr;
 }
 
 List *gpdb::GetExtStatsKinds(Oid statOid) {
-  { return nullptr; }
+  {
+    /* catalog tables: pg_statistic_ext, pg_statistic_ext_data */
+    HeapTuple stat_tuple = SearchSysCache1(STATEXTOID, ObjectIdGetDatum(statOid));
+    if (!HeapTupleIsValid(stat_tuple)) {
+      elog(ERROR, "cache lookup failed for statistics object %u", statOid);
+    }
+
+    List *kinds = GetBuiltExtStatsKinds(stat_tuple, statOid);
+    ReleaseSysCache(stat_tuple);
+
+    return kinds;
+  }
 
   return nullptr;
 }
@@ -1194,11 +1334,30 @@ List *gpdb::GetRelationIndexes(Relation relation) {
 }
 
 MVNDistinct *gpdb::GetMVNDistinct(Oid stat_oid) {
-  { return nullptr; }
+  {
+    /* catalog tables: pg_statistic_ext_data */
+    return statext_ndistinct_load(stat_oid, false /* inh */);
+  }
+
+  return nullptr;
 }
 
 MVDependencies *gpdb::GetMVDependencies(Oid stat_oid) {
-  { return nullptr; }
+  {
+    /* catalog tables: pg_statistic_ext_data */
+    return statext_dependencies_load(stat_oid, false /* inh */);
+  }
+
+  return nullptr;
+}
+
+MCVList *gpdb::GetMVMCVList(Oid stat_oid) {
+  {
+    /* catalog tables: pg_statistic_ext_data */
+    return statext_mcv_load(stat_oid, false /* inh */);
+  }
+
+  return nullptr;
 }
 
 gpdb::RelationWrapper gpdb::GetRelation(Oid rel_oid) {
@@ -1210,7 +1369,79 @@ gpdb::RelationWrapper gpdb::GetRelation(Oid rel_oid) {
 
 ForeignScan *gpdb::CreateForeignScan(Oid rel_oid, Index scanrelid, List *qual, List *targetlist, Query *query,
                                      RangeTblEntry *rte) {
-  { return nullptr; }
+  {
+    /* catalog tables: pg_class, pg_foreign_table, pg_foreign_server */
+    // the FDW callbacks plan against a PlannerInfo, build one that knows
+    // just the scanned relation, at the range table index of the plan
+    Query *parse = makeNode(Query);
+    parse->commandType = nullptr != query ? query->commandType : CMD_SELECT;
+    for (Index rti = 1; rti < scanrelid; rti++) {
+      RangeTblEntry *dummy = makeNode(RangeTblEntry);
+      dummy->rtekind = RTE_RESULT;
+      parse->rtable = lappend(parse->rtable, dummy);
+    }
+    parse->rtable = lappend(parse->rtable, rte);
+
+    PlannerInfo *root = makeNode(PlannerInfo);
+    root->parse = parse;
+    root->glob = makeNode(PlannerGlobal);
+    root->query_level = 1;
+    root->planner_cxt = CurrentMemoryContext;
+    root->wt_param_id = -1;
+    root->all_baserels = bms_make_singleton(scanrelid);
+    root->all_query_rels = root->all_baserels;
+    setup_simple_rel_arrays(root);
+
+    RelOptInfo *rel = build_simple_rel(root, scanrelid, nullptr);
+    if (nullptr == rel->fdwroutine)
+      elog(ERROR, "foreign-data wrapper handler for relation %u is missing", rel_oid);
+
+    List *vars = pull_var_clause((Node *)targetlist, PVC_RECURSE_PLACEHOLDERS);
+    vars = list_concat(vars, pull_var_clause((Node *)qual, PVC_RECURSE_PLACEHOLDERS));
+    foreach_node(Var, var, vars) {
+      if (!list_member(rel->reltarget->exprs, var))
+        rel->reltarget->exprs = lappend(rel->reltarget->exprs, var);
+    }
+
+    foreach_ptr(Expr, clause, qual) {
+      rel->baserestrictinfo = lappend(rel->baserestrictinfo, make_simple_restrictinfo(root, clause));
+    }
+
+    // what create_foreignscan_plan() does with the cheapest path
+    rel->fdwroutine->GetForeignRelSize(root, rel, rel_oid);
+    rel->fdwroutine->GetForeignPaths(root, rel, rel_oid);
+    if (NIL == rel->pathlist)
+      elog(ERROR, "could not devise a query plan for foreign table %u", rel_oid);
+    set_cheapest(rel);
+
+    ForeignPath *best_path = (ForeignPath *)rel->cheapest_total_path;
+    List *scan_clauses = rel->baserestrictinfo;
+    ForeignScan *foreign_scan =
+        rel->fdwroutine->GetForeignPlan(root, rel, rel_oid, best_path, targetlist, scan_clauses, nullptr);
+
+    foreign_scan->fs_server = rel->serverid;
+    foreign_scan->fs_relids = rel->relids;
+    foreign_scan->fs_base_relids = rel->relids;
+    foreign_scan->checkAsUser = rel->userid;
+    foreign_scan->scan.plan.startup_cost = best_path->path.startup_cost;
+    foreign_scan->scan.plan.total_cost = best_path->path.total_cost;
+    foreign_scan->scan.plan.plan_rows = best_path->path.rows;
+    foreign_scan->scan.plan.plan_width = best_path->path.pathtarget->width;
+
+    // system columns have to be fetched by the FDW
+    Bitmapset *attrs_used = nullptr;
+    pull_varattnos((Node *)targetlist, scanrelid, &attrs_used);
+    pull_varattnos((Node *)qual, scanrelid, &attrs_used);
+    foreign_scan->fsSystemCol = false;
+    for (int i = FirstLowInvalidHeapAttributeNumber + 1; i < 0; i++) {
+      if (bms_is_member(i - FirstLowInvalidHeapAttributeNumber, attrs_used)) {
+        foreign_scan->fsSystemCol = true;
+        break;
+      }
+    }
+
+    return foreign_scan;
+  }
 
   return nullptr;
 }
@@ -1457,11 +1688,12 @@ FaultInjectorType_e gpdb::InjectFaultInOptTasks(const char *fault_name) {
  * We register a callback to a cache on all the catalog tables that contain
  * information that's contained in the ORCA metadata cache.
 
- * There is no fine-grained mechanism in the metadata cache for invalidating
- * individual entries ATM, so we just blow the whole cache whenever anything
- * changes. The callback simply increments a counter. Whenever we start
- * planning a query, we check the counter to see if it has changed since the
- * last planned query, and reset the whole cache if it has.
+ * The callbacks record which relations and syscache hash values were
+ * invalidated. Whenever we start planning a query, the recorded
+ * invalidations are handed over to COptTasks, which evicts only the
+ * matching metadata cache entries. If too many invalidations pile up
+ * between two queries, or a callback reports a catalog-wide reset, we fall
+ * back to blowing the whole cache.
  *
  * To make sure we've covered all catalog tables that contain information
  * that's stored in the metadata cache, there are "catalog tables: xxx"
@@ -1470,16 +1702,74 @@ FaultInjectorType_e gpdb::InjectFaultInOptTasks(const char *fault_name) {
  * anything fetched via the wrapper functions in this file can end up in the
  * metadata cache and hence need to have an invalidation callback registered.
  */
+#define MDCACHE_MAX_PENDING_INVALIDATIONS 256
+
 static bool mdcache_invalidation_counter_registered = false;
 static int64 mdcache_invalidation_counter = 0;
 static int64 last_mdcache_invalidation_counter = 0;
 
+/* invalidations received since the last MDCacheNeedsReset() call */
+static gpdb::MDCacheInvalidation mdcache_pending_invalidations[MDCACHE_MAX_PENDING_INVALIDATIONS];
+static int mdcache_num_pending_invalidations = 0;
+static bool mdcache_pending_reset = false;
+
+/*
+ * invalidations handed out by the last MDCacheNeedsReset() call; kept apart
+ * from the pending ones since applying them may access the catalog and
+ * thereby run the callbacks again
+ */
+static gpdb::MDCacheInvalidation mdcache_invalidations[MDCACHE_MAX_PENDING_INVALIDATIONS];
+
+static void record_mdcache_invalidation(int cacheid, uint32 hashvalue, Oid relid) {
+  if (mdcache_pending_reset) {
+    return;
+  }
+
+  /* the same object tends to be invalidated several times in a row */
+  for (int i = mdcache_num_pending_invalidations - 1; i >= 0; i--) {
+    gpdb::MDCacheInvalidation *inval = &mdcache_pending_invalidations[i];
+    if (inval->cacheid == cacheid && inval->hashvalue == hashvalue && inval->relid == relid) {
+      return;
+    }
+  }
+
+  if (mdcache_num_pending_invalidations == MDCACHE_MAX_PENDING_INVALIDATIONS) {
+    mdcache_pending_reset = true;
+    return;
+  }
+
+  gpdb::MDCacheInvalidation *inval = &mdcache_pending_invalidations[mdcache_num_pending_invalidations++];
+  inval->cacheid = cacheid;
+  inval->hashvalue = hashvalue;
+  inval->relid = relid;
+}
+
 static void mdsyscache_invalidation_counter_callback(Datum arg, int cacheid, uint32 hashvalue) {
   mdcache_invalidation_counter++;
+
+  /* a zero hash value means that the whole catalog cache was flushed */
+  if (0 == hashvalue) {
+    mdcache_pending_reset = true;
+  } else {
+    record_mdcache_invalidation(cacheid, hashvalue, InvalidOid);
+  }
+
+  if (STATRELATTINH == cacheid) {
+    gpdxl::CSharedMDCache::InvalidateStatistics(hashvalue);
+  }
 }
 
 static void mdrelcache_invalidation_counter_callback(Datum arg, Oid relid) {
   mdcache_invalidation_counter++;
+
+  /* InvalidOid means that all relcache entries were invalidated */
+  if (!OidIsValid(relid)) {
+    mdcache_pending_reset = true;
+  } else {
+    record_mdcache_invalidation(gpdb::MDCacheInvalidation::RELCACHE_ID, 0, relid);
+  }
+
+  gpdxl::CSharedMDCache::InvalidateRelation(relid);
 }
 
 static void register_mdcache_invalidation_callbacks(void) {
@@ -1541,22 +1831,46 @@ static void register_mdcache_invalidation_callbacks(void) {
   CacheRegisterRelcacheCallback(&mdrelcache_invalidation_counter_callback, (Datum)0);
 }
 
+// Register the metadata cache invalidation callbacks, if not done already
+void gpdb::RegisterMDCacheInvalidationCallbacks(void) {
+  if (!mdcache_invalidation_counter_registered) {
+    register_mdcache_invalidation_callbacks();
+    mdcache_invalidation_counter_registered = true;
+  }
+}
+
 // Has there been any catalog changes since last call?
-bool gpdb::MDCacheNeedsReset(void) {
-  {
-    if (!mdcache_invalidation_counter_registered) {
-      register_mdcache_invalidation_callbacks();
-      mdcache_invalidation_counter_registered = true;
-    }
-    if (last_mdcache_invalidation_counter == mdcache_invalidation_counter) {
-      return false;
-    } else {
-      last_mdcache_invalidation_counter = mdcache_invalidation_counter;
-      return true;
-    }
+bool gpdb::MDCacheNeedsReset(const MDCacheInvalidation **invalidations, int *num_invalidations) {
+  RegisterMDCacheInvalidationCallbacks();
+
+  *invalidations = mdcache_invalidations;
+  *num_invalidations = 0;
+
+  if (last_mdcache_invalidation_counter == mdcache_invalidation_counter) {
+    return false;
+  }
+  last_mdcache_invalidation_counter = mdcache_invalidation_counter;
+
+  bool reset = mdcache_pending_reset;
+  if (!reset) {
+    memcpy(mdcache_invalidations, mdcache_pending_invalidations,
+           mdcache_num_pending_invalidations * sizeof(MDCacheInvalidation));
+    *num_invalidations = mdcache_num_pending_invalidations;
   }
 
-  return true;
+  mdcache_num_pending_invalidations = 0;
+  mdcache_pending_reset = false;
+
+  return reset;
+}
+
+// Number of catalog invalidations seen by the callbacks so far
+uint64 gpdb::MDCacheGeneration(void) {
+  return (uint64)mdcache_invalidation_counter;
+}
+
+uint32 gpdb::GetSysCacheHashValue(int cacheid, Datum key1, Datum key2, Datum key3) {
+  return ::GetSysCacheHashValue(cacheid, key1, key2, key3, (Datum)0);
 }
 
 // returns true if a query cancel is requested in GPDB
@@ -1566,6 +1880,27 @@ bool gpdb::IsAbortRequested(void) {
   return (false);
 }
 
+// Run a call that a helper worker forwarded to the main worker. An ERROR
+// must not longjmp past the helper threads of the worker pool, so it is
+// caught here and raised as a C++ exception, which fails the request and
+// makes the pool cancel and join its helpers. The error stays on the
+// Postgres error stack and is re-thrown once we leave the C++ land.
+void *gpdb::ExecuteHostCall(void *(*func)(void *), void *arg) {
+  MemoryContext oldcontext = CurrentMemoryContext;
+  void *result = nullptr;
+
+  PG_TRY();
+  { result = func(arg); }
+  PG_CATCH();
+  {
+    MemoryContextSwitchTo(oldcontext);
+    GPOS_RAISE(gpdxl::ExmaGPDB, gpdxl::ExmiGPDBError);
+  }
+  PG_END_TRY();
+
+  return result;
+}
+
 // Given the type OID, get the typelem (InvalidOid if not an array type).
 Oid gpdb::GetElementType(Oid array_type_oid) {
   { return get_element_type(array_type_oid); }
@@ -1601,8 +1936,18 @@ void gpdb::GPDBMemoryContextDelete(MemoryContext context) {
   { MemoryContextDelete(context); }
 }
 
+// parent of the memory contexts of all optimizer memory pools, so that
+// optimizer memory shows up as a single subtree in pg_backend_memory_contexts
+static MemoryContext orca_memory_context = nullptr;
+
 MemoryContext gpdb::GPDBAllocSetContextCreate() {
-  { return nullptr; }
+  {
+    if (nullptr == orca_memory_context) {
+      orca_memory_context = AllocSetContextCreate(TopMemoryContext, "pg_orca", ALLOCSET_SMALL_SIZES);
+    }
+
+    return AllocSetContextCreate(orca_memory_context, "ORCA memory pool", ALLOCSET_DEFAULT_SIZES);
+  }
 
   return nullptr;
 }
@@ -30,17 +30,20 @@ class OptConfig;
 class CGPOptimizer {
  public:
   // optimize given query using GP optimizer
-  static PlannedStmt *GPOPTOptimizedPlan(Query *query, gpdxl::OptConfig *config);
+  static PlannedStmt *GPOPTOptimizedPlan(Query *query, gpdxl::OptConfig *config, uint32_t parallel_workers);
+
+  // check the search strategy of the given config, sets error_msg if it is invalid
+  static bool FValidSearchStrategy(gpdxl::OptConfig *config, char **error_msg);
 
   // gpopt initialize and terminate
-  static void InitGPOPT();
+  static void InitGPOPT(const gpdxl::OptConfig *config);
 
   static void TerminateGPOPT();
 };
 
 extern "C" {
 
-extern void InitGPOPT();
+extern void InitGPOPT(const gpdxl::OptConfig *config);
 extern void TerminateGPOPT();
 }
 
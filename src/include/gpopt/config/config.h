@@ -2,9 +2,56 @@
 
 namespace gpdxl {
 // NOLINTBEGIN
+
+// what to do with the metadata cache when optimization fails
+enum MDCacheConsistency {
+  MDCACHE_CONSISTENCY_STRICT,   // drop the cache on every error
+  MDCACHE_CONSISTENCY_CHECKED,  // drop the cache only if the error may have corrupted it
+};
+
+// memory pool used for per-query optimization memory
+enum OptimizerMemoryPool {
+  OPTIMIZER_MEMORY_POOL_TRACKER,  // malloc per allocation, with leak tracking
+  OPTIMIZER_MEMORY_POOL_ARENA,    // bump allocation from large chunks
+};
+
+// optimizer output written to the server log for traced statements
+enum OptimizerTraceLevel {
+  OPTIMIZER_TRACE_OFF,      // nothing
+  OPTIMIZER_TRACE_PLAN,     // physical plan
+  OPTIMIZER_TRACE_QUERY,    // input and preprocessed query, and plan
+  OPTIMIZER_TRACE_VERBOSE,  // additionally the final memo and optimization statistics
+};
+
+// join order search
+enum OptimizerJoinOrder {
+  OPTIMIZER_JOIN_ORDER_QUERY,        // join order of the query
+  OPTIMIZER_JOIN_ORDER_GREEDY,       // greedy and min-cardinality join orders
+  OPTIMIZER_JOIN_ORDER_EXHAUSTIVE,   // dynamic programming, join associativity and commutativity
+  OPTIMIZER_JOIN_ORDER_EXHAUSTIVE2,  // DPv2, including left outer joins
+  OPTIMIZER_JOIN_ORDER_DPHYP,        // DPhyp over connected subgraphs, including left outer joins
+};
+
 struct OptConfig {
   bool enable_optimizer{true};
   bool enable_new_planner_generation{true};
+  bool enable_direct_translation{false};
+  bool enable_shared_mdcache{false};
+  int shared_mdcache_size{64};
+  int mdcache_consistency{MDCACHE_CONSISTENCY_CHECKED};
+  int memory_pool{OPTIMIZER_MEMORY_POOL_TRACKER};
+  bool palloc_memory_pools{false};
+  int optimizer_memory_limit{0};
+  int trace_level{OPTIMIZER_TRACE_OFF};
+  double trace_sample_rate{1.0};
+  int trace_max_size{1024};
+  int plan_cache_size{0};
+  bool enable_parallel{false};
+  bool enable_mergejoin{false};
+  int optimizer_threads{0};
+  int planning_time_budget{0};
+  char *search_strategy{nullptr};
+  int join_order{OPTIMIZER_JOIN_ORDER_QUERY};
 };
 }  // namespace gpdxl
 
@@ -188,6 +188,9 @@ bool IsRepSafeAgg(Oid aggid);
 // does aggregate have a combine function (and serial/deserial functions, if needed)
 bool IsAggPartialCapable(Oid aggid);
 
+// can the executor run aggregate in a hash aggregate with a meaningful memory estimate
+bool IsAggHashCapable(Oid aggid);
+
 // intermediate result type of given aggregate
 Oid GetAggregate(const char *agg, Oid type_oid);
 
@@ -486,6 +489,9 @@ MVNDistinct *GetMVNDistinct(Oid stat_oid);
 
 MVDependencies *GetMVDependencies(Oid stat_oid);
 
+// get the multi-column MCV list of an extended statistics object
+MCVList *GetMVMCVList(Oid stat_oid);
+
 // get relation with given oid
 RelationWrapper GetRelation(Oid rel_oid);
 
@@ -582,13 +588,42 @@ Node *EvalConstExpressions(Node *node);
 FaultInjectorType_e InjectFaultInOptTasks(const char *fault_name);
 #endif
 
+// Register the catalog cache callbacks used to invalidate the metadata cache.
+// Done lazily by MDCacheNeedsReset(), or at library load time when the
+// shared metadata cache is in use.
+void RegisterMDCacheInvalidationCallbacks(void);
+
+// A catalog change recorded by the metadata cache invalidation callbacks:
+// either a relcache invalidation of relid, or a syscache invalidation of the
+// tuples hashing to hashvalue in syscache cacheid
+struct MDCacheInvalidation {
+  static constexpr int RELCACHE_ID = -1;
+
+  int cacheid;
+  uint32 hashvalue;
+  Oid relid;
+};
+
 // Does the metadata cache need to be reset (because of a catalog
-// table has been changed?)
-bool MDCacheNeedsReset(void);
+// table has been changed?) If only individual objects were invalidated
+// since the last call, returns false and hands them out in invalidations
+bool MDCacheNeedsReset(const MDCacheInvalidation **invalidations, int *num_invalidations);
+
+// Number of catalog invalidations seen by the metadata cache invalidation
+// callbacks so far; anything derived from the catalog at an older
+// generation may be stale
+uint64 MDCacheGeneration(void);
+
+// hash value of a syscache key, as passed to the invalidation callbacks
+uint32 GetSysCacheHashValue(int cacheid, Datum key1, Datum key2, Datum key3);
 
 // returns true if a query cancel is requested in GPDB
 bool IsAbortRequested(void);
 
+// run a call forwarded by a helper worker, raising Postgres errors as
+// C++ exceptions
+void *ExecuteHostCall(void *(*func)(void *), void *arg);
+
 // Given the type OID, get the typelem (InvalidOid if not an array type).
 Oid GetElementType(Oid array_type_oid);
 
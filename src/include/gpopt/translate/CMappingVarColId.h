@@ -19,6 +19,7 @@
 #ifndef GPDXL_CMappingVarColId_H
 #define GPDXL_CMappingVarColId_H
 
+#include "gpopt/base/CColRef.h"
 #include "gpopt/translate/CGPDBAttInfo.h"
 #include "gpopt/translate/CGPDBAttOptCol.h"
 #include "gpos/common/CHashMap.h"
@@ -118,6 +119,9 @@ class CMappingVarColId {
   // load up column id mapping information from the array of column descriptors
   void LoadColumns(uint32_t query_level, uint32_t RTE_index, const CDXLColDescrArray *column_descrs);
 
+  // load up mapping information from the output columns of a table scan
+  void LoadColRefs(uint32_t query_level, uint32_t RTE_index, const gpopt::CColRefArray *colrefs);
+
   // load up mapping information from derived table columns
   void LoadDerivedTblColumns(uint32_t query_level, uint32_t RTE_index, const gpdxl::CDXLNodeArray *derived_columns_dxl,
                              List *target_list);
@@ -0,0 +1,156 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CTranslatorQueryToExpr.h
+//
+//	@doc:
+//		Class providing methods for translating a GPDB Query object straight
+//		into an optimizer expression, without building a DXL tree first
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CTranslatorQueryToExpr_H
+#define GPDXL_CTranslatorQueryToExpr_H
+
+#include "gpopt/base/CColRef.h"
+#include "gpopt/metadata/CTableDescriptor.h"
+#include "gpopt/operators/CExpression.h"
+#include "gpopt/translate/CMappingVarColId.h"
+#include "gpopt/translate/IQueryToExprTranslator.h"
+#include "gpos/base.h"
+#include "naucrates/md/CMDName.h"
+
+// fwd declarations
+namespace gpopt {
+class CMDAccessor;
+class CColumnFactory;
+}  // namespace gpopt
+
+struct Query;
+struct RangeTblEntry;
+struct FromExpr;
+struct JoinExpr;
+struct Node;
+struct Expr;
+struct List;
+
+namespace gpdxl {
+using namespace gpos;
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CTranslatorQueryToExpr
+//
+//	@doc:
+//		Translates select-project-join queries over plain tables, with an
+//		optional ORDER BY / LIMIT on top, directly into a logical expression.
+//		Column references are created in the optimizer's column factory and
+//		Vars are resolved through a CMappingVarColId keyed by their ids.
+//		Queries outside this subset are left to CTranslatorQueryToDXL, see
+//		IsSupported().
+//
+//---------------------------------------------------------------------------
+class CTranslatorQueryToExpr : public IQueryToExprTranslator {
+ private:
+  // memory pool
+  CMemoryPool *m_mp;
+
+  // meta data accessor
+  CMDAccessor *m_md_accessor;
+
+  // query being translated, with join alias vars flattened
+  Query *m_query;
+
+  // column factory, available once the optimizer context is installed
+  CColumnFactory *m_pcf;
+
+  // map from Var to the id of its column reference
+  CMappingVarColId *m_var_to_colid_map;
+
+  // output columns of all table scans, used to mark unreferenced ones
+  CColRefArray *m_table_colrefs;
+
+  // ids of the query output column references
+  ULongPtrArray *m_output_colrefs;
+
+  // names of the query output columns
+  CMDNameArray *m_output_col_names;
+
+  // walker checking that an expression only uses supported nodes
+  static bool HasUnsupportedExpr(Node *node, void *context);
+
+  // check that a from clause entry is supported
+  static bool IsSupportedFromClause(Query *query, Node *node);
+
+  // construct a table descriptor from a range table entry
+  CTableDescriptor *Ptabdesc(const RangeTblEntry *rte);
+
+  // translate a from expression and its quals
+  CExpression *PexprFromExpr(FromExpr *from_expr);
+
+  // translate a from clause entry
+  CExpression *PexprFromClause(Node *node);
+
+  // translate a base relation range table entry
+  CExpression *PexprLogicalGet(const RangeTblEntry *rte, uint32_t rt_index);
+
+  // translate a join expression
+  CExpression *PexprJoin(JoinExpr *join_expr);
+
+  // translate the target list into a project on top of the given child,
+  // filling the column references of the target entries by resno
+  CExpression *PexprProject(CExpression *pexpr_child, CColRefArray *te_colrefs);
+
+  // translate ORDER BY / LIMIT / OFFSET on top of the given child
+  CExpression *PexprLimit(CExpression *pexpr_child, CColRefArray *te_colrefs);
+
+  // translate a scalar expression
+  CExpression *PexprScalar(const Expr *expr);
+
+  // translate a list of scalar expressions
+  CExpressionArray *PdrgpexprScalarChildren(List *args);
+
+  CExpression *PexprScalarVar(const Expr *expr);
+
+  CExpression *PexprScalarConst(const Expr *expr);
+
+  CExpression *PexprScalarParam(const Expr *expr);
+
+  CExpression *PexprScalarOp(const Expr *expr);
+
+  CExpression *PexprScalarBoolOp(const Expr *expr);
+
+  CExpression *PexprScalarNullTest(const Expr *expr);
+
+  CExpression *PexprScalarRelabelType(const Expr *expr);
+
+  CExpression *PexprScalarFunc(const Expr *expr);
+
+  // mark table columns that are not referenced by the query as unused
+  void MarkUnknownColsAsUnused();
+
+ public:
+  CTranslatorQueryToExpr(const CTranslatorQueryToExpr &) = delete;
+
+  // ctor
+  CTranslatorQueryToExpr(CMemoryPool *mp, CMDAccessor *md_accessor, Query *query);
+
+  // dtor
+  ~CTranslatorQueryToExpr() override;
+
+  // can the given query be translated without going through DXL?
+  static bool IsSupported(Query *query);
+
+  // main driver
+  CExpression *PexprTranslateQuery() override;
+
+  // ids of the query output column references
+  ULongPtrArray *PdrgpulOutputColRefs() override { return m_output_colrefs; }
+
+  // names of the query output columns
+  CMDNameArray *Pdrgpmdname() override { return m_output_col_names; }
+};
+}  // namespace gpdxl
+#endif  // GPDXL_CTranslatorQueryToExpr_H
+
+// EOF
@@ -23,15 +23,33 @@ class CMemoryPoolPalloc : public CMemoryPool {
  private:
   MemoryContext m_cxt{nullptr};
 
-  // When destroying arrays, we need to call the destructor of each element
-  // To do this, we need the size of the allocation, which we then divide by the
-  // the size of the element to get number of elements to iterate through.
-  // This struct is only used for array allocations (GPOS_NEW_ARRAY())
-  struct SArrayAllocHeader {
-    uint32_t m_user_size;
+  // bytes currently allocated from this pool, including headers
+  uint64_t m_allocated_size{0};
+
+  // bytes currently allocated from all palloc pools, including headers
+  static uint64_t m_total_allocated_size;
+
+  // allocations made while optimizing a query may not grow the total
+  // beyond the baseline by more than the limit; 0 means no limit
+  static uint64_t m_query_baseline;
+  static uint64_t m_query_limit;
+
+  // Header of every allocation. When destroying arrays, we need to call the
+  // destructor of each element. To do this, we need the size of the
+  // allocation, which we then divide by the size of the element to get
+  // number of elements to iterate through. The owner tag in the trailer
+  // lets CMemoryPool tell our allocations from those of other pools.
+  struct SAllocHeader {
+    // pointer to pool
+    CMemoryPoolPalloc *m_mp;
+
+    // user requested size and owner tag
+    SAllocTrailer m_trailer;
   };
 
  public:
+  CMemoryPoolPalloc(CMemoryPoolPalloc &) = delete;
+
   // ctor
   CMemoryPoolPalloc();
 
@@ -49,6 +67,10 @@ class CMemoryPoolPalloc : public CMemoryPool {
 
   // get user requested size of allocation
   static uint32_t UserSizeOfAlloc(const void *ptr);
+
+  // limit the memory allocated from now on until the next call;
+  // memory already allocated, e.g. by the metadata cache, is not counted
+  static void SetQueryMemoryLimit(uint64_t limit);
 };
 }  // namespace gpos
 
@@ -99,7 +99,6 @@ extern int optimizer_samples_number;
 extern int optimizer_join_arity_for_associativity_commutativity;
 extern int optimizer_array_expansion_threshold;
 extern int optimizer_join_order_threshold;
-extern int optimizer_join_order;
 extern int optimizer_cte_inlining_bound;
 extern int optimizer_push_group_by_below_setop_threshold;
 extern int optimizer_xform_bind_threshold;
@@ -133,6 +132,7 @@ extern bool optimizer_xforms[OPTIMIZER_XFORMS_COUNT];
 namespace gpos {
 class CMemoryPool;
 class CBitSet;
+class CWStringDynamic;
 }  // namespace gpos
 
 namespace gpdxl {
@@ -148,6 +148,10 @@ class COptimizerConfig;
 class ICostModel;
 }  // namespace gpopt
 
+namespace gpdb {
+struct MDCacheInvalidation;
+}  // namespace gpdb
+
 struct PlannedStmt;
 struct Query;
 struct List;
@@ -190,6 +194,9 @@ struct SOptContext {
   // buffer for optimizer error messages
   char *m_error_msg{nullptr};
 
+  // number of workers a Gather may launch, 0 plans the query serially
+  uint32_t m_parallel_workers{0};
+
   gpdxl::OptConfig *config;
 
   // ctor
@@ -212,14 +219,26 @@ class COptTasks {
   static void Execute(void *(*func)(void *), void *func_arg);
 
   // map GPOS log severity level to GPDB, print error and delete the given error buffer
-  static void LogExceptionMessageAndDelete(char *err_buf);
+  static void LogExceptionMessage(const CWStringDynamic *err_str);
 
   // create optimizer configuration object
   static COptimizerConfig *CreateOptimizerConfig(CMemoryPool *mp, ICostModel *cost_model);
 
+  // evict the metadata cache entries affected by catalog changes
+  static void EvictInvalidatedMDObjects(const gpdb::MDCacheInvalidation *invalidations, int num_invalidations);
+
+  // hash of the optimizer settings a cached plan depends on
+  static uint64_t PlanCacheConfigHash(const CBitSet *trace_flags, uint32_t parallel_workers);
+
+  // can the metadata cache be kept after the given optimizer error?
+  static bool FMDCacheSurvivesError(CException &ex);
+
   // optimize a query to a physical DXL
   static void *OptimizeTask(void *ptr);
 
+  // parse the search strategy of the context's config
+  static void *ValidateSearchStrategyTask(void *ptr);
+
   // translate a DXL tree into a planned statement
   static PlannedStmt *ConvertToPlanStmtFromDXL(CMemoryPool *mp, CMDAccessor *md_accessor, const Query *orig_query,
                                                const CDXLNode *dxlnode, bool can_set_tag);
@@ -228,10 +247,10 @@ class COptTasks {
   static char *CreateMultiByteCharStringFromWCString(const wchar_t *wcstr);
 
   // set cost model parameters
-  static void SetCostModelParams(ICostModel *cost_model);
+  static void SetCostModelParams(ICostModel *cost_model, uint32_t parallel_workers);
 
   // generate an instance of optimizer cost model
-  static ICostModel *GetCostModel(CMemoryPool *mp, uint32_t num_segments);
+  static ICostModel *GetCostModel(CMemoryPool *mp, uint32_t num_segments, uint32_t parallel_workers);
 
  public:
   // convert Query->DXL->LExpr->Optimize->PExpr->DXL
@@ -240,6 +259,9 @@ class COptTasks {
   // optimize Query->DXL->LExpr->Optimize->PExpr->DXL->PlannedStmt
   static PlannedStmt *GPOPTOptimizedPlan(Query *query, SOptContext *gpopt_context);
 
+  // parse the search strategy of the context's config, raises if it is invalid
+  static void ValidateSearchStrategy(SOptContext *gpopt_context);
+
   // enable/disable a given xforms
   static bool SetXform(char *xform_str, bool should_disable);
 };
@@ -0,0 +1,58 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPlanCache.h
+//
+//	@doc:
+//		Backend-local cache of plans produced by the optimizer, so that
+//		statements seen before skip the optimizer altogether.
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CPlanCache_H
+#define GPDXL_CPlanCache_H
+
+#include "gpos/base.h"
+
+struct PlannedStmt;
+
+namespace gpdxl {
+using namespace gpos;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CPlanCache
+//
+//	@doc:
+//		Plans are keyed by the serialized Query tree, which holds Params
+//		rather than their values for parameterized statements, and by a
+//		hash of the optimizer settings. Each plan also records the catalog
+//		invalidation generation it was produced at; any invalidation
+//		processed since, including new statistics, makes it stale.
+//
+//		The cache owns a copy of every plan in a memory context of its own
+//		and hands out copies in the caller's memory context. Least recently
+//		used plans are evicted once the cache is full.
+//
+//---------------------------------------------------------------------------
+class CPlanCache {
+ public:
+  CPlanCache(const CPlanCache &) = delete;
+
+  // look up the plan of the given query; returns a copy or nullptr
+  static PlannedStmt *Lookup(const char *query_str, uint64_t config_hash, uint64_t generation);
+
+  // remember the plan of the given query, keeping at most max_entries plans
+  static void Store(const char *query_str, uint64_t config_hash, uint64_t generation, const PlannedStmt *plan,
+                    uint32_t max_entries);
+
+  // drop all plans
+  static void Reset();
+
+  // number of cached plans
+  static uint32_t Size();
+};
+}  // namespace gpdxl
+
+#endif  // !GPDXL_CPlanCache_H
+
+// EOF
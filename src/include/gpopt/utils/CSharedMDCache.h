@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CSharedMDCache.h
+//
+//	@doc:
+//		Cluster-wide tier of the metadata cache kept in dynamic shared
+//		memory. Holds serialized metadata objects keyed by their mdid so
+//		that a new backend does not have to rebuild them from the catalog.
+//
+//---------------------------------------------------------------------------
+
+#ifndef GPDXL_CSharedMDCache_H
+#define GPDXL_CSharedMDCache_H
+
+#include "gpos/base.h"
+#include "naucrates/md/IMDCacheObject.h"
+#include "naucrates/md/IMDId.h"
+
+namespace gpopt {
+class CMDAccessor;
+}
+
+namespace gpdxl {
+using namespace gpos;
+using namespace gpmd;
+using namespace gpopt;
+
+//---------------------------------------------------------------------------
+//	@class:
+//		CSharedMDCache
+//
+//	@doc:
+//		Shared metadata cache tier sitting between the backend-local CMDCache
+//		and the relcache provider. Only statistics objects, which are the
+//		most expensive to build, are shared; everything else is always
+//		fetched through the relcache.
+//
+//		Entries are never invalidated in place. Instead every catalog
+//		invalidation processed by any backend advances a generation number
+//		recorded in fixed shared memory for the affected relation, and an
+//		entry is only returned if it was fetched after the last invalidation
+//		of its relation. Invalidation callbacks therefore never touch the
+//		dynamic shared memory area.
+//
+//---------------------------------------------------------------------------
+class CSharedMDCache {
+ public:
+  CSharedMDCache(const CSharedMDCache &) = delete;
+
+  // reserve fixed shared memory, must be called from shmem_request_hook
+  static void RequestShmem();
+
+  // attach fixed shared memory, must be called from shmem_startup_hook
+  static void ShmemStartup();
+
+  // was the shared tier set up at postmaster start?
+  static bool IsAvailable();
+
+  // can objects of the given mdid be kept in the shared tier?
+  static bool IsCacheable(const IMDId *mdid);
+
+  // current invalidation generation; to be read before fetching an object
+  static uint64_t CurrentGeneration();
+
+  // look up an object; returns nullptr if not present or stale
+  static IMDCacheObject *Lookup(CMemoryPool *mp, CMDAccessor *md_accessor, IMDId *mdid);
+
+  // publish an object fetched from the catalog at the given generation
+  static void Store(CMDAccessor *md_accessor, const IMDCacheObject *md_obj, uint64_t generation,
+                    uint32_t size_limit_mb);
+
+  // invalidation hooks, called from the catalog cache callbacks
+  static void InvalidateRelation(uint32_t relid);
+  static void InvalidateStatistics(uint32_t hashvalue);
+};
+}  // namespace gpdxl
+
+#endif  // !GPDXL_CSharedMDCache_H
+
+// EOF
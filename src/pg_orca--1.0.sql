@@ -1,2 +1,7 @@
 -- load 'pg_orca.so';
--- 为什么有的插件直接安装就可以直接使用，而有的还需要重启
\ No newline at end of file
+-- 为什么有的插件直接安装就可以直接使用，而有的还需要重启
+
+CREATE FUNCTION pg_orca_mdcache_stats(OUT event text, OUT count int8)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT VOLATILE;
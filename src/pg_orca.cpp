@@ -4,39 +4,150 @@
 
 #include "gpopt/CGPOptimizer.h"
 #include "gpopt/config/config.h"
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/mdcache/CMDCache.h"
+#include "gpopt/utils/CSharedMDCache.h"
 
 extern "C" {
 
 #include <postgres.h>
 #include <fmgr.h>
 
+#include <access/parallel.h>
+#include <catalog/pg_class.h>
+#include <catalog/pg_proc.h>
 #include <commands/explain.h>
+#include <funcapi.h>
+#include <miscadmin.h>
+#include <nodes/nodeFuncs.h>
+#include <optimizer/clauses.h>
+#include <optimizer/cost.h>
 #include <optimizer/planner.h>
+#include <storage/dsm_impl.h>
+#include <storage/ipc.h>
 #include <utils/elog.h>
+#include <utils/builtins.h>
 #include <utils/guc.h>
+#include <utils/lsyscache.h>
 }
 
 static bool init = false;
 
 static planner_hook_type prev_planner_hook = nullptr;
 static ExplainOneQuery_hook_type prev_explain_hook = nullptr;
+static shmem_request_hook_type prev_shmem_request_hook = nullptr;
+static shmem_startup_hook_type prev_shmem_startup_hook = nullptr;
+
+static const struct config_enum_entry mdcache_consistency_options[] = {
+    {"strict", gpdxl::MDCACHE_CONSISTENCY_STRICT, false},
+    {"checked", gpdxl::MDCACHE_CONSISTENCY_CHECKED, false},
+    {NULL, 0, false},
+};
+
+static const struct config_enum_entry memory_pool_options[] = {
+    {"tracker", gpdxl::OPTIMIZER_MEMORY_POOL_TRACKER, false},
+    {"arena", gpdxl::OPTIMIZER_MEMORY_POOL_ARENA, false},
+    {NULL, 0, false},
+};
+
+static const struct config_enum_entry trace_level_options[] = {
+    {"off", gpdxl::OPTIMIZER_TRACE_OFF, false},
+    {"plan", gpdxl::OPTIMIZER_TRACE_PLAN, false},
+    {"query", gpdxl::OPTIMIZER_TRACE_QUERY, false},
+    {"verbose", gpdxl::OPTIMIZER_TRACE_VERBOSE, false},
+    {NULL, 0, false},
+};
+
+static const struct config_enum_entry join_order_options[] = {
+    {"query", gpdxl::OPTIMIZER_JOIN_ORDER_QUERY, false},
+    {"greedy", gpdxl::OPTIMIZER_JOIN_ORDER_GREEDY, false},
+    {"exhaustive", gpdxl::OPTIMIZER_JOIN_ORDER_EXHAUSTIVE, false},
+    {"exhaustive2", gpdxl::OPTIMIZER_JOIN_ORDER_EXHAUSTIVE2, false},
+    {"dphyp", gpdxl::OPTIMIZER_JOIN_ORDER_DPHYP, false},
+    {NULL, 0, false},
+};
 
 namespace optimizer {
 
 gpdxl::OptConfig config;
 
+// does the query read a relation parallel workers cannot scan? temporary
+// tables live in the backend's local buffers, foreign tables are scanned by
+// FDWs that may not be parallel safe and CTE scans share the tuplestore of
+// the leader
+static bool HasParallelRestrictedRelation(Node *node, void *context) {
+  if (nullptr == node)
+    return false;
+
+  if (IsA(node, RangeTblEntry)) {
+    RangeTblEntry *rte = (RangeTblEntry *)node;
+    if (RTE_CTE == rte->rtekind)
+      return true;
+
+    return RTE_RELATION == rte->rtekind && (RELPERSISTENCE_TEMP == get_rel_persistence(rte->relid) ||
+                                            RELKIND_FOREIGN_TABLE == get_rel_relkind(rte->relid));
+  }
+
+  if (IsA(node, Query))
+    return query_tree_walker((Query *)node, HasParallelRestrictedRelation, context, QTW_EXAMINE_RTES_BEFORE);
+
+  return expression_tree_walker(node, HasParallelRestrictedRelation, context);
+}
+
+// number of workers the optimizer may plan a Gather with, the same checks
+// standard_planner() does before considering parallel paths at all
+static uint32_t ParallelWorkers(Query *parse, int cursorOptions) {
+  if (!config.enable_parallel || !config.enable_new_planner_generation || 0 >= max_parallel_workers_per_gather)
+    return 0;
+
+  if (0 == (cursorOptions & CURSOR_OPT_PARALLEL_OK) || !IsUnderPostmaster || IsParallelWorker() ||
+      parse->hasModifyingCTE || DSM_IMPL_NONE == dynamic_shared_memory_type)
+    return 0;
+
+  // the optimizer does not track which parts of the plan are parallel
+  // restricted, so the whole query has to be safe
+  if (PROPARALLEL_SAFE != max_parallel_hazard(parse) || HasParallelRestrictedRelation((Node *)parse, nullptr))
+    return 0;
+
+  return (uint32_t)max_parallel_workers_per_gather;
+}
+
+// the strategy is parsed when a query is planned, where an error only makes
+// the query fall back to the Postgres planner; reject it on SET instead
+static bool CheckSearchStrategy(char **newval, void **extra, GucSource source) {
+  // the postmaster reads postgresql.conf before the optimizer can be
+  // initialized, parallel workers get the leader's checked value
+  if (nullptr == *newval || '\0' == (*newval)[0] || !IsUnderPostmaster || IsParallelWorker())
+    return true;
+
+  if (!init) {
+    InitGPOPT(&config);
+    init = true;
+  }
+
+  gpdxl::OptConfig strategy_config = config;
+  strategy_config.search_strategy = *newval;
+
+  char *error_msg = nullptr;
+  if (CGPOptimizer::FValidSearchStrategy(&strategy_config, &error_msg))
+    return true;
+
+  GUC_check_errdetail("%s", nullptr != error_msg ? error_msg : "invalid search strategy");
+  return false;
+}
+
 static PlannedStmt *pg_planner(Query *parse, const char *query_string, int cursorOptions, ParamListInfo boundParams) {
   if (!config.enable_optimizer)
     return standard_planner(parse, query_string, cursorOptions, boundParams);
 
   if (!init) {
-    InitGPOPT();
+    InitGPOPT(&config);
     init = true;
   }
   switch (parse->commandType) {
     case CMD_SELECT:
       try {
-        return CGPOptimizer::GPOPTOptimizedPlan(parse, &config);
+        return CGPOptimizer::GPOPTOptimizedPlan(parse, &config, ParallelWorkers(parse, cursorOptions));
       } catch (const std::exception &e) {
         elog(WARNING, "pg_orca Failed to plan query, get error: %s", e.what());
         return standard_planner(parse, query_string, cursorOptions, boundParams);
@@ -68,12 +179,51 @@ static void ExplainOneQuery(Query *query, int cursorOptions, IntoClause *into, E
   if (config.enable_optimizer)
     ExplainPropertyText("Optimizer", "pg_orca", es);
 }
+
+static void ShmemRequest() {
+  if (prev_shmem_request_hook)
+    prev_shmem_request_hook();
+  gpdxl::CSharedMDCache::RequestShmem();
+}
+
+static void ShmemStartup() {
+  if (prev_shmem_startup_hook)
+    prev_shmem_startup_hook();
+  gpdxl::CSharedMDCache::ShmemStartup();
+}
 }  // namespace optimizer
 
 extern "C" {
 
 PG_MODULE_MAGIC;
 
+PG_FUNCTION_INFO_V1(pg_orca_mdcache_stats);
+
+// number of times each metadata cache event occurred in this backend
+Datum pg_orca_mdcache_stats(PG_FUNCTION_ARGS) {
+  static const char *const event_names[] = {
+      "invalidation_reset",
+      "invalidation_evict",
+      "error_reset",
+      "error_keep",
+  };
+  static_assert(lengthof(event_names) == gpopt::CMDCache::EmdceSentinel);
+
+  InitMaterializedSRF(fcinfo, 0);
+  ReturnSetInfo *rsinfo = (ReturnSetInfo *)fcinfo->resultinfo;
+
+  for (int i = 0; i < gpopt::CMDCache::EmdceSentinel; i++) {
+    Datum values[2];
+    bool nulls[2] = {false, false};
+
+    values[0] = CStringGetTextDatum(event_names[i]);
+    values[1] = Int64GetDatum(gpopt::CMDCache::ULLGetEventCounter((gpopt::CMDCache::EMDCacheEvent)i));
+    tuplestore_putvalues(rsinfo->setResult, rsinfo->setDesc, values, nulls);
+  }
+
+  return (Datum)0;
+}
+
 void _PG_init(void) {
   // clang-format off
   DefineCustomBoolVariable(
@@ -101,8 +251,258 @@ void _PG_init(void) {
     NULL,
     NULL
   );
+
+  DefineCustomBoolVariable(
+    "pg_orca.enable_direct_translation",
+    "translate simple queries into the optimizer's input without going through DXL.",
+    NULL,
+    &optimizer::config.enable_direct_translation,
+    false,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomBoolVariable(
+    "pg_orca.enable_shared_mdcache",
+    "share statistics metadata between backends through shared memory.",
+    "Only available when pg_orca is in shared_preload_libraries.",
+    &optimizer::config.enable_shared_mdcache,
+    false,
+    PGC_SUSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomIntVariable(
+    "pg_orca.shared_mdcache_size",
+    "maximum size of the shared metadata cache.",
+    NULL,
+    &optimizer::config.shared_mdcache_size,
+    64,
+    1,
+    INT_MAX / 1024,
+    PGC_POSTMASTER,
+    GUC_UNIT_MB,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomEnumVariable(
+    "pg_orca.mdcache_consistency",
+    "what to do with the metadata cache when optimization fails.",
+    "strict drops the cache on every error, checked only when the error may have left it inconsistent.",
+    &optimizer::config.mdcache_consistency,
+    gpdxl::MDCACHE_CONSISTENCY_CHECKED,
+    mdcache_consistency_options,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomEnumVariable(
+    "pg_orca.memory_pool",
+    "memory pool used while optimizing a query.",
+    "arena allocates from large chunks released at the end of optimization, tracker allocates every object separately.",
+    &optimizer::config.memory_pool,
+    gpdxl::OPTIMIZER_MEMORY_POOL_TRACKER,
+    memory_pool_options,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomBoolVariable(
+    "pg_orca.palloc_memory_pools",
+    "allocate optimizer memory from PostgreSQL memory contexts.",
+    "Optimizer memory then shows up under the pg_orca context in pg_backend_memory_contexts. Read when the optimizer is first used in a session.",
+    &optimizer::config.palloc_memory_pools,
+    false,
+    PGC_BACKEND,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomIntVariable(
+    "pg_orca.optimizer_memory_limit",
+    "maximum memory the optimizer may allocate for a single query.",
+    "Only enforced with pg_orca.palloc_memory_pools; the query falls back to the Postgres planner when exceeded. 0 disables the limit.",
+    &optimizer::config.optimizer_memory_limit,
+    0,
+    0,
+    INT_MAX,
+    PGC_USERSET,
+    GUC_UNIT_KB,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomEnumVariable(
+    "pg_orca.trace_level",
+    "optimizer output written to the server log.",
+    "plan logs the physical plan, query also the input and preprocessed query, verbose also the final memo and optimization statistics.",
+    &optimizer::config.trace_level,
+    gpdxl::OPTIMIZER_TRACE_OFF,
+    trace_level_options,
+    PGC_SUSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomRealVariable(
+    "pg_orca.trace_sample_rate",
+    "fraction of statements traced when pg_orca.trace_level is not off.",
+    NULL,
+    &optimizer::config.trace_sample_rate,
+    1.0,
+    0.0,
+    1.0,
+    PGC_SUSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomIntVariable(
+    "pg_orca.trace_max_size",
+    "maximum size of the optimizer trace output of a single statement.",
+    "Trace messages beyond the limit are dropped. 0 disables the limit.",
+    &optimizer::config.trace_max_size,
+    1024,
+    0,
+    INT_MAX / 1024,
+    PGC_SUSET,
+    GUC_UNIT_KB,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomIntVariable(
+    "pg_orca.plan_cache_size",
+    "maximum number of optimized plans cached per backend.",
+    "Statements seen before under the same settings reuse their plan until the catalog changes. 0 disables the cache.",
+    &optimizer::config.plan_cache_size,
+    0,
+    0,
+    INT_MAX,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomBoolVariable(
+    "pg_orca.enable_parallel",
+    "let the optimizer plan parallel scans and joins below a Gather.",
+    "Requires pg_orca.enable_new_planner; uses up to max_parallel_workers_per_gather workers.",
+    &optimizer::config.enable_parallel,
+    false,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomBoolVariable(
+    "pg_orca.enable_mergejoin",
+    "let the optimizer plan inner, left outer, semi and anti merge joins.",
+    NULL,
+    &optimizer::config.enable_mergejoin,
+    false,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomIntVariable(
+    "pg_orca.optimizer_threads",
+    "number of threads running the optimizer's search jobs.",
+    "0 or 1 searches on the backend thread only. Ignored with pg_orca.palloc_memory_pools or when optimizer output is traced.",
+    &optimizer::config.optimizer_threads,
+    0,
+    0,
+    64,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomIntVariable(
+    "pg_orca.planning_time_budget",
+    "time the optimizer may search for a plan of a single statement.",
+    "Past it no more alternatives are explored and the best plan found so far is used; the Postgres planner is only used when no plan was found. 0 disables the budget.",
+    &optimizer::config.planning_time_budget,
+    0,
+    0,
+    INT_MAX,
+    PGC_USERSET,
+    GUC_UNIT_MS,
+    NULL,
+    NULL,
+    NULL
+  );
+
+  DefineCustomStringVariable(
+    "pg_orca.search_strategy",
+    "search stages of the optimizer, as a JSON array with one object per stage.",
+    "Each stage may list its exploration xforms (\"xforms\") or leave some out (\"exclude\"), and set a time limit in ms (\"time\") and a cost under which later stages are skipped (\"cost\"). Empty runs a single stage with all xforms.",
+    &optimizer::config.search_strategy,
+    "",
+    PGC_USERSET,
+    0,
+    optimizer::CheckSearchStrategy,
+    NULL,
+    NULL
+  );
+
+  DefineCustomEnumVariable(
+    "pg_orca.join_order",
+    "join order search of the optimizer.",
+    "query keeps the join order of the query, dphyp searches all join orders without cross products, also of left outer joins, for up to 64 tables.",
+    &optimizer::config.join_order,
+    gpdxl::OPTIMIZER_JOIN_ORDER_QUERY,
+    join_order_options,
+    PGC_USERSET,
+    0,
+    NULL,
+    NULL,
+    NULL
+  );
   // clang-format on
 
+  if (process_shared_preload_libraries_in_progress) {
+    prev_shmem_request_hook = shmem_request_hook;
+    shmem_request_hook = optimizer::ShmemRequest;
+    prev_shmem_startup_hook = shmem_startup_hook;
+    shmem_startup_hook = optimizer::ShmemStartup;
+
+    // invalidations must reach the shared metadata cache from every backend,
+    // not only from those that happened to plan a query with orca
+    gpdb::RegisterMDCacheInvalidationCallbacks();
+  }
+
   prev_planner_hook = planner_hook;
   planner_hook = optimizer::pg_planner;
 
@@ -20,6 +20,7 @@ extern "C" {
 #include "gpopt/mdcache/CMDAccessor.h"
 #include "gpopt/relcache/CMDProviderRelcache.h"
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
+#include "gpopt/utils/CSharedMDCache.h"
 #include "naucrates/dxl/CDXLUtils.h"
 #include "naucrates/exception.h"
 
@@ -30,9 +31,28 @@ using namespace gpmd;
 // return the requested metadata object
 IMDCacheObject *CMDProviderRelcache::GetMDObj(CMemoryPool *mp, CMDAccessor *md_accessor, IMDId *mdid,
                                               IMDCacheObject::Emdtype mdtype) const {
+  bool use_shared_cache =
+      GPOS_CONDIF(enable_shared_mdcache) && CSharedMDCache::IsAvailable() && CSharedMDCache::IsCacheable(mdid);
+
+  uint64_t generation = 0;
+  if (use_shared_cache) {
+    IMDCacheObject *md_obj = CSharedMDCache::Lookup(mp, md_accessor, mdid);
+    if (nullptr != md_obj) {
+      return md_obj;
+    }
+
+    // must be read before going to the catalog, so that an invalidation
+    // racing with the fetch below makes the published copy stale
+    generation = CSharedMDCache::CurrentGeneration();
+  }
+
   IMDCacheObject *md_obj = CTranslatorRelcacheToDXL::RetrieveObject(mp, md_accessor, mdid, mdtype);
   GPOS_ASSERT(nullptr != md_obj);
 
+  if (use_shared_cache) {
+    CSharedMDCache::Store(md_accessor, md_obj, generation, GPOS_CONDIF(shared_mdcache_size));
+  }
+
   return md_obj;
 }
 
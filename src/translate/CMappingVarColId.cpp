@@ -18,6 +18,7 @@ extern "C" {
 #include <nodes/primnodes.h>
 #include <nodes/value.h>
 }
+#include "gpopt/base/CColRefTable.h"
 #include "gpopt/gpdbwrappers.h"
 #include "gpopt/translate/CMappingVarColId.h"
 #include "gpopt/translate/CTranslatorUtils.h"
@@ -228,6 +229,26 @@ void CMappingVarColId::LoadColumns(uint32_t query_level, uint32_t RTE_index, con
   }
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		CMappingVarColId::LoadColRefs
+//
+//	@doc:
+//		Load up columns information from the output column references of
+//		a table scan
+//
+//---------------------------------------------------------------------------
+void CMappingVarColId::LoadColRefs(uint32_t query_level, uint32_t RTE_index, const gpopt::CColRefArray *colrefs) {
+  GPOS_ASSERT(nullptr != colrefs);
+  const uint32_t size = colrefs->Size();
+
+  // add mapping information for columns
+  for (uint32_t i = 0; i < size; i++) {
+    gpopt::CColRefTable *colref = gpopt::CColRefTable::PcrConvert((*colrefs)[i]);
+    this->Insert(query_level, RTE_index, colref->AttrNum(), colref->Id(), colref->Name().Pstr()->Copy(m_mp));
+  }
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		CMappingVarColId::LoadDerivedTblColumns
@@ -1557,6 +1557,31 @@ Plan *CTranslatorDXLToPlStmt::TranslateDXLMergeJoin(const CDXLNode *merge_join_d
   Plan *right_plan =
       TranslateDXLOperatorToPlan(right_tree_dxlnode, &right_dxl_translate_ctxt, translation_context_arr_with_siblings);
 
+  // the inner side is rescanned from a marked position for duplicate outer
+  // keys; put a Material on top of plans that cannot restore a position,
+  // the same node types ExecSupportsMarkRestore() accepts
+  if (!IsA(right_plan, Sort) && !IsA(right_plan, Material) && !IsA(right_plan, IndexScan) &&
+      !IsA(right_plan, IndexOnlyScan)) {
+    Material *materialize = makeNode(Material);
+    Plan *mat_plan = &(materialize->plan);
+    mat_plan->plan_node_id = m_dxl_to_plstmt_context->GetNextPlanId();
+
+    ListCell *lc_tle;
+    foreach (lc_tle, right_plan->targetlist) {
+      TargetEntry *tle = (TargetEntry *)lfirst(lc_tle);
+      Var *var = gpdb::MakeVarFromTargetEntry(OUTER_VAR, tle);
+      mat_plan->targetlist = gpdb::LAppend(mat_plan->targetlist,
+                                           gpdb::MakeTargetEntry((Expr *)var, tle->resno, tle->resname, tle->resjunk));
+    }
+
+    mat_plan->startup_cost = right_plan->startup_cost;
+    mat_plan->total_cost = right_plan->total_cost;
+    mat_plan->plan_rows = right_plan->plan_rows;
+    mat_plan->plan_width = right_plan->plan_width;
+    mat_plan->lefttree = right_plan;
+    right_plan = mat_plan;
+  }
+
   CDXLTranslationContextArray *child_contexts = GPOS_NEW(m_mp) CDXLTranslationContextArray(m_mp);
   child_contexts->Append(&left_dxl_translate_ctxt);
   child_contexts->Append(&right_dxl_translate_ctxt);
@@ -1622,7 +1647,7 @@ Plan *CTranslatorDXLToPlStmt::TranslateDXLMergeJoin(const CDXLNode *merge_join_d
       merge_join->mergeCollations[ul] = gpdb::ExprCollation((Node *)leftarg);
 
       // Make sure that the following properties match
-      // those in CPhysicalFullMergeJoin::PosRequired().
+      // those in CPhysicalMergeJoin::PosMergeKeys().
       merge_join->mergeStrategies[ul] = BTLessStrategyNumber;
       merge_join->mergeNullsFirst[ul] = false;
       ++ul;
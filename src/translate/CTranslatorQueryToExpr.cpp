@@ -0,0 +1,936 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CTranslatorQueryToExpr.cpp
+//
+//	@doc:
+//		Implementation of the methods used to translate a query directly into
+//		an optimizer expression. Operators are built the same way
+//		CTranslatorDXLToExpr builds them from the DXL produced by
+//		CTranslatorQueryToDXL, so both paths hand identical trees to the
+//		optimizer.
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include <postgres.h>
+
+#include <catalog/pg_class.h>
+#include <nodes/nodeFuncs.h>
+#include <nodes/parsenodes.h>
+#include <nodes/primnodes.h>
+}
+
+#include "gpopt/base/CAutoOptCtxt.h"
+#include "gpopt/base/CColRefTable.h"
+#include "gpopt/base/CColumnFactory.h"
+#include "gpopt/base/COrderSpec.h"
+#include "gpopt/base/CUtils.h"
+#include "gpopt/gpdbwrappers.h"
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/mdcache/CMDAccessorUtils.h"
+#include "gpopt/metadata/CColumnDescriptor.h"
+#include "gpopt/operators/CLogicalGet.h"
+#include "gpopt/operators/CLogicalLimit.h"
+#include "gpopt/operators/CLogicalProject.h"
+#include "gpopt/operators/CLogicalSelect.h"
+#include "gpopt/operators/CScalarArrayCoerceExpr.h"
+#include "gpopt/operators/CScalarBoolOp.h"
+#include "gpopt/operators/CScalarCast.h"
+#include "gpopt/operators/CScalarCmp.h"
+#include "gpopt/operators/CScalarConst.h"
+#include "gpopt/operators/CScalarFunc.h"
+#include "gpopt/operators/CScalarIdent.h"
+#include "gpopt/operators/CScalarNullTest.h"
+#include "gpopt/operators/CScalarOp.h"
+#include "gpopt/operators/CScalarParam.h"
+#include "gpopt/operators/CScalarProjectElement.h"
+#include "gpopt/operators/CScalarProjectList.h"
+#include "gpopt/translate/CTranslatorDXLToExprUtils.h"
+#include "gpopt/translate/CTranslatorQueryToExpr.h"
+#include "gpopt/translate/CTranslatorScalarToDXL.h"
+#include "gpopt/translate/CTranslatorUtils.h"
+#include "gpos/common/CAutoTimer.h"
+#include "naucrates/dxl/CDXLUtils.h"
+#include "naucrates/dxl/operators/CDXLDatum.h"
+#include "naucrates/md/CMDArrayCoerceCastGPDB.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/md/IMDCast.h"
+#include "naucrates/md/IMDFunction.h"
+#include "naucrates/md/IMDRelation.h"
+#include "naucrates/md/IMDScalarOp.h"
+#include "naucrates/md/IMDType.h"
+#include "naucrates/traceflags/traceflags.h"
+
+using namespace gpdxl;
+using namespace gpos;
+using namespace gpopt;
+using namespace gpmd;
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::CTranslatorQueryToExpr
+//
+//	@doc:
+//		Ctor
+//
+//---------------------------------------------------------------------------
+CTranslatorQueryToExpr::CTranslatorQueryToExpr(CMemoryPool *mp, CMDAccessor *md_accessor, Query *query)
+    : m_mp(mp),
+      m_md_accessor(md_accessor),
+      m_query(nullptr),
+      m_pcf(nullptr),
+      m_var_to_colid_map(nullptr),
+      m_table_colrefs(nullptr),
+      m_output_colrefs(nullptr),
+      m_output_col_names(nullptr) {
+  GPOS_ASSERT(IsSupported(query));
+
+  // Vars referring to join RTEs are replaced by the columns they stand for
+  m_query = gpdb::FlattenJoinAliasVar(query, 0 /*query_level*/);
+
+  m_var_to_colid_map = GPOS_NEW(m_mp) CMappingVarColId(m_mp);
+  m_table_colrefs = GPOS_NEW(m_mp) CColRefArray(m_mp);
+  m_output_colrefs = GPOS_NEW(m_mp) ULongPtrArray(m_mp);
+  m_output_col_names = GPOS_NEW(m_mp) CMDNameArray(m_mp);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::~CTranslatorQueryToExpr
+//
+//	@doc:
+//		Dtor
+//
+//---------------------------------------------------------------------------
+CTranslatorQueryToExpr::~CTranslatorQueryToExpr() {
+  GPOS_DELETE(m_var_to_colid_map);
+  gpdb::GPDBFree(m_query);
+  m_table_colrefs->Release();
+  m_output_colrefs->Release();
+  m_output_col_names->Release();
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::HasUnsupportedExpr
+//
+//	@doc:
+//		Expression walker returning true on the first node the direct
+//		translator cannot handle
+//
+//---------------------------------------------------------------------------
+bool CTranslatorQueryToExpr::HasUnsupportedExpr(Node *node, void *context) {
+  if (nullptr == node) {
+    return false;
+  }
+
+  Query *query = (Query *)context;
+
+  switch (nodeTag(node)) {
+    default:
+      return true;
+
+    case T_Var: {
+      Var *var = (Var *)node;
+      if (0 != var->varlevelsup || 0 >= var->varattno || 0 >= var->varno ||
+          gpdb::ListLength(query->rtable) < var->varno) {
+        return true;
+      }
+
+      RangeTblEntry *rte = (RangeTblEntry *)gpdb::ListNth(query->rtable, var->varno - 1);
+      if (RTE_JOIN == rte->rtekind) {
+        // join alias vars are flattened, so check what they resolve to
+        if (gpdb::ListLength(rte->joinaliasvars) < var->varattno) {
+          return true;
+        }
+        Node *alias_var = (Node *)gpdb::ListNth(rte->joinaliasvars, var->varattno - 1);
+        return nullptr == alias_var || HasUnsupportedExpr(alias_var, context);
+      }
+
+      return RTE_RELATION != rte->rtekind;
+    }
+
+    case T_Const:
+    case T_Param:
+    case T_OpExpr:
+    case T_BoolExpr:
+    case T_RelabelType:
+    case T_List:
+      break;
+
+    case T_NullTest: {
+      if (((NullTest *)node)->argisrow) {
+        return true;
+      }
+      break;
+    }
+
+    case T_FuncExpr: {
+      if (((FuncExpr *)node)->funcretset) {
+        return true;
+      }
+      break;
+    }
+  }
+
+  return gpdb::WalkExpressionTree(node, (bool (*)(Node *, void *))CTranslatorQueryToExpr::HasUnsupportedExpr,
+                                  context);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::IsSupportedFromClause
+//
+//	@doc:
+//		Check that a from clause entry only consists of plain tables joined
+//		by inner or left outer joins
+//
+//---------------------------------------------------------------------------
+bool CTranslatorQueryToExpr::IsSupportedFromClause(Query *query, Node *node) {
+  if (IsA(node, RangeTblRef)) {
+    const RangeTblEntry *rte = (RangeTblEntry *)gpdb::ListNth(query->rtable, ((RangeTblRef *)node)->rtindex - 1);
+    return RTE_RELATION == rte->rtekind;
+  }
+
+  if (IsA(node, JoinExpr)) {
+    JoinExpr *join_expr = (JoinExpr *)node;
+    if (JOIN_INNER != join_expr->jointype && JOIN_LEFT != join_expr->jointype) {
+      return false;
+    }
+
+    return IsSupportedFromClause(query, join_expr->larg) && IsSupportedFromClause(query, join_expr->rarg) &&
+           !HasUnsupportedExpr(join_expr->quals, query);
+  }
+
+  return false;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::IsSupported
+//
+//	@doc:
+//		Can the given query be translated without going through DXL? Anything
+//		not handled here, including every construct the DXL translator
+//		rejects, is left to CTranslatorQueryToDXL
+//
+//---------------------------------------------------------------------------
+bool CTranslatorQueryToExpr::IsSupported(Query *query) {
+  if (CMD_SELECT != query->commandType || nullptr != query->utilityStmt || nullptr != query->setOperations ||
+      NIL != query->cteList || query->hasAggs || query->hasWindowFuncs || query->hasTargetSRFs ||
+      query->hasSubLinks || query->hasDistinctOn || query->hasRecursive || query->hasModifyingCTE ||
+      query->hasForUpdate || query->hasRowSecurity || NIL != query->groupClause || NIL != query->groupingSets ||
+      nullptr != query->havingQual || NIL != query->windowClause || NIL != query->distinctClause ||
+      NIL != query->rowMarks || NIL != query->withCheckOptions || NIL != query->returningList ||
+      nullptr != query->onConflict || LIMIT_OPTION_WITH_TIES == query->limitOption) {
+    return false;
+  }
+
+  if (nullptr == query->jointree || 0 == gpdb::ListLength(query->jointree->fromlist)) {
+    return false;
+  }
+
+  ListCell *lc = nullptr;
+  foreach (lc, query->rtable) {
+    RangeTblEntry *rte = (RangeTblEntry *)lfirst(lc);
+
+    switch (rte->rtekind) {
+      case RTE_RELATION: {
+        // ONLY, RLS, TABLESAMPLE and foreign tables go through DXL which
+        // either supports or rejects them
+        if (!rte->inh || rte->lateral || nullptr != rte->securityQuals || nullptr != rte->tablesample ||
+            (RELKIND_RELATION != rte->relkind && RELKIND_PARTITIONED_TABLE != rte->relkind)) {
+          return false;
+        }
+        break;
+      }
+      case RTE_JOIN: {
+        if (JOIN_INNER != rte->jointype && JOIN_LEFT != rte->jointype) {
+          return false;
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+
+  foreach (lc, query->jointree->fromlist) {
+    if (!IsSupportedFromClause(query, (Node *)lfirst(lc))) {
+      return false;
+    }
+  }
+
+  if (HasUnsupportedExpr(query->jointree->quals, query) || HasUnsupportedExpr(query->limitCount, query) ||
+      HasUnsupportedExpr(query->limitOffset, query)) {
+    return false;
+  }
+
+  foreach (lc, query->targetList) {
+    TargetEntry *target_entry = (TargetEntry *)lfirst(lc);
+    if (HasUnsupportedExpr((Node *)target_entry->expr, query)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprTranslateQuery
+//
+//	@doc:
+//		Main driver
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprTranslateQuery() {
+  CAutoTimer at("\n[OPT]: Query To Expr Translation Time", GPOS_FTRACE(EopttracePrintOptimizationStatistics));
+
+  // see CTranslatorQueryToDXL::TranslateSelectQueryToDXL
+  CTranslatorUtils::CheckRTEPermissions(m_query->rtable);
+
+  m_pcf = COptCtxt::PoctxtFromTLS()->Pcf();
+  GPOS_ASSERT(nullptr != m_pcf);
+
+  CExpression *pexpr = PexprFromExpr(m_query->jointree);
+
+  // column references of the target entries, indexed by resno - 1
+  CColRefArray *te_colrefs = GPOS_NEW(m_mp) CColRefArray(m_mp);
+  pexpr = PexprProject(pexpr, te_colrefs);
+  pexpr = PexprLimit(pexpr, te_colrefs);
+
+  // generate the array of output column reference ids and column names
+  ListCell *lc = nullptr;
+  foreach (lc, m_query->targetList) {
+    TargetEntry *target_entry = (TargetEntry *)lfirst(lc);
+    if (target_entry->resjunk) {
+      continue;
+    }
+
+    CColRef *colref = (*te_colrefs)[target_entry->resno - 1];
+    m_output_colrefs->Append(GPOS_NEW(m_mp) uint32_t(colref->Id()));
+
+    CMDName *mdname = nullptr;
+    if (nullptr == target_entry->resname) {
+      CWStringConst str_unnamed_col(GPOS_WSZ_LIT("?column?"));
+      mdname = GPOS_NEW(m_mp) CMDName(m_mp, &str_unnamed_col);
+    } else {
+      CWStringDynamic *alias_str = CDXLUtils::CreateDynamicStringFromCharArray(m_mp, target_entry->resname);
+      mdname = GPOS_NEW(m_mp) CMDName(m_mp, alias_str);
+      GPOS_DELETE(alias_str);
+    }
+    m_output_col_names->Append(mdname);
+  }
+  te_colrefs->Release();
+
+  MarkUnknownColsAsUnused();
+
+  return pexpr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::Ptabdesc
+//
+//	@doc:
+//		Construct a table descriptor from a range table entry, combining
+//		CTranslatorUtils::GetTableDescr and CTranslatorDXLToExpr::Ptabdesc
+//
+//---------------------------------------------------------------------------
+CTableDescriptor *CTranslatorQueryToExpr::Ptabdesc(const RangeTblEntry *rte) {
+  CMDIdGPDB *mdid = GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidRel, rte->relid);
+  const IMDRelation *md_rel = m_md_accessor->RetrieveRel(mdid);
+
+  CWStringConst *str_name = rte->alias ? GPOS_NEW(m_mp) CWStringConst(m_mp, rte->alias->aliasname)
+                                       : GPOS_NEW(m_mp) CWStringConst(m_mp, md_rel->Mdname().GetMDName()->GetBuffer());
+
+  CTableDescriptor *ptabdesc = GPOS_NEW(m_mp)
+      CTableDescriptor(m_mp, mdid, CName(m_mp, str_name), md_rel->ConvertHashToRandom(),
+                       md_rel->RetrieveRelStorageType(), 0 /*ulExecuteAsUser*/, rte->rellockmode, 0 /*acl_mode*/,
+                       UNASSIGNED_QUERYID);
+  GPOS_DELETE(str_name);
+
+  // position of each column among the non-dropped ones
+  IntToUlongMap *attno_to_colpos = GPOS_NEW(m_mp) IntToUlongMap(m_mp);
+  UlongToUlongMap *pos_to_colpos = GPOS_NEW(m_mp) UlongToUlongMap(m_mp);
+
+  const uint32_t num_columns = md_rel->ColumnCount();
+  uint32_t col_pos = 0;
+  for (uint32_t ul = 0; ul < num_columns; ul++) {
+    const IMDColumn *md_col = md_rel->GetMdCol(ul);
+    if (md_col->IsDropped()) {
+      continue;
+    }
+
+    (void)attno_to_colpos->Insert(GPOS_NEW(m_mp) int32_t(md_col->AttrNum()), GPOS_NEW(m_mp) uint32_t(col_pos));
+    (void)pos_to_colpos->Insert(GPOS_NEW(m_mp) uint32_t(ul), GPOS_NEW(m_mp) uint32_t(col_pos));
+    col_pos++;
+
+    const IMDType *md_type = m_md_accessor->RetrieveType(md_col->MdidType());
+    CColumnDescriptor *pcoldesc = GPOS_NEW(m_mp)
+        CColumnDescriptor(m_mp, md_type, md_col->TypeModifier(), CName(m_mp, md_col->Mdname().GetMDName()),
+                          md_col->AttrNum(), md_col->IsNullable(), md_col->Length());
+    ptabdesc->AddColumn(pcoldesc);
+  }
+
+  if (md_rel->IsPartitioned()) {
+    const uint32_t num_part_cols = md_rel->PartColumnCount();
+    for (uint32_t ul = 0; ul < num_part_cols; ul++) {
+      int32_t attno = md_rel->PartColAt(ul)->AttrNum();
+      uint32_t *part_col_pos = attno_to_colpos->Find(&attno);
+      GPOS_ASSERT(nullptr != part_col_pos);
+      ptabdesc->AddPartitionColumn(*part_col_pos);
+    }
+  }
+
+  // populate key sets
+  CTranslatorDXLToExprUtils::AddKeySets(m_mp, ptabdesc, md_rel, pos_to_colpos);
+
+  attno_to_colpos->Release();
+  pos_to_colpos->Release();
+
+  return ptabdesc;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprFromExpr
+//
+//	@doc:
+//		Translate a from expression; several from list entries become an
+//		n-ary inner join, the quals its condition
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprFromExpr(FromExpr *from_expr) {
+  const uint32_t num_entries = gpdb::ListLength(from_expr->fromlist);
+  GPOS_ASSERT(0 < num_entries);
+
+  if (1 == num_entries) {
+    CExpression *pexpr = PexprFromClause((Node *)gpdb::ListNth(from_expr->fromlist, 0));
+    if (nullptr == from_expr->quals) {
+      return pexpr;
+    }
+
+    CExpression *pexpr_cond = PexprScalar((Expr *)from_expr->quals);
+    return GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CLogicalSelect(m_mp), pexpr, pexpr_cond);
+  }
+
+  CExpressionArray *pdrgpexpr_children = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+  ListCell *lc = nullptr;
+  foreach (lc, from_expr->fromlist) {
+    pdrgpexpr_children->Append(PexprFromClause((Node *)lfirst(lc)));
+  }
+
+  // a cross join has condition true
+  CExpression *pexpr_cond = nullptr == from_expr->quals ? CUtils::PexprScalarConstBool(m_mp, true /*value*/)
+                                                        : PexprScalar((Expr *)from_expr->quals);
+  pdrgpexpr_children->Append(pexpr_cond);
+
+  return CUtils::PexprLogicalJoin(m_mp, EdxljtInner, pdrgpexpr_children);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprFromClause
+//
+//	@doc:
+//		Translate a from list entry or a join child
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprFromClause(Node *node) {
+  GPOS_ASSERT(nullptr != node);
+
+  if (IsA(node, RangeTblRef)) {
+    uint32_t rt_index = ((RangeTblRef *)node)->rtindex;
+    const RangeTblEntry *rte = (RangeTblEntry *)gpdb::ListNth(m_query->rtable, rt_index - 1);
+    GPOS_ASSERT(RTE_RELATION == rte->rtekind);
+
+    return PexprLogicalGet(rte, rt_index);
+  }
+
+  GPOS_ASSERT(IsA(node, JoinExpr));
+  return PexprJoin((JoinExpr *)node);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprLogicalGet
+//
+//	@doc:
+//		Translate a base relation into a logical get and make note of its
+//		columns
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprLogicalGet(const RangeTblEntry *rte, uint32_t rt_index) {
+  CTableDescriptor *ptabdesc = Ptabdesc(rte);
+
+  CName *pname = GPOS_NEW(m_mp) CName(m_mp, ptabdesc->Name());
+  CLogicalGet *pop_get = GPOS_NEW(m_mp) CLogicalGet(m_mp, pname, ptabdesc, false /*hasSecurityQuals*/);
+
+  CColRefArray *colref_array = pop_get->PdrgpcrOutput();
+  const uint32_t num_cols = colref_array->Size();
+  for (uint32_t ul = 0; ul < num_cols; ul++) {
+    CColRef *colref = (*colref_array)[ul];
+    colref->SetMdidTable(ptabdesc->MDId());
+    m_table_colrefs->Append(colref);
+  }
+
+  m_var_to_colid_map->LoadColRefs(0 /*query_level*/, rt_index, colref_array);
+
+  return GPOS_NEW(m_mp) CExpression(m_mp, pop_get);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprJoin
+//
+//	@doc:
+//		Translate an inner or left outer join expression
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprJoin(JoinExpr *join_expr) {
+  GPOS_ASSERT(JOIN_INNER == join_expr->jointype || JOIN_LEFT == join_expr->jointype);
+
+  CExpressionArray *pdrgpexpr_children = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+  pdrgpexpr_children->Append(PexprFromClause(join_expr->larg));
+  pdrgpexpr_children->Append(PexprFromClause(join_expr->rarg));
+
+  // a cross join has condition true
+  CExpression *pexpr_cond = nullptr == join_expr->quals ? CUtils::PexprScalarConstBool(m_mp, true /*value*/)
+                                                        : PexprScalar((Expr *)join_expr->quals);
+  pdrgpexpr_children->Append(pexpr_cond);
+
+  EdxlJoinType join_type = JOIN_INNER == join_expr->jointype ? EdxljtInner : EdxljtLeft;
+  return CUtils::PexprLogicalJoin(m_mp, join_type, pdrgpexpr_children);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprProject
+//
+//	@doc:
+//		Translate the target list. Columns are passed through, every other
+//		entry is computed by a project on top of the child
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprProject(CExpression *pexpr_child, CColRefArray *te_colrefs) {
+  CExpressionArray *pdrgpexpr_prj_elems = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+
+  ListCell *lc = nullptr;
+  foreach (lc, m_query->targetList) {
+    TargetEntry *target_entry = (TargetEntry *)lfirst(lc);
+    GPOS_ASSERT((uint32_t)target_entry->resno == te_colrefs->Size() + 1);
+
+    CExpression *pexpr_scalar = PexprScalar(target_entry->expr);
+    if (IsA(target_entry->expr, Var)) {
+      te_colrefs->Append(const_cast<CColRef *>(CScalarIdent::PopConvert(pexpr_scalar->Pop())->Pcr()));
+      pexpr_scalar->Release();
+      continue;
+    }
+
+    CScalar *pop_scalar = CScalar::PopConvert(pexpr_scalar->Pop());
+    const IMDType *md_type = m_md_accessor->RetrieveType(pop_scalar->MdidType());
+
+    CWStringDynamic *alias_str = CDXLUtils::CreateDynamicStringFromCharArray(
+        m_mp, nullptr == target_entry->resname ? "?column?" : target_entry->resname);
+    CColRef *colref = m_pcf->PcrCreate(md_type, pop_scalar->TypeModifier(), CName(m_mp, alias_str));
+    GPOS_DELETE(alias_str);
+
+    te_colrefs->Append(colref);
+    pdrgpexpr_prj_elems->Append(
+        GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CScalarProjectElement(m_mp, colref), pexpr_scalar));
+  }
+
+  if (0 == pdrgpexpr_prj_elems->Size()) {
+    pdrgpexpr_prj_elems->Release();
+    return pexpr_child;
+  }
+
+  CExpression *pexpr_prj_list =
+      GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CScalarProjectList(m_mp), pdrgpexpr_prj_elems);
+
+  return GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CLogicalProject(m_mp), pexpr_child, pexpr_prj_list);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprLimit
+//
+//	@doc:
+//		Translate the sort clause, limit count and offset into a logical
+//		limit, see CTranslatorDXLToExpr::PexprLogicalLimit
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprLimit(CExpression *pexpr_child, CColRefArray *te_colrefs) {
+  if (0 == gpdb::ListLength(m_query->sortClause) && nullptr == m_query->limitCount &&
+      nullptr == m_query->limitOffset) {
+    return pexpr_child;
+  }
+
+  COrderSpec *pos = GPOS_NEW(m_mp) COrderSpec(m_mp);
+  ListCell *lc = nullptr;
+  foreach (lc, m_query->sortClause) {
+    SortGroupClause *sort_group_clause = (SortGroupClause *)lfirst(lc);
+
+    // find the target entry of the sorting column
+    CColRef *colref = nullptr;
+    ListCell *lc_te = nullptr;
+    foreach (lc_te, m_query->targetList) {
+      TargetEntry *target_entry = (TargetEntry *)lfirst(lc_te);
+      if (target_entry->ressortgroupref == sort_group_clause->tleSortGroupRef) {
+        colref = (*te_colrefs)[target_entry->resno - 1];
+        break;
+      }
+    }
+    GPOS_ASSERT(nullptr != colref);
+
+    COrderSpec::ENullTreatment ent = sort_group_clause->nulls_first ? COrderSpec::EntFirst : COrderSpec::EntLast;
+    pos->Append(GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, sort_group_clause->sortop), colref, ent);
+  }
+
+  CExpression *pexpr_count = nullptr;
+  bool has_count = false;
+  if (nullptr != m_query->limitCount) {
+    pexpr_count = PexprScalar((Expr *)m_query->limitCount);
+    COperator *pop_count = pexpr_count->Pop();
+    has_count = COperator::EopScalarConst != pop_count->Eopid() ||
+                !CScalarConst::PopConvert(pop_count)->GetDatum()->IsNull();
+  } else {
+    // no limit count is specified, manufacture a null count
+    pexpr_count = CUtils::PexprScalarConstInt8(m_mp, 0 /*val*/, true /*is_null*/);
+  }
+
+  CExpression *pexpr_offset = nullptr != m_query->limitOffset ? PexprScalar((Expr *)m_query->limitOffset)
+                                                              : CUtils::PexprScalarConstInt8(m_mp, 0 /*val*/);
+
+  // the limit of the top level query is never removed
+  CLogicalLimit *pop_limit =
+      GPOS_NEW(m_mp) CLogicalLimit(m_mp, pos, true /*fGlobal*/, has_count, true /*fTopLimitUnderDML*/);
+  return GPOS_NEW(m_mp) CExpression(m_mp, pop_limit, pexpr_child, pexpr_offset, pexpr_count);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalar
+//
+//	@doc:
+//		Translate a scalar expression
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalar(const Expr *expr) {
+  // recursive function - check stack
+  GPOS_CHECK_STACK_SIZE;
+  GPOS_ASSERT(nullptr != expr);
+
+  switch (nodeTag(expr)) {
+    default: {
+      GPOS_ASSERT(!"Expression not supported by the direct translator");
+      GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiQuery2DXLUnsupportedFeature, GPOS_WSZ_LIT("Scalar expression"));
+      return nullptr;
+    }
+    case T_Var:
+      return PexprScalarVar(expr);
+    case T_Const:
+      return PexprScalarConst(expr);
+    case T_Param:
+      return PexprScalarParam(expr);
+    case T_OpExpr:
+      return PexprScalarOp(expr);
+    case T_BoolExpr:
+      return PexprScalarBoolOp(expr);
+    case T_NullTest:
+      return PexprScalarNullTest(expr);
+    case T_RelabelType:
+      return PexprScalarRelabelType(expr);
+    case T_FuncExpr:
+      return PexprScalarFunc(expr);
+    case T_List: {
+      // implicitly ANDed quals
+      CExpressionArray *pdrgpexpr = PdrgpexprScalarChildren((List *)expr);
+      if (1 == pdrgpexpr->Size()) {
+        CExpression *pexpr = (*pdrgpexpr)[0];
+        pexpr->AddRef();
+        pdrgpexpr->Release();
+        return pexpr;
+      }
+      return CUtils::PexprScalarBoolOp(m_mp, CScalarBoolOp::EboolopAnd, pdrgpexpr);
+    }
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PdrgpexprScalarChildren
+//
+//	@doc:
+//		Translate a list of scalar expressions
+//
+//---------------------------------------------------------------------------
+CExpressionArray *CTranslatorQueryToExpr::PdrgpexprScalarChildren(List *args) {
+  CExpressionArray *pdrgpexpr = GPOS_NEW(m_mp) CExpressionArray(m_mp);
+
+  ListCell *lc = nullptr;
+  foreach (lc, args) {
+    pdrgpexpr->Append(PexprScalar((Expr *)lfirst(lc)));
+  }
+
+  return pdrgpexpr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarVar
+//
+//	@doc:
+//		Translate a Var into an ident of the column reference it maps to
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarVar(const Expr *expr) {
+  const Var *var = (Var *)expr;
+
+  const uint32_t colid = m_var_to_colid_map->GetColId(0 /*query_level*/, var, EpspotNone);
+  CColRef *colref = m_pcf->LookupColRef(colid);
+  GPOS_ASSERT(nullptr != colref);
+  colref->MarkAsUsed();
+
+  return GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CScalarIdent(m_mp, colref));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarConst
+//
+//	@doc:
+//		Translate a Const
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarConst(const Expr *expr) {
+  const Const *constant = (Const *)expr;
+
+  CDXLDatum *datum_dxl = CTranslatorScalarToDXL::TranslateConstToDXL(m_mp, m_md_accessor, constant);
+  IDatum *datum = m_md_accessor->RetrieveType(datum_dxl->MDId())->GetDatumForDXLDatum(m_mp, datum_dxl);
+  datum_dxl->Release();
+
+  return GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CScalarConst(m_mp, datum));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarParam
+//
+//	@doc:
+//		Translate a Param
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarParam(const Expr *expr) {
+  const Param *param = (Param *)expr;
+
+  CScalarParam *pop_param = GPOS_NEW(m_mp) CScalarParam(
+      m_mp, param->paramid, GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, param->paramtype), param->paramtypmod);
+
+  return GPOS_NEW(m_mp) CExpression(m_mp, pop_param);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarOp
+//
+//	@doc:
+//		Translate an OpExpr; binary operators returning bool are comparisons
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarOp(const Expr *expr) {
+  const OpExpr *op_expr = (OpExpr *)expr;
+
+  CMDIdGPDB *mdid_op = GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, op_expr->opno);
+  CMDIdGPDB *mdid_return_type = GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, op_expr->opresulttype);
+  const CWStringConst *str_op = m_md_accessor->RetrieveScOp(mdid_op)->Mdname().GetMDName();
+
+  CExpressionArray *pdrgpexpr_args = PdrgpexprScalarChildren(op_expr->args);
+
+  if (IMDType::EtiBool == m_md_accessor->RetrieveType(mdid_return_type)->GetDatumType() &&
+      2 == pdrgpexpr_args->Size()) {
+    mdid_return_type->Release();
+    CScalarCmp *pop_cmp = GPOS_NEW(m_mp) CScalarCmp(m_mp, mdid_op, GPOS_NEW(m_mp) CWStringConst(m_mp, str_op->GetBuffer()),
+                                                    CUtils::ParseCmpType(mdid_op));
+    return GPOS_NEW(m_mp) CExpression(m_mp, pop_cmp, pdrgpexpr_args);
+  }
+
+  CScalarOp *pop_op = GPOS_NEW(m_mp)
+      CScalarOp(m_mp, mdid_op, mdid_return_type, GPOS_NEW(m_mp) CWStringConst(m_mp, str_op->GetBuffer()));
+  return GPOS_NEW(m_mp) CExpression(m_mp, pop_op, pdrgpexpr_args);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarBoolOp
+//
+//	@doc:
+//		Translate a BoolExpr; two cascaded NOTs cancel each other
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarBoolOp(const Expr *expr) {
+  const BoolExpr *bool_expr = (BoolExpr *)expr;
+  const uint32_t count = gpdb::ListLength(bool_expr->args);
+
+  if ((NOT_EXPR != bool_expr->boolop && 2 > count) || (NOT_EXPR == bool_expr->boolop && 1 != count)) {
+    GPOS_RAISE(gpdxl::ExmaDXL, gpdxl::ExmiQuery2DXLUnsupportedFeature,
+               GPOS_WSZ_LIT("Boolean Expression: Incorrect Number of Children "));
+  }
+
+  CScalarBoolOp::EBoolOperator eboolop = CScalarBoolOp::EboolopAnd;
+  switch (bool_expr->boolop) {
+    case AND_EXPR:
+      eboolop = CScalarBoolOp::EboolopAnd;
+      break;
+    case OR_EXPR:
+      eboolop = CScalarBoolOp::EboolopOr;
+      break;
+    case NOT_EXPR: {
+      Expr *child = (Expr *)gpdb::ListNth(bool_expr->args, 0);
+      if (IsA(child, BoolExpr) && NOT_EXPR == ((BoolExpr *)child)->boolop) {
+        return PexprScalar((Expr *)gpdb::ListNth(((BoolExpr *)child)->args, 0));
+      }
+      eboolop = CScalarBoolOp::EboolopNot;
+      break;
+    }
+  }
+
+  return CUtils::PexprScalarBoolOp(m_mp, eboolop, PdrgpexprScalarChildren(bool_expr->args));
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarNullTest
+//
+//	@doc:
+//		Translate a NullTest; IS NOT NULL gets a NOT on top
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarNullTest(const Expr *expr) {
+  const NullTest *null_test = (NullTest *)expr;
+  GPOS_ASSERT(IS_NULL == null_test->nulltesttype || IS_NOT_NULL == null_test->nulltesttype);
+
+  CExpression *pexpr =
+      GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CScalarNullTest(m_mp), PexprScalar(null_test->arg));
+
+  if (IS_NOT_NULL == null_test->nulltesttype) {
+    pexpr = GPOS_NEW(m_mp) CExpression(m_mp, GPOS_NEW(m_mp) CScalarBoolOp(m_mp, CScalarBoolOp::EboolopNot), pexpr);
+  }
+
+  return pexpr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarRelabelType
+//
+//	@doc:
+//		Translate a RelabelType into a cast without a cast function, see
+//		CTranslatorDXLToExpr::PexprScalarCast
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarRelabelType(const Expr *expr) {
+  const RelabelType *relabel_type = (RelabelType *)expr;
+
+  CExpression *pexpr_child = PexprScalar(relabel_type->arg);
+
+  IMDId *mdid_type = GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, relabel_type->resulttype);
+  IMDId *mdid_input = CScalar::PopConvert(pexpr_child->Pop())->MdidType();
+  const IMDCast *md_cast = m_md_accessor->Pmdcast(mdid_input, mdid_type);
+
+  if (md_cast->GetMDPathType() == IMDCast::EmdtArrayCoerce) {
+    CMDArrayCoerceCastGPDB *array_coerce_cast = (CMDArrayCoerceCastGPDB *)md_cast;
+    CExpression *pexpr_cast_func =
+        CUtils::PexprFuncElemExpr(m_mp, m_md_accessor, md_cast->GetCastFuncMdId(),
+                                  array_coerce_cast->GetSrcElemTypeMdId(), array_coerce_cast->TypeModifier());
+
+    return GPOS_NEW(m_mp) CExpression(
+        m_mp,
+        GPOS_NEW(m_mp) CScalarArrayCoerceExpr(m_mp, mdid_type, array_coerce_cast->TypeModifier(),
+                                              (COperator::ECoercionForm)array_coerce_cast->GetCoercionForm(),
+                                              array_coerce_cast->Location()),
+        pexpr_child, pexpr_cast_func);
+  }
+
+  IMDId *mdid_func = GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, 0 /*casting function oid*/);
+  return GPOS_NEW(m_mp) CExpression(
+      m_mp, GPOS_NEW(m_mp) CScalarCast(m_mp, mdid_type, mdid_func, md_cast->IsBinaryCoercible()), pexpr_child);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::PexprScalarFunc
+//
+//	@doc:
+//		Translate a FuncExpr; functions implementing a cast become casts, see
+//		CTranslatorDXLToExpr::PexprScalarFunc
+//
+//---------------------------------------------------------------------------
+CExpression *CTranslatorQueryToExpr::PexprScalarFunc(const Expr *expr) {
+  const FuncExpr *func_expr = (FuncExpr *)expr;
+
+  CMDIdGPDB *mdid_func = GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, func_expr->funcid);
+  CMDIdGPDB *mdid_return_type = GPOS_NEW(m_mp) CMDIdGPDB(IMDId::EmdidGeneral, func_expr->funcresulttype);
+  const IMDFunction *md_func = m_md_accessor->RetrieveFunc(mdid_func);
+
+  CExpressionArray *pdrgpexpr_args = PdrgpexprScalarChildren(func_expr->args);
+
+  IMDId *mdid_input = nullptr;
+  if (1 == pdrgpexpr_args->Size()) {
+    mdid_input = CScalar::PopConvert((*pdrgpexpr_args)[0]->Pop())->MdidType();
+  }
+
+  COperator *pop = nullptr;
+  if (nullptr != mdid_input && CMDAccessorUtils::FCastExists(m_md_accessor, mdid_input, mdid_return_type) &&
+      m_md_accessor->Pmdcast(mdid_input, mdid_return_type)->GetCastFuncMdId()->Equals(mdid_func)) {
+    const IMDCast *md_cast = m_md_accessor->Pmdcast(mdid_input, mdid_return_type);
+
+    if (md_cast->GetMDPathType() == IMDCast::EmdtArrayCoerce) {
+      CMDArrayCoerceCastGPDB *array_coerce_cast = (CMDArrayCoerceCastGPDB *)md_cast;
+      mdid_func->Release();
+      pop = GPOS_NEW(m_mp) CScalarArrayCoerceExpr(m_mp, mdid_return_type, array_coerce_cast->TypeModifier(),
+                                                  (COperator::ECoercionForm)array_coerce_cast->GetCoercionForm(),
+                                                  array_coerce_cast->Location());
+    } else {
+      pop = GPOS_NEW(m_mp) CScalarCast(m_mp, mdid_return_type, mdid_func, md_cast->IsBinaryCoercible());
+    }
+  } else {
+    pop = GPOS_NEW(m_mp) CScalarFunc(m_mp, mdid_func, mdid_return_type, gpdb::ExprTypeMod((Node *)expr),
+                                     GPOS_NEW(m_mp) CWStringConst(m_mp, md_func->Mdname().GetMDName()->GetBuffer()),
+                                     func_expr->funcvariadic);
+  }
+
+  if (IMDFunction::EfsVolatile == md_func->GetFuncStability()) {
+    COptCtxt::PoctxtFromTLS()->SetHasVolatileFunc();
+  }
+
+  if (0 == pdrgpexpr_args->Size()) {
+    pdrgpexpr_args->Release();
+    return GPOS_NEW(m_mp) CExpression(m_mp, pop);
+  }
+
+  return GPOS_NEW(m_mp) CExpression(m_mp, pop, pdrgpexpr_args);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CTranslatorQueryToExpr::MarkUnknownColsAsUnused
+//
+//	@doc:
+//		Mark the table columns the query does not reference as unused. This
+//		can only be done once the whole query has been translated
+//
+//---------------------------------------------------------------------------
+void CTranslatorQueryToExpr::MarkUnknownColsAsUnused() {
+  const uint32_t size = m_table_colrefs->Size();
+  for (uint32_t ul = 0; ul < size; ul++) {
+    CColRef *colref = (*m_table_colrefs)[ul];
+    if (colref->GetUsage() == CColRef::EUnknown) {
+      colref->MarkAsUnused();
+    }
+  }
+}
+
+// EOF
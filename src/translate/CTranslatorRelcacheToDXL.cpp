@@ -304,7 +304,8 @@ void CTranslatorRelcacheToDXL::CheckUnsupportedRelation(Relation rel) {
 //		CTranslatorRelcacheToDXL::RetrieveExtStats
 //
 //	@doc:
-//		Retrieve extended statistics from relcache
+//		Retrieve extended statistics from relcache: functional dependencies,
+//		multivariate n-distinct coefficients and multi-column MCV lists
 //
 //---------------------------------------------------------------------------
 IMDCacheObject *CTranslatorRelcacheToDXL::RetrieveExtStats(CMemoryPool *mp, IMDId *mdid) {
@@ -345,11 +346,41 @@ IMDCacheObject *CTranslatorRelcacheToDXL::RetrieveExtStats(CMemoryPool *mp, IMDI
     }
   }
 
+  CMDMCVItemArray *md_mcv_items = GPOS_NEW(mp) CMDMCVItemArray(mp);
+  if (list_member_int(kinds, STATS_EXT_MCV)) {
+    MCVList *mcvlist = gpdb::GetMVMCVList(stat_oid);
+
+    if (nullptr != mcvlist) {
+      IMDType *md_types[STATS_MAX_DIMENSIONS];
+      for (int32_t dim = 0; dim < mcvlist->ndimensions; dim++) {
+        CMDIdGPDB *mdid_type = GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidGeneral, mcvlist->types[dim]);
+        md_types[dim] = RetrieveType(mp, mdid_type);
+        mdid_type->Release();
+      }
+
+      for (uint32_t i = 0; i < mcvlist->nitems; i++) {
+        MCVItem *item = &mcvlist->items[i];
+
+        IDatumArray *values = GPOS_NEW(mp) IDatumArray(mp);
+        for (int32_t dim = 0; dim < mcvlist->ndimensions; dim++) {
+          values->Append(CTranslatorScalarToDXL::CreateIDatumFromGpdbDatum(mp, md_types[dim], item->isnull[dim],
+                                                                           item->values[dim]));
+        }
+
+        md_mcv_items->Append(GPOS_NEW(mp) CMDMCVItem(item->frequency, item->base_frequency, values));
+      }
+
+      for (int32_t dim = 0; dim < mcvlist->ndimensions; dim++) {
+        md_types[dim]->Release();
+      }
+    }
+  }
+
   const CWStringConst *statname = GPOS_NEW(mp)
       CWStringConst(CDXLUtils::CreateDynamicStringFromCharArray(mp, gpdb::GetExtStatsName(stat_oid))->GetBuffer());
   CMDName *mdname = GPOS_NEW(mp) CMDName(mp, statname);
 
-  return GPOS_NEW(mp) CDXLExtStats(mp, mdid, mdname, deps, md_ndistincts);
+  return GPOS_NEW(mp) CDXLExtStats(mp, mdid, mdname, deps, md_ndistincts, md_mcv_items);
 }
 
 //---------------------------------------------------------------------------
@@ -1146,9 +1177,9 @@ CMDAggregateGPDB *CTranslatorRelcacheToDXL::RetrieveAgg(CMemoryPool *mp, IMDId *
   // combine function
   bool is_splittable = !is_ordered && gpdb::IsAggPartialCapable(agg_oid);
 
-  // cannot use hash agg for ordered aggs or aggs without a combine func
-  // due to the fact that hashAgg may spill
-  bool is_hash_agg_capable = !is_ordered && gpdb::IsAggPartialCapable(agg_oid);
+  // ordered aggs cannot use hash agg; unlike in GPDB, a spilling hash agg
+  // does not need a combine function, so this is independent of splitting
+  bool is_hash_agg_capable = !is_ordered && gpdb::IsAggHashCapable(agg_oid);
 
   CMDAggregateGPDB *pmdagg =
       GPOS_NEW(mp) CMDAggregateGPDB(mp, mdid, mdname, result_type_mdid, intermediate_result_type_mdid, is_ordered,
@@ -23,55 +23,80 @@ extern "C" {
 
 using namespace gpos;
 
+uint64_t CMemoryPoolPalloc::m_total_allocated_size = 0;
+uint64_t CMemoryPoolPalloc::m_query_baseline = 0;
+uint64_t CMemoryPoolPalloc::m_query_limit = 0;
+
 // ctor
 CMemoryPoolPalloc::CMemoryPoolPalloc() {
+  GPOS_CPL_ASSERT(GPOS_MEM_ALIGNED_STRUCT_SIZE(SAllocHeader) == sizeof(SAllocHeader), "");
+
   m_cxt = gpdb::GPDBAllocSetContextCreate();
 }
 
-void *CMemoryPoolPalloc::NewImpl(const uint32_t bytes, const char *, const uint32_t, CMemoryPool::EAllocationType eat) {
-  // if it's a singleton allocation, allocate requested memory
-  if (CMemoryPool::EatSingleton == eat) {
-    return gpdb::GPDBMemoryContextAlloc(m_cxt, bytes);
+void *CMemoryPoolPalloc::NewImpl(const uint32_t bytes, const char *, const uint32_t, CMemoryPool::EAllocationType) {
+  GPOS_ASSERT(bytes <= GPOS_MEM_ALLOC_MAX);
+
+  // singletons get the same header as arrays, a raw palloc chunk could not
+  // be told apart from allocations of other pools when it is freed
+  uint32_t alloc_size = sizeof(SAllocHeader) + GPOS_MEM_ALIGNED_SIZE(bytes);
+
+  if (0 < m_query_limit && m_total_allocated_size + alloc_size > m_query_baseline + m_query_limit) {
+    GPOS_RAISE(CException::ExmaSystem, CException::ExmiOOM);
   }
-  // if it's an array allocation, allocate header + requested memory
-  else {
-    uint32_t alloc_size = GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader) + GPOS_MEM_ALIGNED_SIZE(bytes);
 
-    void *ptr = gpdb::GPDBMemoryContextAlloc(m_cxt, alloc_size);
+  SAllocHeader *header = static_cast<SAllocHeader *>(gpdb::GPDBMemoryContextAlloc(m_cxt, alloc_size));
 
-    SArrayAllocHeader *header = static_cast<SArrayAllocHeader *>(ptr);
+  header->m_mp = this;
+  header->m_trailer.m_user_size = bytes;
+  header->m_trailer.m_owner = EaoPalloc;
 
-    header->m_user_size = bytes;
-    return static_cast<uint8_t *>(ptr) + GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader);
-  }
+  m_allocated_size += alloc_size;
+  m_total_allocated_size += alloc_size;
+
+  return header + 1;
 }
 
-void CMemoryPoolPalloc::DeleteImpl(void *ptr, CMemoryPool::EAllocationType eat) {
-  if (CMemoryPool::EatSingleton == eat) {
-    gpdb::GPDBFree(ptr);
-  } else {
-    void *header = static_cast<uint8_t *>(ptr) - GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader);
-    gpdb::GPDBFree(header);
-  }
+void CMemoryPoolPalloc::DeleteImpl(void *ptr, CMemoryPool::EAllocationType) {
+  GPOS_ASSERT(EaoPalloc == Trailer(ptr)->m_owner);
+
+  SAllocHeader *header = static_cast<SAllocHeader *>(ptr) - 1;
+  uint32_t alloc_size = sizeof(SAllocHeader) + GPOS_MEM_ALIGNED_SIZE(header->m_trailer.m_user_size);
+
+  GPOS_ASSERT(header->m_mp->m_allocated_size >= alloc_size);
+  header->m_mp->m_allocated_size -= alloc_size;
+  m_total_allocated_size -= alloc_size;
+
+  gpdb::GPDBFree(header);
 }
 
-// Prepare the memory pool to be deleted
+// Prepare the memory pool to be deleted; whatever is still allocated goes
+// away with the memory context
 void CMemoryPoolPalloc::TearDown() {
   gpdb::GPDBMemoryContextDelete(m_cxt);
+  m_cxt = nullptr;
+
+  m_total_allocated_size -= m_allocated_size;
+  m_allocated_size = 0;
 }
 
 // Total allocated size including management overheads
 uint64_t CMemoryPoolPalloc::TotalAllocatedSize() const {
-  // return MemoryContextGetCurrentSpace(m_cxt);
-  return 100;
+  return m_allocated_size;
 }
 
-// get user requested size of array allocation. Note: this is ONLY called for arrays
+// get user requested size of allocation
 uint32_t CMemoryPoolPalloc::UserSizeOfAlloc(const void *ptr) {
   GPOS_ASSERT(ptr != nullptr);
-  void *void_header = static_cast<uint8_t *>(const_cast<void *>(ptr)) - GPOS_MEM_ALIGNED_STRUCT_SIZE(SArrayAllocHeader);
-  const SArrayAllocHeader *header = static_cast<SArrayAllocHeader *>(void_header);
-  return header->m_user_size;
+  GPOS_ASSERT(EaoPalloc == Trailer(ptr)->m_owner);
+
+  return Trailer(ptr)->m_user_size;
+}
+
+// limit the memory allocated from now on until the next call
+void CMemoryPoolPalloc::SetQueryMemoryLimit(uint64_t limit) {
+  m_query_baseline = m_total_allocated_size;
+  m_query_limit = limit;
 }
 
 // EOF
@@ -17,8 +17,11 @@
 
 extern "C" {
 
+#include "common/hashfn.h"
+#include "executor/nodeHash.h"
 #include "utils/fmgroids.h"
 #include "utils/guc.h"
+#include "utils/syscache.h"
 }
 
 #include "gpdbcost/CCostModelGPDB.h"
@@ -36,23 +39,28 @@ extern "C" {
 #include "gpopt/optimizer/COptimizer.h"
 #include "gpopt/optimizer/COptimizerConfig.h"
 #include "gpopt/relcache/CMDProviderRelcache.h"
+#include "gpopt/search/CSearchStage.h"
 #include "gpopt/translate/CContextDXLToPlStmt.h"
 #include "gpopt/translate/CTranslatorDXLToExpr.h"
 #include "gpopt/translate/CTranslatorDXLToPlStmt.h"
 #include "gpopt/translate/CTranslatorExprToDXL.h"
 #include "gpopt/translate/CTranslatorQueryToDXL.h"
+#include "gpopt/translate/CTranslatorQueryToExpr.h"
 #include "gpopt/translate/CTranslatorRelcacheToDXL.h"
 #include "gpopt/translate/CTranslatorUtils.h"
 #include "gpopt/translate/plan_generator.h"
 #include "gpopt/utils/CConstExprEvaluatorProxy.h"
+#include "gpopt/utils/CPlanCache.h"
 #include "gpopt/xforms/CXformFactory.h"
 #include "gpos/_api.h"
 #include "gpos/base.h"
 #include "gpos/common/CAutoP.h"
+#include "gpos/common/CBitSetIter.h"
 #include "gpos/error/CException.h"
 #include "gpos/io/COstreamString.h"
 #include "gpos/memory/CAutoMemoryPool.h"
 #include "gpos/memory/set.h"
+#include "gpos/string/CWStringDynamic.h"
 #include "gpos/task/CAutoTraceFlag.h"
 #include "naucrates/base/CQueryToDXLResult.h"
 #include "naucrates/dxl/CDXLUtils.h"
@@ -61,6 +69,7 @@ extern "C" {
 #include "naucrates/exception.h"
 #include "naucrates/init.h"
 #include "naucrates/md/CMDIdCast.h"
+#include "naucrates/md/CMDIdColStats.h"
 #include "naucrates/md/CMDIdRelStats.h"
 #include "naucrates/md/CMDIdScCmp.h"
 #include "naucrates/md/CSystemId.h"
@@ -73,11 +82,14 @@ using namespace gpopt;
 using namespace gpdxl;
 using namespace gpdbcost;
 
-// size of error buffer
-#define GPOPT_ERROR_BUFFER_SIZE 10 * 1024 * 1024
-
 // definition of default AutoMemoryPool
-#define AUTO_MEM_POOL(amp) CAutoMemoryPool amp(CAutoMemoryPool::ElcExc)
+#define AUTO_MEM_POOL(amp) CAutoMemoryPool amp(CAutoMemoryPool::ElcExc, OptimizerPoolKind())
+
+// kind of memory pool to optimize in, must be called inside a task
+static CMemoryPoolManager::EPoolKind OptimizerPoolKind() {
+  return gpdxl::OPTIMIZER_MEMORY_POOL_ARENA == GPOS_CONDIF(memory_pool) ? CMemoryPoolManager::EpkArena
+                                                                        : CMemoryPoolManager::EpkDefault;
+}
 
 // default id for the source system
 const CSystemId default_sysid(IMDId::EmdidGeneral, GPOS_WSZ_STR_LENGTH("GPDB"));
@@ -188,9 +200,6 @@ char *COptTasks::CreateMultiByteCharStringFromWCString(const wchar_t *wcstr) {
 void COptTasks::Execute(void *(*func)(void *), void *func_arg) {
   Assert(func);
 
-  char *err_buf = (char *)palloc(GPOPT_ERROR_BUFFER_SIZE);
-  err_buf[0] = '\0';
-
   // initialize DXL support
   InitDXL();
 
@@ -198,6 +207,9 @@ void COptTasks::Execute(void *(*func)(void *), void *func_arg) {
 
   CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
 
+  // error messages are rare, the string allocates only when written to
+  CWStringDynamic err_str(amp.Pmp());
+
   auto *xx = (SOptContext *)func_arg;
 
   gpos_exec_params params;
@@ -205,8 +217,9 @@ void COptTasks::Execute(void *(*func)(void *), void *func_arg) {
   params.arg = func_arg;
   params.stack_start = &params;
   params.config = xx->config;
-  params.error_buffer = err_buf;
-  params.error_buffer_size = GPOPT_ERROR_BUFFER_SIZE;
+  params.error_string = &err_str;
+  // the GUC is in kB, CLoggerStream counts wide characters
+  params.max_trace_size = (int)(xx->config->trace_max_size * 1024L / (long)sizeof(wchar_t));
   params.abort_requested = &abort_flag;
 
   // execute task and send log message to server log
@@ -214,19 +227,17 @@ void COptTasks::Execute(void *(*func)(void *), void *func_arg) {
     (void)gpos_exec(&params);
   }
   GPOS_CATCH_EX(ex) {
-    LogExceptionMessageAndDelete(err_buf);
+    LogExceptionMessage(&err_str);
     GPOS_RETHROW(ex);
   }
   GPOS_CATCH_END;
-  LogExceptionMessageAndDelete(err_buf);
+  LogExceptionMessage(&err_str);
 }
 
-void COptTasks::LogExceptionMessageAndDelete(char *err_buf) {
-  if ('\0' != err_buf[0]) {
-    elog(LOG, "%s", CreateMultiByteCharStringFromWCString((wchar_t *)err_buf));
+void COptTasks::LogExceptionMessage(const CWStringDynamic *err_str) {
+  if (!err_str->IsEmpty()) {
+    elog(LOG, "%s", CreateMultiByteCharStringFromWCString(err_str->GetBuffer()));
   }
-
-  pfree(err_buf);
 }
 
 //---------------------------------------------------------------------------
@@ -294,7 +305,7 @@ COptimizerConfig *COptTasks::CreateOptimizerConfig(CMemoryPool *mp, ICostModel *
 //			Set cost model parameters
 //
 //---------------------------------------------------------------------------
-void COptTasks::SetCostModelParams(ICostModel *cost_model) {
+void COptTasks::SetCostModelParams(ICostModel *cost_model, uint32_t parallel_workers) {
   GPOS_ASSERT(nullptr != cost_model);
 
   if (1024 > 1.0) {
@@ -314,6 +325,22 @@ void COptTasks::SetCostModelParams(ICostModel *cost_model) {
     cost_model->GetCostModelParams()->SetParam(cost_param->Id(), cost_param->Get() * 1,
                                                cost_param->GetLowerBoundVal() * 1, cost_param->GetUpperBoundVal() * 1);
   }
+
+  if (0 < parallel_workers) {
+    // let the optimizer place Gathers with that many workers
+    ICostModelParams::SCostParam *cost_param =
+        cost_model->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpParallelWorkers);
+    CDouble workers(parallel_workers);
+    cost_model->GetCostModelParams()->SetParam(cost_param->Id(), workers, workers, workers);
+  }
+
+  {
+    // the cache of a memoized inner side gets as much memory as a hash table
+    ICostModelParams::SCostParam *cost_param =
+        cost_model->GetCostModelParams()->PcpLookup(CCostModelParamsGPDB::EcpMemoizeCacheSize);
+    CDouble cache_size((double)get_hash_memory_limit());
+    cost_model->GetCostModelParams()->SetParam(cost_param->Id(), cache_size, cache_size, cache_size);
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -324,14 +351,195 @@ void COptTasks::SetCostModelParams(ICostModel *cost_model) {
 //			Generate an instance of optimizer cost model
 //
 //---------------------------------------------------------------------------
-ICostModel *COptTasks::GetCostModel(CMemoryPool *mp, uint32_t num_segments) {
+ICostModel *COptTasks::GetCostModel(CMemoryPool *mp, uint32_t num_segments, uint32_t parallel_workers) {
   ICostModel *cost_model = GPOS_NEW(mp) CCostModelGPDB(mp);
 
-  SetCostModelParams(cost_model);
+  SetCostModelParams(cost_model, parallel_workers);
 
   return cost_model;
 }
 
+// syscache invalidations to be applied to the metadata cache
+struct SSyscacheInvalidationCtxt {
+  const gpdb::MDCacheInvalidation *m_invalidations;
+  int m_num_invalidations;
+};
+
+// was the syscache entry with the given key hash invalidated?
+static bool FSyscacheInvalidated(const SSyscacheInvalidationCtxt *ctxt, int cacheid, Datum key1, Datum key2 = 0,
+                                 Datum key3 = 0) {
+  uint32 hashvalue = 0;
+  for (int i = 0; i < ctxt->m_num_invalidations; i++) {
+    if (cacheid != ctxt->m_invalidations[i].cacheid) {
+      continue;
+    }
+
+    if (0 == hashvalue) {
+      hashvalue = gpdb::GetSysCacheHashValue(cacheid, key1, key2, key3);
+    }
+    if (hashvalue == ctxt->m_invalidations[i].hashvalue) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// was any entry of the given syscache invalidated?
+static bool FSyscacheInvalidated(const SSyscacheInvalidationCtxt *ctxt, int cacheid) {
+  for (int i = 0; i < ctxt->m_num_invalidations; i++) {
+    if (cacheid == ctxt->m_invalidations[i].cacheid) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// does the cached object depend on one of the invalidated syscache entries?
+static bool FMDObjInvalidated(const IMDCacheObject *md_obj, void *arg) {
+  const SSyscacheInvalidationCtxt *ctxt = static_cast<SSyscacheInvalidationCtxt *>(arg);
+  const IMDId *mdid = md_obj->MDId();
+
+  // operator class and family changes affect the operators and orderings
+  // recorded in types, operators and indexes; they are rare enough not to
+  // bother matching them exactly
+  bool opclass_changed = FSyscacheInvalidated(ctxt, AMOPOPID) || FSyscacheInvalidated(ctxt, OPFAMILYOID);
+
+  switch (md_obj->MDType()) {
+    case IMDCacheObject::EmdtType:
+      return opclass_changed || FSyscacheInvalidated(ctxt, TYPEOID, ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid()));
+    case IMDCacheObject::EmdtOp:
+      return opclass_changed || FSyscacheInvalidated(ctxt, OPEROID, ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid()));
+    case IMDCacheObject::EmdtInd:
+      return opclass_changed;
+    case IMDCacheObject::EmdtScCmp:
+      // comparisons are resolved through the operator catalog
+      return opclass_changed || FSyscacheInvalidated(ctxt, OPEROID);
+    case IMDCacheObject::EmdtFunc:
+      return FSyscacheInvalidated(ctxt, PROCOID, ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid()));
+    case IMDCacheObject::EmdtAgg: {
+      Datum oid = ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid());
+      return FSyscacheInvalidated(ctxt, AGGFNOID, oid) || FSyscacheInvalidated(ctxt, PROCOID, oid);
+    }
+    case IMDCacheObject::EmdtCheckConstraint:
+      return FSyscacheInvalidated(ctxt, CONSTROID, ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid)->Oid()));
+    case IMDCacheObject::EmdtCastFunc: {
+      const CMDIdCast *mdid_cast = CMDIdCast::CastMdid(mdid);
+      return FSyscacheInvalidated(ctxt, CASTSOURCETARGET,
+                                  ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid_cast->MdidSrc())->Oid()),
+                                  ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid_cast->MdidDest())->Oid()));
+    }
+    case IMDCacheObject::EmdtColStats: {
+      // user columns are laid out in attribute number order, see
+      // CTranslatorRelcacheToDXL::RetrieveRelColumns
+      const CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(mdid);
+      Datum rel_oid = ObjectIdGetDatum(CMDIdGPDB::CastMdid(mdid_col_stats->GetRelMdId())->Oid());
+      Datum attno = Int16GetDatum(mdid_col_stats->Position() + 1);
+      return FSyscacheInvalidated(ctxt, STATRELATTINH, rel_oid, attno, BoolGetDatum(false)) ||
+             FSyscacheInvalidated(ctxt, STATRELATTINH, rel_oid, attno, BoolGetDatum(true));
+    }
+    default:
+      return false;
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::EvictInvalidatedMDObjects
+//
+//	@doc:
+//		Evict the metadata cache entries affected by the given catalog
+//		invalidations, keeping the rest of the cache warm
+//
+//---------------------------------------------------------------------------
+void COptTasks::EvictInvalidatedMDObjects(const gpdb::MDCacheInvalidation *invalidations, int num_invalidations) {
+  bool has_syscache_invalidations = false;
+
+  for (int i = 0; i < num_invalidations; i++) {
+    if (gpdb::MDCacheInvalidation::RELCACHE_ID == invalidations[i].cacheid) {
+      CMDCache::EvictRelation(invalidations[i].relid);
+    } else {
+      has_syscache_invalidations = true;
+    }
+  }
+
+  if (has_syscache_invalidations) {
+    SSyscacheInvalidationCtxt ctxt = {invalidations, num_invalidations};
+    CMDCache::Evict(FMDObjInvalidated, &ctxt);
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::PlanCacheConfigHash
+//
+//	@doc:
+//		Hash of the optimizer settings a cached plan depends on; settings
+//		that change the plan of a query must be folded in here
+//
+//---------------------------------------------------------------------------
+uint64_t COptTasks::PlanCacheConfigHash(const CBitSet *trace_flags, uint32_t parallel_workers) {
+  uint64_t hash = hash_combine64(GPOS_CONDIF(enable_new_planner_generation), GPOS_CONDIF(enable_direct_translation));
+  hash = hash_combine64(hash, parallel_workers);
+  hash = hash_combine64(hash, get_hash_memory_limit());
+  hash = hash_combine64(hash, GPOS_CONDIF(planning_time_budget));
+  hash = hash_combine64(hash, GPOS_CONDIF(optimizer_threads));
+
+  const char *search_strategy = GPOS_CONDIF(search_strategy);
+  if (nullptr != search_strategy) {
+    hash = hash_combine64(hash,
+                          gpos::HashByteArray((const uint8_t *)search_strategy, gpos::clib::Strlen(search_strategy)));
+  }
+
+  CBitSetIter bsi(*trace_flags);
+  while (bsi.Advance()) {
+    hash = hash_combine64(hash, bsi.Bit());
+  }
+
+  return hash;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::FMDCacheSurvivesError
+//
+//	@doc:
+//		Can the metadata cache be kept after the given optimizer error?
+//		Expected fallbacks such as unsupported features or missing catalog
+//		objects never leave partially built objects in the cache; internal
+//		errors, duplicate entries and leaked accessors might
+//
+//---------------------------------------------------------------------------
+bool COptTasks::FMDCacheSurvivesError(CException &ex) {
+  if (gpdxl::MDCACHE_CONSISTENCY_STRICT == GPOS_CONDIF(mdcache_consistency) || !CMDCache::FInitialized()) {
+    return false;
+  }
+
+  if (CException::ExmaUnhandled == ex.Major()) {
+    return false;
+  }
+
+  if (CException::ExmaSystem == ex.Major()) {
+    switch (ex.Minor()) {
+      case CException::ExmiAssert:
+      case CException::ExmiOOM:
+      case CException::ExmiInvalidDeletion:
+      case CException::ExmiUnhandled:
+      case CException::ExmiORCAInvalidState:
+        return false;
+      default:
+        break;
+    }
+  }
+
+  if (gpdxl::ExmaMD == ex.Major() && gpdxl::ExmiMDCacheEntryDuplicate == ex.Minor()) {
+    return false;
+  }
+
+  return CMDCache::FConsistent();
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::OptimizeTask
@@ -357,7 +565,9 @@ void *COptTasks::OptimizeTask(void *ptr) {
   // don't care about the return value of MDCacheNeedsReset(). But
   // we need to call it anyway, to give it a chance to initialize
   // the invalidation mechanism.
-  bool reset_mdcache = gpdb::MDCacheNeedsReset();
+  const gpdb::MDCacheInvalidation *invalidations = nullptr;
+  int num_invalidations = 0;
+  bool reset_mdcache = gpdb::MDCacheNeedsReset(&invalidations, &num_invalidations);
 
   // initialize metadata cache, or purge if needed, or change size if requested
   if (!CMDCache::FInitialized()) {
@@ -366,8 +576,16 @@ void *COptTasks::OptimizeTask(void *ptr) {
   } else if (reset_mdcache) {
     CMDCache::Reset();
     CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
-  } else if (CMDCache::ULLGetCacheQuota() != (uint64_t)optimizer_mdcache_size * 1024L) {
-    CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+    CMDCache::RecordEvent(CMDCache::EmdceInvalidationReset);
+  } else {
+    if (0 < num_invalidations) {
+      EvictInvalidatedMDObjects(invalidations, num_invalidations);
+      CMDCache::RecordEvent(CMDCache::EmdceInvalidationEvict);
+    }
+
+    if (CMDCache::ULLGetCacheQuota() != (uint64_t)optimizer_mdcache_size * 1024L) {
+      CMDCache::SetCacheQuota(optimizer_mdcache_size * 1024L);
+    }
   }
 
   CSearchStageArray *search_strategy_arr = nullptr;
@@ -378,90 +596,162 @@ void *COptTasks::OptimizeTask(void *ptr) {
   void *plan_dxl = nullptr;
   bool flag = GPOS_CONDIF(enable_new_planner_generation);
 
+  // only plans handed back as PlannedStmt are cached
+  uint32_t plan_cache_size = (uint32_t)GPOS_CONDIF(plan_cache_size);
+  bool use_plan_cache = 0 < plan_cache_size && opt_ctxt->m_should_generate_plan_stmt;
+  uint64_t generation = gpdb::MDCacheGeneration();
+  char *query_str = nullptr;
+  uint64_t config_hash = 0;
+  bool cache_plan = true;
+
+  if (0 == plan_cache_size && 0 < CPlanCache::Size()) {
+    CPlanCache::Reset();
+  }
+
   GPOS_TRY {
     // set trace flags
     trace_flags = CConfigParamMapping::PackConfigParamInBitset(mp, CXform::ExfSentinel);
     SetTraceflags(mp, trace_flags, &enabled_trace_flags, &disabled_trace_flags);
 
-    // set up relcache MD provider
-    CMDProviderRelcache *relcache_provider = GPOS_NEW(mp) CMDProviderRelcache();
+    // statements optimized before under the same settings and catalog
+    // state reuse their plan; traced statements always go through the
+    // optimizer so that they produce their trace
+    if (use_plan_cache && !GPOS_FTRACE(EopttracePrintPlan) && !GPOS_FTRACE(EopttracePrintQuery)) {
+      query_str = gpdb::NodeToString(opt_ctxt->m_query);
+      config_hash = PlanCacheConfigHash(trace_flags, opt_ctxt->m_parallel_workers);
+      opt_ctxt->m_plan_stmt = CPlanCache::Lookup(query_str, config_hash, generation);
+    }
 
-    {
-      // scope for MD accessor
-      CMDAccessor mda(mp, CMDCache::Pcache(), default_sysid, relcache_provider);
+    if (nullptr == opt_ctxt->m_plan_stmt) {
+      // set up relcache MD provider
+      CMDProviderRelcache *relcache_provider = GPOS_NEW(mp) CMDProviderRelcache();
 
-      uint32_t num_segments = gpdb::GetGPSegmentCount();
-      uint32_t num_segments_for_costing = 0;
-      if (0 == num_segments_for_costing) {
-        num_segments_for_costing = num_segments;
-      }
+      {
+        // scope for MD accessor
+        CMDAccessor mda(mp, CMDCache::Pcache(), default_sysid, relcache_provider);
+
+        uint32_t num_segments = gpdb::GetGPSegmentCount();
+        uint32_t num_segments_for_costing = 0;
+        if (0 == num_segments_for_costing) {
+          num_segments_for_costing = num_segments;
+        }
 
-      CAutoP<CTranslatorQueryToDXL> query_to_dxl_translator;
-      query_to_dxl_translator = CTranslatorQueryToDXL::QueryToDXLInstance(mp, &mda, (Query *)opt_ctxt->m_query);
-
-      ICostModel *cost_model = GetCostModel(mp, num_segments_for_costing);
-      COptimizerConfig *optimizer_config = CreateOptimizerConfig(mp, cost_model);
-      CConstExprEvaluatorProxy expr_eval_proxy(mp, &mda);
-      IConstExprEvaluator *expr_evaluator = GPOS_NEW(mp) CConstExprEvaluatorDXL(mp, &mda, &expr_eval_proxy);
-
-      CDXLNode *query_dxl = query_to_dxl_translator->TranslateQueryToDXL();
-      CDXLNodeArray *query_output_dxlnode_array = query_to_dxl_translator->GetQueryOutputCols();
-      CDXLNodeArray *cte_dxlnode_array = query_to_dxl_translator->GetCTEs();
-      GPOS_ASSERT(nullptr != query_output_dxlnode_array);
-
-      // See NoteDistributionPolicyOpclasses() in src/backend/gpopt/translate/CTranslatorQueryToDXL.cpp
-      CAutoTraceFlag atf2(EopttraceUseLegacyOpfamilies, false);
-      CAutoTraceFlag atf3(EopttracePrintQuery, true);
-      CAutoTraceFlag atf4(EopttracePrintPlan, true);
-      // CAutoTraceFlag atf5(EopttracePrintMemoAfterExploration, true);
-      // CAutoTraceFlag atf6(EopttracePrintMemoAfterImplementation, true);
-      // CAutoTraceFlag atf7(EopttracePrintMemoAfterOptimization, true);
-      // CAutoTraceFlag atf8(EopttracePrintMemoEnforcement, true);
-      // CAutoTraceFlag atf9(EopttracePrintGroupProperties, true);
-      // CAutoTraceFlag atfa(EopttracePrintExpressionProperties, true);
-      // CAutoTraceFlag atfb(EopttracePrintOptimizationContext, true);
-      // CAutoTraceFlag atfc(EopttracePrintXformPattern, true);
-      // CAutoTraceFlag atfd(EopttracePrintRequiredColumns, true);
-      // CAutoTraceFlag atfe(EopttracePrintXform, true);
-      // CAutoTraceFlag atff(EopttracePrintXformResults, true);
-
-      plan_dxl = COptimizer::PdxlnOptimize(mp, &mda, query_dxl, query_output_dxlnode_array, cte_dxlnode_array,
-                                           expr_evaluator, search_strategy_arr, optimizer_config);
-
-      if (flag) {
-        auto *plan = (PlanResult *)plan_dxl;
-        auto *plan_stmt = makeNode(PlannedStmt);
-        plan_stmt->planTree = plan->plan;
-        plan_stmt->rtable = plan->rtable;
-        plan_stmt->relationOids = plan->relationOids;
-        plan_stmt->commandType = CMD_SELECT;
-
-        opt_ctxt->m_plan_stmt = plan_stmt;
-      } else {
-        // translate DXL->PlStmt only when needed
-        if (opt_ctxt->m_should_generate_plan_stmt) {
-          // always use opt_ctxt->m_query->can_set_tag as the query_to_dxl_translator->Pquery() is a mutated Query
-          // object that may not have the correct can_set_tag
-          opt_ctxt->m_plan_stmt = (PlannedStmt *)gpdb::CopyObject(ConvertToPlanStmtFromDXL(
-              mp, &mda, opt_ctxt->m_query, (CDXLNode *)plan_dxl, opt_ctxt->m_query->canSetTag));
+        ICostModel *cost_model = GetCostModel(mp, num_segments_for_costing, opt_ctxt->m_parallel_workers);
+        COptimizerConfig *optimizer_config = CreateOptimizerConfig(mp, cost_model);
+        CConstExprEvaluatorProxy expr_eval_proxy(mp, &mda);
+        IConstExprEvaluator *expr_evaluator = GPOS_NEW(mp) CConstExprEvaluatorDXL(mp, &mda, &expr_eval_proxy);
+
+        // a configured search strategy replaces the single default stage
+        const char *search_strategy = GPOS_CONDIF(search_strategy);
+        if (nullptr != search_strategy && '\0' != search_strategy[0]) {
+          search_strategy_arr = CSearchStage::PdrgpssParse(mp, search_strategy);
+        }
+
+        // simple queries are translated straight into the optimizer's input
+        // expression, everything else goes through DXL
+        bool direct_translation =
+            GPOS_CONDIF(enable_direct_translation) && CTranslatorQueryToExpr::IsSupported(opt_ctxt->m_query);
+
+        // See NoteDistributionPolicyOpclasses() in src/backend/gpopt/translate/CTranslatorQueryToDXL.cpp
+        CAutoTraceFlag atf2(EopttraceUseLegacyOpfamilies, false);
+        // CAutoTraceFlag atf5(EopttracePrintMemoAfterExploration, true);
+        // CAutoTraceFlag atf6(EopttracePrintMemoAfterImplementation, true);
+        // CAutoTraceFlag atf7(EopttracePrintMemoAfterOptimization, true);
+        // CAutoTraceFlag atf8(EopttracePrintMemoEnforcement, true);
+        // CAutoTraceFlag atf9(EopttracePrintGroupProperties, true);
+        // CAutoTraceFlag atfa(EopttracePrintExpressionProperties, true);
+        // CAutoTraceFlag atfb(EopttracePrintOptimizationContext, true);
+        // CAutoTraceFlag atfc(EopttracePrintXformPattern, true);
+        // CAutoTraceFlag atfd(EopttracePrintRequiredColumns, true);
+        // CAutoTraceFlag atfe(EopttracePrintXform, true);
+        // CAutoTraceFlag atff(EopttracePrintXformResults, true);
+
+        CDXLNode *query_dxl = nullptr;
+        if (direct_translation) {
+          CAutoP<CTranslatorQueryToExpr> query_to_expr_translator;
+          query_to_expr_translator = GPOS_NEW(mp) CTranslatorQueryToExpr(mp, &mda, opt_ctxt->m_query);
+
+          plan_dxl = COptimizer::PdxlnOptimize(mp, &mda, query_to_expr_translator.Value(), expr_evaluator,
+                                               search_strategy_arr, optimizer_config);
+        } else {
+          CAutoP<CTranslatorQueryToDXL> query_to_dxl_translator;
+          query_to_dxl_translator = CTranslatorQueryToDXL::QueryToDXLInstance(mp, &mda, (Query *)opt_ctxt->m_query);
+
+          query_dxl = query_to_dxl_translator->TranslateQueryToDXL();
+          CDXLNodeArray *query_output_dxlnode_array = query_to_dxl_translator->GetQueryOutputCols();
+          CDXLNodeArray *cte_dxlnode_array = query_to_dxl_translator->GetCTEs();
+          GPOS_ASSERT(nullptr != query_output_dxlnode_array);
+
+          plan_dxl = COptimizer::PdxlnOptimize(mp, &mda, query_dxl, query_output_dxlnode_array, cte_dxlnode_array,
+                                               expr_evaluator, search_strategy_arr, optimizer_config);
+        }
+
+        if (flag) {
+          auto *plan = (PlanResult *)plan_dxl;
+          if (nullptr != plan->dxl_plan) {
+            // the plan generator fell back to DXL for this plan
+            plan_dxl = plan->dxl_plan;
+            flag = false;
+          } else {
+            auto *plan_stmt = makeNode(PlannedStmt);
+            plan_stmt->planTree = plan->plan;
+            plan_stmt->rtable = plan->rtable;
+            plan_stmt->relationOids = plan->relationOids;
+            plan_stmt->commandType = CMD_SELECT;
+            plan_stmt->parallelModeNeeded = plan->parallel_mode_needed;
+            plan_stmt->paramExecTypes = plan->param_exec_types;
+            plan_stmt->subplans = plan->subplans;
+
+            opt_ctxt->m_plan_stmt = plan_stmt;
+          }
+          delete plan;
+        }
+
+        if (!flag) {
+          // translate DXL->PlStmt only when needed
+          if (opt_ctxt->m_should_generate_plan_stmt) {
+            // always use opt_ctxt->m_query->can_set_tag as the query_to_dxl_translator->Pquery() is a mutated Query
+            // object that may not have the correct can_set_tag
+            opt_ctxt->m_plan_stmt = (PlannedStmt *)gpdb::CopyObject(ConvertToPlanStmtFromDXL(
+                mp, &mda, opt_ctxt->m_query, (CDXLNode *)plan_dxl, opt_ctxt->m_query->canSetTag));
+          }
+        }
+
+        // plans cut short by the planning time budget depend on timing and are
+        // not cached, the next execution gets another chance at a full search
+        if (optimizer_config->FBudgetExhausted()) {
+          cache_plan = false;
         }
+
+        expr_evaluator->Release();
+        CRefCount::SafeRelease(query_dxl);
+        optimizer_config->Release();
+        if (!flag)
+          ((CDXLNode *)plan_dxl)->Release();
       }
 
-      expr_evaluator->Release();
-      query_dxl->Release();
-      optimizer_config->Release();
-      if (!flag)
-        ((CDXLNode *)plan_dxl)->Release();
+      if (cache_plan && nullptr != query_str && nullptr != opt_ctxt->m_plan_stmt) {
+        CPlanCache::Store(query_str, config_hash, generation, opt_ctxt->m_plan_stmt, plan_cache_size);
+      }
     }
   }
   GPOS_CATCH_EX(ex) {
+    if (nullptr != query_str) {
+      gpdb::GPDBFree(query_str);
+    }
     ResetTraceflags(enabled_trace_flags, disabled_trace_flags);
     CRefCount::SafeRelease(enabled_trace_flags);
     CRefCount::SafeRelease(disabled_trace_flags);
     CRefCount::SafeRelease(trace_flags);
     if (!flag)
       CRefCount::SafeRelease(((CDXLNode *)plan_dxl));
-    CMDCache::Shutdown();
+
+    if (FMDCacheSurvivesError(ex)) {
+      CMDCache::RecordEvent(CMDCache::EmdceErrorKeep);
+    } else {
+      CMDCache::Shutdown();
+      CMDCache::RecordEvent(CMDCache::EmdceErrorReset);
+    }
 
     IErrorContext *errctxt = CTask::Self()->GetErrCtxt();
 
@@ -473,6 +763,9 @@ void *COptTasks::OptimizeTask(void *ptr) {
   GPOS_CATCH_END;
 
   // cleanup
+  if (nullptr != query_str) {
+    gpdb::GPDBFree(query_str);
+  }
   ResetTraceflags(enabled_trace_flags, disabled_trace_flags);
   CRefCount::SafeRelease(enabled_trace_flags);
   CRefCount::SafeRelease(disabled_trace_flags);
@@ -523,6 +816,50 @@ PlannedStmt *COptTasks::GPOPTOptimizedPlan(Query *query, SOptContext *gpopt_cont
   return gpopt_context->m_plan_stmt;
 }
 
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ValidateSearchStrategyTask
+//
+//	@doc:
+//		Parse the search strategy with the parser used at planning time
+//
+//---------------------------------------------------------------------------
+void *COptTasks::ValidateSearchStrategyTask(void *ptr) {
+  SOptContext *opt_ctxt = SOptContext::Cast(ptr);
+
+  CAutoMemoryPool amp(CAutoMemoryPool::ElcNone);
+  CMemoryPool *mp = amp.Pmp();
+
+  GPOS_TRY {
+    CSearchStage::PdrgpssParse(mp, GPOS_CONDIF(search_strategy))->Release();
+  }
+  GPOS_CATCH_EX(ex) {
+    IErrorContext *errctxt = CTask::Self()->GetErrCtxt();
+    opt_ctxt->m_error_msg = CreateMultiByteCharStringFromWCString(errctxt->GetErrorMsg());
+
+    GPOS_RETHROW(ex);
+  }
+  GPOS_CATCH_END;
+
+  return nullptr;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		COptTasks::ValidateSearchStrategy
+//
+//	@doc:
+//		Check the search strategy of the context's config, raises if it
+//		is invalid
+//
+//---------------------------------------------------------------------------
+void COptTasks::ValidateSearchStrategy(SOptContext *gpopt_context) {
+  Assert(gpopt_context);
+  Assert(gpopt_context->config->search_strategy);
+
+  Execute(&ValidateSearchStrategyTask, gpopt_context);
+}
+
 //---------------------------------------------------------------------------
 //	@function:
 //		COptTasks::SetXform
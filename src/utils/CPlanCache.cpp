@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CPlanCache.cpp
+//
+//	@doc:
+//		Implementation of the backend-local plan cache
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include <postgres.h>
+
+#include <common/hashfn.h>
+#include <lib/ilist.h>
+#include <nodes/plannodes.h>
+#include <utils/hsearch.h>
+#include <utils/memutils.h>
+}
+
+#include "gpopt/utils/CPlanCache.h"
+
+using namespace gpdxl;
+
+struct SPlanCacheEntry {
+  // hash of query string and settings, hash table key
+  uint64 m_key;
+
+  // serialized query and hash of the optimizer settings, to tell
+  // colliding keys apart
+  char *m_query_str;
+  uint64 m_config_hash;
+
+  // catalog invalidation generation the plan was produced at
+  uint64 m_generation;
+
+  // memory context holding the query string and the plan
+  MemoryContext m_cxt;
+  PlannedStmt *m_plan;
+
+  // position in the LRU list, most recently used first
+  dlist_node m_lru_node;
+};
+
+// parent of the entries' memory contexts
+static MemoryContext plan_cache_context = nullptr;
+
+static HTAB *plan_cache = nullptr;
+
+static dlist_head plan_cache_lru = DLIST_STATIC_INIT(plan_cache_lru);
+
+static uint64 PlanCacheKey(const char *query_str, uint64 config_hash) {
+  return hash_combine64(hash_bytes_extended((const unsigned char *)query_str, strlen(query_str), 0), config_hash);
+}
+
+static void RemoveEntry(SPlanCacheEntry *entry) {
+  dlist_delete(&entry->m_lru_node);
+  MemoryContextDelete(entry->m_cxt);
+  hash_search(plan_cache, &entry->m_key, HASH_REMOVE, nullptr);
+}
+
+static void InitPlanCache() {
+  plan_cache_context = AllocSetContextCreate(TopMemoryContext, "pg_orca plan cache", ALLOCSET_SMALL_SIZES);
+
+  HASHCTL ctl;
+  ctl.keysize = sizeof(uint64);
+  ctl.entrysize = sizeof(SPlanCacheEntry);
+  ctl.hcxt = plan_cache_context;
+  plan_cache = hash_create("pg_orca plan cache", 256, &ctl, HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Lookup
+//
+//	@doc:
+//		Look up the plan of the given query; stale plans are dropped on
+//		the way
+//
+//---------------------------------------------------------------------------
+PlannedStmt *CPlanCache::Lookup(const char *query_str, uint64_t config_hash, uint64_t generation) {
+  if (nullptr == plan_cache) {
+    return nullptr;
+  }
+
+  uint64 key = PlanCacheKey(query_str, config_hash);
+  SPlanCacheEntry *entry = (SPlanCacheEntry *)hash_search(plan_cache, &key, HASH_FIND, nullptr);
+  if (nullptr == entry) {
+    return nullptr;
+  }
+
+  if (entry->m_generation != generation) {
+    RemoveEntry(entry);
+    return nullptr;
+  }
+
+  if (entry->m_config_hash != config_hash || 0 != strcmp(entry->m_query_str, query_str)) {
+    return nullptr;
+  }
+
+  dlist_move_head(&plan_cache_lru, &entry->m_lru_node);
+
+  return (PlannedStmt *)copyObject(entry->m_plan);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Store
+//
+//	@doc:
+//		Remember the plan of the given query, replacing a plan stored under
+//		the same key and evicting the least recently used plans if needed
+//
+//---------------------------------------------------------------------------
+void CPlanCache::Store(const char *query_str, uint64_t config_hash, uint64_t generation, const PlannedStmt *plan,
+                       uint32_t max_entries) {
+  if (0 == max_entries) {
+    return;
+  }
+
+  if (nullptr == plan_cache) {
+    InitPlanCache();
+  }
+
+  uint64 key = PlanCacheKey(query_str, config_hash);
+  SPlanCacheEntry *entry = (SPlanCacheEntry *)hash_search(plan_cache, &key, HASH_FIND, nullptr);
+  if (nullptr != entry) {
+    RemoveEntry(entry);
+  }
+
+  while (!dlist_is_empty(&plan_cache_lru) && hash_get_num_entries(plan_cache) >= (long)max_entries) {
+    RemoveEntry(dlist_tail_element(SPlanCacheEntry, m_lru_node, &plan_cache_lru));
+  }
+
+  // copy the plan before creating the entry, copying may fail
+  MemoryContext cxt = AllocSetContextCreate(plan_cache_context, "pg_orca cached plan", ALLOCSET_SMALL_SIZES);
+  MemoryContext old_cxt = MemoryContextSwitchTo(cxt);
+  char *query_str_copy = pstrdup(query_str);
+  PlannedStmt *plan_copy = (PlannedStmt *)copyObject(plan);
+  MemoryContextSwitchTo(old_cxt);
+
+  entry = (SPlanCacheEntry *)hash_search(plan_cache, &key, HASH_ENTER, nullptr);
+  entry->m_query_str = query_str_copy;
+  entry->m_config_hash = config_hash;
+  entry->m_generation = generation;
+  entry->m_cxt = cxt;
+  entry->m_plan = plan_copy;
+  dlist_push_head(&plan_cache_lru, &entry->m_lru_node);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CPlanCache::Reset
+//
+//	@doc:
+//		Drop all plans
+//
+//---------------------------------------------------------------------------
+void CPlanCache::Reset() {
+  if (nullptr == plan_cache) {
+    return;
+  }
+
+  MemoryContextDelete(plan_cache_context);
+  plan_cache_context = nullptr;
+  plan_cache = nullptr;
+  dlist_init(&plan_cache_lru);
+}
+
+// number of cached plans
+uint32_t CPlanCache::Size() {
+  return nullptr == plan_cache ? 0 : (uint32_t)hash_get_num_entries(plan_cache);
+}
+
+// EOF
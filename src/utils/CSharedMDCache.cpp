@@ -0,0 +1,707 @@
+//---------------------------------------------------------------------------
+//	@filename:
+//		CSharedMDCache.cpp
+//
+//	@doc:
+//		Implementation of the shared memory tier of the metadata cache.
+//
+//		The fixed part of the shared state (lock, dsa/dshash handles and the
+//		invalidation generations) is reserved at postmaster start. The
+//		dsa area holding the entries is created lazily by the first backend
+//		that publishes an object, and attached by everybody else on demand.
+//
+//---------------------------------------------------------------------------
+
+extern "C" {
+#include <postgres.h>
+
+#include <common/hashfn.h>
+#include <lib/dshash.h>
+#include <lib/stringinfo.h>
+#include <miscadmin.h>
+#include <port/atomics.h>
+#include <storage/ipc.h>
+#include <storage/lwlock.h>
+#include <storage/shmem.h>
+#include <utils/dsa.h>
+#include <utils/memutils.h>
+#include <utils/syscache.h>
+}
+
+#include "gpopt/mdcache/CMDAccessor.h"
+#include "gpopt/utils/CSharedMDCache.h"
+#include "naucrates/dxl/operators/CDXLDatumBool.h"
+#include "naucrates/dxl/operators/CDXLDatumInt2.h"
+#include "naucrates/dxl/operators/CDXLDatumInt4.h"
+#include "naucrates/dxl/operators/CDXLDatumInt8.h"
+#include "naucrates/dxl/operators/CDXLDatumOid.h"
+#include "naucrates/dxl/operators/CDXLDatumStatsDoubleMappable.h"
+#include "naucrates/dxl/operators/CDXLDatumStatsLintMappable.h"
+#include "naucrates/md/CDXLColStats.h"
+#include "naucrates/md/CDXLRelStats.h"
+#include "naucrates/md/CMDIdColStats.h"
+#include "naucrates/md/CMDIdGPDB.h"
+#include "naucrates/md/CMDIdRelStats.h"
+
+using namespace gpdxl;
+using namespace gpmd;
+using namespace gpos;
+
+// number of invalidation generation slots per kind; relations and
+// pg_statistic hash values are folded onto these, collisions only cause
+// spurious misses
+#define SHARED_MDCACHE_INVAL_SLOTS 4096
+
+// lwlock tranche name, also used for the dsa area and the hash table
+#define SHARED_MDCACHE_TRANCHE_NAME "pg_orca_mdcache"
+
+// memory accounted per entry on top of its payload: the dshash item header,
+// its bucket slots and the rounding of dsa size classes
+#define SHARED_MDCACHE_ENTRY_OVERHEAD (sizeof(SSharedEntry) + 64)
+
+// kinds of objects kept in the shared tier
+enum ESharedEntryKind { EsekRelStats = 1, EsekColStats = 2 };
+
+// hash key, must not contain padding since it is compared with memcmp
+struct SSharedEntryKey {
+  Oid m_dbid;
+  Oid m_relid;
+  int32 m_kind;
+  uint32 m_pos;
+};
+
+struct SSharedEntry {
+  SSharedEntryKey m_key;
+
+  // invalidation generation at the time the object was fetched
+  uint64 m_generation;
+
+  // pg_statistic syscache hash values of the column (plain and inherited)
+  uint32 m_stats_hash;
+  uint32 m_stats_hash_inh;
+
+  // serialized object
+  dsa_pointer m_payload;
+  Size m_payload_size;
+};
+
+struct SSharedState {
+  // protects creation of the dsa area and the hash table
+  LWLock *m_lock;
+
+  int m_tranche_id;
+  dsa_handle m_area_handle;
+  dshash_table_handle m_table_handle;
+
+  // bytes entries may take up, half of the area; dshash raises an error
+  // when it cannot allocate an entry or grow its buckets, so the other half
+  // is kept free for that and for fragmentation
+  uint64 m_budget;
+
+  // bytes taken up by the entries
+  pg_atomic_uint64 m_used;
+
+  // generation counter, advanced by every invalidation
+  pg_atomic_uint64 m_generation;
+
+  // generation of the last full reset
+  pg_atomic_uint64 m_reset_generation;
+
+  // generation of the last invalidation per relation and per pg_statistic hash
+  pg_atomic_uint64 m_rel_generation[SHARED_MDCACHE_INVAL_SLOTS];
+  pg_atomic_uint64 m_stats_generation[SHARED_MDCACHE_INVAL_SLOTS];
+};
+
+static SSharedState *shared_state = nullptr;
+
+// backend-local attachment
+static dsa_area *shared_area = nullptr;
+static dshash_table *shared_table = nullptr;
+
+static const dshash_parameters shared_table_params = {
+    sizeof(SSharedEntryKey), sizeof(SSharedEntry), dshash_memcmp, dshash_memhash, dshash_memcpy,
+    0 /* tranche id, set on attach */};
+
+static uint32 RelSlot(Oid dbid, Oid relid) {
+  return hash_combine(murmurhash32(dbid), murmurhash32(relid)) % SHARED_MDCACHE_INVAL_SLOTS;
+}
+
+static uint32 StatsSlot(uint32 hashvalue) {
+  return hashvalue % SHARED_MDCACHE_INVAL_SLOTS;
+}
+
+// raise the generation stored in the given slot to at least the given value
+static void AdvanceGeneration(pg_atomic_uint64 *slot, uint64 generation) {
+  uint64 current = pg_atomic_read_u64(slot);
+  while (current < generation && !pg_atomic_compare_exchange_u64(slot, &current, generation)) {
+  }
+}
+
+// was the entry fetched after the last invalidation affecting it?
+static bool IsEntryValid(const SSharedEntry *entry) {
+  uint64 generation = entry->m_generation;
+
+  if (generation < pg_atomic_read_u64(&shared_state->m_reset_generation) ||
+      generation <
+          pg_atomic_read_u64(&shared_state->m_rel_generation[RelSlot(entry->m_key.m_dbid, entry->m_key.m_relid)])) {
+    return false;
+  }
+
+  if (EsekColStats == entry->m_key.m_kind &&
+      (generation < pg_atomic_read_u64(&shared_state->m_stats_generation[StatsSlot(entry->m_stats_hash)]) ||
+       generation < pg_atomic_read_u64(&shared_state->m_stats_generation[StatsSlot(entry->m_stats_hash_inh)]))) {
+    return false;
+  }
+
+  return true;
+}
+
+// attach to the dsa area and the hash table, creating them if needed
+static bool Attach(uint32_t size_limit_mb) {
+  if (nullptr != shared_table) {
+    return true;
+  }
+
+  if (nullptr == shared_state) {
+    return false;
+  }
+
+  MemoryContext old_cxt = MemoryContextSwitchTo(TopMemoryContext);
+
+  dshash_parameters params = shared_table_params;
+  params.tranche_id = shared_state->m_tranche_id;
+  LWLockRegisterTranche(shared_state->m_tranche_id, SHARED_MDCACHE_TRANCHE_NAME);
+
+  LWLockAcquire(shared_state->m_lock, LW_EXCLUSIVE);
+  if (DSA_HANDLE_INVALID == shared_state->m_area_handle) {
+    shared_area = dsa_create(shared_state->m_tranche_id);
+    dsa_pin(shared_area);
+    dsa_set_size_limit(shared_area, (size_t)size_limit_mb * 1024 * 1024);
+    shared_state->m_budget = (uint64)size_limit_mb * 1024 * 1024 / 2;
+    pg_atomic_write_u64(&shared_state->m_used, 0);
+    shared_table = dshash_create(shared_area, &params, nullptr);
+
+    shared_state->m_area_handle = dsa_get_handle(shared_area);
+    shared_state->m_table_handle = dshash_get_hash_table_handle(shared_table);
+  } else {
+    shared_area = dsa_attach(shared_state->m_area_handle);
+    shared_table = dshash_attach(shared_area, &params, shared_state->m_table_handle, nullptr);
+  }
+  LWLockRelease(shared_state->m_lock);
+
+  dsa_pin_mapping(shared_area);
+  MemoryContextSwitchTo(old_cxt);
+
+  return true;
+}
+
+// account the given number of bytes if they fit into the budget
+static bool ReserveBytes(uint64 size) {
+  uint64 used = pg_atomic_read_u64(&shared_state->m_used);
+  while (used + size <= shared_state->m_budget) {
+    if (pg_atomic_compare_exchange_u64(&shared_state->m_used, &used, used + size)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void ReleaseBytes(uint64 size) {
+  pg_atomic_sub_fetch_u64(&shared_state->m_used, size);
+}
+
+// free the payload of an entry that is about to be deleted
+static void FreeEntry(SSharedEntry *entry) {
+  dsa_free(shared_area, entry->m_payload);
+  ReleaseBytes(SHARED_MDCACHE_ENTRY_OVERHEAD + entry->m_payload_size);
+}
+
+// delete the entries that can no longer be returned, such as those of
+// dropped relations or fetched before a reset; with reset_all every entry
+// goes; returns the number of deleted entries
+static uint32 Sweep(bool reset_all) {
+  uint32 deleted = 0;
+  dshash_seq_status status;
+
+  dshash_seq_init(&status, shared_table, true /* exclusive */);
+  SSharedEntry *entry;
+  while (nullptr != (entry = (SSharedEntry *)dshash_seq_next(&status))) {
+    if (reset_all || !IsEntryValid(entry)) {
+      FreeEntry(entry);
+      dshash_delete_current(&status);
+      deleted++;
+    }
+  }
+  dshash_seq_term(&status);
+
+  return deleted;
+}
+
+static void FillKey(SSharedEntryKey *key, const IMDId *mdid) {
+  memset(key, 0, sizeof(SSharedEntryKey));
+  key->m_dbid = MyDatabaseId;
+
+  if (IMDId::EmdidColStats == mdid->MdidType()) {
+    const CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(mdid);
+    key->m_kind = EsekColStats;
+    key->m_relid = CMDIdGPDB::CastMdid(mdid_col_stats->GetRelMdId())->Oid();
+    key->m_pos = mdid_col_stats->Position();
+  } else {
+    GPOS_ASSERT(IMDId::EmdidRelStats == mdid->MdidType());
+    const CMDIdRelStats *mdid_rel_stats = CMDIdRelStats::CastMdid(mdid);
+    key->m_kind = EsekRelStats;
+    key->m_relid = CMDIdGPDB::CastMdid(mdid_rel_stats->GetRelMdId())->Oid();
+  }
+}
+
+//---------------------------------------------------------------------------
+// Serialization of statistics objects. The payload is a flat byte string
+// read back in the same order it was written; it never leaves the cluster
+// so no attempt is made to be portable.
+//---------------------------------------------------------------------------
+
+template <class T>
+static void Write(StringInfo buf, T value) {
+  appendBinaryStringInfo(buf, (const char *)&value, sizeof(T));
+}
+
+struct SPayloadReader {
+  const char *m_cur;
+  const char *m_end;
+
+  template <class T>
+  T Read() {
+    T value;
+    GPOS_RTL_ASSERT(m_cur + sizeof(T) <= m_end);
+    memcpy(&value, m_cur, sizeof(T));
+    m_cur += sizeof(T);
+    return value;
+  }
+
+  const char *ReadBytes(uint32 length) {
+    GPOS_RTL_ASSERT(m_cur + length <= m_end);
+    const char *bytes = m_cur;
+    m_cur += length;
+    return bytes;
+  }
+};
+
+static void WriteName(StringInfo buf, const CMDName &mdname) {
+  const CWStringConst *str = mdname.GetMDName();
+  uint32 length = str->Length();
+  Write<uint32>(buf, length);
+  appendBinaryStringInfo(buf, (const char *)str->GetBuffer(), length * sizeof(wchar_t));
+}
+
+static CMDName *ReadName(CMemoryPool *mp, SPayloadReader *reader) {
+  uint32 length = reader->Read<uint32>();
+  wchar_t *chars = GPOS_NEW_ARRAY(mp, wchar_t, length + 1);
+  memcpy(chars, reader->ReadBytes(length * sizeof(wchar_t)), length * sizeof(wchar_t));
+  chars[length] = L'\0';
+
+  CWStringConst str(chars);
+  CMDName *mdname = GPOS_NEW(mp) CMDName(mp, &str);
+  GPOS_DELETE_ARRAY(chars);
+
+  return mdname;
+}
+
+static void WriteDatum(StringInfo buf, const CDXLDatum *datum) {
+  CDXLDatum *dxl_datum = const_cast<CDXLDatum *>(datum);
+  CDXLDatum::EdxldatumType datum_type = dxl_datum->GetDatumType();
+
+  Write<int32>(buf, (int32)datum_type);
+  Write<Oid>(buf, CMDIdGPDB::CastMdid(dxl_datum->MDId())->Oid());
+  Write<bool>(buf, dxl_datum->IsNull());
+
+  switch (datum_type) {
+    case CDXLDatum::EdxldatumInt2:
+      Write<int16>(buf, CDXLDatumInt2::Cast(dxl_datum)->Value());
+      break;
+    case CDXLDatum::EdxldatumInt4:
+      Write<int32>(buf, CDXLDatumInt4::Cast(dxl_datum)->Value());
+      break;
+    case CDXLDatum::EdxldatumInt8:
+      Write<int64>(buf, CDXLDatumInt8::Cast(dxl_datum)->Value());
+      break;
+    case CDXLDatum::EdxldatumBool:
+      Write<bool>(buf, CDXLDatumBool::Cast(dxl_datum)->GetValue());
+      break;
+    case CDXLDatum::EdxldatumOid:
+      Write<Oid>(buf, CDXLDatumOid::Cast(dxl_datum)->OidValue());
+      break;
+    case CDXLDatum::EdxldatumGeneric:
+    case CDXLDatum::EdxldatumStatsDoubleMappable:
+    case CDXLDatum::EdxldatumStatsLintMappable: {
+      CDXLDatumGeneric *generic = CDXLDatumGeneric::Cast(dxl_datum);
+      Write<int32>(buf, generic->TypeModifier());
+      Write<uint32>(buf, generic->Length());
+      if (0 < generic->Length()) {
+        appendBinaryStringInfo(buf, (const char *)generic->GetByteArray(), generic->Length());
+      }
+      if (CDXLDatum::EdxldatumStatsDoubleMappable == datum_type) {
+        Write<double>(buf, generic->GetDoubleMapping().Get());
+      } else if (CDXLDatum::EdxldatumStatsLintMappable == datum_type) {
+        Write<int64>(buf, generic->GetLINTMapping());
+      }
+      break;
+    }
+    default:
+      GPOS_RTL_ASSERT(!"Unexpected datum type");
+  }
+}
+
+static CDXLDatum *ReadDatum(CMemoryPool *mp, SPayloadReader *reader) {
+  auto datum_type = (CDXLDatum::EdxldatumType)reader->Read<int32>();
+  IMDId *mdid_type = GPOS_NEW(mp) CMDIdGPDB(IMDId::EmdidGeneral, reader->Read<Oid>());
+  bool is_null = reader->Read<bool>();
+
+  switch (datum_type) {
+    case CDXLDatum::EdxldatumInt2:
+      return GPOS_NEW(mp) CDXLDatumInt2(mp, mdid_type, is_null, reader->Read<int16>());
+    case CDXLDatum::EdxldatumInt4:
+      return GPOS_NEW(mp) CDXLDatumInt4(mp, mdid_type, is_null, reader->Read<int32>());
+    case CDXLDatum::EdxldatumInt8:
+      return GPOS_NEW(mp) CDXLDatumInt8(mp, mdid_type, is_null, reader->Read<int64>());
+    case CDXLDatum::EdxldatumBool:
+      return GPOS_NEW(mp) CDXLDatumBool(mp, mdid_type, is_null, reader->Read<bool>());
+    case CDXLDatum::EdxldatumOid:
+      return GPOS_NEW(mp) CDXLDatumOid(mp, mdid_type, is_null, reader->Read<Oid>());
+    case CDXLDatum::EdxldatumGeneric:
+    case CDXLDatum::EdxldatumStatsDoubleMappable:
+    case CDXLDatum::EdxldatumStatsLintMappable: {
+      int32 type_modifier = reader->Read<int32>();
+      uint32 length = reader->Read<uint32>();
+      uint8_t *bytes = nullptr;
+      if (0 < length) {
+        bytes = GPOS_NEW_ARRAY(mp, uint8_t, length);
+        memcpy(bytes, reader->ReadBytes(length), length);
+      }
+      if (CDXLDatum::EdxldatumStatsDoubleMappable == datum_type) {
+        return GPOS_NEW(mp) CDXLDatumStatsDoubleMappable(mp, mdid_type, type_modifier, is_null, bytes, length,
+                                                         CDouble(reader->Read<double>()));
+      }
+      if (CDXLDatum::EdxldatumStatsLintMappable == datum_type) {
+        return GPOS_NEW(mp)
+            CDXLDatumStatsLintMappable(mp, mdid_type, type_modifier, is_null, bytes, length, reader->Read<int64>());
+      }
+      return GPOS_NEW(mp) CDXLDatumGeneric(mp, mdid_type, type_modifier, is_null, bytes, length);
+    }
+    default:
+      GPOS_RTL_ASSERT(!"Unexpected datum type");
+      return nullptr;
+  }
+}
+
+static void SerializeColStats(StringInfo buf, const CDXLColStats *col_stats) {
+  WriteName(buf, col_stats->Mdname());
+  Write<double>(buf, col_stats->Width().Get());
+  Write<double>(buf, col_stats->GetNullFreq().Get());
+  Write<double>(buf, col_stats->GetDistinctRemain().Get());
+  Write<double>(buf, col_stats->GetFreqRemain().Get());
+  Write<bool>(buf, col_stats->IsColStatsMissing());
+
+  const uint32 num_buckets = col_stats->Buckets();
+  Write<uint32>(buf, num_buckets);
+  for (uint32 ul = 0; ul < num_buckets; ul++) {
+    const CDXLBucket *bucket = col_stats->GetDXLBucketAt(ul);
+    WriteDatum(buf, bucket->GetDXLDatumLower());
+    WriteDatum(buf, bucket->GetDXLDatumUpper());
+    Write<bool>(buf, bucket->IsLowerClosed());
+    Write<bool>(buf, bucket->IsUpperClosed());
+    Write<double>(buf, bucket->GetFrequency().Get());
+    Write<double>(buf, bucket->GetNumDistinct().Get());
+  }
+}
+
+static IMDCacheObject *DeserializeColStats(CMemoryPool *mp, IMDId *mdid, SPayloadReader *reader) {
+  CMDName *mdname = ReadName(mp, reader);
+  CDouble width(reader->Read<double>());
+  CDouble null_freq(reader->Read<double>());
+  CDouble distinct_remaining(reader->Read<double>());
+  CDouble freq_remaining(reader->Read<double>());
+  bool is_col_stats_missing = reader->Read<bool>();
+
+  const uint32 num_buckets = reader->Read<uint32>();
+  CDXLBucketArray *buckets = GPOS_NEW(mp) CDXLBucketArray(mp);
+  for (uint32 ul = 0; ul < num_buckets; ul++) {
+    CDXLDatum *lower = ReadDatum(mp, reader);
+    CDXLDatum *upper = ReadDatum(mp, reader);
+    bool is_lower_closed = reader->Read<bool>();
+    bool is_upper_closed = reader->Read<bool>();
+    CDouble frequency(reader->Read<double>());
+    CDouble distinct(reader->Read<double>());
+    buckets->Append(GPOS_NEW(mp) CDXLBucket(lower, upper, is_lower_closed, is_upper_closed, frequency, distinct));
+  }
+
+  mdid->AddRef();
+  return GPOS_NEW(mp) CDXLColStats(mp, CMDIdColStats::CastMdid(mdid), mdname, width, null_freq, distinct_remaining,
+                                   freq_remaining, buckets, is_col_stats_missing);
+}
+
+static void SerializeRelStats(StringInfo buf, const CDXLRelStats *rel_stats) {
+  WriteName(buf, rel_stats->Mdname());
+  Write<double>(buf, rel_stats->Rows().Get());
+  Write<bool>(buf, rel_stats->IsEmpty());
+  Write<uint32>(buf, rel_stats->RelPages());
+  Write<uint32>(buf, rel_stats->RelAllVisible());
+}
+
+static IMDCacheObject *DeserializeRelStats(CMemoryPool *mp, IMDId *mdid, SPayloadReader *reader) {
+  CMDName *mdname = ReadName(mp, reader);
+  CDouble rows(reader->Read<double>());
+  bool is_empty = reader->Read<bool>();
+  uint32 relpages = reader->Read<uint32>();
+  uint32 relallvisible = reader->Read<uint32>();
+
+  mdid->AddRef();
+  return GPOS_NEW(mp)
+      CDXLRelStats(mp, CMDIdRelStats::CastMdid(mdid), mdname, rows, is_empty, relpages, relallvisible);
+}
+
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSharedMDCache::RequestShmem
+//
+//	@doc:
+//		Reserve the fixed part of the shared state
+//
+//---------------------------------------------------------------------------
+void CSharedMDCache::RequestShmem() {
+  RequestAddinShmemSpace(MAXALIGN(sizeof(SSharedState)));
+  RequestNamedLWLockTranche(SHARED_MDCACHE_TRANCHE_NAME, 1);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSharedMDCache::ShmemStartup
+//
+//	@doc:
+//		Attach to, or initialize, the fixed part of the shared state
+//
+//---------------------------------------------------------------------------
+void CSharedMDCache::ShmemStartup() {
+  bool found = false;
+
+  LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+  shared_state = (SSharedState *)ShmemInitStruct(SHARED_MDCACHE_TRANCHE_NAME, sizeof(SSharedState), &found);
+  if (!found) {
+    shared_state->m_lock = &(GetNamedLWLockTranche(SHARED_MDCACHE_TRANCHE_NAME))->lock;
+    shared_state->m_tranche_id = LWLockNewTrancheId();
+    shared_state->m_area_handle = DSA_HANDLE_INVALID;
+    shared_state->m_table_handle = DSHASH_HANDLE_INVALID;
+    shared_state->m_budget = 0;
+    pg_atomic_init_u64(&shared_state->m_used, 0);
+    pg_atomic_init_u64(&shared_state->m_generation, 0);
+    pg_atomic_init_u64(&shared_state->m_reset_generation, 0);
+    for (uint32 ul = 0; ul < SHARED_MDCACHE_INVAL_SLOTS; ul++) {
+      pg_atomic_init_u64(&shared_state->m_rel_generation[ul], 0);
+      pg_atomic_init_u64(&shared_state->m_stats_generation[ul], 0);
+    }
+  }
+  LWLockRelease(AddinShmemInitLock);
+}
+
+bool CSharedMDCache::IsAvailable() {
+  return nullptr != shared_state;
+}
+
+bool CSharedMDCache::IsCacheable(const IMDId *mdid) {
+  return IMDId::EmdidColStats == mdid->MdidType() || IMDId::EmdidRelStats == mdid->MdidType();
+}
+
+uint64_t CSharedMDCache::CurrentGeneration() {
+  GPOS_ASSERT(IsAvailable());
+
+  return pg_atomic_read_membarrier_u64(&shared_state->m_generation);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSharedMDCache::Lookup
+//
+//	@doc:
+//		Deserialize a shared copy of the object into the given memory pool.
+//		Stale entries found on the way are removed.
+//
+//---------------------------------------------------------------------------
+IMDCacheObject *CSharedMDCache::Lookup(CMemoryPool *mp, CMDAccessor *, IMDId *mdid) {
+  GPOS_ASSERT(IsCacheable(mdid));
+
+  // nothing was ever published if the area does not exist yet
+  if (nullptr == shared_table && (!IsAvailable() || DSA_HANDLE_INVALID == shared_state->m_area_handle)) {
+    return nullptr;
+  }
+
+  if (!Attach(0)) {
+    return nullptr;
+  }
+
+  SSharedEntryKey key;
+  FillKey(&key, mdid);
+
+  // copy the payload out while holding the partition lock, deserialize later
+  StringInfoData payload;
+  initStringInfo(&payload);
+  bool valid = false;
+
+  auto *entry = (SSharedEntry *)dshash_find(shared_table, &key, true /* exclusive */);
+  if (nullptr == entry) {
+    pfree(payload.data);
+    return nullptr;
+  }
+
+  if (IsEntryValid(entry)) {
+    appendBinaryStringInfo(&payload, (const char *)dsa_get_address(shared_area, entry->m_payload),
+                           entry->m_payload_size);
+    valid = true;
+    dshash_release_lock(shared_table, entry);
+  } else {
+    FreeEntry(entry);
+    dshash_delete_entry(shared_table, entry);
+  }
+
+  IMDCacheObject *md_obj = nullptr;
+  if (valid) {
+    SPayloadReader reader{payload.data, payload.data + payload.len};
+    if (IMDId::EmdidColStats == mdid->MdidType()) {
+      md_obj = DeserializeColStats(mp, mdid, &reader);
+    } else {
+      md_obj = DeserializeRelStats(mp, mdid, &reader);
+    }
+  }
+  pfree(payload.data);
+
+  return md_obj;
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSharedMDCache::Store
+//
+//	@doc:
+//		Publish an object. When the area is full, stale entries are swept
+//		out first and the whole table is reset if that frees nothing. It
+//		silently gives up if the object still does not fit; the object will
+//		simply be fetched from the catalog again next time.
+//
+//---------------------------------------------------------------------------
+void CSharedMDCache::Store(CMDAccessor *md_accessor, const IMDCacheObject *md_obj, uint64_t generation,
+                           uint32_t size_limit_mb) {
+  IMDId *mdid = md_obj->MDId();
+  GPOS_ASSERT(IsCacheable(mdid));
+
+  if (!Attach(size_limit_mb)) {
+    return;
+  }
+
+  SSharedEntryKey key;
+  FillKey(&key, mdid);
+
+  uint32 stats_hash = 0;
+  uint32 stats_hash_inh = 0;
+  StringInfoData payload;
+  initStringInfo(&payload);
+
+  if (EsekColStats == key.m_kind) {
+    const CMDIdColStats *mdid_col_stats = CMDIdColStats::CastMdid(mdid);
+    const IMDRelation *md_rel = md_accessor->RetrieveRel(mdid_col_stats->GetRelMdId());
+    int16 attno = (int16)md_rel->GetMdCol(mdid_col_stats->Position())->AttrNum();
+    stats_hash = GetSysCacheHashValue3(STATRELATTINH, ObjectIdGetDatum(key.m_relid), Int16GetDatum(attno),
+                                       BoolGetDatum(false));
+    stats_hash_inh = GetSysCacheHashValue3(STATRELATTINH, ObjectIdGetDatum(key.m_relid), Int16GetDatum(attno),
+                                           BoolGetDatum(true));
+    SerializeColStats(&payload, dynamic_cast<const CDXLColStats *>(md_obj));
+  } else {
+    SerializeRelStats(&payload, dynamic_cast<const CDXLRelStats *>(md_obj));
+  }
+
+  // the entry is only inserted once its memory is accounted for, so that
+  // dshash never runs the area out of memory
+  uint64 size = SHARED_MDCACHE_ENTRY_OVERHEAD + payload.len;
+  if (!ReserveBytes(size) && (0 == Sweep(false /* reset_all */) || !ReserveBytes(size))) {
+    Sweep(true /* reset_all */);
+    if (!ReserveBytes(size)) {
+      pfree(payload.data);
+      return;
+    }
+  }
+
+  dsa_pointer dp = dsa_allocate_extended(shared_area, payload.len, DSA_ALLOC_NO_OOM);
+  if (!DsaPointerIsValid(dp)) {
+    ReleaseBytes(size);
+    pfree(payload.data);
+    return;
+  }
+  memcpy(dsa_get_address(shared_area, dp), payload.data, payload.len);
+  pfree(payload.data);
+
+  bool found = false;
+  auto *entry = (SSharedEntry *)dshash_find_or_insert(shared_table, &key, &found);
+  if (found) {
+    // keep whichever copy was fetched more recently
+    if (entry->m_generation >= generation) {
+      dshash_release_lock(shared_table, entry);
+      dsa_free(shared_area, dp);
+      ReleaseBytes(size);
+      return;
+    }
+    FreeEntry(entry);
+  }
+
+  entry->m_generation = generation;
+  entry->m_stats_hash = stats_hash;
+  entry->m_stats_hash_inh = stats_hash_inh;
+  entry->m_payload = dp;
+  entry->m_payload_size = payload.len;
+  dshash_release_lock(shared_table, entry);
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSharedMDCache::InvalidateRelation
+//
+//	@doc:
+//		Relcache invalidation of the given relation, InvalidOid means all
+//		relations. Only touches fixed shared memory and is therefore safe
+//		to call from an invalidation callback.
+//
+//---------------------------------------------------------------------------
+void CSharedMDCache::InvalidateRelation(uint32_t relid) {
+  if (!IsAvailable()) {
+    return;
+  }
+
+  uint64 generation = pg_atomic_add_fetch_u64(&shared_state->m_generation, 1);
+  if (InvalidOid == relid) {
+    AdvanceGeneration(&shared_state->m_reset_generation, generation);
+  } else {
+    AdvanceGeneration(&shared_state->m_rel_generation[RelSlot(MyDatabaseId, relid)], generation);
+  }
+}
+
+//---------------------------------------------------------------------------
+//	@function:
+//		CSharedMDCache::InvalidateStatistics
+//
+//	@doc:
+//		pg_statistic syscache invalidation, hash value 0 means the whole
+//		cache
+//
+//---------------------------------------------------------------------------
+void CSharedMDCache::InvalidateStatistics(uint32_t hashvalue) {
+  if (!IsAvailable()) {
+    return;
+  }
+
+  uint64 generation = pg_atomic_add_fetch_u64(&shared_state->m_generation, 1);
+  if (0 == hashvalue) {
+    AdvanceGeneration(&shared_state->m_reset_generation, generation);
+  } else {
+    AdvanceGeneration(&shared_state->m_stats_generation[StatsSlot(hashvalue)], generation);
+  }
+}
+
+// EOF
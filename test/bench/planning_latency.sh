@@ -0,0 +1,99 @@
+#!/usr/bin/env bash
+#
+# Measure orca planning latency on the TPC-H and TPC-DS queries, and on a few
+# single queries that stress one part of the optimizer.
+#
+# Run it once against a server with the Debug build of pg_orca installed and
+# once against the Release build, then compare the two outputs:
+#
+#   test/bench/planning_latency.sh 20 > debug.txt
+#   test/bench/planning_latency.sh 20 > release.txt
+#   join debug.txt release.txt
+#
+# Connection parameters are taken from the usual PG* environment variables.
+# The databases created by the tpch and tpcds regression tests are reused
+# when present.
+
+set -euo pipefail
+
+RUNS=${1:-10}
+
+# print the median of the planning times of all but the first explain
+median() {
+  gawk -v name="$1" '
+    /Planning Time/ { if (seen++) t[n++] = $3 }
+    END {
+      if (n == 0) exit
+      asort(t)
+      printf "%s %.3f\n", name, (n % 2) ? t[(n + 1) / 2] : (t[n / 2] + t[n / 2 + 1]) / 2
+    }'
+}
+
+# explain :q once to warm up the metadata cache, then RUNS times
+explain_runs() {
+  echo "explain (costs off, summary) :q;"
+  for _ in $(seq 1 "$RUNS"); do echo "explain (costs off, summary) :q;"; done
+}
+
+create_db() {
+  local db=$1
+
+  psql -X -q -v ON_ERROR_STOP=1 -d postgres -c "create database $db" 2>/dev/null || true
+  psql -X -q -v ON_ERROR_STOP=1 -d "$db" -c "create extension if not exists pg_$db"
+}
+
+measure() {
+  local db=$1 func=$2 count=$3
+
+  create_db "$db"
+
+  for q in $(seq 1 "$count"); do
+    psql -X -q -A -t -v ON_ERROR_STOP=1 -d "$db" <<SQL | median "$db.q$q"
+set pg_orca.enable_orca to off;
+select query as q from ${func}($q) \gset
+set pg_orca.enable_orca to on;
+$(explain_runs)
+SQL
+  done
+}
+
+# measure a single query of the tpch database, after the given settings
+measure_query() {
+  local name=$1 query=$2 settings=${3:-}
+
+  psql -X -q -A -t -v ON_ERROR_STOP=1 -d tpch <<SQL | median "$name"
+set pg_orca.enable_orca to on;
+$settings
+\set q '$query'
+$(explain_runs)
+SQL
+}
+
+# a comma separated list of the integers 1..n, with NULL appended if asked
+int_list() {
+  local n=$1 null=${2:-}
+
+  seq -s, 1 "$n" | tr -d '\n'
+  [ -n "$null" ] && echo -n ",null"
+  echo
+}
+
+measure tpch tpch_queries 22
+measure tpcds tpcds_queries 99
+
+# long IN and NOT IN lists are estimated in one pass over the histogram
+for n in 1000 10000; do
+  measure_query "in.$n" "select count(*) from lineitem where l_orderkey in ($(int_list "$n"))"
+  measure_query "not_in.$n" "select count(*) from lineitem where l_orderkey not in ($(int_list "$n"))"
+  measure_query "not_in_null.$n" "select count(*) from lineitem where l_orderkey not in ($(int_list "$n" null))"
+done
+
+# memo overhead: a single table query whose memo has a handful of groups, and
+# the exhaustive join order search of all eight tables, which fills it with
+# thousands of group expressions
+measure_query "memo.small" "select n_name from nation where n_nationkey = 1"
+memo_join="select count(*) from region, nation, supplier, customer, orders, lineitem, part, partsupp"
+memo_join+=" where r_regionkey = n_regionkey and n_nationkey = s_nationkey and s_nationkey = c_nationkey"
+memo_join+=" and c_custkey = o_custkey and o_orderkey = l_orderkey and l_partkey = p_partkey"
+memo_join+=" and ps_partkey = p_partkey and ps_suppkey = s_suppkey"
+measure_query "memo.large" "$memo_join" "set pg_orca.join_order to exhaustive;"
@@ -0,0 +1,17 @@
+set pg_orca.enable_orca to off;
+
+create table agg_t (a int, b int);
+insert into agg_t select i, i % 10 from generate_series(1, 10000) i;
+analyze agg_t;
+
+set pg_orca.enable_orca to on;
+
+-- states of a known size may be hashed
+explain (costs off) select b, count(*), sum(a), avg(a) from agg_t group by b;
+-- internal states of unknown size and ordered aggregates are not
+explain (costs off) select b, array_agg(a) from agg_t group by b;
+explain (costs off) select b, string_agg(a::text, ',') from agg_t group by b;
+explain (costs off) select b, percentile_cont(0.5) within group (order by a) from agg_t group by b;
+
+set pg_orca.enable_orca to off;
+drop table agg_t;
@@ -0,0 +1,31 @@
+set pg_orca.enable_orca to off;
+
+create table card_t (a int, b int);
+insert into card_t select i % 100, i % 10 from generate_series(1, 10000) i;
+analyze card_t;
+
+-- EXPLAIN output with the costs masked, the row estimates are what is checked
+create function explain_rows(query text) returns setof text language plpgsql as $$
+declare
+  line text;
+begin
+  for line in execute 'explain ' || query loop
+    return next regexp_replace(line, 'cost=\S+ ', '');
+  end loop;
+end $$;
+
+set pg_orca.enable_orca to on;
+
+-- IN and NOT IN lists
+select explain_rows('select * from card_t where a in (1, 2, 3)');
+select explain_rows('select * from card_t where a in (1, 2, 3, null)');
+select explain_rows('select * from card_t where a not in (1, 2, 3)');
+-- a NOT IN list with a NULL never qualifies a row
+select explain_rows('select * from card_t where a not in (1, 2, 3, null)');
+-- long lists take the single pass over the histogram
+select explain_rows('select * from card_t where a not in (' || (select string_agg(i::text, ',') from generate_series(0, 49) i) || ')');
+select explain_rows('select * from card_t where a not in (' || (select string_agg(i::text, ',') from generate_series(0, 49) i) || ', null)');
+
+set pg_orca.enable_orca to off;
+drop function explain_rows(text);
+drop table card_t;
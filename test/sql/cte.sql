@@ -0,0 +1,20 @@
+set pg_orca.enable_orca to off;
+
+create table cte_t (a int, b int);
+insert into cte_t select i, i % 10 from generate_series(1, 1000) i;
+analyze cte_t;
+
+set pg_orca.enable_orca to on;
+set pg_orca.enable_new_planner to on;
+
+-- a CTE read twice is produced once into a tuplestore
+explain (costs off) with c as (select b, count(*) n from cte_t group by b) select * from c c1 join c c2 on c1.b = c2.b;
+with c as (select b, count(*) n from cte_t group by b) select count(*) = 10 and sum(c1.n * c2.n) = 100000 as cte_rows from c c1 join c c2 on c1.b = c2.b;
+with c as (select a, b from cte_t where a <= 100) select count(*) = 100 as cte_filter from c c1 join c c2 on c1.a = c2.a where c2.b < 10;
+
+-- the DXL translation falls back to the Postgres planner for CTEs
+set pg_orca.enable_new_planner to off;
+with c as (select b, count(*) n from cte_t group by b) select count(*) = 10 and sum(c1.n * c2.n) = 100000 as cte_rows_fallback from c c1 join c c2 on c1.b = c2.b;
+
+set pg_orca.enable_orca to off;
+drop table cte_t;
@@ -0,0 +1,29 @@
+set pg_orca.enable_orca to off;
+
+create table dt_a (id int, v int);
+create table dt_b (a_id int, w int);
+insert into dt_a select i, i % 100 from generate_series(1, 1000) i;
+insert into dt_b select i % 1000 + 1, i from generate_series(1, 10000) i;
+analyze dt_a;
+analyze dt_b;
+
+set pg_orca.enable_orca to on;
+
+-- the direct translator and the DXL translator hand the optimizer the same
+-- input, so both settings give the same plans and rows
+set pg_orca.enable_direct_translation to on;
+explain (costs off) select a.id, b.w from dt_a a join dt_b b on b.a_id = a.id where a.v < 10 order by b.w limit 5;
+explain (costs off) select a.id, b.w from dt_a a left join dt_b b on b.a_id = a.id order by a.id, b.w limit 5;
+select a.id, b.w from dt_a a join dt_b b on b.a_id = a.id where a.v < 10 order by b.w limit 5;
+select a.id, b.w from dt_a a left join dt_b b on b.a_id = a.id order by a.id, b.w limit 5;
+
+set pg_orca.enable_direct_translation to off;
+explain (costs off) select a.id, b.w from dt_a a join dt_b b on b.a_id = a.id where a.v < 10 order by b.w limit 5;
+explain (costs off) select a.id, b.w from dt_a a left join dt_b b on b.a_id = a.id order by a.id, b.w limit 5;
+select a.id, b.w from dt_a a join dt_b b on b.a_id = a.id where a.v < 10 order by b.w limit 5;
+select a.id, b.w from dt_a a left join dt_b b on b.a_id = a.id order by a.id, b.w limit 5;
+reset pg_orca.enable_direct_translation;
+
+set pg_orca.enable_orca to off;
+drop table dt_a;
+drop table dt_b;
@@ -0,0 +1,34 @@
+set pg_orca.enable_orca to off;
+
+-- a and b are fully correlated, every (a, b) combination has 100 rows
+create table ext_t (a int, b int);
+insert into ext_t select i % 100, i % 100 from generate_series(1, 10000) i;
+analyze ext_t;
+
+-- EXPLAIN output with the costs masked, the row estimates are what is checked
+create function explain_rows(query text) returns setof text language plpgsql as $$
+declare
+  line text;
+begin
+  for line in execute 'explain ' || query loop
+    return next regexp_replace(line, 'cost=\S+ ', '');
+  end loop;
+end $$;
+
+set pg_orca.enable_orca to on;
+
+-- without extended statistics the columns are taken as independent
+select explain_rows('select * from ext_t where a = 1 and b = 1');
+
+set pg_orca.enable_orca to off;
+create statistics ext_t_mcv (mcv) on a, b from ext_t;
+analyze ext_t;
+set pg_orca.enable_orca to on;
+
+-- the multi-column MCV list has the frequency of the combination
+select explain_rows('select * from ext_t where a = 1 and b = 1');
+select explain_rows('select * from ext_t where a = 1 and b = 2');
+
+set pg_orca.enable_orca to off;
+drop function explain_rows(text);
+drop table ext_t;
@@ -0,0 +1,32 @@
+set pg_orca.enable_orca to off;
+
+create table isort_t (a int, b int, c int);
+insert into isort_t select i / 100, i % 100, (i * 37) % 1000 from generate_series(1, 100000) i;
+create index on isort_t (a);
+create index on isort_t (a, b);
+analyze isort_t;
+
+set pg_orca.enable_orca to on;
+set pg_orca.enable_new_planner to on;
+
+-- an index on a delivers the first sort column, only c is sorted
+explain (costs off) select a, b from isort_t where a < 10 order by a, c limit 20;
+
+-- an index on a, b delivers the first two sort columns
+explain (costs off) select * from isort_t where a < 10 order by a, b, c limit 20;
+
+-- the rows come out in the same order as with a full sort
+select array_agg(c) = '{34,35,36,37,71,72,73,74,108,109,110,111,145,146,147,148,182,183,184,185}' as one_presorted_rows
+from (select c from isort_t where a < 10 order by a, c limit 20) s;
+
+-- the DXL translators would turn it into a full sort, so it is not costed
+set pg_orca.enable_new_planner to off;
+explain (costs off) select a, b from isort_t where a < 10 order by a, c limit 20;
+set pg_orca.enable_new_planner to on;
+
+set enable_incremental_sort to off;
+explain (costs off) select a, b from isort_t where a < 10 order by a, c limit 20;
+reset enable_incremental_sort;
+
+set pg_orca.enable_orca to off;
+drop table isort_t;
@@ -0,0 +1,73 @@
+set pg_orca.enable_orca to off;
+
+-- a star: fact table f with 16 dimensions d1 .. d16, and a chain c1 .. c20
+do $$
+begin
+  create table f (id int, k1 int, k2 int, k3 int, k4 int, k5 int, k6 int, k7 int, k8 int,
+                  k9 int, k10 int, k11 int, k12 int, k13 int, k14 int, k15 int, k16 int);
+  insert into f select i, i % 100, i % 100, i % 100, i % 100, i % 100, i % 100, i % 100, i % 100,
+                       i % 100, i % 100, i % 100, i % 100, i % 100, i % 100, i % 100, i % 100
+    from generate_series(1, 10000) i;
+  for i in 1 .. 16 loop
+    execute format('create table d%s (k int, v int)', i);
+    execute format('insert into d%s select i, i from generate_series(0, 99) i', i);
+    execute format('analyze d%s', i);
+  end loop;
+  for i in 1 .. 20 loop
+    execute format('create table c%s (a int, b int)', i);
+    execute format('insert into c%s select i, i from generate_series(1, 1000) i', i);
+    execute format('analyze c%s', i);
+  end loop;
+  analyze f;
+end $$;
+
+create function star_query(outer_join bool) returns text language sql as $$
+  select 'select count(*) from '
+      || string_agg(format('d%s', i), ', ' order by i) || ', f'
+      || ' where ' || string_agg(format('f.k%s = d%s.k', i, i), ' and ' order by i)
+    from generate_series(1, 16) i
+   where not outer_join
+  union all
+  select 'select count(*) from f '
+      || string_agg(format('left join d%s on f.k%s = d%s.k', i, i, i), ' ' order by i)
+    from generate_series(1, 16) i
+   where outer_join
+$$;
+
+create function chain_query() returns text language sql as $$
+  select 'select count(*) from '
+      || string_agg(format('c%s', i), ', ' order by i desc)
+      || ' where ' || string_agg(format('c%s.b = c%s.a', i, i + 1), ' and ' order by i)
+    from generate_series(1, 19) i
+$$;
+
+select star_query(false) as star_query \gset
+select star_query(true) as star_outer_join_query \gset
+select chain_query() as chain_query \gset
+
+set pg_orca.enable_orca to on;
+set pg_orca.join_order to dphyp;
+
+-- a 17 table star has more connected subgraphs than the DP table holds:
+-- the joins are ordered greedily instead of in the order of the query,
+-- which starts with cross products of the dimensions
+explain (costs off) :star_query;
+explain (costs off) :star_outer_join_query;
+
+-- a 20 table chain has few connected subgraphs and is enumerated
+explain (costs off) :chain_query;
+
+reset pg_orca.join_order;
+set pg_orca.enable_orca to off;
+drop function chain_query();
+drop function star_query(bool);
+do $$
+begin
+  for i in 1 .. 16 loop
+    execute format('drop table d%s', i);
+  end loop;
+  for i in 1 .. 20 loop
+    execute format('drop table c%s', i);
+  end loop;
+end $$;
+drop table f;
@@ -0,0 +1,35 @@
+set pg_orca.enable_orca to off;
+
+create table mz_outer (id int, k int);
+create table mz_inner (a int, b int);
+insert into mz_outer select i, i % 5 + 1 from generate_series(1, 1000) i;
+insert into mz_inner select i, i % 100 from generate_series(1, 100000) i;
+create index on mz_outer (id);
+create index on mz_inner (a);
+analyze mz_outer;
+analyze mz_inner;
+
+set pg_orca.enable_orca to on;
+set pg_orca.enable_new_planner to on;
+
+-- 200 outer rows probe the index of the inner side with 5 distinct keys, the
+-- inner side is cached on the param set from o.k
+explain (costs off) select o.id, i.b from mz_outer o join mz_inner i on i.a = o.k where o.id <= 200;
+explain (costs off) select o.id, i.b from mz_outer o left join mz_inner i on i.a = o.k where o.id <= 200;
+select count(*) = 200 and sum(i.b) = 600 as memoize_rows from mz_outer o join mz_inner i on i.a = o.k where o.id <= 200;
+select count(*) = 200 and count(i.b) = 200 as memoize_left_rows from mz_outer o left join mz_inner i on i.a = o.k where o.id <= 200;
+
+-- the DXL translators cannot express the cache, so the join is not costed
+-- with it
+set pg_orca.enable_new_planner to off;
+explain (costs off) select o.id, i.b from mz_outer o join mz_inner i on i.a = o.k where o.id <= 200;
+set pg_orca.enable_new_planner to on;
+
+set enable_memoize to off;
+explain (costs off) select o.id, i.b from mz_outer o join mz_inner i on i.a = o.k where o.id <= 200;
+select count(*) = 200 and sum(i.b) = 600 as disabled_rows from mz_outer o join mz_inner i on i.a = o.k where o.id <= 200;
+reset enable_memoize;
+
+set pg_orca.enable_orca to off;
+drop table mz_outer;
+drop table mz_inner;
@@ -0,0 +1,39 @@
+set pg_orca.enable_orca to off;
+
+create table mj_l (a int, b int);
+create table mj_r (a int, c int);
+insert into mj_l select i, i % 7 from generate_series(1, 100000) i;
+insert into mj_r select i * 2, i from generate_series(1, 50000) i;
+create index on mj_l (a);
+create index on mj_r (a);
+analyze mj_l;
+analyze mj_r;
+
+set pg_orca.enable_orca to on;
+set pg_orca.enable_new_planner to on;
+
+-- merge joins other than full ones are off by default
+explain (costs off) select * from mj_l join mj_r using (a) order by a;
+
+set pg_orca.enable_mergejoin to on;
+
+-- both sides come sorted from their index, and the join keeps the order
+explain (costs off) select * from mj_l join mj_r using (a) order by a;
+
+select count(*) = 50000 and sum(b) = 150003 as inner_rows from mj_l join mj_r using (a);
+select count(*) = 100000 and count(c) = 50000 as left_rows from mj_l left join mj_r using (a);
+select count(*) = 50000 as semi_rows from mj_l where exists (select 1 from mj_r where mj_r.a = mj_l.a);
+select count(*) = 50000 as anti_rows from mj_l where not exists (select 1 from mj_r where mj_r.a = mj_l.a);
+select array_agg(a) = '{2,4,6}' as ordered from (select a from mj_l join mj_r using (a) order by a limit 3) s;
+
+-- the DXL translation of the same plans
+set pg_orca.enable_new_planner to off;
+select count(*) = 50000 and sum(b) = 150003 as inner_rows_dxl from mj_l join mj_r using (a);
+select count(*) = 100000 and count(c) = 50000 as left_rows_dxl from mj_l left join mj_r using (a);
+select count(*) = 50000 as semi_rows_dxl from mj_l where exists (select 1 from mj_r where mj_r.a = mj_l.a);
+select count(*) = 50000 as anti_rows_dxl from mj_l where not exists (select 1 from mj_r where mj_r.a = mj_l.a);
+
+reset pg_orca.enable_mergejoin;
+set pg_orca.enable_orca to off;
+drop table mj_l;
+drop table mj_r;